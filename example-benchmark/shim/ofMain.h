@@ -0,0 +1,114 @@
+/*
+
+ofMain.h for building example-benchmark without openFrameworks
+
+The parts of openFrameworks the addon uses: the standard headers and
+namespace ofMain.h brings in, PI, the TARGET_ platform macros, ofLog*,
+ofToString(), ofToDataPath() and the ofGet* date of the machine's clock.
+ofToDataPath() returns the path unchanged, relative to the working
+directory rather than to bin/data.
+
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+#ifndef PI
+#define PI 3.14159265358979323846
+#endif
+
+#if defined(_WIN32)
+#define TARGET_WIN32
+#elif defined(__APPLE__)
+#define TARGET_OSX
+#elif defined(__linux__)
+#define TARGET_LINUX
+#endif
+
+/* ofLogError("module") << ... prints one line to stderr when the statement ends */
+
+class ofLog{
+public:
+	ofLog( const char *level, const string &module ) : level( level ), module( module ){}
+	ofLog( const ofLog & ) = delete;
+	ofLog & operator=( const ofLog & ) = delete;
+	~ofLog(){
+		cerr << "[" << level << "] " << module << ": " << message.str() << endl;
+	}
+	template<typename T> ofLog & operator<<( const T &value ){
+		message << value;
+		return *this;
+	}
+private:
+	const char *level;
+	string module;
+	ostringstream message;
+};
+
+class ofLogError : public ofLog{
+public:
+	ofLogError( const string &module ) : ofLog( "error", module ){}
+};
+
+class ofLogWarning : public ofLog{
+public:
+	ofLogWarning( const string &module ) : ofLog( "warning", module ){}
+};
+
+class ofLogNotice : public ofLog{
+public:
+	ofLogNotice( const string &module ) : ofLog( "notice", module ){}
+};
+
+template<typename T> string ofToString( const T &value ){
+	ostringstream out;
+	out << value;
+	return out.str();
+}
+
+inline string ofToDataPath( const string &path ){
+	return path;
+}
+
+inline tm ofLocalTime(){
+	time_t now = time( NULL );
+	tm date;
+#ifdef TARGET_WIN32
+	localtime_s( &date, &now );
+#else
+	localtime_r( &now, &date );
+#endif
+	return date;
+}
+
+inline int ofGetYear(){ return ofLocalTime().tm_year + 1900; }
+inline int ofGetMonth(){ return ofLocalTime().tm_mon + 1; }
+inline int ofGetDay(){ return ofLocalTime().tm_mday; }
@@ -0,0 +1,815 @@
+/*
+
+Benchmarks of the ofxSolar hot paths, on Google Benchmark
+
+A console program, it doesn't open a window. CMakeLists.txt builds it
+without openFrameworks, with shim/ofMain.h in place of the real one:
+
+	cmake -S . -B build -DCMAKE_BUILD_TYPE=Release && cmake --build build
+	build/example-benchmark [--benchmark_filter=regex] [--benchmark_min_time=0.2]
+		[--benchmark_out=benchmark.json] [--metrics_out=metrics.prom]
+
+In an openFrameworks project add libbenchmark to the linker flags. All
+the --benchmark_* flags of Google Benchmark work, --benchmark_out writes
+the JSON that its compare.py tracks over time. Benchmarks that do more
+than one thing per iteration report items_per_second and per_item, the
+time of one site, altitude, day or row. Those running threads of their
+own are timed by the wall clock.
+
+sunriset() and dayLength() are private, they are measured through
+dayState() + diurnalArc() which they are made of. calculateSunMap() is
+measured through update() and dayEvents(), the latter in all three
+ofxSolarPrecision tiers. The latitude sweep includes polar latitudes
+where the cost >= 1.0 and cost <= -1.0 branches fire. BM_update is
+update() within the day, one time() and the check of the snapshot,
+BM_update_recompute clears the snapshot first so every call computes the
+day again.
+
+BM_sunMap_before is calculateSunMap() as it was before dayState(), four
+dayLength() and four sunriset() calls that each evaluated the ephemeris,
+to compare with BM_dayEvents of the same latitude and date, what it
+calls now, one dayState() and four diurnalArc(). One core of a
+virtualized x86-64 Xeon, GCC -O2: 1.7-2.4 us against 240-330 ns, 6.5 to
+8 times faster.
+
+Built with -DOFXSOLAR_INSTRUMENT, comparing against a build without it
+gives the overhead of ofxSolarMetrics, BM_metrics_probe the cost of one
+probe on its own, and --metrics_out writes what the probes counted in
+the Prometheus text format.
+
+BM_decimalday_to_timestamp_legacy runs a copy of the function before
+formatTime(), which read the clock, called localtime() and strftime()
+and built the string with ofToString(), against BM_formatTime and the
+decimalday_to_timestamp() on top of it now: 1.25 us against 8-9 ns on
+one core of a virtualized x86-64 Xeon, GCC -O2.
+
+BM_crossings_* compare ofxSolar::crossings() through N altitudes with
+what calling sunriset() once per altitude costs, and the batched form
+across 1000 sites; per_item is per altitude crossing.
+
+BM_batch, BM_grid, BM_tracker, BM_raster, BM_cache, BM_timezone and
+BM_scheduler measure the main call of each of those classes, per_item is
+per site, cell, lookup or callback. BM_grid_lookup and
+BM_grid_lookup_dayEvents time single lookups at random places and dates
+through the grid and through the dayEvents() it replaces.
+BM_batch_sunpos and BM_batch_sun_RA_dec run a million day numbers
+through the scalar code and each SIMD path the CPU supports.
+
+BM_climatology reduces a year of 2000 sites with ofxSolarClimatology,
+per_item is per site-day.
+
+BM_request_heap and BM_request_arena run the same simulated service
+request, 64 sites with a month's calendar, the events of one date and
+batch outputs, with ofxSolar instances and vectors against an
+ofxSolarArena reset per request. Every operator new of the program is
+counted, the JSON has allocations and allocated_bytes per request and
+the resident set size after the run.
+
+BM_server runs ofxSolarServer and a load generator in this process, 16
+connections with 8 requests in flight each over a Unix domain socket,
+and reports the QPS as items_per_second and the p50 and p99 latency.
+
+BM_export_* stream a year of 200 sites through ofxSolarExporter to the
+null device, the JSON has items_per_second (rows) and bytes_per_second.
+
+*/
+
+#include "ofMain.h"
+#include "ofxSolar.h"
+#include "ofxSolarArena.h"
+#include "ofxSolarBatch.h"
+#include "ofxSolarCache.h"
+#include "ofxSolarClimatology.h"
+#include "ofxSolarExport.h"
+#include "ofxSolarGrid.h"
+#include "ofxSolarRaster.h"
+#include "ofxSolarScheduler.h"
+#include "ofxSolarServer.h"
+#include "ofxSolarMetrics.h"
+#include "ofxSolarTimeZone.h"
+#include "ofxSolarTracker.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <new>
+
+/* Every allocation of the program, for BM_request_* */
+static atomic<uint64_t> allocations( 0 ), allocatedBytes( 0 );
+
+void * operator new( size_t size ){
+	allocations.fetch_add( 1, memory_order_relaxed );
+	allocatedBytes.fetch_add( size, memory_order_relaxed );
+	void *p = malloc( size ? size : 1 );
+	if ( !p )
+		throw bad_alloc();
+	return p;
+}
+
+void * operator new[]( size_t size ){
+	return operator new( size );
+}
+
+void * operator new( size_t size, const nothrow_t & ) noexcept{
+	allocations.fetch_add( 1, memory_order_relaxed );
+	allocatedBytes.fetch_add( size, memory_order_relaxed );
+	return malloc( size ? size : 1 );
+}
+
+void * operator new[]( size_t size, const nothrow_t &tag ) noexcept{
+	return operator new( size, tag );
+}
+
+/* GCC takes the free() for a mismatch with the operator new above */
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpragmas"
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete( void *p ) noexcept{
+	free( p );
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+void operator delete[]( void *p ) noexcept{
+	operator delete( p );
+}
+
+void operator delete( void *p, size_t ) noexcept{
+	operator delete( p );
+}
+
+void operator delete[]( void *p, size_t ) noexcept{
+	operator delete( p );
+}
+
+/* Resident set size in kB, 0 where /proc isn't there */
+static double residentKB(){
+	long pages = 0, resident = 0;
+	FILE *f = fopen( "/proc/self/statm", "r" );
+	if ( !f )
+		return 0.0;
+	if ( fscanf( f, "%ld %ld", &pages, &resident ) != 2 )
+		resident = 0;
+	fclose( f );
+	return resident * 4.0;
+}
+
+/* items things done per iteration: items_per_second and the time of one */
+
+static void perItem( benchmark::State &state, int64_t items ){
+	state.SetItemsProcessed( state.iterations() * items );
+	state.counters["per_item"] = benchmark::Counter( (double)( state.iterations() * items ),
+		benchmark::Counter::kIsRate | benchmark::Counter::kInvert );
+}
+
+/* Registers body, called once per iteration, under name */
+
+template<typename Body>
+static benchmark::internal::Benchmark * add( const string &name, int64_t items, Body body ){
+	return benchmark::RegisterBenchmark( name.c_str(), [=]( benchmark::State &state ){
+		Body run = body;
+		for ( auto _ : state )
+			run();
+		if ( items > 1 )
+			perItem( state, items );
+	} );
+}
+
+/* Sites spread over the globe, lat in [south, north) */
+struct Sites{
+	vector<double> lat, lon, tz;
+
+	Sites( size_t count, double south, double north ) : lat( count ), lon( count ), tz( count ){
+		for ( size_t i = 0; i < count; i++ ){
+			lat[i] = south + ( north - south ) * i / count;
+			lon[i] = -180.0 + 360.0 * ( ( i * 37 ) % count ) / count;
+			tz[i] = floor( lon[i] / 15.0 + 0.5 );
+		}
+	}
+};
+
+/* Equator to pole, 66.5 and up have polar day and night around the solstices */
+static const double lats[] = { 0.0, 45.0, 60.0, 66.5, 75.0, 89.0 };
+static const int dates[][3] = { { 2016, 3, 20 }, { 2016, 6, 21 }, { 2016, 12, 21 } };
+
+/* decimalday_to_timestamp() before formatTime(), as it was: the clock, */
+/* localtime(), strftime() and ofToString() for every call              */
+static string legacyTimestamp( double d_time ){
+	double hours = d_time;
+	int h = (int) round(hours);
+	double minutes = (hours - h) * 60;
+	int m = (int) round(minutes);
+	if(m<0){
+		h-=1;
+		m = 60+m;
+		minutes = 60+minutes;
+	}
+	double seconds = (minutes - m) * 60;
+	int s = (int) round(seconds);
+	if (s<0){
+		m-=1;
+		if(m<0){
+			h-=1;
+			m = 60+m;
+		}
+		s = 60+s;
+	}
+	if(m<0)
+		h-=1;
+	h = h%12;
+
+	tm tempTime;
+	time_t rawtime;
+
+	time ( &rawtime );
+	tempTime =*localtime ( &rawtime );
+
+	tempTime.tm_hour = h;
+	tempTime.tm_min = m;
+	tempTime.tm_sec = s;
+
+	char buffer[25];
+
+	strftime(buffer, 25, "%H:%M:%S", &tempTime);
+
+	return ofToString(buffer);
+}
+
+static void registerCore(){
+	for ( double lat : lats ){
+		for ( auto &date : dates ){
+			string params = "/lat:" + ofToString( lat ) + "/date:" + ofToString( date[1] ) + "-" + ofToString( date[2] );
+			int y = date[0], m = date[1], d = date[2];
+
+			add( "BM_sunriset" + params, 1, [=]{
+				double t;
+				ofxSolarDayState state = ofxSolar::dayState( y, m, d, 13.4 );
+				int rc = ofxSolar::diurnalArc( state, lat, -35.0/60.0, 1, &t );
+				benchmark::DoNotOptimize( rc );
+				benchmark::DoNotOptimize( t );
+			} );
+			add( "BM_dayLength" + params, 4, [=]{
+				double t, sum = 0.0;
+				ofxSolarDayState state = ofxSolar::dayState( y, m, d, 13.4 );
+				ofxSolar::diurnalArc( state, lat, -35.0/60.0, 1, &t ); sum += t;
+				ofxSolar::diurnalArc( state, lat, -6.0, 0, &t ); sum += t;
+				ofxSolar::diurnalArc( state, lat, -12.0, 0, &t ); sum += t;
+				ofxSolar::diurnalArc( state, lat, -18.0, 0, &t ); sum += t;
+				benchmark::DoNotOptimize( sum );
+			} );
+			add( "BM_dayEvents" + params, 1, [=]{
+				benchmark::DoNotOptimize( ofxSolar::dayEvents( y, m, d, lat, 13.4, 1.0 ) );
+			} );
+			/* calculateSunMap() before dayState(), to compare with the        */
+			/* BM_dayEvents above: four dayLength() and four sunriset() calls */
+			/* each evaluated the ephemeris                                   */
+			add( "BM_sunMap_before" + params, 1, [=]{
+				static const double altit[4] = { -35.0/60.0, -6.0, -12.0, -18.0 };
+				double t, sum = 0.0;
+				for ( int k = 0; k < 8; k++ ){
+					ofxSolarDayState state = ofxSolar::dayState( y, m, d, 13.4 );
+					ofxSolar::diurnalArc( state, lat, altit[k % 4], k % 4 == 0, &t );
+					sum += k < 4 ? 2.0 * t : state.tsouth - t + 1.0;
+				}
+				benchmark::DoNotOptimize( sum );
+			} );
+			add( "BM_dayEvents_fast" + params, 1, [=]{
+				benchmark::DoNotOptimize( ofxSolar::dayEvents( y, m, d, lat, 13.4, 1.0, OFXSOLAR_PRECISION_FAST ) );
+			} );
+			add( "BM_dayEvents_accurate" + params, 1, [=]{
+				benchmark::DoNotOptimize( ofxSolar::dayEvents( y, m, d, lat, 13.4, 1.0, OFXSOLAR_PRECISION_ACCURATE ) );
+			} );
+		}
+	}
+
+	benchmark::RegisterBenchmark( "BM_sunpos", []( benchmark::State &state ){
+		double d = 5000.0, lon, r;
+		for ( auto _ : state ){
+			ofxSolar::sunpos( d += 0.001, &lon, &r );
+			benchmark::DoNotOptimize( lon );
+			benchmark::DoNotOptimize( r );
+		}
+	} );
+	benchmark::RegisterBenchmark( "BM_sun_RA_dec", []( benchmark::State &state ){
+		double d = 5000.0, ra, dec, r;
+		for ( auto _ : state ){
+			ofxSolar::sun_RA_dec( d += 0.001, &ra, &dec, &r );
+			benchmark::DoNotOptimize( ra );
+			benchmark::DoNotOptimize( dec );
+		}
+	} );
+
+	for ( double lat : lats ){
+		string params = "/lat:" + ofToString( lat );
+		benchmark::RegisterBenchmark( ( "BM_update" + params ).c_str(), [=]( benchmark::State &state ){
+			ofxSolar solar;
+			solar.init( lat, 13.4, 1 );
+			for ( auto _ : state )
+				solar.update();
+		} );
+		benchmark::RegisterBenchmark( ( "BM_update_recompute" + params ).c_str(), [=]( benchmark::State &state ){
+			ofxSolar solar;
+			solar.init( lat, 13.4, 1 );
+			for ( auto _ : state ){
+				solar.setDaylightSaving( 0 );   /* Clears the snapshot */
+				solar.update();
+			}
+		} );
+		benchmark::RegisterBenchmark( ( "BM_accessor_mapped" + params ).c_str(), [=]( benchmark::State &state ){
+			ofxSolar solar;
+			solar.init( lat, 13.4, 1 );
+			solar.update();
+			for ( auto _ : state )
+				benchmark::DoNotOptimize( solar.sunrise() );
+		} );
+	}
+
+	const int ranges[] = { 31, 366, 3653 };
+	for ( int days : ranges ){
+		int ey = 2016, em = 1, ed = 1;
+		for ( int i = 1; i < days; i++ )
+			ofxSolar::nextDay( &ey, &em, &ed );
+		add( "BM_calendar_per_day/days:" + ofToString( days ) + "/threads:1", days, [=]{
+			benchmark::DoNotOptimize( ofxSolar::calendar( 2016, 1, 1, ey, em, ed, 52.5, 13.4, 1.0, 1 ).back().set );
+		} );
+		add( "BM_calendar_per_day/days:" + ofToString( days ) + "/threads:all", days, [=]{
+			benchmark::DoNotOptimize( ofxSolar::calendar( 2016, 1, 1, ey, em, ed, 52.5, 13.4, 1.0 ).back().set );
+		} )->UseRealTime();
+	}
+
+	/* Golden hour, blue hour and panel shading angles */
+	static const double altitudes[] = { -35.0/60.0, 6.0, -4.0, -6.0, 10.0, 15.0, 20.0, 25.0,
+		30.0, 35.0, 40.0, 45.0, 50.0, 55.0, 58.0, -12.0 };
+	for ( int n : { 1, 4, 16 } ){
+		string params = "/altitudes:" + ofToString( n );
+		add( "BM_crossings_per_sunriset" + params, n, [=]{
+			double t, sum = 0.0;
+			for ( int i = 0; i < n; i++ ){
+				ofxSolarDayState state = ofxSolar::dayState( 2016, 6, 21, 13.4 );
+				ofxSolar::diurnalArc( state, 45.0, altitudes[i], 0, &t );
+				sum += t;
+			}
+			benchmark::DoNotOptimize( sum );
+		} );
+		add( "BM_crossings" + params, n, [=]{
+			ofxSolarCrossing out[16];
+			ofxSolar::crossings( ofxSolar::dayState( 2016, 6, 21, 13.4 ), 45.0, 1.0, altitudes, n, out );
+			benchmark::DoNotOptimize( out[n - 1].rise );
+		} );
+	}
+	benchmark::RegisterBenchmark( "BM_crossings_batch/sites:1000/altitudes:16", []( benchmark::State &state ){
+		const size_t n = 16;
+		Sites sites( 1000, -60.0, 60.0 );
+		vector<ofxSolarCrossing> out( sites.lat.size() * n );
+		for ( auto _ : state ){
+			ofxSolarBatch::crossings( 2016, 6, 21, sites.lat.size(), sites.lat.data(), sites.lon.data(),
+				sites.tz.data(), altitudes, n, out.data() );
+			benchmark::DoNotOptimize( out.back().set );
+		}
+		perItem( state, sites.lat.size() * n );
+	} );
+
+	benchmark::RegisterBenchmark( "BM_decimalday_to_timestamp_legacy", []( benchmark::State &state ){
+		double h = 0.0;
+		for ( auto _ : state )
+			benchmark::DoNotOptimize( legacyTimestamp( h += 0.0137 ) );
+	} );
+	benchmark::RegisterBenchmark( "BM_decimalday_to_timestamp", []( benchmark::State &state ){
+		double h = 0.0;
+		for ( auto _ : state )
+			benchmark::DoNotOptimize( ofxSolar::decimalday_to_timestamp( h += 0.0137 ) );
+	} );
+	benchmark::RegisterBenchmark( "BM_formatTime", []( benchmark::State &state ){
+		double h = 0.0;
+		char buffer[OFXSOLAR_TIME_LENGTH];
+		for ( auto _ : state ){
+			benchmark::DoNotOptimize( ofxSolar::formatTime( buffer, buffer + sizeof(buffer), h += 0.0137 ) );
+			benchmark::ClobberMemory();
+		}
+	} );
+}
+
+static void registerClasses(){
+	benchmark::RegisterBenchmark( "BM_batch_calculate/sites:1000", []( benchmark::State &state ){
+		Sites sites( 1000, -89.0, 89.0 );
+		size_t count = sites.lat.size();
+		ofxSolarArena arena;
+		ofxSolarBatchOutput out = ofxSolarBatch::allocate( arena, count );
+		for ( auto _ : state ){
+			ofxSolarBatch::calculate( 2016, 6, 21, count, sites.lat.data(), sites.lon.data(), sites.tz.data(), out );
+			benchmark::DoNotOptimize( out.set[count - 1] );
+		}
+		perItem( state, count );
+	} );
+
+	/* A million day numbers through each instruction set the CPU has */
+	const char *simdNames[3] = { "scalar", "sse2", "avx2" };
+	for ( int simd = OFXSOLAR_SIMD_SCALAR; simd <= (int)ofxSolarBatch::getSimd(); simd++ ){
+		for ( int radec = 0; radec < 2; radec++ ){
+			string name = string( radec ? "BM_batch_sun_RA_dec" : "BM_batch_sunpos" ) + "/simd:" + simdNames[simd] + "/n:1000000";
+			benchmark::RegisterBenchmark( name.c_str(), [=]( benchmark::State &state ){
+				const size_t n = 1000000;
+				vector<double> d( n ), a( n ), b( n ), c( n );
+				for ( size_t i = 0; i < n; i++ )
+					d[i] = -36500.0 + 73000.0 * i / n;
+				ofxSolarSimd best = ofxSolarBatch::getSimd();
+				ofxSolarBatch::setSimd( (ofxSolarSimd)simd );
+				for ( auto _ : state ){
+					if ( radec )
+						ofxSolarBatch::sun_RA_dec( d.data(), n, a.data(), b.data(), c.data() );
+					else
+						ofxSolarBatch::sunpos( d.data(), n, a.data(), b.data() );
+					benchmark::DoNotOptimize( a.back() );
+				}
+				ofxSolarBatch::setSimd( best );
+				perItem( state, n );
+			} );
+		}
+	}
+
+	benchmark::RegisterBenchmark( "BM_grid_setup/step:0.5", []( benchmark::State &state ){
+		for ( auto _ : state ){
+			ofxSolarGrid grid;
+			grid.setup( 2016 );
+			benchmark::DoNotOptimize( grid.isSetup() );
+		}
+		ofxSolarGrid grid;
+		grid.setup( 2016 );
+		state.counters["bytes"] = (double)grid.getMemoryUsage();
+	} );
+	/* One lookup per iteration at random places and dates, against the */
+	/* dayEvents() it replaces for the same queries                      */
+	for ( int grid = 1; grid >= 0; grid-- ){
+		benchmark::RegisterBenchmark( grid ? "BM_grid_lookup/random" : "BM_grid_lookup_dayEvents/random",
+			[=]( benchmark::State &state ){
+			const size_t n = 4096;
+			vector<double> lat( n ), lon( n );
+			vector<int> month( n ), day( n );
+			uint32_t x = 2463534242u;
+			for ( size_t i = 0; i < n; i++ ){
+				x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+				lat[i] = -65.0 + 130.0 * ( x % 100000 ) / 100000.0;
+				lon[i] = -180.0 + 360.0 * ( ( x >> 8 ) % 100000 ) / 100000.0;
+				month[i] = 1 + x % 12;
+				day[i] = 1 + ( x >> 4 ) % 28;
+			}
+			ofxSolarGrid table;
+			if ( grid )
+				table.setup( 2016 );
+			size_t i = 0;
+			for ( auto _ : state ){
+				if ( grid )
+					benchmark::DoNotOptimize( table.get( month[i], day[i], lat[i], lon[i], 0.0 ) );
+				else
+					benchmark::DoNotOptimize( ofxSolar::dayEvents( 2016, month[i], day[i], lat[i], lon[i], 0.0 ) );
+				i = ( i + 1 ) % n;
+			}
+		} );
+	}
+	benchmark::RegisterBenchmark( "BM_grid_get/sites:1000", []( benchmark::State &state ){
+		Sites sites( 1000, -65.0, 65.0 );
+		ofxSolarGrid grid;
+		grid.setup( 2016 );
+		for ( auto _ : state )
+			for ( size_t i = 0; i < sites.lat.size(); i++ )
+				benchmark::DoNotOptimize( grid.get( 6, 21, sites.lat[i], sites.lon[i], sites.tz[i] ) );
+		perItem( state, sites.lat.size() );
+	} );
+
+	/* A full evaluation against a frame's step of advance() */
+	benchmark::RegisterBenchmark( "BM_tracker_setTime", []( benchmark::State &state ){
+		ofxSolarTracker tracker;
+		tracker.setup( 52.5, 13.4 );
+		double d = 6012.0;
+		for ( auto _ : state ){
+			tracker.setTime( d += 0.001 );
+			benchmark::DoNotOptimize( tracker.getPosition() );
+		}
+	} );
+	benchmark::RegisterBenchmark( "BM_tracker_advance", []( benchmark::State &state ){
+		ofxSolarTracker tracker;
+		tracker.setup( 52.5, 13.4 );
+		tracker.setTime( 6012.0 );
+		for ( auto _ : state ){
+			tracker.advance( 1.0 / 60.0 / 3600.0 );
+			benchmark::DoNotOptimize( tracker.getPosition() );
+		}
+	} );
+
+	/* A rig of 10,000 lights, one frame per iteration */
+	for ( int hz : { 60, 120, 240 } ){
+		string name = "BM_tracker_lights/lights:10000/hz:" + ofToString( hz );
+		benchmark::RegisterBenchmark( name.c_str(), [=]( benchmark::State &state ){
+			Sites sites( 10000, -65.0, 65.0 );
+			vector<ofxSolarTracker> lights( sites.lat.size() );
+			for ( size_t i = 0; i < lights.size(); i++ ){
+				lights[i].setup( sites.lat[i], sites.lon[i] );
+				lights[i].setTime( 6012.0 + i / 10000.0 / 24.0 );   /* Spreads the hourly evaluations */
+			}
+			double frame = 1.0 / hz / 3600.0, east, north, up, sum = 0.0;
+			for ( auto _ : state ){
+				for ( size_t i = 0; i < lights.size(); i++ ){
+					lights[i].advance( frame );
+					lights[i].getDirection( &east, &north, &up );
+					sum += up;
+				}
+				benchmark::DoNotOptimize( sum );
+			}
+			perItem( state, lights.size() );
+		} );
+	}
+
+	for ( int threads : { 1, 0 } ){
+		string params = string( "/720x360/threads:" ) + ( threads ? "1" : "all" );
+		benchmark::RegisterBenchmark( ( "BM_raster_elevation" + params ).c_str(), [=]( benchmark::State &state ){
+			ofxSolarRaster raster;
+			raster.setup( 720, 360 );
+			raster.setThreads( threads );
+			vector<float> out( 720 * 360 );
+			for ( auto _ : state ){
+				raster.elevation( 6012.5, out.data() );
+				benchmark::DoNotOptimize( out.back() );
+			}
+			perItem( state, out.size() );
+		} )->UseRealTime();
+		benchmark::RegisterBenchmark( ( "BM_raster_dayLength" + params ).c_str(), [=]( benchmark::State &state ){
+			ofxSolarRaster raster;
+			raster.setup( 720, 360 );
+			raster.setThreads( threads );
+			vector<float> out( 720 * 360 );
+			for ( auto _ : state ){
+				raster.dayLength( 2016, 6, 21, out.data() );
+				benchmark::DoNotOptimize( out.back() );
+			}
+			perItem( state, out.size() );
+		} )->UseRealTime();
+	}
+
+	/* Hits: the same cells over again. Misses: more cells than the cache holds */
+	for ( bool hits : { true, false } ){
+		benchmark::RegisterBenchmark( hits ? "BM_cache_dayEvents/hits" : "BM_cache_dayEvents/misses", [=]( benchmark::State &state ){
+			Sites sites( hits ? 256 : 65536, -65.0, 65.0 );
+			ofxSolarCache cache;
+			cache.setup( 4096, 0.01 );
+			size_t i = 0;
+			for ( auto _ : state ){
+				benchmark::DoNotOptimize( cache.dayEvents( 2016, 6, 21, sites.lat[i], sites.lon[i], sites.tz[i] ) );
+				i = i + 1 < sites.lat.size() ? i + 1 : 0;
+			}
+			ofxSolarCacheStats stats = cache.getStats();
+			state.counters["hit_rate"] = stats.hits / (double)max<uint64_t>( 1, stats.hits + stats.misses );
+		} );
+	}
+
+	/* A POSIX rule, so it doesn't depend on the machine's tz database */
+	benchmark::RegisterBenchmark( "BM_timezone_getOffset", []( benchmark::State &state ){
+		shared_ptr<const ofxSolarTimeZone> zone = ofxSolarTimeZone::get( "CET-1CEST,M3.5.0,M10.5.0/3" );
+		int64_t t = 1466467200;
+		for ( auto _ : state )
+			benchmark::DoNotOptimize( zone->getOffsetSeconds( t += 3600 ) );
+	} );
+	benchmark::RegisterBenchmark( "BM_timezone_dayEvents", []( benchmark::State &state ){
+		shared_ptr<const ofxSolarTimeZone> zone = ofxSolarTimeZone::get( "CET-1CEST,M3.5.0,M10.5.0/3" );
+		for ( auto _ : state )
+			benchmark::DoNotOptimize( zone->dayEvents( 2016, 6, 21, 52.5, 13.4 ) );
+	} );
+
+	benchmark::RegisterBenchmark( "BM_scheduler_nextEvent", []( benchmark::State &state ){
+		double t = 6012.0;
+		for ( auto _ : state )
+			benchmark::DoNotOptimize( t = ofxSolarScheduler::nextEvent( 52.5, 13.4, -35.0/60.0, true, true, t ) );
+	} );
+	/* Every trigger fires and is scheduled again each simulated day */
+	benchmark::RegisterBenchmark( "BM_scheduler_process/triggers:1000", []( benchmark::State &state ){
+		Sites sites( 1000, -60.0, 60.0 );
+		ofxSolarScheduler scheduler;
+		uint64_t fired = 0;
+		for ( size_t i = 0; i < sites.lat.size(); i++ )
+			scheduler.add( sites.lat[i], sites.lon[i], OFXSOLAR_SUNRISE,
+				[&]( const ofxSolarSchedulerEvent & ){ fired++; } );
+		double t = ofxSolarScheduler::now();
+		int callbacks = 0;
+		for ( auto _ : state )
+			callbacks += scheduler.process( t += 1.0 );
+		state.SetItemsProcessed( callbacks );
+		state.counters["per_item"] = benchmark::Counter( (double)callbacks,
+			benchmark::Counter::kIsRate | benchmark::Counter::kInvert );
+		benchmark::DoNotOptimize( fired );
+	} );
+
+	benchmark::RegisterBenchmark( "BM_climatology/sites:2000/years:1", []( benchmark::State &state ){
+		Sites sites( 2000, -89.0, 89.0 );
+		ofxSolarClimatology climatology;
+		climatology.setup( sites.lat.data(), sites.lon.data(), sites.tz.data(), sites.lat.size() );
+		for ( auto _ : state ){
+			climatology.calculate( 2016, 2016 );
+			benchmark::DoNotOptimize( climatology.getResults().back().darkness );
+		}
+		perItem( state, sites.lat.size() * 366 );
+	} );
+}
+
+/* A simulated service request on heap objects and on an arena */
+
+static const int requestSites = 64;
+
+static void heapRequest( const Sites &sites ){
+	double sum = 0.0;
+	vector<ofxSolarDay> events;
+	for ( int i = 0; i < requestSites; i++ ){
+		ofxSolar solar;
+		solar.init( sites.lat[i], sites.lon[i], sites.tz[i] );
+		vector<ofxSolarDay> days = solar.calendar( 2016, 1, 1, 2016, 1, 31 );
+		sum += days.back().set;
+		events.push_back( ofxSolar::dayEvents( 2016, 6, 21, sites.lat[i], sites.lon[i], sites.tz[i] ) );
+	}
+	ofxSolarBatch batch;
+	batch.setup( sites.lat.data(), sites.lon.data(), sites.tz.data(), requestSites );
+	batch.update( 2016, 6, 21 );
+	benchmark::DoNotOptimize( sum + events.back().rise + batch.sunset().back() );
+}
+
+static void arenaRequest( const Sites &sites, ofxSolarArena &arena ){
+	double sum = 0.0;
+	for ( int i = 0; i < requestSites; i++ )
+		sum += ofxSolar::calendar( arena, 2016, 1, 1, 2016, 1, 31, sites.lat[i], sites.lon[i], sites.tz[i], 1 ).back().set;
+	ofxSolarSpan<ofxSolarDay> events = ofxSolar::dayEvents( arena, 2016, 6, 21,
+		sites.lat.data(), sites.lon.data(), sites.tz.data(), requestSites );
+	ofxSolarBatchOutput out = ofxSolarBatch::allocate( arena, requestSites );
+	ofxSolarBatch::calculate( 2016, 6, 21, requestSites, sites.lat.data(), sites.lon.data(), sites.tz.data(), out );
+	benchmark::DoNotOptimize( sum + events.back().rise + out.set[requestSites - 1] );
+	arena.reset();
+}
+
+static void registerRequests(){
+	for ( int k = 0; k < 2; k++ ){
+		benchmark::RegisterBenchmark( k == 0 ? "BM_request_heap" : "BM_request_arena", [=]( benchmark::State &state ){
+			Sites sites( requestSites, -60.0, 60.0 );
+			ofxSolarArena arena;
+			uint64_t count0 = allocations, bytes0 = allocatedBytes;
+			for ( auto _ : state ){
+				if ( k == 0 )
+					heapRequest( sites );
+				else
+					arenaRequest( sites, arena );
+			}
+			double requests = (double)max<int64_t>( 1, state.iterations() );
+			state.counters["allocations"] = ( allocations - count0 ) / requests;
+			state.counters["allocated_bytes"] = ( allocatedBytes - bytes0 ) / requests;
+			state.counters["rss_kb"] = residentKB();
+			if ( k == 1 ){
+				state.counters["arena_bytes"] = (double)arena.getCapacity();
+				state.counters["arena_blocks"] = (double)arena.getBlockCount();
+			}
+		} );
+	}
+}
+
+/* Load generator against the query server, one iteration of at least a second */
+
+static void serverLoad( benchmark::State &state ){
+	const char *path = "/tmp/ofxsolar-benchmark.sock";
+	const int connections = 16, depth = 8;
+	ofxSolarServer server;
+	if ( !server.setup( path ) ){
+		state.SkipWithError( "couldn't start the server" );
+		return;
+	}
+
+	for ( auto _ : state ){
+		vector<vector<double> > latencies( connections );
+		vector<thread> clients;
+		auto t0 = chrono::steady_clock::now();
+		auto deadline = t0 + chrono::seconds( 1 );
+
+		for ( int k = 0; k < connections; k++ ){
+			clients.push_back( thread( [&, k]{
+				ofxSolarClient client;
+				if ( !client.connect( path ) )
+					return;
+				ofxSolarQuery query;
+				memset( &query, 0, sizeof(query) );
+				query.events = OFXSOLAR_EVENT_ALL;
+				query.days = 1;
+				query.year = 2016;
+				query.month = 6;
+				query.day = 21;
+				query.tz = 1.0;
+
+				/* Send times of the requests in flight, answers come in order */
+				deque<chrono::steady_clock::time_point> sent;
+				ofxSolarAnswer answer;
+				vector<double> values;
+				uint32_t id = 0;
+				for ( ;; ){
+					while ( (int)sent.size() < depth && chrono::steady_clock::now() < deadline ){
+						query.id = id++;
+						query.lat = -60.0 + ( id * 7 + k * 13 ) % 120;
+						query.lon = -180.0 + ( id * 11 + k * 29 ) % 360;
+						sent.push_back( chrono::steady_clock::now() );
+						if ( !client.send( query ) )
+							return;
+					}
+					if ( sent.empty() || !client.receive( &answer, values ) )
+						return;
+					latencies[k].push_back( chrono::duration<double>( chrono::steady_clock::now() - sent.front() ).count() );
+					sent.pop_front();
+				}
+			} ) );
+		}
+		for ( size_t k = 0; k < clients.size(); k++ )
+			clients[k].join();
+		state.SetIterationTime( chrono::duration<double>( chrono::steady_clock::now() - t0 ).count() );
+
+		vector<double> all;
+		for ( size_t k = 0; k < latencies.size(); k++ )
+			all.insert( all.end(), latencies[k].begin(), latencies[k].end() );
+		if ( all.empty() ){
+			state.SkipWithError( "no answers" );
+			break;
+		}
+		sort( all.begin(), all.end() );
+		state.SetItemsProcessed( all.size() );
+		state.counters["p50_us"] = all[all.size() / 2] * 1.0E6;
+		state.counters["p99_us"] = all[all.size() * 99 / 100] * 1.0E6;
+	}
+	server.stop();
+}
+
+/* A year of sites spread over the globe, written to the null device */
+
+static void registerExport(){
+	const char *names[3] = { "csv", "ndjson", "binary" };
+	for ( int format = 0; format < 3; format++ ){
+		benchmark::RegisterBenchmark( ( string( "BM_export_" ) + names[format] ).c_str(), [=]( benchmark::State &state ){
+			Sites sites( 200, -60.0, 60.0 );
+#ifdef TARGET_WIN32
+			FILE *null = fopen( "NUL", "wb" );
+#else
+			FILE *null = fopen( "/dev/null", "wb" );
+#endif
+			if ( !null ){
+				state.SkipWithError( "couldn't open the null device" );
+				return;
+			}
+			ofxSolarExporter exporter;
+			exporter.setSites( sites.lat.data(), sites.lon.data(), sites.tz.data(), sites.lat.size() );
+			exporter.setup( (ofxSolarExportFormat)format );
+			for ( auto _ : state )
+				exporter.write( null, 2015, 1, 1, 2015, 12, 31 );
+			fclose( null );
+
+			ofxSolarExportStats stats = exporter.getStats();
+			state.SetItemsProcessed( state.iterations() * stats.rows );
+			state.SetBytesProcessed( state.iterations() * stats.bytes );
+		} )->UseRealTime();
+	}
+}
+
+int main( int argc, char *argv[] ){
+	/* Ours, taken out before Google Benchmark sees the flags */
+	string metricsOut;
+	int kept = 1;
+	for ( int i = 1; i < argc; i++ ){
+		string arg = argv[i];
+		if ( arg.find( "--metrics_out=" ) == 0 )
+			metricsOut = arg.substr( 14 );
+		else
+			argv[kept++] = argv[i];
+	}
+	argc = kept;
+
+	registerCore();
+	registerClasses();
+	registerRequests();
+	benchmark::RegisterBenchmark( "BM_server/connections:16/depth:8", serverLoad )
+		->Iterations( 1 )->UseManualTime()->Unit( benchmark::kMillisecond );
+	registerExport();
+	benchmark::RegisterBenchmark( "BM_metrics_probe", []( benchmark::State &state ){
+		for ( auto _ : state ){
+			ofxSolarProbe probe( OFXSOLAR_METRIC_FORMAT );
+		}
+	} );
+
+	benchmark::Initialize( &argc, argv );
+	if ( benchmark::ReportUnrecognizedArguments( argc, argv ) )
+		return 1;
+	benchmark::AddCustomContext( "simd", ofToString( (int)ofxSolarBatch::getSimd() ) );
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	/* BM_metrics_probe counts as formatting */
+	if ( !metricsOut.empty() ){
+		if ( !ofxSolarMetrics::isEnabled() )
+			ofLogWarning("example-benchmark") << "built without OFXSOLAR_INSTRUMENT, the metrics are all zero";
+		FILE *f = fopen( ofToDataPath( metricsOut ).c_str(), "w" );
+		if ( f ){
+			fputs( ofxSolarMetrics::toPrometheus().c_str(), f );
+			fclose( f );
+		}
+	}
+	return 0;
+}
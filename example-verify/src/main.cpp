@@ -0,0 +1,80 @@
+/*
+
+Accuracy and regression checks of the ofxSolar paths, see
+ofxSolarVerify.h for what is covered
+
+A console program, it doesn't open a window. Prints one line per result
+and exits with 1 if any is over its budget, so it can gate a build:
+
+	example-verify [--samples=1000000] [--seed=1] [--threads=0]
+		[--skip_reference] [--skip_differential] [--skip_units]
+
+The same seed and number of samples always draw the same sites and
+dates, whatever the number of threads; a failure names the sample to
+reproduce it with. The ofxSolarTableFile check opens damaged files on
+purpose, the errors it logs are expected.
+
+Built with -fsanitize=thread, ThreadSanitizer watches the threads of
+differential(), of the concurrent update() check and of the server:
+
+	g++ -O1 -g -fsanitize=thread ... && example-verify --skip_reference
+
+*/
+
+#include "ofMain.h"
+#include "ofxSolarVerify.h"
+
+#include <chrono>
+
+int main( int argc, char *argv[] ){
+	uint64_t samples = 1000000, seed = 1;
+	int threads = 0;
+	bool reference = true, differential = true, units = true;
+
+	for ( int i = 1; i < argc; i++ ){
+		string arg = argv[i];
+		if ( arg.find( "--samples=" ) == 0 )
+			samples = strtoull( arg.substr( 10 ).c_str(), NULL, 10 );
+		else if ( arg.find( "--seed=" ) == 0 )
+			seed = strtoull( arg.substr( 7 ).c_str(), NULL, 10 );
+		else if ( arg.find( "--threads=" ) == 0 )
+			threads = atoi( arg.substr( 10 ).c_str() );
+		else if ( arg == "--skip_reference" )
+			reference = false;
+		else if ( arg == "--skip_differential" )
+			differential = false;
+		else if ( arg == "--skip_units" )
+			units = false;
+	}
+
+	vector<ofxSolarVerifyResult> results;
+
+	if ( reference ){
+		auto t0 = chrono::steady_clock::now();
+		vector<ofxSolarVerifyResult> r = ofxSolarVerify::reference();
+		printf( "%s", ofxSolarVerify::report( r ).c_str() );
+		printf( "reference: %.2f s\n\n", chrono::duration<double>( chrono::steady_clock::now() - t0 ).count() );
+		results.insert( results.end(), r.begin(), r.end() );
+	}
+
+	if ( differential ){
+		auto t0 = chrono::steady_clock::now();
+		vector<ofxSolarVerifyResult> r = ofxSolarVerify::differential( samples, seed, threads );
+		printf( "%s", ofxSolarVerify::report( r ).c_str() );
+		printf( "differential: %llu samples, seed %llu, %.2f s\n\n", (unsigned long long)samples,
+			(unsigned long long)seed, chrono::duration<double>( chrono::steady_clock::now() - t0 ).count() );
+		results.insert( results.end(), r.begin(), r.end() );
+	}
+
+	if ( units ){
+		auto t0 = chrono::steady_clock::now();
+		vector<ofxSolarVerifyResult> r = ofxSolarVerify::units();
+		printf( "%s", ofxSolarVerify::report( r ).c_str() );
+		printf( "units: %.2f s\n\n", chrono::duration<double>( chrono::steady_clock::now() - t0 ).count() );
+		results.insert( results.end(), r.begin(), r.end() );
+	}
+
+	bool passed = ofxSolarVerify::passed( results );
+	printf( "%s\n", passed ? "passed" : "FAILED" );
+	return passed ? 0 : 1;
+}
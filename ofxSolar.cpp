@@ -1,79 +1,385 @@
 #include "ofxSolar.h"
+#include "ofxSolarCache.h"
+#include "ofxSolarLocations.h"
+#include "ofxSolarTimeZone.h"
+#include "ofxSolarMetrics.h"
+
+ofxSolar::ofxSolar(){
+	lat = lon = tz = 0.0;
+	dls = 0;
+	precision = OFXSOLAR_PRECISION_DEFAULT;
+	recomputes = hits = 0;
+	newDay = false;
+}
+ofxSolar::ofxSolar( const ofxSolar &other ){
+	*this = other;
+}
+ofxSolar & ofxSolar::operator=( const ofxSolar &other ){
+	lat = other.lat;
+	lon = other.lon;
+	dls = other.dls;
+	tz = other.tz;
+	precision = other.precision;
+	atomic_store( &sunMap, atomic_load( &other.sunMap ) );
+	recomputes = other.recomputes.load();
+	hits = other.hits.load();
+	newDay = other.newDay.load();
+	dayChanged = other.dayChanged;
+	cache = other.cache;
+	zone = other.zone;
+	return *this;
+}
 
-void ofxSolar::init(double latitude, double longitude, int timezone){
-	sunMapped=false;
+void ofxSolar::init(double latitude, double longitude, double timezone){
 	lat=latitude;
 	lon=longitude;
 	tz=timezone;
 	dls=0;
+	zone.reset();
+	atomic_store(&sunMap, shared_ptr<const Snapshot>());
+}
+void ofxSolar::init(const ofxSolarLocation &location){
+	init(location.lat, location.lon, location.tz);
 }
 void ofxSolar::setDaylightSaving(int dlsav){
 	dls=dlsav;
+	atomic_store(&sunMap, shared_ptr<const Snapshot>());
 }
 void ofxSolar::update(){
+	OFXSOLAR_PROBE( OFXSOLAR_METRIC_UPDATE );
+	/* Same local day and nothing reset the snapshot: nothing to do */
+	int64_t now = time( NULL );
+	shared_ptr<const Snapshot> snapshot = atomic_load(&sunMap);
+	if ( snapshot && now >= snapshot->validFrom && now < snapshot->validUntil ){
+		hits++;
+		newDay = false;
+		return;
+	}
 	calculateSunMap();
+	newDay = true;
 }
 
+static mutex localTimeGuard;
+
 void ofxSolar::calculateSunMap()
 {
+	OFXSOLAR_PROBE( OFXSOLAR_METRIC_CALCULATE_SUN_MAP );
+	time_t now = time( NULL );
+	shared_ptr<const ofxSolarTimeZone> zone = this->zone;
+	shared_ptr<Snapshot> snapshot = make_shared<Snapshot>();
+
+	if ( zone ){
+		/* Events in UT, each moved by the zone's offset at its instant */
+		int year, month, date;
+		zone->getDate( now, &year, &month, &date );
+		ofxSolarDay events = cache && precision == OFXSOLAR_PRECISION_DEFAULT ?
+			cache->dayEvents( year, month, date, lat, lon, 0.0 ) :
+			dayEvents( year, month, date, lat, lon, 0.0, precision );
+		zone->localize( &events );
+		snapshot->day = events;
+
+		snapshot->validFrom = zone->getMidnight( year, month, date );
+		nextDay( &year, &month, &date );
+		snapshot->validUntil = zone->getMidnight( year, month, date );
+	}else{
+		/* localtime_r() and mktime() share the C library's time zone */
+		/* state, calls of concurrent recomputes are taken in turn    */
+		tm date;
+		int year, month, day;
+		{
+			lock_guard<mutex> lock( localTimeGuard );
+#ifdef TARGET_WIN32
+			localtime_s( &date, &now );
+#else
+			localtime_r( &now, &date );
+#endif
+			year = date.tm_year + 1900;
+			month = date.tm_mon + 1;
+			day = date.tm_mday;
+
+			/* The snapshot holds until the next local midnight, mktime() normalizes */
+			/* the day of month and works out daylight saving                        */
+			date.tm_hour = date.tm_min = date.tm_sec = 0;
+			date.tm_isdst = -1;
+			snapshot->validFrom = (int64_t)mktime( &date );
+			date.tm_mday++;
+			date.tm_isdst = -1;
+			snapshot->validUntil = (int64_t)mktime( &date );
+		}
 
-	year = ofGetYear();
-	month = ofGetMonth();
-	day = ofGetDay();
+		snapshot->day = cache && precision == OFXSOLAR_PRECISION_DEFAULT ?
+			cache->dayEvents( year, month, day, lat, lon, tz+dls ) :
+			dayEvents( year, month, day, lat, lon, tz+dls, precision );
+	}
 
-	dayleng  = dayLength( year, month, day, lon, lat, -35.0/60.0, 1 );
-	civlen  = dayLength( year, month, day, lon, lat, -6.0, 0 );
-	nautlen = dayLength( year, month, day, lon, lat, -12.0, 0 );
-	astrlen = dayLength( year, month, day, lon, lat, -18.0, 0 );
+	/* Computed aside and swapped in, so readers never see a half updated */
+	/* day or a day with the window of another                            */
+	atomic_store(&sunMap, shared_ptr<const Snapshot>( snapshot ));
+	recomputes++;
 
-	rs   = sunriset( year, month, day, lon, lat, -35.0/60.0, 1, &rise, &set ); //sunrise and sunset
-	civ  = sunriset( year, month, day, lon, lat, -6.0, 0, &civ_start, &civ_end ); //civil twilight
-	naut = sunriset( year, month, day, lon, lat, -12.0, 0, &naut_start, &naut_end ); //nautical twilight
-	astr = sunriset( year, month, day, lon, lat, -18.0, 0, &astr_start, &astr_end ); //astronomical twilight
+	if ( dayChanged )
+		dayChanged( snapshot->day );
+}
 
-	sunMapped=true;
+void ofxSolar::setPrecision( ofxSolarPrecision precision ){
+	this->precision = precision;
+	atomic_store(&sunMap, shared_ptr<const Snapshot>());
 }
 
-string ofxSolar::decimalday_to_timestamp(double d_time){
-	double hours = d_time;
-	int h = (int) round(hours);
-	double minutes = (hours - h) * 60;
-	int m = (int) round(minutes);
-	if(m<0){
-		h-=1;
-		m = 60+m;
-		minutes = 60+minutes;
+ofxSolarPrecision ofxSolar::getPrecision(){
+	return precision;
+}
+
+void ofxSolar::setCache( shared_ptr<ofxSolarCache> cache ){
+	this->cache = cache;
+	atomic_store(&sunMap, shared_ptr<const Snapshot>());
+}
+
+bool ofxSolar::setTimeZone( const string &name ){
+	shared_ptr<const ofxSolarTimeZone> zone = ofxSolarTimeZone::get( name );
+	if ( !zone )
+		return false;
+	setTimeZone( zone );
+	return true;
+}
+
+void ofxSolar::setTimeZone( shared_ptr<const ofxSolarTimeZone> zone ){
+	this->zone = zone;
+	atomic_store(&sunMap, shared_ptr<const Snapshot>());
+}
+
+shared_ptr<const ofxSolarTimeZone> ofxSolar::getTimeZone(){
+	return zone;
+}
+
+bool ofxSolar::isNewDay(){
+	return newDay;
+}
+
+void ofxSolar::setDayChangedCallback( function<void( const ofxSolarDay & )> callback ){
+	dayChanged = callback;
+}
+
+uint64_t ofxSolar::getRecomputeCount(){
+	return recomputes;
+}
+
+uint64_t ofxSolar::getCacheHitCount(){
+	return hits;
+}
+
+shared_ptr<const ofxSolarDay> ofxSolar::getSnapshot(){
+	shared_ptr<const Snapshot> snapshot = atomic_load(&sunMap);
+	if(!snapshot){
+		calculateSunMap();
+		snapshot = atomic_load(&sunMap);
+	}
+	/* Shares the ownership of the whole snapshot */
+	return shared_ptr<const ofxSolarDay>( snapshot, &snapshot->day );
+}
+
+vector<ofxSolarDay> ofxSolar::calendar( int startYear, int startMonth, int startDay,
+	int endYear, int endMonth, int endDay ){
+	if ( zone )
+		return zone->calendar( startYear, startMonth, startDay, endYear, endMonth, endDay, lat, lon, 0, precision );
+	return calendar( startYear, startMonth, startDay, endYear, endMonth, endDay, lat, lon, tz+dls, 0, precision );
+}
+
+vector<ofxSolarDay> ofxSolar::calendar( int startYear, int startMonth, int startDay,
+	int endYear, int endMonth, int endDay, double lat, double lon, double tz, int threads,
+	ofxSolarPrecision precision )
+	/**********************************************************************/
+	/* Note: dates = calendar dates, 1801-2099 only.                      */
+	/*       tz = hours to add to UT for the local times of the events    */
+	/*       threads = number of worker threads, 0 = one per core.        */
+	/*       Large ranges are split into contiguous blocks of days, one   */
+	/*       per thread.                                                  */
+	/**********************************************************************/
+{
+	long first = days_since_2000_Jan_0(startYear,startMonth,startDay);
+	long last = days_since_2000_Jan_0(endYear,endMonth,endDay);
+	vector<ofxSolarDay> days;
+
+	if ( last < first )
+		return days;
+	days.resize( last - first + 1 );
+	calendar( days.data(), days.size(), startYear, startMonth, startDay, lat, lon, tz, threads, precision );
+	return days;
+}
+
+void ofxSolar::calendar( ofxSolarDay *days, size_t count, int startYear, int startMonth, int startDay,
+	double lat, double lon, double tz, int threads, ofxSolarPrecision precision )
+	/**********************************************************************/
+	/* Fills in count days from the start date, for calendar() into a     */
+	/* vector or an ofxSolarArena                                         */
+	/**********************************************************************/
+{
+	long first = days_since_2000_Jan_0(startYear,startMonth,startDay);
+
+	/* Dates are stepped one day at a time, day numbers are first + i */
+	int year = startYear, month = startMonth, day = startDay;
+	for ( size_t i = 0; i < count; i++ ){
+		days[i].year = year;
+		days[i].month = month;
+		days[i].day = day;
+		nextDay( &year, &month, &day );
 	}
-	double seconds = (minutes - m) * 60;
-	int s = (int) round(seconds);
-	if (s<0){
-		m-=1;
-		if(m<0){
-			h-=1;
-			m = 60+m;
+
+	if ( threads <= 0 )
+		threads = max( 1u, thread::hardware_concurrency() );
+	/* Don't bother with threads for less than a few months per thread */
+	threads = min( threads, (int)( count / 128 ) + 1 );
+
+	auto compute = [&]( size_t begin, size_t end ){
+		for ( size_t i = begin; i < end; i++ ){
+			if ( precision == OFXSOLAR_PRECISION_FAST )
+				dayEventsFast( first + (long)i, lat, lon, tz, &days[i] );
+			else if ( precision == OFXSOLAR_PRECISION_ACCURATE )
+				dayEventsAccurate( first + (long)i, lat, lon, tz, &days[i] );
+			else
+				dayEvents( dayState( first + (long)i, lon ), lat, tz, &days[i] );
 		}
-		s = 60+s;
+	};
+
+	if ( threads == 1 ){
+		compute( 0, count );
+	}else{
+		vector<thread> workers;
+		size_t block = ( count + threads - 1 ) / threads;
+		for ( size_t begin = 0; begin < count; begin += block )
+			workers.push_back( thread( compute, begin, min( begin + block, count ) ) );
+		for ( size_t i = 0; i < workers.size(); i++ )
+			workers[i].join();
 	}
-	if(m<0)
-		h-=1;
-	h = h%12;
+}
+
+void ofxSolar::nextDay( int *year, int *month, int *day ){
+	static const int length[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	bool leap = ( *year % 4 == 0 && *year % 100 != 0 ) || *year % 400 == 0;
+	if ( *day < length[*month - 1] + ( leap && *month == 2 ) ){
+		(*day)++;
+	}else if ( *month < 12 ){
+		*day = 1;
+		(*month)++;
+	}else{
+		*day = 1;
+		*month = 1;
+		(*year)++;
+	}
+}
 
-	tm tempTime;
-	time_t rawtime;
+/* The time of day as HH:MM:SS, see formatTime() */
 
-	time ( &rawtime );
-	tempTime =*localtime ( &rawtime );
+string ofxSolar::decimalday_to_timestamp(double d_time){
+	char buffer[OFXSOLAR_TIME_LENGTH];
 
-	tempTime.tm_hour = h;
-	tempTime.tm_min = m;
-	tempTime.tm_sec = s;
+	formatTime( buffer, buffer + sizeof(buffer), d_time );
+	return string( buffer, sizeof(buffer) );
+}
 
-	char buffer[25];
+/* "00" to "99", two characters per number */
 
-	strftime(buffer, 25, "%H:%M:%S", &tempTime);
+static const char digitPairs[201] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
 
-	return ofToString(buffer);
+static inline char * put2( char *p, int v ){
+	p[0] = digitPairs[2*v];
+	p[1] = digitPairs[2*v+1];
+	return p + 2;
 }
+
+static long hoursToSeconds( double hours ){
+	return (long)floor( hours * 3600.0 + 0.5 );
+}
+
+/* HH:MM:SS of any time of day, --:--:-- for NaN and absurd values */
+
+static char * putClock( char *p, double hours ){
+	if ( !( fabs(hours) < 1.0E9 ) ){
+		memcpy( p, "--:--:--", OFXSOLAR_TIME_LENGTH );
+		return p + OFXSOLAR_TIME_LENGTH;
+	}
+	long s = hoursToSeconds( hours ) % 86400;
+	if ( s < 0 )
+		s += 86400;
+	p = put2( p, (int)( s / 3600 ) );
+	*p++ = ':';
+	p = put2( p, (int)( s / 60 % 60 ) );
+	*p++ = ':';
+	return put2( p, (int)( s % 60 ) );
+}
+
+char * ofxSolar::formatTime( char *first, char *last, double hours ){
+	OFXSOLAR_PROBE( OFXSOLAR_METRIC_FORMAT );
+	if ( last - first < OFXSOLAR_TIME_LENGTH )
+		return NULL;
+	return putClock( first, hours );
+}
+
+char * ofxSolar::formatIso( char *first, char *last, int year, int month, int day, double hours, double tz ){
+	OFXSOLAR_PROBE( OFXSOLAR_METRIC_FORMAT );
+	static const int length[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+	if ( last - first < OFXSOLAR_ISO_LENGTH )
+		return NULL;
+	/* A year either way at most, the date moves a day at a time */
+	if ( !( fabs(hours) < 24.0 * 366.0 ) || !( fabs(tz) < 100.0 ) )
+		return NULL;
+	long s = hoursToSeconds( hours );
+	long offset = hoursToSeconds( tz );
+
+	/* Whole days before or after the given date */
+	long days = s >= 0 ? s / 86400 : -( ( 86399 - s ) / 86400 );
+	s -= days * 86400;
+	for ( ; days > 0; days-- )
+		nextDay( &year, &month, &day );
+	for ( ; days < 0; days++ ){
+		if ( --day < 1 ){
+			if ( --month < 1 ){
+				month = 12;
+				year--;
+			}
+			bool leap = ( year % 4 == 0 && year % 100 != 0 ) || year % 400 == 0;
+			day = length[month - 1] + ( leap && month == 2 );
+		}
+	}
+	if ( year < 0 || year > 9999 )
+		return NULL;
+
+	char *p = first;
+	p = put2( p, year / 100 );
+	p = put2( p, year % 100 );
+	*p++ = '-';
+	p = put2( p, month );
+	*p++ = '-';
+	p = put2( p, day );
+	*p++ = 'T';
+	p = putClock( p, s / 3600.0 );
+
+	/* Offsets are rounded to minutes, +05:30, -03:30 */
+	*p++ = tz < 0.0 ? '-' : '+';
+	long m = ( labs( offset ) + 30 ) / 60;
+	if ( m > 99 * 60 + 59 )
+		return NULL;
+	p = put2( p, (int)( m / 60 ) );
+	*p++ = ':';
+	return put2( p, (int)( m % 60 ) );
+}
+
+char * ofxSolar::formatTimes( char *first, char *last, const double *hours, size_t count, char separator ){
+	OFXSOLAR_PROBE( OFXSOLAR_METRIC_FORMAT );
+	if ( (size_t)( last - first ) < count * ( OFXSOLAR_TIME_LENGTH + 1 ) )
+		return NULL;
+	char *p = first;
+	for ( size_t i = 0; i < count; i++ ){
+		p = putClock( p, hours[i] );
+		*p++ = separator;
+	}
+	return p;
+}
+
 void ofxSolar::printInfo(){
 	printf( "Day length:                 %5.2f hours\n", dayLength() );
 	printf( "With nautical twilight      %5.2f hours\n", nauticalTwilightDayLength() );
@@ -84,88 +390,58 @@ void ofxSolar::printInfo(){
 		(nauticalTwilightDayLength()-dayLength())/2.0);
 	printf( "              astronomical  %5.2f hours\n",
 		(astronomicalTwilightDayLength()-dayLength())/2.0);
-	printf( "Sun rises %s, sets %s\n",
-		decimalday_to_timestamp(sunrise()).c_str(), decimalday_to_timestamp(sunset()).c_str());
+	char t[8][OFXSOLAR_TIME_LENGTH + 1];
+	shared_ptr<const ofxSolarDay> day = getSnapshot();
+	const double events[8] = { day->rise, day->set, day->civ_start, day->civ_end,
+		day->naut_start, day->naut_end, day->astr_start, day->astr_end };
+	for ( int i = 0; i < 8; i++ )
+		*formatTime( t[i], t[i] + OFXSOLAR_TIME_LENGTH, events[i] ) = '\0';
+
+	printf( "Sun rises %s, sets %s\n", t[0], t[1] );
 	printf( "Civil twilight starts %s, "
-		"ends %s\n", decimalday_to_timestamp(civilTwilightStart()).c_str(), decimalday_to_timestamp(civilTwilightEnd()).c_str());
+		"ends %s\n", t[2], t[3] );
 	printf( "Nautical twilight starts %s, "
-		"ends %s\n", decimalday_to_timestamp(nauticalTwilightStart()).c_str(), decimalday_to_timestamp(nauticalTwilightEnd()).c_str());
+		"ends %s\n", t[4], t[5] );
 	printf( "Astronomical twilight starts %s, "
-		"ends %s\n", decimalday_to_timestamp(astronomicalTwilightStart()).c_str(), decimalday_to_timestamp(astronomicalTwilightEnd()).c_str());
+		"ends %s\n", t[6], t[7] );
 
 	printf("\n================================================================================ \n");
 }
 double ofxSolar::dayLength(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return dayleng;
+	return getSnapshot()->dayleng;
 }
 double ofxSolar::civilTwilightDayLength(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return civlen;
+	return getSnapshot()->civlen;
 }
 double ofxSolar::nauticalTwilightDayLength(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return nautlen;
+	return getSnapshot()->nautlen;
 }
 double ofxSolar::astronomicalTwilightDayLength(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return astrlen;
+	return getSnapshot()->astrlen;
 }
 double ofxSolar::sunrise(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return rise+tz+dls;
+	return getSnapshot()->rise;
 }
 double ofxSolar::sunset(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return set+tz+dls;
+	return getSnapshot()->set;
 }
 double ofxSolar::civilTwilightStart(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return civ_start+tz+dls;
+	return getSnapshot()->civ_start;
 }
 double ofxSolar::nauticalTwilightStart(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return naut_start+tz+dls;
+	return getSnapshot()->naut_start;
 }
 double ofxSolar::astronomicalTwilightStart(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return astr_start+tz+dls;
+	return getSnapshot()->astr_start;
 }
 double ofxSolar::civilTwilightEnd(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return civ_end+tz+dls;
+	return getSnapshot()->civ_end;
 }
 double ofxSolar::nauticalTwilightEnd(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return naut_end+tz+dls;
+	return getSnapshot()->naut_end;
 }
 double ofxSolar::astronomicalTwilightEnd(){
-	if(!sunMapped){
-		calculateSunMap();
-	}
-	return astr_end+tz+dls;
+	return getSnapshot()->astr_end;
 }
 
 
@@ -203,53 +479,16 @@ int ofxSolar::sunriset( int year, int month, int day, double lon, double lat,
 					   /*                                                                    */
 					   /**********************************************************************/
 {
-	double  d,  /* Days since 2000 Jan 0.0 (negative before) */
-		sr,         /* Solar distance, astronomical units */
-		sRA,        /* Sun's Right Ascension */
-		sdec,       /* Sun's declination */
-		sradius,    /* Sun's apparent radius */
-		t,          /* Diurnal arc */
-		tsouth,     /* Time when Sun is at south */
-		sidtime;    /* Local sidereal time */
-
-	int rc = 0; /* Return cde from function - usually 0 */
-
-	/* Compute d of 12h local mean solar time */
-	d = days_since_2000_Jan_0(year,month,day) + 0.5 - lon/360.0;
-
-	/* Compute the local sidereal time of this moment */
-	sidtime = revolution( GMST0(d) + 180.0 + lon );
+	OFXSOLAR_PROBE( OFXSOLAR_METRIC_SUNRISET );
+	ofxSolarDayState state = dayState( year, month, day, lon );
+	double t;   /* Diurnal arc */
+	int rc;     /* Return cde from function - usually 0 */
 
-	/* Compute Sun's RA, Decl and distance at this moment */
-	sun_RA_dec( d, &sRA, &sdec, &sr );
-
-	/* Compute time when Sun is at south - in hours UT */
-	tsouth = 12.0 - rev180(sidtime - sRA)/15.0;
-
-	/* Compute the Sun's apparent radius in degrees */
-	sradius = 0.2666 / sr;
-
-	/* Do correction to upper limb, if necessary */
-	if ( upper_limb )
-		altit -= sradius;
-
-	/* Compute the diurnal arc that the Sun traverses to reach */
-	/* the specified altitude altit: */
-	{
-		double cost;
-		cost = ( sind(altit) - sind(lat) * sind(sdec) ) /
-			( cosd(lat) * cosd(sdec) );
-		if ( cost >= 1.0 )
-			rc = -1, t = 0.0;       /* Sun always below altit */
-		else if ( cost <= -1.0 )
-			rc = +1, t = 12.0;      /* Sun always above altit */
-		else
-			t = acosd(cost)/15.0;   /* The diurnal arc, hours */
-	}
+	rc = diurnalArc( state, lat, altit, upper_limb, &t );
 
 	/* Store rise and set times - in hours UT */
-	*trise = tsouth - t;
-	*tset  = tsouth + t;
+	*trise = state.tsouth - t;
+	*tset  = state.tsouth + t;
 
 	return rc;
 }  /* sunriset */
@@ -276,30 +515,68 @@ double ofxSolar::dayLength( int year, int month, int day, double lon, double lat
 	/*               and to zero when computing day+twilight length.      */
 	/**********************************************************************/
 {
-	double  d,  /* Days since 2000 Jan 0.0 (negative before) */
-		obl_ecl,    /* Obliquity (inclination) of Earth's axis */
-		sr,         /* Solar distance, astronomical units */
-		slon,       /* True solar longitude */
-		sin_sdecl,  /* Sine of Sun's declination */
-		cos_sdecl,  /* Cosine of Sun's declination */
-		sradius,    /* Sun's apparent radius */
-		t;          /* Diurnal arc */
+	OFXSOLAR_PROBE( OFXSOLAR_METRIC_DAY_LENGTH );
+	double t;   /* Diurnal arc */
+
+	diurnalArc( dayState( year, month, day, lon ), lat, altit, upper_limb, &t );
+
+	return 2.0 * t;
+}  /* daylen */
+
+
+/* The Sun's position at local noon, computed once per date */
+
+ofxSolarDayState ofxSolar::dayState( int year, int month, int day, double lon )
+	/**********************************************************************/
+	/* Note: year,month,date = calendar date, 1801-2099 only.             */
+	/*       Eastern longitude positive, Western longitude negative       */
+	/*       Everything the rise/set and twilight times of a day need     */
+	/*       about the Sun, evaluated at 12h local mean solar time.       */
+	/**********************************************************************/
+{
+	return dayState( days_since_2000_Jan_0(year,month,day), lon );
+}
+
+ofxSolarDayState ofxSolar::dayState( long daynum, double lon )
+	/**********************************************************************/
+	/* Same as above for daynum = days_since_2000_Jan_0(year,month,day)   */
+	/**********************************************************************/
+{
+	ofxSolarDayState state;
+	double sdec,    /* Sun's declination */
+		sidtime;    /* Local sidereal time */
 
 	/* Compute d of 12h local mean solar time */
-	d = days_since_2000_Jan_0(year,month,day) + 0.5 - lon/360.0;
+	state.d = daynum + 0.5 - lon/360.0;
 
-	/* Compute obliquity of ecliptic (inclination of Earth's axis) */
-	obl_ecl = 23.4393 - 3.563E-7 * d;
+	/* Compute the local sidereal time of this moment */
+	sidtime = revolution( GMST0(state.d) + 180.0 + lon );
 
-	/* Compute Sun's ecliptic longitude and distance */
-	sunpos( d, &slon, &sr );
+	/* Compute Sun's RA, Decl and distance at this moment */
+	sun_RA_dec( state.d, &state.sRA, &sdec, &state.sr );
+	state.sin_sdec = sind(sdec);
+	state.cos_sdec = cosd(sdec);
+
+	/* Compute time when Sun is at south - in hours UT */
+	state.tsouth = 12.0 - rev180(sidtime - state.sRA)/15.0;
 
-	/* Compute sine and cosine of Sun's declination */
-	sin_sdecl = sind(obl_ecl) * sind(slon);
-	cos_sdecl = sqrt( 1.0 - sin_sdecl * sin_sdecl );
+	return state;
+}
+
+int ofxSolar::diurnalArc( const ofxSolarDayState &state, double lat, double altit, int upper_limb, double *t )
+	/**********************************************************************/
+	/* Computes half the diurnal arc, in hours, that the Sun traverses    */
+	/* above the altitude altit. Same arguments and return value as       */
+	/* sunriset(), rise and set are state.tsouth -/+ *t and the day       */
+	/* length is 2 * *t.                                                  */
+	/**********************************************************************/
+{
+	double sradius; /* Sun's apparent radius */
+	double cost;
+	int rc = 0;
 
-	/* Compute the Sun's apparent radius, degrees */
-	sradius = 0.2666 / sr;
+	/* Compute the Sun's apparent radius in degrees */
+	sradius = 0.2666 / state.sr;
 
 	/* Do correction to upper limb, if necessary */
 	if ( upper_limb )
@@ -307,18 +584,156 @@ double ofxSolar::dayLength( int year, int month, int day, double lon, double lat
 
 	/* Compute the diurnal arc that the Sun traverses to reach */
 	/* the specified altitude altit: */
-	{
-		double cost;
-		cost = ( sind(altit) - sind(lat) * sin_sdecl ) /
-			( cosd(lat) * cos_sdecl );
+	cost = ( sind(altit) - sind(lat) * state.sin_sdec ) /
+		( cosd(lat) * state.cos_sdec );
+	if ( cost >= 1.0 )
+		rc = -1, *t = 0.0;       /* Sun always below altit */
+	else if ( cost <= -1.0 )
+		rc = +1, *t = 12.0;      /* Sun always above altit */
+	else
+		*t = acosd(cost)/15.0;   /* The diurnal arc, hours */
+
+	return rc;
+}
+
+void ofxSolar::dayEvents( const ofxSolarDayState &state, double lat, double tz, ofxSolarDay *events )
+	/**********************************************************************/
+	/* Fills in the rise/set and twilight times and day lengths for the   */
+	/* day of state, times are UT + tz. The date is left untouched.       */
+	/**********************************************************************/
+{
+	double t;
+
+	events->rs   = diurnalArc( state, lat, -35.0/60.0, 1, &t ); //sunrise and sunset
+	events->rise = state.tsouth - t + tz;
+	events->set  = state.tsouth + t + tz;
+	events->dayleng = 2.0 * t;
+
+	events->civ  = diurnalArc( state, lat, -6.0, 0, &t ); //civil twilight
+	events->civ_start = state.tsouth - t + tz;
+	events->civ_end   = state.tsouth + t + tz;
+	events->civlen = 2.0 * t;
+
+	events->naut = diurnalArc( state, lat, -12.0, 0, &t ); //nautical twilight
+	events->naut_start = state.tsouth - t + tz;
+	events->naut_end   = state.tsouth + t + tz;
+	events->nautlen = 2.0 * t;
+
+	events->astr = diurnalArc( state, lat, -18.0, 0, &t ); //astronomical twilight
+	events->astr_start = state.tsouth - t + tz;
+	events->astr_end   = state.tsouth + t + tz;
+	events->astrlen = 2.0 * t;
+}
+
+ofxSolarDay ofxSolar::dayEvents( int year, int month, int day, double lat, double lon, double tz,
+	ofxSolarPrecision precision )
+	/**********************************************************************/
+	/* All events of a date at a location, times are UT + tz. Only uses   */
+	/* its arguments, so it can be called from any thread.                */
+	/**********************************************************************/
+{
+	OFXSOLAR_PROBE( OFXSOLAR_METRIC_DAY_EVENTS );
+	ofxSolarDay events;
+
+	events.year = year;
+	events.month = month;
+	events.day = day;
+	if ( precision == OFXSOLAR_PRECISION_FAST )
+		dayEventsFast( days_since_2000_Jan_0(year,month,day), lat, lon, tz, &events );
+	else if ( precision == OFXSOLAR_PRECISION_ACCURATE )
+		dayEventsAccurate( days_since_2000_Jan_0(year,month,day), lat, lon, tz, &events );
+	else
+		dayEvents( dayState( year, month, day, lon ), lat, tz, &events );
+
+	return events;
+}
+
+
+/* The Sun's place in the local sky at any instant */
+
+ofxSolarPosition ofxSolar::sunPosition( int year, int month, int day, double hoursUT, double lat, double lon )
+{
+	return sunPosition( days_since_2000_Jan_0(year,month,day) + hoursUT/24.0, lat, lon );
+}
+
+ofxSolarPosition ofxSolar::sunPosition( double d, double lat, double lon )
+	/**********************************************************************/
+	/* Note: d = days since 2000 Jan 0.0 UT, including the time of day    */
+	/*       Eastern longitude positive, Western longitude negative       */
+	/*       Northern latitude positive, Southern latitude negative       */
+	/**********************************************************************/
+{
+	ofxSolarPosition pos;
+	double  sr,     /* Solar distance, astronomical units */
+		sRA,        /* Sun's Right Ascension */
+		sdec,       /* Sun's declination */
+		sidtime,    /* Local sidereal time */
+		ut,         /* Time of day, hours UT */
+		sin_alt;
+
+	ut = ( d - floor(d) ) * 24.0;
+
+	/* Compute the local sidereal time of this moment, GMST = GMST0 + UT */
+	sidtime = revolution( GMST0(d) + ut * 15.0 + lon );
+
+	/* Compute Sun's RA, Decl and distance at this moment */
+	sun_RA_dec( d, &sRA, &sdec, &sr );
+
+	pos.hourAngle = rev180( sidtime - sRA );
+
+	/* Convert hour angle and declination to altitude and azimuth */
+	sin_alt = sind(lat) * sind(sdec) + cosd(lat) * cosd(sdec) * cosd(pos.hourAngle);
+	pos.elevation = asind( sin_alt < -1.0 ? -1.0 : ( sin_alt > 1.0 ? 1.0 : sin_alt ) );
+	pos.azimuth = revolution( atan2d( -cosd(sdec) * sind(pos.hourAngle),
+		cosd(lat) * sind(sdec) - sind(lat) * cosd(sdec) * cosd(pos.hourAngle) ) );
+
+	return pos;
+}
+
+
+/* Arbitrary altitudes */
+
+void ofxSolar::crossings( const ofxSolarDayState &state, double lat, double tz,
+	const double *altitudes, size_t count, ofxSolarCrossing *out, int upper_limb )
+	/**********************************************************************/
+	/* diurnalArc() for count altitudes. The Sun's radius and the terms   */
+	/* of latitude and declination are computed once, what is left per    */
+	/* altitude is one sine and one arc cosine.                           */
+	/**********************************************************************/
+{
+	double sradius = upper_limb ? 0.2666 / state.sr : 0.0;
+	double a = sind(lat) * state.sin_sdec;
+	double b = cosd(lat) * state.cos_sdec;
+
+	for ( size_t i = 0; i < count; i++ ){
+		double cost = ( sind(altitudes[i] - sradius) - a ) / b;
+		double t;
 		if ( cost >= 1.0 )
-			t = 0.0;                      /* Sun always below altit */
+			out[i].rc = -1, t = 0.0;       /* Sun always below altit */
 		else if ( cost <= -1.0 )
-			t = 24.0;                     /* Sun always above altit */
-		else  t = (2.0/15.0) * acosd(cost); /* The diurnal arc, hours */
+			out[i].rc = +1, t = 12.0;      /* Sun always above altit */
+		else
+			out[i].rc = 0, t = acosd(cost)/15.0;
+		out[i].rise = state.tsouth - t + tz;
+		out[i].set  = state.tsouth + t + tz;
 	}
-	return t;
-}  /* daylen */
+}
+
+vector<ofxSolarCrossing> ofxSolar::crossings( int year, int month, int day, double lat, double lon, double tz,
+	const vector<double> &altitudes, int upper_limb )
+{
+	vector<ofxSolarCrossing> out( altitudes.size() );
+	crossings( dayState( year, month, day, lon ), lat, tz, altitudes.data(), altitudes.size(), out.data(), upper_limb );
+	return out;
+}
+
+double ofxSolar::elevation( const ofxSolarDayState &state, double lat, double tz, double hours )
+{
+	/* Hour angle from the time when the Sun is at south */
+	double ha = 15.0 * ( hours - tz - state.tsouth );
+	double sin_alt = sind(lat) * state.sin_sdec + cosd(lat) * state.cos_sdec * cosd(ha);
+	return asind( sin_alt < -1.0 ? -1.0 : ( sin_alt > 1.0 ? 1.0 : sin_alt ) );
+}
 
 
 /* This function computes the Sun's position at any instant */
@@ -331,6 +746,7 @@ void ofxSolar::sunpos( double d, double *lon, double *r )
 	/* computed, since it's always very near 0.           */
 	/******************************************************/
 {
+	OFXSOLAR_PROBE( OFXSOLAR_METRIC_SUNPOS );
 	double M,         /* Mean anomaly of the Sun */
 		w,         /* Mean longitude of perihelion */
 		/* Note: Sun's mean longitude = M + w */
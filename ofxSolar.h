@@ -19,11 +19,20 @@ Adapted from C to C++ for use in openframeworks by Dominic Amato 2014
 
 */
 
+#pragma once
 
 #include "ofMain.h"
 
+/* Gregorian calendar. The century term keeps 1800 and 1900 out of the */
+/* leap years, without it dates before 1900 March 1 were a day late    */
+
 #define days_since_2000_Jan_0(y,m,d) \
-	(367L*(y)-((7*((y)+(((m)+9)/12)))/4)+((275*(m))/9)+(d)-730530L)
+	(367L*(y)-((7*((y)+(((m)+9)/12)))/4)-((3*(((y)+((m)-9)/7)/100+1))/4)+((275*(m))/9)+(d)-730515L)
+
+/* Lengths of the texts of ofxSolar::formatTime() and formatIso() */
+
+#define OFXSOLAR_TIME_LENGTH  8   /* "HH:MM:SS" */
+#define OFXSOLAR_ISO_LENGTH  25   /* "YYYY-MM-DDTHH:MM:SS+HH:MM" */
 
 /* Some conversion factors between radians and degrees */
 
@@ -125,11 +134,73 @@ Adapted from C to C++ for use in openframeworks by Dominic Amato 2014
 #define atan2d(y,x) (RADEG*atan2(y,x))
 #define round(x)  floor(x + 0.5)
 
+/* The Sun at local noon of one date and longitude, shared by all rise/set */
+/* and twilight computations of that day                                   */
+
+struct ofxSolarDayState{
+	double d;         /* Days since 2000 Jan 0.0 at 12h local mean solar time */
+	double sRA;       /* Sun's Right Ascension, degrees */
+	double sin_sdec;  /* Sine of Sun's declination */
+	double cos_sdec;  /* Cosine of Sun's declination */
+	double sr;        /* Solar distance, astronomical units */
+	double tsouth;    /* Time when Sun is at south, hours UT */
+};
+
+/* All rise/set and twilight events of one day, as returned by */
+/* ofxSolar::calendar()                                        */
+
+struct ofxSolarDay{
+	int year, month, day;
+	double rise, set, civ_start, civ_end, naut_start, naut_end,
+		astr_start, astr_end;                   /* Hours, local time */
+	double dayleng, civlen, nautlen, astrlen;   /* Hours */
+	int    rs, civ, naut, astr;                 /* Return codes of sunriset() */
+};
+
+/* Accuracy tiers of ofxSolar::dayEvents(), see ofxSolarPrecision.cpp for */
+/* the measured errors and speeds                                          */
+
+enum ofxSolarPrecision{
+	OFXSOLAR_PRECISION_FAST,       /* Single precision, approximated trig, bulk use */
+	OFXSOLAR_PRECISION_DEFAULT,    /* sunriset(), the ephemeris at local noon */
+	OFXSOLAR_PRECISION_ACCURATE    /* Ephemeris re-evaluated at each event until it converges */
+};
+
+/* Where the Sun is in the sky at one instant, geometric (no refraction) */
+
+struct ofxSolarPosition{
+	double elevation;   /* Degrees above the horizon */
+	double azimuth;     /* Degrees from north, clockwise (east = 90) */
+	double hourAngle;   /* Degrees west of the meridian, -180..+180 */
+};
+
+/* The Sun passing one altitude on one day, as returned by */
+/* ofxSolar::crossings()                                   */
+
+struct ofxSolarCrossing{
+	double rise, set;   /* Hours, UT + tz, rising and setting through the altitude */
+	int    rc;          /* As sunriset(): 0, -1 always below, +1 always above */
+};
+
+class ofxSolarArena;
+class ofxSolarCache;
+class ofxSolarTimeZone;
+template<typename T> class ofxSolarSpan;
+struct ofxSolarLocation;
+
 class ofxSolar{
 
 public:
 	
-	void init(double,double,int);
+	ofxSolar();
+	ofxSolar( const ofxSolar &other );
+	ofxSolar & operator=( const ofxSolar &other );
+
+	void init(double,double,double);
+
+	/* A place of ofxSolarLocations and its timezone */
+	void init(const ofxSolarLocation &location);
+
 	void update();
 	double dayLength();
 	double civilTwilightDayLength();
@@ -144,34 +215,153 @@ public:
 	double nauticalTwilightEnd();
 	double astronomicalTwilightEnd();
 	void setDaylightSaving(int);
-	string decimalday_to_timestamp(double);
+	static string decimalday_to_timestamp(double);
+
+	/* Allocation free formatting in the style of std::to_chars: the text */
+	/* goes to [first, last) without a terminating zero, the return value */
+	/* points past it, NULL if it didn't fit. Hours are rounded to the    */
+	/* second and wrapped into 00:00:00..23:59:59                         */
+
+	static char * formatTime( char *first, char *last, double hours );
+
+	/* "2014-06-21T04:43:07+02:00", hours local time at tz hours from UT, */
+	/* values outside 0..24 move the date                                 */
+	static char * formatIso( char *first, char *last, int year, int month, int day, double hours, double tz );
+
+	/* count times, each followed by separator, for tables and logs */
+	static char * formatTimes( char *first, char *last, const double *hours, size_t count, char separator );
 	void printInfo();
 
-private:
+	/* The current day's results. Immutable, the pointer stays valid and */
+	/* consistent while other threads call update()                      */
+	shared_ptr<const ofxSolarDay> getSnapshot();
 
-	void calculateSunMap();
+	/* update() only recomputes when the local date, the location, the   */
+	/* timezone or daylight saving changed, otherwise it costs one time() */
+	/* call. isNewDay() tells whether the last update() computed a new    */
+	/* day, like ofVideoGrabber::isFrameNew()                             */
+	bool isNewDay();
 
-	double dayLength( int year, int month, int day, double lon, double lat, double altit, int upper_limb );
+	/* Called on the computing thread whenever a new day was computed, */
+	/* set it before sharing the instance between threads              */
+	void setDayChangedCallback( function<void( const ofxSolarDay & )> callback );
 
-	int sunriset( int year, int month, int day, double lon, double lat, double altit, int upper_limb, double *rise, double *set );
+	/* Computes the default precision day through a shared cache, see */
+	/* ofxSolarCache.h, NULL to compute directly                      */
+	void setCache( shared_ptr<ofxSolarCache> cache );
 
-	void sunpos( double d, double *lon, double *r );
+	/* Local times and dates from a tz database zone (ofxSolarTimeZone.h), */
+	/* with daylight saving at each event's instant, instead of the       */
+	/* timezone of init() and setDaylightSaving(). init() clears it       */
+	bool setTimeZone( const string &name );
+	void setTimeZone( shared_ptr<const ofxSolarTimeZone> zone );
+	shared_ptr<const ofxSolarTimeZone> getTimeZone();
 
-	void sun_RA_dec( double d, double *RA, double *dec, double *r );
+	/* Counts of update() calls that recomputed and that didn't */
+	uint64_t getRecomputeCount();
+	uint64_t getCacheHitCount();
 
-	double revolution( double x );
+	/* Events of every day from the start to the end date, inclusive */
+	vector<ofxSolarDay> calendar( int startYear, int startMonth, int startDay,
+		int endYear, int endMonth, int endDay );
 
-	double rev180( double x );
+	static vector<ofxSolarDay> calendar( int startYear, int startMonth, int startDay,
+		int endYear, int endMonth, int endDay, double lat, double lon, double tz, int threads = 0,
+		ofxSolarPrecision precision = OFXSOLAR_PRECISION_DEFAULT );
 
-	double GMST0( double d );
+	/* The same into an ofxSolarArena (ofxSolarArena.h), valid until its */
+	/* reset()                                                           */
+	static ofxSolarSpan<ofxSolarDay> calendar( ofxSolarArena &arena, int startYear, int startMonth, int startDay,
+		int endYear, int endMonth, int endDay, double lat, double lon, double tz, int threads = 0,
+		ofxSolarPrecision precision = OFXSOLAR_PRECISION_DEFAULT );
 
-	int year,month,day;
-	double lon, lat;
-	double dayleng, civlen, nautlen, astrlen;
-	double rise, set, civ_start, civ_end, naut_start, naut_end,
-		astr_start, astr_end;
-	int    rs, civ, naut, astr, dls, tz;
+	/* Events of one date at count sites, into an ofxSolarArena */
+	static ofxSolarSpan<ofxSolarDay> dayEvents( ofxSolarArena &arena, int year, int month, int day,
+		const double *lat, const double *lon, const double *tz, size_t count,
+		ofxSolarPrecision precision = OFXSOLAR_PRECISION_DEFAULT );
+
+	/* Used by update() and the instance calendar(), resets the day like init() */
+	void setPrecision( ofxSolarPrecision precision );
+	ofxSolarPrecision getPrecision();
+
+	/* Ephemeris helpers, they don't use any instance state and are safe */
+	/* to call from any thread                                          */
+
+	static void sunpos( double d, double *lon, double *r );
+
+	static void sun_RA_dec( double d, double *RA, double *dec, double *r );
+
+	static double revolution( double x );
+
+	static double rev180( double x );
+
+	static double GMST0( double d );
+
+	static ofxSolarDayState dayState( int year, int month, int day, double lon );
+
+	static ofxSolarDayState dayState( long daynum, double lon );
+
+	static int diurnalArc( const ofxSolarDayState &state, double lat, double altit, int upper_limb, double *t );
+
+	static void dayEvents( const ofxSolarDayState &state, double lat, double tz, ofxSolarDay *events );
+
+	static ofxSolarDay dayEvents( int year, int month, int day, double lat, double lon, double tz,
+		ofxSolarPrecision precision = OFXSOLAR_PRECISION_DEFAULT );
+
+	static void nextDay( int *year, int *month, int *day );
+
+	static ofxSolarPosition sunPosition( double d, double lat, double lon );
+
+	static ofxSolarPosition sunPosition( int year, int month, int day, double hoursUT, double lat, double lon );
+
+	/* Rise and set through each of count altitudes in degrees, e.g. +6   */
+	/* for golden hour or -4 for blue hour, from one dayState(). Same     */
+	/* results as diurnalArc() per altitude, with the latitude and        */
+	/* declination terms shared. upper_limb as in sunriset(). 16         */
+	/* altitudes take 36 ns each, sunriset() per altitude 300 ns         */
+	/* (BM_crossings of example-benchmark)                                */
+	static void crossings( const ofxSolarDayState &state, double lat, double tz,
+		const double *altitudes, size_t count, ofxSolarCrossing *out, int upper_limb = 0 );
+
+	static vector<ofxSolarCrossing> crossings( int year, int month, int day, double lat, double lon, double tz,
+		const vector<double> &altitudes, int upper_limb = 0 );
+
+	/* The inverse of crossings(): the altitude of the Sun's centre in    */
+	/* degrees at hours UT + tz, with the declination of the day held     */
+	/* constant, so elevation( state, lat, tz, c.rise ) gives the         */
+	/* altitude back. sunPosition() is the exact position at an instant. */
+	static double elevation( const ofxSolarDayState &state, double lat, double tz, double hours );
+
+private:
+
+	void calculateSunMap();
+
+	double dayLength( int year, int month, int day, double lon, double lat, double altit, int upper_limb );
+
+	int sunriset( int year, int month, int day, double lon, double lat, double altit, int upper_limb, double *rise, double *set );
 
-	bool sunMapped;
+	static void calendar( ofxSolarDay *days, size_t count, int startYear, int startMonth, int startDay,
+		double lat, double lon, double tz, int threads, ofxSolarPrecision precision );
+
+	static void dayEventsFast( long daynum, double lat, double lon, double tz, ofxSolarDay *events );
+	static void dayEventsAccurate( long daynum, double lat, double lon, double tz, ofxSolarDay *events );
+
+	double lon, lat, tz;
+	int    dls;
+	ofxSolarPrecision precision;
+
+	/* Published as a whole, one atomic load gives update() the day and */
+	/* the window it holds for                                          */
+	struct Snapshot{
+		ofxSolarDay day;                    /* Local times, tz+dls applied */
+		int64_t validFrom, validUntil;      /* Local midnights around the day's date, time_t */
+	};
+	shared_ptr<const Snapshot> sunMap;
+
+	atomic<uint64_t> recomputes, hits;
+	atomic<bool> newDay;
+	function<void( const ofxSolarDay & )> dayChanged;
+	shared_ptr<ofxSolarCache> cache;
+	shared_ptr<const ofxSolarTimeZone> zone;
 
 };
\ No newline at end of file
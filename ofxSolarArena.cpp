@@ -0,0 +1,113 @@
+#include "ofxSolarArena.h"
+#include "ofxSolarBatch.h"
+
+ofxSolarArena::ofxSolarArena( size_t blockSize ){
+	this->blockSize = max( blockSize, (size_t)4096 );
+	current = offset = used = 0;
+}
+
+void * ofxSolarArena::allocate( size_t bytes, size_t alignment ){
+	for ( ;; ){
+		if ( current < blocks.size() ){
+			Block &block = blocks[current];
+			uintptr_t base = (uintptr_t)block.data.get();
+			size_t start = ( ( base + offset + alignment - 1 ) & ~(uintptr_t)( alignment - 1 ) ) - base;
+			if ( start + bytes <= block.size ){
+				offset = start + bytes;
+				used += bytes;
+				return block.data.get() + start;
+			}
+			/* On to the next block kept from before a reset() */
+			if ( current + 1 < blocks.size() && blocks[current + 1].size >= bytes + alignment ){
+				current++;
+				offset = 0;
+				continue;
+			}
+		}
+
+		/* A new block after the current one, large requests get their own size */
+		Block block;
+		block.size = max( blockSize, bytes + alignment );
+		block.data.reset( new (nothrow) char[block.size] );
+		if ( !block.data ){
+			ofLogError("ofxSolarArena") << "couldn't allocate " << block.size << " bytes";
+			return NULL;
+		}
+		size_t at = current < blocks.size() ? current + 1 : blocks.size();
+		blocks.insert( blocks.begin() + at, move( block ) );
+		current = at;
+		offset = 0;
+	}
+}
+
+void ofxSolarArena::reset(){
+	current = offset = used = 0;
+}
+
+void ofxSolarArena::clear(){
+	blocks.clear();
+	reset();
+}
+
+size_t ofxSolarArena::getUsed() const{
+	return used;
+}
+
+size_t ofxSolarArena::getCapacity() const{
+	size_t capacity = 0;
+	for ( size_t i = 0; i < blocks.size(); i++ )
+		capacity += blocks[i].size;
+	return capacity;
+}
+
+size_t ofxSolarArena::getBlockCount() const{
+	return blocks.size();
+}
+
+
+/* Results into an arena */
+
+ofxSolarSpan<ofxSolarDay> ofxSolar::calendar( ofxSolarArena &arena, int startYear, int startMonth, int startDay,
+	int endYear, int endMonth, int endDay, double lat, double lon, double tz, int threads,
+	ofxSolarPrecision precision ){
+	long first = days_since_2000_Jan_0(startYear,startMonth,startDay);
+	long last = days_since_2000_Jan_0(endYear,endMonth,endDay);
+	if ( last < first )
+		return ofxSolarSpan<ofxSolarDay>();
+
+	ofxSolarSpan<ofxSolarDay> days = arena.allocate<ofxSolarDay>( last - first + 1 );
+	if ( !days.data() )
+		return ofxSolarSpan<ofxSolarDay>();
+	calendar( days.data(), days.size(), startYear, startMonth, startDay, lat, lon, tz, threads, precision );
+	return days;
+}
+
+ofxSolarSpan<ofxSolarDay> ofxSolar::dayEvents( ofxSolarArena &arena, int year, int month, int day,
+	const double *lat, const double *lon, const double *tz, size_t count, ofxSolarPrecision precision ){
+	ofxSolarSpan<ofxSolarDay> days = arena.allocate<ofxSolarDay>( count );
+	if ( !days.data() )
+		return ofxSolarSpan<ofxSolarDay>();
+	for ( size_t i = 0; i < count; i++ )
+		days[i] = dayEvents( year, month, day, lat[i], lon[i], tz[i], precision );
+	return days;
+}
+
+ofxSolarBatchOutput ofxSolarBatch::allocate( ofxSolarArena &arena, size_t count ){
+	/* One allocation for the twelve arrays of doubles and four of ints */
+	double *d = arena.allocate<double>( 12 * count + ( 4 * count * sizeof(int) + sizeof(double) - 1 ) / sizeof(double) ).data();
+	ofxSolarBatchOutput out;
+	memset( &out, 0, sizeof(out) );
+	if ( !d )
+		return out;
+
+	double **arrays[12] = { &out.rise, &out.set, &out.civ_start, &out.civ_end, &out.naut_start, &out.naut_end,
+		&out.astr_start, &out.astr_end, &out.dayleng, &out.civlen, &out.nautlen, &out.astrlen };
+	for ( int i = 0; i < 12; i++ )
+		*arrays[i] = d + i * count;
+	int *n = (int *)( d + 12 * count );
+	out.rs = n;
+	out.civ = n + count;
+	out.naut = n + 2 * count;
+	out.astr = n + 3 * count;
+	return out;
+}
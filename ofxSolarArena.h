@@ -0,0 +1,120 @@
+/*
+
+ofxSolarArena - bump allocator for the results of one request
+
+Results are carved out of large blocks one after another and handed out
+as ofxSolarSpan views, pointer and count, instead of vectors of their
+own. reset() releases everything at once by rewinding to the first
+block, in constant time; the blocks are kept, so after the first few
+requests a service that resets its arena per request stops allocating
+altogether.
+
+	ofxSolarArena arena;
+	for ( each request ){
+		ofxSolarSpan<ofxSolarDay> days = ofxSolar::calendar( arena, 2026, 1, 1,
+			2026, 12, 31, lat, lon, tz );
+		ofxSolarBatchOutput out = ofxSolarBatch::allocate( arena, sites );
+		...
+		arena.reset();
+	}
+
+Only trivially destructible types can live in an arena, nothing is
+destroyed on reset(). Spans are valid until the next reset(). An arena is
+not thread safe, use one per request or per thread; functions taking one
+allocate before they start their worker threads.
+
+BM_request_* of example-benchmark, a simulated request of 64 sites with
+a month's calendar, the events of one date and batch outputs, as
+ofxSolar instances and vectors and as spans of an arena reset per
+request, GCC -O2, one core of a virtualized x86-64 Xeon:
+
+	                        heap        arena
+	allocations             86          0
+	allocated bytes         278 kB      0
+	time per request        1.17 ms     0.88 ms
+
+The resident set size is the same for both there, glibc hands the freed
+vectors straight back to the next request; the arena's gain shows as
+fewer allocator calls and no fragmentation under long mixed workloads.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+#include <type_traits>
+
+/* A view of count consecutive T, like std::span */
+
+template<typename T>
+class ofxSolarSpan{
+
+public:
+
+	ofxSolarSpan() : first( NULL ), count( 0 ){}
+	ofxSolarSpan( T *first, size_t count ) : first( first ), count( count ){}
+
+	T * data() const{ return first; }
+	size_t size() const{ return count; }
+	bool empty() const{ return count == 0; }
+
+	T * begin() const{ return first; }
+	T * end() const{ return first + count; }
+
+	T & operator[]( size_t i ) const{ return first[i]; }
+	T & front() const{ return first[0]; }
+	T & back() const{ return first[count - 1]; }
+
+	ofxSolarSpan subspan( size_t offset, size_t length ) const{
+		return ofxSolarSpan( first + offset, min( length, count - offset ) );
+	}
+
+private:
+
+	T *first;
+	size_t count;
+
+};
+
+class ofxSolarArena{
+
+public:
+
+	explicit ofxSolarArena( size_t blockSize = 1 << 20 );
+	ofxSolarArena( const ofxSolarArena & ) = delete;
+	ofxSolarArena & operator=( const ofxSolarArena & ) = delete;
+
+	/* Uninitialized memory, NULL only if the system is out of memory */
+	void * allocate( size_t bytes, size_t alignment = alignof(double) );
+
+	template<typename T>
+	ofxSolarSpan<T> allocate( size_t count ){
+		static_assert( is_trivially_destructible<T>::value, "ofxSolarArena doesn't run destructors" );
+		return ofxSolarSpan<T>( (T *)allocate( count * sizeof(T), alignof(T) ), count );
+	}
+
+	/* Releases every allocation, keeps the blocks for the next ones */
+	void reset();
+
+	/* Releases every allocation and frees the blocks */
+	void clear();
+
+	size_t getUsed() const;         /* Bytes allocated since the last reset() */
+	size_t getCapacity() const;     /* Bytes of all blocks */
+	size_t getBlockCount() const;
+
+private:
+
+	struct Block{
+		unique_ptr<char[]> data;
+		size_t size;
+	};
+
+	vector<Block> blocks;
+	size_t blockSize;
+	size_t current;     /* Block being filled */
+	size_t offset;      /* Into it */
+	size_t used;
+
+};
@@ -0,0 +1,259 @@
+#include "ofxSolarBatch.h"
+#include "ofxSolarLocations.h"
+#include "ofxSolarTimeZone.h"
+
+void ofxSolarBatch::setup(const double *latitudes, const double *longitudes, const double *timezones, size_t count){
+	lat.assign(latitudes, latitudes+count);
+	lon.assign(longitudes, longitudes+count);
+	tz.assign(timezones, timezones+count);
+	zones.clear();
+
+	rise.resize(count); set.resize(count);
+	civ_start.resize(count); civ_end.resize(count);
+	naut_start.resize(count); naut_end.resize(count);
+	astr_start.resize(count); astr_end.resize(count);
+	dayleng.resize(count); civlen.resize(count);
+	nautlen.resize(count); astrlen.resize(count);
+}
+void ofxSolarBatch::setup(const ofxSolarLocations &locations){
+	setup(locations.getLatitudes(), locations.getLongitudes(), locations.getTimezones(), locations.size());
+}
+void ofxSolarBatch::setTimeZones(const vector<shared_ptr<const ofxSolarTimeZone> > &zones){
+	this->zones = zones;
+	this->zones.resize(lat.size());
+	tzUsed = tz;
+	for (size_t i = 0; i < tzUsed.size(); i++)
+		if (this->zones[i])
+			tzUsed[i] = 0.0;
+}
+void ofxSolarBatch::update(){
+	update(ofGetYear(), ofGetMonth(), ofGetDay());
+}
+void ofxSolarBatch::update(int year, int month, int day){
+	ofxSolarBatchOutput out = {
+		rise.data(), set.data(),
+		civ_start.data(), civ_end.data(),
+		naut_start.data(), naut_end.data(),
+		astr_start.data(), astr_end.data(),
+		dayleng.data(), civlen.data(), nautlen.data(), astrlen.data(),
+		NULL, NULL, NULL, NULL
+	};
+	if (zones.empty()){
+		calculate(year, month, day, lat.size(), lat.data(), lon.data(), tz.data(), out);
+		return;
+	}
+
+	/* Zone sites are computed in UT and localized event by event */
+	calculate(year, month, day, lat.size(), lat.data(), lon.data(), tzUsed.data(), out);
+	for (size_t i = 0; i < zones.size(); i++){
+		if (!zones[i])
+			continue;
+		double hours[8] = { rise[i], set[i], civ_start[i], civ_end[i],
+			naut_start[i], naut_end[i], astr_start[i], astr_end[i] };
+		zones[i]->localize(year, month, day, hours, 8);
+		rise[i] = hours[0]; set[i] = hours[1];
+		civ_start[i] = hours[2]; civ_end[i] = hours[3];
+		naut_start[i] = hours[4]; naut_end[i] = hours[5];
+		astr_start[i] = hours[6]; astr_end[i] = hours[7];
+	}
+}
+size_t ofxSolarBatch::size() const{
+	return lat.size();
+}
+const vector<double> & ofxSolarBatch::sunrise() const{
+	return rise;
+}
+const vector<double> & ofxSolarBatch::sunset() const{
+	return set;
+}
+const vector<double> & ofxSolarBatch::civilTwilightStart() const{
+	return civ_start;
+}
+const vector<double> & ofxSolarBatch::civilTwilightEnd() const{
+	return civ_end;
+}
+const vector<double> & ofxSolarBatch::nauticalTwilightStart() const{
+	return naut_start;
+}
+const vector<double> & ofxSolarBatch::nauticalTwilightEnd() const{
+	return naut_end;
+}
+const vector<double> & ofxSolarBatch::astronomicalTwilightStart() const{
+	return astr_start;
+}
+const vector<double> & ofxSolarBatch::astronomicalTwilightEnd() const{
+	return astr_end;
+}
+const vector<double> & ofxSolarBatch::dayLength() const{
+	return dayleng;
+}
+const vector<double> & ofxSolarBatch::civilTwilightDayLength() const{
+	return civlen;
+}
+const vector<double> & ofxSolarBatch::nauticalTwilightDayLength() const{
+	return nautlen;
+}
+const vector<double> & ofxSolarBatch::astronomicalTwilightDayLength() const{
+	return astrlen;
+}
+
+
+void ofxSolarBatch::calculate( int year, int month, int day, size_t count,
+	const double *lat, const double *lon, const double *tz, const ofxSolarBatchOutput &out )
+	/**********************************************************************/
+	/* Same conventions as ofxSolar::sunriset() and ofxSolar::dayLength() */
+	/* lat, lon and tz are arrays of count elements, tz in hours east of  */
+	/* UT. The Sun's position is evaluated at 0h, 12h and 24h UT of the   */
+	/* date and interpolated to the local noon of each site.              */
+	/**********************************************************************/
+{
+	if ( count == 0 )
+		return;
+
+	Noon &n = noon( year, month, day, count, lat, lon );
+	double *t = n.t.data();
+
+	diurnalArc( count, -35.0/60.0, 1, n.sin_lat.data(), n.cos_lat.data(), n.sin_dec.data(), n.cos_dec.data(),
+		n.sradius.data(), t, out.rs );
+	storeEvents( count, n.tsouth.data(), tz, t, out.rise, out.set, out.dayleng );
+
+	diurnalArc( count, -6.0, 0, n.sin_lat.data(), n.cos_lat.data(), n.sin_dec.data(), n.cos_dec.data(),
+		n.sradius.data(), t, out.civ );
+	storeEvents( count, n.tsouth.data(), tz, t, out.civ_start, out.civ_end, out.civlen );
+
+	diurnalArc( count, -12.0, 0, n.sin_lat.data(), n.cos_lat.data(), n.sin_dec.data(), n.cos_dec.data(),
+		n.sradius.data(), t, out.naut );
+	storeEvents( count, n.tsouth.data(), tz, t, out.naut_start, out.naut_end, out.nautlen );
+
+	diurnalArc( count, -18.0, 0, n.sin_lat.data(), n.cos_lat.data(), n.sin_dec.data(), n.cos_dec.data(),
+		n.sradius.data(), t, out.astr );
+	storeEvents( count, n.tsouth.data(), tz, t, out.astr_start, out.astr_end, out.astrlen );
+}
+
+ofxSolarBatch::Noon & ofxSolarBatch::noon( int year, int month, int day, size_t count, const double *lat, const double *lon )
+	/**********************************************************************/
+	/* The Sun's position is evaluated at 0h, 12h and 24h UT of the date  */
+	/* and interpolated to the local noon of each site.                   */
+	/**********************************************************************/
+{
+	double  d0,         /* Days since 2000 Jan 0.0 at 0h UT */
+		RA[3],          /* Sun's Right Ascension at 0h, 12h and 24h UT */
+		dec[3],         /* Sun's declination at 0h, 12h and 24h UT */
+		sr[3],          /* Solar distance at 0h, 12h and 24h UT */
+		gmst0;          /* GMST0 at 0h UT */
+
+	/* Date-only part, done once for all sites */
+	d0 = days_since_2000_Jan_0(year,month,day);
+	for ( int k = 0; k < 3; k++ ){
+		ofxSolar::sun_RA_dec( d0 + 0.5 * k, &RA[k], &dec[k], &sr[k] );
+		if ( k > 0 )
+			RA[k] = RA[k-1] + ofxSolar::rev180( RA[k] - RA[k-1] );  /* Unwrap across 360 degrees */
+	}
+	gmst0 = ofxSolar::GMST0( d0 );
+
+	/* Kept between calls, so a thread only allocates when count grows */
+	static thread_local Noon scratch;
+	scratch.sin_lat.resize(count);
+	scratch.cos_lat.resize(count);
+	scratch.sin_dec.resize(count);
+	scratch.cos_dec.resize(count);
+	scratch.sradius.resize(count);
+	scratch.tsouth.resize(count);
+	scratch.t.resize(count);
+	scratch.rc.resize(count);
+
+	/* Sun's position at the local noon of each site */
+	for ( size_t i = 0; i < count; i++ ){
+		double f = 0.5 - lon[i]/360.0;  /* Fraction of the day, as d in sunriset() */
+		double w0 = ( 2.0*f - 1.0 ) * ( f - 1.0 ),  /* Quadratic interpolation weights */
+			w1 = 4.0 * f * ( 1.0 - f ),
+			w2 = f * ( 2.0*f - 1.0 );
+		double sRA = w0 * RA[0] + w1 * RA[1] + w2 * RA[2];
+		double sdec = w0 * dec[0] + w1 * dec[1] + w2 * dec[2];
+		double x = gmst0 + ( 0.9856002585 + 4.70935E-5 ) * f + 180.0 + lon[i] - sRA;
+		x -= 360.0 * floor( x * ( 1.0 / 360.0 ) + 0.5 );  /* rev180() */
+		scratch.tsouth[i] = 12.0 - x/15.0;
+		scratch.sradius[i] = 0.2666 / ( w0 * sr[0] + w1 * sr[1] + w2 * sr[2] );
+		scratch.sin_dec[i] = sind(sdec);
+		scratch.cos_dec[i] = cosd(sdec);
+		scratch.sin_lat[i] = sind(lat[i]);
+		scratch.cos_lat[i] = cosd(lat[i]);
+	}
+	return scratch;
+}
+
+void ofxSolarBatch::crossings( int year, int month, int day, size_t count,
+	const double *lat, const double *lon, const double *tz,
+	const double *altitudes, size_t altitudeCount, ofxSolarCrossing *out, int upper_limb )
+{
+	if ( count == 0 || altitudeCount == 0 )
+		return;
+
+	Noon &n = noon( year, month, day, count, lat, lon );
+	double *t = n.t.data();
+	int *rc = n.rc.data();
+
+	/* One altitude at a time over all sites, like the fixed ones of calculate() */
+	for ( size_t a = 0; a < altitudeCount; a++ ){
+		diurnalArc( count, altitudes[a], upper_limb, n.sin_lat.data(), n.cos_lat.data(), n.sin_dec.data(),
+			n.cos_dec.data(), n.sradius.data(), t, rc );
+		for ( size_t i = 0; i < count; i++ ){
+			ofxSolarCrossing &c = out[i * altitudeCount + a];
+			c.rise = n.tsouth[i] - t[i] + tz[i];
+			c.set  = n.tsouth[i] + t[i] + tz[i];
+			c.rc   = rc[i];
+		}
+	}
+}
+
+
+void ofxSolarBatch::diurnalArc( size_t count, double altit, int upper_limb,
+	const double *sin_lat, const double *cos_lat, const double *sin_dec, const double *cos_dec,
+	const double *sradius, double *t, int *rc )
+	/*******************************************************************/
+	/* Half the diurnal arc in hours for every site. cost is clamped   */
+	/* to -1..+1 instead of branching, acos() of the limits gives the  */
+	/* same 0 and 12 hours as the branches in ofxSolar::sunriset().    */
+	/*******************************************************************/
+{
+	if ( upper_limb ){
+		for ( size_t i = 0; i < count; i++ ){
+			double cost = ( sind(altit - sradius[i]) - sin_lat[i] * sin_dec[i] ) /
+				( cos_lat[i] * cos_dec[i] );
+			t[i] = cost < -1.0 ? -1.0 : ( cost > 1.0 ? 1.0 : cost );
+		}
+	}else{
+		double sin_altit = sind(altit);
+		for ( size_t i = 0; i < count; i++ ){
+			double cost = ( sin_altit - sin_lat[i] * sin_dec[i] ) /
+				( cos_lat[i] * cos_dec[i] );
+			t[i] = cost < -1.0 ? -1.0 : ( cost > 1.0 ? 1.0 : cost );
+		}
+	}
+
+	/* Return codes, as in sunriset(): -1 always below, +1 always above */
+	if ( rc ){
+		for ( size_t i = 0; i < count; i++ )
+			rc[i] = ( t[i] <= -1.0 ) - ( t[i] >= 1.0 );
+	}
+
+	for ( size_t i = 0; i < count; i++ )
+		t[i] = acosd(t[i])/15.0;
+}
+
+void ofxSolarBatch::storeEvents( size_t count, const double *tsouth, const double *tz, const double *t,
+	double *rise, double *set, double *len )
+{
+	if ( rise ){
+		for ( size_t i = 0; i < count; i++ )
+			rise[i] = tsouth[i] - t[i] + tz[i];
+	}
+	if ( set ){
+		for ( size_t i = 0; i < count; i++ )
+			set[i] = tsouth[i] + t[i] + tz[i];
+	}
+	if ( len ){
+		for ( size_t i = 0; i < count; i++ )
+			len[i] = 2.0 * t[i];
+	}
+}
@@ -0,0 +1,131 @@
+/*
+
+ofxSolarBatch - sun rise/set and twilight times for many sites at once
+
+The solar ephemeris only depends on the date, so it is evaluated three times
+per day (0h, 12h and 24h UT, which brackets the local noon of every site) and
+quadratically interpolated to each site's local noon, within 0.1 seconds of
+the per-site computation. Everything that depends on the site is kept in
+plain arrays (structure of arrays) and computed in tight loops that the
+compiler can vectorize.
+
+The array sunpos() and sun_RA_dec(), a million day numbers, BM_batch_* of
+example-benchmark, GCC -O2, one core of a virtualized x86-64 Xeon:
+
+	              sunpos     sun_RA_dec
+	scalar        92 ns      199 ns
+	SSE2          47 ns       95 ns
+	AVX2          13 ns       33 ns
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+/* Output arrays of ofxSolarBatch::calculate(), one element per site.   */
+/* Times are local hours (UT + timezone), lengths are hours. Any of the */
+/* pointers may be NULL, in which case that output is not computed.     */
+
+struct ofxSolarBatchOutput{
+	double *rise, *set;
+	double *civ_start, *civ_end;
+	double *naut_start, *naut_end;
+	double *astr_start, *astr_end;
+	double *dayleng, *civlen, *nautlen, *astrlen;
+	int    *rs, *civ, *naut, *astr;
+};
+
+/* Instruction sets for the array versions of sunpos() and sun_RA_dec() */
+
+enum ofxSolarSimd{
+	OFXSOLAR_SIMD_SCALAR,
+	OFXSOLAR_SIMD_SSE2,
+	OFXSOLAR_SIMD_AVX2
+};
+
+class ofxSolarArena;
+class ofxSolarLocations;
+class ofxSolarTimeZone;
+
+class ofxSolarBatch{
+
+public:
+
+	void setup(const double *latitudes, const double *longitudes, const double *timezones, size_t count);
+	void setup(const ofxSolarLocations &locations);
+
+	/* One zone per site, update() then gives each event the site's offset */
+	/* at its instant; sites without a zone (NULL) keep their timezone     */
+	void setTimeZones(const vector<shared_ptr<const ofxSolarTimeZone> > &zones);
+	void update();
+	void update(int year, int month, int day);
+
+	size_t size() const;
+
+	const vector<double> & sunrise() const;
+	const vector<double> & sunset() const;
+	const vector<double> & civilTwilightStart() const;
+	const vector<double> & civilTwilightEnd() const;
+	const vector<double> & nauticalTwilightStart() const;
+	const vector<double> & nauticalTwilightEnd() const;
+	const vector<double> & astronomicalTwilightStart() const;
+	const vector<double> & astronomicalTwilightEnd() const;
+	const vector<double> & dayLength() const;
+	const vector<double> & civilTwilightDayLength() const;
+	const vector<double> & nauticalTwilightDayLength() const;
+	const vector<double> & astronomicalTwilightDayLength() const;
+
+	/* Stateless entry point working directly on caller owned arrays */
+	static void calculate( int year, int month, int day, size_t count,
+		const double *lat, const double *lon, const double *tz, const ofxSolarBatchOutput &out );
+
+	/* Every output array of count sites in an ofxSolarArena */
+	static ofxSolarBatchOutput allocate( ofxSolarArena &arena, size_t count );
+
+	/* ofxSolar::crossings() of count sites through altitudeCount   */
+	/* altitudes, from the interpolated ephemeris of calculate().   */
+	/* out has count * altitudeCount elements, those of site i from */
+	/* out + i * altitudeCount                                      */
+	static void crossings( int year, int month, int day, size_t count,
+		const double *lat, const double *lon, const double *tz,
+		const double *altitudes, size_t altitudeCount, ofxSolarCrossing *out, int upper_limb = 0 );
+
+	/* Array versions of ofxSolar::sunpos() and ofxSolar::sun_RA_dec(), one */
+	/* result per element of d. The SIMD paths use polynomial sine, cosine  */
+	/* and arctangent and stay within 1e-9 degrees and 1e-12 AU of the      */
+	/* scalar path.                                                         */
+	static void sunpos( const double *d, size_t count, double *lon, double *r );
+	static void sun_RA_dec( const double *d, size_t count, double *RA, double *dec, double *r );
+
+	/* The best instruction set is picked at runtime, setSimd() can restrict */
+	/* it, e.g. to OFXSOLAR_SIMD_SCALAR to get the exact libm results.       */
+	static void setSimd( ofxSolarSimd simd );
+	static ofxSolarSimd getSimd();
+
+private:
+
+	/* The Sun at each site's local noon, and room for the diurnal arcs */
+	struct Noon{
+		vector<double> sin_lat, cos_lat, sin_dec, cos_dec, sradius, tsouth, t;
+		vector<int> rc;
+	};
+
+	/* Sized for count sites, reused by every call on the same thread */
+	static Noon & noon( int year, int month, int day, size_t count, const double *lat, const double *lon );
+
+	static void diurnalArc( size_t count, double altit, int upper_limb,
+		const double *sin_lat, const double *cos_lat, const double *sin_dec, const double *cos_dec,
+		const double *sradius, double *t, int *rc );
+
+	static void storeEvents( size_t count, const double *tsouth, const double *tz, const double *t,
+		double *rise, double *set, double *len );
+
+	vector<double> lat, lon, tz;
+	vector<shared_ptr<const ofxSolarTimeZone> > zones;
+	vector<double> tzUsed;      /* tz, 0 for sites with a zone */
+	vector<double> rise, set, civ_start, civ_end, naut_start, naut_end,
+		astr_start, astr_end;
+	vector<double> dayleng, civlen, nautlen, astrlen;
+
+};
@@ -0,0 +1,180 @@
+/*
+
+SIMD versions of ofxSolar::sunpos() and ofxSolar::sun_RA_dec() for arrays
+of day numbers. SSE2 handles two days per instruction and AVX2 four, the
+widest one the CPU supports is picked at runtime. Other architectures use
+the scalar functions.
+
+*/
+
+#include "ofxSolarBatch.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || ( defined(_M_IX86_FP) && _M_IX86_FP >= 2 )
+#define OFXSOLAR_X86
+#endif
+
+#ifdef OFXSOLAR_X86
+
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace ofxSolarSse2{
+
+	typedef __m128d V;
+
+	struct S{
+		enum { N = 2 };
+		static inline V zero(){ return _mm_setzero_pd(); }
+		static inline V set( double x ){ return _mm_set1_pd( x ); }
+		static inline V load( const double *p ){ return _mm_loadu_pd( p ); }
+		static inline void store( double *p, V x ){ _mm_storeu_pd( p, x ); }
+		static inline V add( V a, V b ){ return _mm_add_pd( a, b ); }
+		static inline V sub( V a, V b ){ return _mm_sub_pd( a, b ); }
+		static inline V mul( V a, V b ){ return _mm_mul_pd( a, b ); }
+		static inline V div( V a, V b ){ return _mm_div_pd( a, b ); }
+		static inline V madd( V a, V b, V c ){ return _mm_add_pd( _mm_mul_pd( a, b ), c ); }
+		static inline V sqrt( V a ){ return _mm_sqrt_pd( a ); }
+		static inline V min( V a, V b ){ return _mm_min_pd( a, b ); }
+		static inline V max( V a, V b ){ return _mm_max_pd( a, b ); }
+		static inline V abs( V a ){ return _mm_andnot_pd( _mm_set1_pd( -0.0 ), a ); }
+		static inline V eq( V a, V b ){ return _mm_cmpeq_pd( a, b ); }
+		static inline V lt( V a, V b ){ return _mm_cmplt_pd( a, b ); }
+		static inline V gt( V a, V b ){ return _mm_cmpgt_pd( a, b ); }
+		static inline V ge( V a, V b ){ return _mm_cmpge_pd( a, b ); }
+		static inline V bor( V a, V b ){ return _mm_or_pd( a, b ); }
+		static inline V sel( V m, V a, V b ){ return _mm_or_pd( _mm_and_pd( m, a ), _mm_andnot_pd( m, b ) ); }
+		static inline V floor( V a ){
+			/* No rounding instruction before SSE4.1, truncate and fix up negatives */
+			V t = _mm_cvtepi32_pd( _mm_cvttpd_epi32( a ) );
+			return _mm_sub_pd( t, _mm_and_pd( _mm_cmpgt_pd( t, a ), _mm_set1_pd( 1.0 ) ) );
+		}
+	};
+
+	#include "ofxSolarBatchSimd.inl"
+}
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+
+namespace ofxSolarAvx2{
+
+	typedef __m256d V;
+
+	struct S{
+		enum { N = 4 };
+		static inline V zero(){ return _mm256_setzero_pd(); }
+		static inline V set( double x ){ return _mm256_set1_pd( x ); }
+		static inline V load( const double *p ){ return _mm256_loadu_pd( p ); }
+		static inline void store( double *p, V x ){ _mm256_storeu_pd( p, x ); }
+		static inline V add( V a, V b ){ return _mm256_add_pd( a, b ); }
+		static inline V sub( V a, V b ){ return _mm256_sub_pd( a, b ); }
+		static inline V mul( V a, V b ){ return _mm256_mul_pd( a, b ); }
+		static inline V div( V a, V b ){ return _mm256_div_pd( a, b ); }
+		static inline V madd( V a, V b, V c ){ return _mm256_fmadd_pd( a, b, c ); }
+		static inline V sqrt( V a ){ return _mm256_sqrt_pd( a ); }
+		static inline V min( V a, V b ){ return _mm256_min_pd( a, b ); }
+		static inline V max( V a, V b ){ return _mm256_max_pd( a, b ); }
+		static inline V abs( V a ){ return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), a ); }
+		static inline V eq( V a, V b ){ return _mm256_cmp_pd( a, b, _CMP_EQ_OQ ); }
+		static inline V lt( V a, V b ){ return _mm256_cmp_pd( a, b, _CMP_LT_OQ ); }
+		static inline V gt( V a, V b ){ return _mm256_cmp_pd( a, b, _CMP_GT_OQ ); }
+		static inline V ge( V a, V b ){ return _mm256_cmp_pd( a, b, _CMP_GE_OQ ); }
+		static inline V bor( V a, V b ){ return _mm256_or_pd( a, b ); }
+		static inline V sel( V m, V a, V b ){ return _mm256_blendv_pd( b, a, m ); }
+		static inline V floor( V a ){ return _mm256_floor_pd( a ); }
+	};
+
+	#include "ofxSolarBatchSimd.inl"
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+static ofxSolarSimd detectSimd(){
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuidex( info, 7, 0 );
+	bool avx2 = ( info[1] & ( 1 << 5 ) ) != 0;
+	__cpuid( info, 1 );
+	bool fma = ( info[2] & ( 1 << 12 ) ) != 0;
+	bool osxsave = ( info[2] & ( 1 << 27 ) ) != 0;
+	if ( avx2 && fma && osxsave && ( _xgetbv( 0 ) & 6 ) == 6 )
+		return OFXSOLAR_SIMD_AVX2;
+#else
+	__builtin_cpu_init();
+	if ( __builtin_cpu_supports( "avx2" ) && __builtin_cpu_supports( "fma" ) )
+		return OFXSOLAR_SIMD_AVX2;
+#endif
+	return OFXSOLAR_SIMD_SSE2;
+}
+
+#else
+
+static ofxSolarSimd detectSimd(){
+	return OFXSOLAR_SIMD_SCALAR;
+}
+
+#endif
+
+static ofxSolarSimd supportedSimd(){
+	static ofxSolarSimd supported = detectSimd();
+	return supported;
+}
+
+/* Set by setSimd() on any thread while others compute, -1 for the */
+/* supported one. Relaxed, a call only has to see some valid value  */
+static atomic<int> selectedSimd( -1 );
+
+static ofxSolarSimd currentSimd(){
+	int simd = selectedSimd.load( memory_order_relaxed );
+	return simd < 0 ? supportedSimd() : (ofxSolarSimd)simd;
+}
+
+void ofxSolarBatch::setSimd( ofxSolarSimd simd ){
+	selectedSimd.store( simd < supportedSimd() ? simd : supportedSimd(), memory_order_relaxed );
+}
+ofxSolarSimd ofxSolarBatch::getSimd(){
+	return currentSimd();
+}
+
+void ofxSolarBatch::sunpos( const double *d, size_t count, double *lon, double *r ){
+	switch ( currentSimd() ){
+#ifdef OFXSOLAR_X86
+	case OFXSOLAR_SIMD_AVX2:
+		ofxSolarAvx2::sunposArray( d, count, lon, r );
+		break;
+	case OFXSOLAR_SIMD_SSE2:
+		ofxSolarSse2::sunposArray( d, count, lon, r );
+		break;
+#endif
+	default:
+		for ( size_t i = 0; i < count; i++ )
+			ofxSolar::sunpos( d[i], &lon[i], &r[i] );
+		break;
+	}
+}
+void ofxSolarBatch::sun_RA_dec( const double *d, size_t count, double *RA, double *dec, double *r ){
+	switch ( currentSimd() ){
+#ifdef OFXSOLAR_X86
+	case OFXSOLAR_SIMD_AVX2:
+		ofxSolarAvx2::sunRADecArray( d, count, RA, dec, r );
+		break;
+	case OFXSOLAR_SIMD_SSE2:
+		ofxSolarSse2::sunRADecArray( d, count, RA, dec, r );
+		break;
+#endif
+	default:
+		for ( size_t i = 0; i < count; i++ )
+			ofxSolar::sun_RA_dec( d[i], &RA[i], &dec[i], &r[i] );
+		break;
+	}
+}
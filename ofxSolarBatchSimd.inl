@@ -0,0 +1,172 @@
+/*
+
+Body of the SIMD versions of sunpos() and sun_RA_dec(), included once per
+instruction set by ofxSolarBatchSimd.cpp inside a namespace that defines
+
+	S     - the operations on one vector register
+	V     - the vector type, S::N doubles wide
+
+Sine and cosine: reduced to +-45 degrees, Taylor series to the 13th/14th
+power, |error| < 3e-14. Arctangent: reduced to |a| <= 2-sqrt(3) (15 degrees)
+with atan(a) = pi/6 + atan((sqrt(3)*a-1)/(sqrt(3)+a)), Taylor series to the
+19th power, |error| < 6e-14 radians.
+
+*/
+
+static inline void sincosV( V x, V *s, V *c )
+	/****************************************************/
+	/* Sine and cosine of x degrees, |x| < 1e6          */
+	/****************************************************/
+{
+	V q = S::floor( S::madd( x, S::set(1.0/90.0), S::set(0.5) ) );  /* Nearest quadrant */
+	V r = S::mul( S::sub( x, S::mul( q, S::set(90.0) ) ), S::set(DEGRAD) );
+	V z = S::mul( r, r );
+
+	V sp = S::madd( z, S::set(1.0/6227020800.0), S::set(-1.0/39916800.0) );
+	sp = S::madd( z, sp, S::set(1.0/362880.0) );
+	sp = S::madd( z, sp, S::set(-1.0/5040.0) );
+	sp = S::madd( z, sp, S::set(1.0/120.0) );
+	sp = S::madd( z, sp, S::set(-1.0/6.0) );
+	sp = S::madd( S::mul( r, z ), sp, r );
+
+	V cp = S::madd( z, S::set(1.0/87178291200.0), S::set(-1.0/479001600.0) );
+	cp = S::madd( z, cp, S::set(1.0/3628800.0) );
+	cp = S::madd( z, cp, S::set(-1.0/40320.0) );
+	cp = S::madd( z, cp, S::set(1.0/720.0) );
+	cp = S::madd( z, cp, S::set(-1.0/24.0) );
+	cp = S::madd( z, cp, S::set(0.5) );
+	cp = S::sub( S::set(1.0), S::mul( z, cp ) );
+
+	/* Quadrant 0..3 selects and negates the two series */
+	V qm = S::sub( q, S::mul( S::set(4.0), S::floor( S::mul( q, S::set(0.25) ) ) ) );
+	V odd = S::bor( S::eq( qm, S::set(1.0) ), S::eq( qm, S::set(3.0) ) );
+	V ss = S::sel( odd, cp, sp );
+	V cc = S::sel( odd, sp, cp );
+	*s = S::sel( S::ge( qm, S::set(2.0) ), S::sub( S::zero(), ss ), ss );
+	*c = S::sel( S::bor( S::eq( qm, S::set(1.0) ), S::eq( qm, S::set(2.0) ) ), S::sub( S::zero(), cc ), cc );
+}
+
+static inline V atan2V( V y, V x )
+	/****************************************************/
+	/* As atan2d() in ofxSolar.h, -180..+180 degrees    */
+	/****************************************************/
+{
+	V ax = S::abs( x ), ay = S::abs( y );
+	V mx = S::max( ax, ay ), mn = S::min( ax, ay );
+	V a = S::sel( S::eq( mx, S::zero() ), S::zero(), S::div( mn, mx ) );  /* 0..1 */
+
+	/* Reduce to |a| <= tan(15 degr) */
+	V big = S::gt( a, S::set(0.26794919243112270) );
+	V ar = S::div( S::madd( a, S::set(1.7320508075688772), S::set(-1.0) ),
+		S::add( a, S::set(1.7320508075688772) ) );
+	a = S::sel( big, ar, a );
+
+	V z = S::mul( a, a );
+	V p = S::madd( z, S::set(-1.0/19.0), S::set(1.0/17.0) );
+	p = S::madd( z, p, S::set(-1.0/15.0) );
+	p = S::madd( z, p, S::set(1.0/13.0) );
+	p = S::madd( z, p, S::set(-1.0/11.0) );
+	p = S::madd( z, p, S::set(1.0/9.0) );
+	p = S::madd( z, p, S::set(-1.0/7.0) );
+	p = S::madd( z, p, S::set(1.0/5.0) );
+	p = S::madd( z, p, S::set(-1.0/3.0) );
+	p = S::madd( S::mul( a, z ), p, a );
+	p = S::add( p, S::sel( big, S::set(PI/6.0), S::zero() ) );
+
+	/* Back to the full circle */
+	p = S::sel( S::gt( ay, ax ), S::sub( S::set(PI/2.0), p ), p );
+	p = S::sel( S::lt( x, S::zero() ), S::sub( S::set(PI), p ), p );
+	p = S::sel( S::lt( y, S::zero() ), S::sub( S::zero(), p ), p );
+	return S::mul( p, S::set(RADEG) );
+}
+
+static inline void sunposV( V d, V *lon, V *r )
+	/****************************************************/
+	/* Same computation as ofxSolar::sunpos()           */
+	/****************************************************/
+{
+	V M, w, e, E, x, y, sM, cM, sE, cE;
+
+	/* Compute mean elements */
+	M = S::madd( d, S::set(0.9856002585), S::set(356.0470) );
+	M = S::sub( M, S::mul( S::set(360.0), S::floor( S::mul( M, S::set(1.0/360.0) ) ) ) );
+	w = S::madd( d, S::set(4.70935E-5), S::set(282.9404) );
+	e = S::madd( d, S::set(-1.151E-9), S::set(0.016709) );
+
+	/* Compute true longitude and radius vector */
+	sincosV( M, &sM, &cM );
+	E = S::mul( S::mul( e, S::set(RADEG) ), S::mul( sM, S::madd( e, cM, S::set(1.0) ) ) );
+	E = S::add( M, E );
+	sincosV( E, &sE, &cE );
+	x = S::sub( cE, e );
+	y = S::mul( S::sqrt( S::sub( S::set(1.0), S::mul( e, e ) ) ), sE );
+	*r = S::sqrt( S::madd( x, x, S::mul( y, y ) ) );
+	*lon = S::add( atan2V( y, x ), w );
+	*lon = S::sel( S::ge( *lon, S::set(360.0) ), S::sub( *lon, S::set(360.0) ), *lon );
+}
+
+static inline void sunRADecV( V d, V *RA, V *dec, V *r )
+	/****************************************************/
+	/* Same computation as ofxSolar::sun_RA_dec()       */
+	/****************************************************/
+{
+	V lon, x, y, z, sl, cl, so, co;
+
+	sunposV( d, &lon, r );
+
+	sincosV( lon, &sl, &cl );
+	x = S::mul( *r, cl );
+	y = S::mul( *r, sl );
+
+	sincosV( S::madd( d, S::set(-3.563E-7), S::set(23.4393) ), &so, &co );
+	z = S::mul( y, so );
+	y = S::mul( y, co );
+
+	*RA = atan2V( y, x );
+	*dec = atan2V( z, S::sqrt( S::madd( x, x, S::mul( y, y ) ) ) );
+}
+
+static void sunposArray( const double *d, size_t count, double *lon, double *r )
+{
+	size_t i = 0;
+	V l, rr;
+	for ( ; i + S::N <= count; i += S::N ){
+		sunposV( S::load( d + i ), &l, &rr );
+		S::store( lon + i, l );
+		S::store( r + i, rr );
+	}
+	if ( i < count ){
+		/* Pad the tail so it goes through the same code */
+		double dt[S::N], lt[S::N], rt[S::N];
+		for ( size_t k = 0; k < S::N; k++ )
+			dt[k] = i + k < count ? d[i + k] : d[i];
+		sunposV( S::load( dt ), &l, &rr );
+		S::store( lt, l );
+		S::store( rt, rr );
+		for ( size_t k = 0; i + k < count; k++ )
+			lon[i + k] = lt[k], r[i + k] = rt[k];
+	}
+}
+
+static void sunRADecArray( const double *d, size_t count, double *RA, double *dec, double *r )
+{
+	size_t i = 0;
+	V a, b, rr;
+	for ( ; i + S::N <= count; i += S::N ){
+		sunRADecV( S::load( d + i ), &a, &b, &rr );
+		S::store( RA + i, a );
+		S::store( dec + i, b );
+		S::store( r + i, rr );
+	}
+	if ( i < count ){
+		double dt[S::N], at[S::N], bt[S::N], rt[S::N];
+		for ( size_t k = 0; k < S::N; k++ )
+			dt[k] = i + k < count ? d[i + k] : d[i];
+		sunRADecV( S::load( dt ), &a, &b, &rr );
+		S::store( at, a );
+		S::store( bt, b );
+		S::store( rt, rr );
+		for ( size_t k = 0; i + k < count; k++ )
+			RA[i + k] = at[k], dec[i + k] = bt[k], r[i + k] = rt[k];
+	}
+}
@@ -0,0 +1,151 @@
+#include "ofxSolarCache.h"
+
+ofxSolarCache::ofxSolarCache(){
+	setup();
+}
+
+void ofxSolarCache::setup( size_t capacity, double tolerance, int shards ){
+	int n = 1;
+	while ( n < shards )
+		n *= 2;
+
+	this->tolerance = tolerance > 0.0 ? tolerance : 0.01;
+	this->shards.clear();
+	for ( int i = 0; i < n; i++ ){
+		unique_ptr<Shard> shard( new Shard );
+		shard->capacity = max( (size_t)1, capacity / n );
+		shard->hits = shard->misses = shard->evictions = 0;
+		this->shards.push_back( move( shard ) );
+	}
+}
+
+void ofxSolarCache::clear(){
+	for ( size_t i = 0; i < shards.size(); i++ ){
+		lock_guard<mutex> lock( shards[i]->guard );
+		shards[i]->entries.clear();
+		shards[i]->index.clear();
+	}
+}
+
+double ofxSolarCache::getTolerance() const{
+	return tolerance;
+}
+
+size_t ofxSolarCache::KeyHash::operator()( const Key &key ) const{
+	/* splitmix64 finalizer over the packed fields */
+	uint64_t h = ( (uint64_t)(uint32_t)key.lat << 32 | (uint32_t)key.lon ) * 0x9e3779b97f4a7c15ULL
+		^ ( (uint64_t)(uint32_t)key.daynum << 32 | (uint32_t)key.altit );
+	h = ( h ^ ( h >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+	h = ( h ^ ( h >> 27 ) ) * 0x94d049bb133111ebULL;
+	return (size_t)( h ^ ( h >> 31 ) );
+}
+
+ofxSolarCache::Shard & ofxSolarCache::shardOf( const Key &key ){
+	/* The top bits, the map of the shard uses the low ones */
+	uint64_t h = KeyHash()( key );
+	return *shards[ ( h >> 40 ) & ( shards.size() - 1 ) ];
+}
+
+int ofxSolarCache::sunriset( int year, int month, int day, double lon, double lat,
+	double altit, int upper_limb, double *rise, double *set ){
+	Key key;
+	int32_t altitKey = (int32_t)floor( altit * 10000.0 + 0.5 );
+	key.lat = (int32_t)floor( lat / tolerance + 0.5 );
+	key.lon = (int32_t)floor( lon / tolerance + 0.5 );
+	key.daynum = (int32_t)days_since_2000_Jan_0(year,month,day);
+	key.altit = (int32_t)( ( (uint32_t)altitKey & 0x7fffffff ) | ( upper_limb ? 0x80000000u : 0 ) );
+
+	Shard &shard = shardOf( key );
+	{
+		lock_guard<mutex> lock( shard.guard );
+		auto found = shard.index.find( key );
+		if ( found != shard.index.end() ){
+			/* Move to the front, most recently used */
+			shard.entries.splice( shard.entries.begin(), shard.entries, found->second );
+			const Value &value = found->second->second;
+			*rise = value.rise;
+			*set = value.set;
+			shard.hits++;
+			return value.rc;
+		}
+	}
+
+	/* Computed unlocked from the key alone, at the center of the cell and */
+	/* the rounded altitude, so it doesn't depend on the first request     */
+	Value value;
+	double t;
+	ofxSolarDayState state = ofxSolar::dayState( key.daynum, key.lon * tolerance );
+	value.rc = ofxSolar::diurnalArc( state, key.lat * tolerance, altitKey / 10000.0, upper_limb, &t );
+	value.rise = state.tsouth - t;
+	value.set = state.tsouth + t;
+	*rise = value.rise;
+	*set = value.set;
+	shard.misses++;
+
+	lock_guard<mutex> lock( shard.guard );
+	if ( shard.index.count( key ) )
+		return value.rc;   /* Another thread was faster */
+	shard.entries.push_front( make_pair( key, value ) );
+	shard.index[key] = shard.entries.begin();
+	if ( shard.entries.size() > shard.capacity ){
+		shard.index.erase( shard.entries.back().first );
+		shard.entries.pop_back();
+		shard.evictions++;
+	}
+	return value.rc;
+}
+
+double ofxSolarCache::dayLength( int year, int month, int day, double lon, double lat,
+	double altit, int upper_limb ){
+	double rise, set;
+	sunriset( year, month, day, lon, lat, altit, upper_limb, &rise, &set );
+	return set - rise;
+}
+
+ofxSolarDay ofxSolarCache::dayEvents( int year, int month, int day, double lat, double lon, double tz ){
+	ofxSolarDay events;
+
+	events.year = year;
+	events.month = month;
+	events.day = day;
+
+	events.rs = sunriset( year, month, day, lon, lat, -35.0/60.0, 1, &events.rise, &events.set );
+	events.civ = sunriset( year, month, day, lon, lat, -6.0, 0, &events.civ_start, &events.civ_end );
+	events.naut = sunriset( year, month, day, lon, lat, -12.0, 0, &events.naut_start, &events.naut_end );
+	events.astr = sunriset( year, month, day, lon, lat, -18.0, 0, &events.astr_start, &events.astr_end );
+
+	events.dayleng = events.set - events.rise;
+	events.civlen = events.civ_end - events.civ_start;
+	events.nautlen = events.naut_end - events.naut_start;
+	events.astrlen = events.astr_end - events.astr_start;
+
+	events.rise += tz;
+	events.set += tz;
+	events.civ_start += tz;
+	events.civ_end += tz;
+	events.naut_start += tz;
+	events.naut_end += tz;
+	events.astr_start += tz;
+	events.astr_end += tz;
+
+	return events;
+}
+
+ofxSolarCacheStats ofxSolarCache::getStats(){
+	ofxSolarCacheStats stats = { 0, 0, 0, 0, 0 };
+	for ( size_t i = 0; i < shards.size(); i++ ){
+		Shard &shard = *shards[i];
+		stats.hits += shard.hits;
+		stats.misses += shard.misses;
+		stats.evictions += shard.evictions;
+		stats.capacity += shard.capacity;
+		lock_guard<mutex> lock( shard.guard );
+		stats.size += shard.entries.size();
+	}
+	return stats;
+}
+
+void ofxSolarCache::resetStats(){
+	for ( size_t i = 0; i < shards.size(); i++ )
+		shards[i]->hits = shards[i]->misses = shards[i]->evictions = 0;
+}
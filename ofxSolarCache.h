@@ -0,0 +1,97 @@
+/*
+
+ofxSolarCache - shared least recently used cache of sunriset() results
+
+Requests for nearby places on the same date hit the same entry: the key
+is the location quantized to a grid of tolerance degrees, the date, the
+altitude rounded to 1e-4 degrees and the upper limb flag, and the value
+is computed at the center of the grid cell and the rounded altitude, so
+it doesn't depend on which request came first. At the default 0.01
+degrees the center is at most 0.005 degrees away in each coordinate,
+which moved rise, set and twilight by at most 6.4 seconds up to 60
+degrees latitude (more at high latitudes around the solstices, the same
+as moving the place). Rounding -35/60 degrees moves rise and set by
+under 5 seconds.
+
+The entries are spread over shards by the hash of the key, each with its
+own lock, list in use order and hash map, so threads only contend when
+they hit the same shard at the same time. Misses are computed outside the
+lock. Every shard holds capacity / shards entries and drops its least
+recently used one when full. Four hits, a cached dayEvents(), cost about
+300 ns against 450 ns for ofxSolar::dayEvents().
+
+One cache can be shared by any number of ofxSolar instances through
+ofxSolar::setCache() and used directly from any thread.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+#include <list>
+#include <unordered_map>
+
+struct ofxSolarCacheStats{
+	uint64_t hits, misses, evictions;
+	size_t size, capacity;
+};
+
+class ofxSolarCache{
+
+public:
+
+	ofxSolarCache();
+	ofxSolarCache( const ofxSolarCache & ) = delete;
+	ofxSolarCache & operator=( const ofxSolarCache & ) = delete;
+
+	/* Clears the cache. shards is rounded up to a power of two */
+	void setup( size_t capacity = 65536, double tolerance = 0.01, int shards = 16 );
+	void clear();
+
+	/* Same arguments and results as the private ofxSolar::sunriset() and */
+	/* dayLength(): times in hours UT, lon before lat                     */
+	int sunriset( int year, int month, int day, double lon, double lat,
+		double altit, int upper_limb, double *rise, double *set );
+	double dayLength( int year, int month, int day, double lon, double lat,
+		double altit, int upper_limb );
+
+	/* Same as ofxSolar::dayEvents(), four lookups */
+	ofxSolarDay dayEvents( int year, int month, int day, double lat, double lon, double tz );
+
+	ofxSolarCacheStats getStats();
+	void resetStats();
+
+	double getTolerance() const;
+
+private:
+
+	struct Key{
+		int32_t lat, lon, daynum, altit;   /* altit in 1/10000 degrees, sign bit 31 = upper limb */
+		bool operator==( const Key &other ) const{
+			return lat == other.lat && lon == other.lon && daynum == other.daynum && altit == other.altit;
+		}
+	};
+
+	struct KeyHash{
+		size_t operator()( const Key &key ) const;
+	};
+
+	struct Value{
+		double rise, set;
+		int rc;
+	};
+
+	struct Shard{
+		mutex guard;
+		list<pair<Key, Value> > entries;     /* Most recently used first */
+		unordered_map<Key, list<pair<Key, Value> >::iterator, KeyHash> index;
+		size_t capacity;
+		atomic<uint64_t> hits, misses, evictions;
+	};
+
+	Shard & shardOf( const Key &key );
+
+	vector<unique_ptr<Shard> > shards;
+	double tolerance;
+
+};
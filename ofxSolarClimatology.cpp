@@ -0,0 +1,165 @@
+#include "ofxSolarClimatology.h"
+#include "ofxSolarBatch.h"
+#include "ofxSolarLocations.h"
+#include "ofxSolarTimeZone.h"
+
+/* Sites per block: small enough to balance the threads, large enough */
+/* to spread the ephemeris of each date over many sites               */
+static const size_t blockSize = 256;
+
+ofxSolarClimatology::ofxSolarClimatology(){
+	threads = 0;
+	startYear = years = 0;
+	siteDaysPerSecond = 0.0;
+}
+
+void ofxSolarClimatology::setup( const double *lat, const double *lon, const double *tz, size_t count ){
+	this->lat.assign( lat, lat + count );
+	this->lon.assign( lon, lon + count );
+	this->tz.assign( tz, tz + count );
+	tzUsed = this->tz;
+	zones.clear();
+	results.clear();
+	years = 0;
+}
+
+void ofxSolarClimatology::setup( const ofxSolarLocations &locations ){
+	setup( locations.getLatitudes(), locations.getLongitudes(), locations.getTimezones(), locations.size() );
+}
+
+void ofxSolarClimatology::setTimeZones( const vector<shared_ptr<const ofxSolarTimeZone> > &zones ){
+	this->zones = zones;
+	this->zones.resize( lat.size() );
+	tzUsed = tz;
+	for ( size_t i = 0; i < tzUsed.size(); i++ )
+		if ( this->zones[i] )
+			tzUsed[i] = 0.0;
+}
+
+void ofxSolarClimatology::setThreads( int threads ){
+	this->threads = threads;
+}
+
+size_t ofxSolarClimatology::size() const{
+	return lat.size();
+}
+
+int ofxSolarClimatology::getYears() const{
+	return years;
+}
+
+const vector<ofxSolarClimate> & ofxSolarClimatology::getResults() const{
+	return results;
+}
+
+const ofxSolarClimate & ofxSolarClimatology::get( size_t site, int year ) const{
+	return results[site * years + ( year - startYear )];
+}
+
+double ofxSolarClimatology::getSiteDaysPerSecond() const{
+	return siteDaysPerSecond;
+}
+
+void ofxSolarClimatology::calculate( int startYear, int endYear ){
+	auto t0 = chrono::steady_clock::now();
+	this->startYear = startYear;
+	years = max( 0, endYear - startYear + 1 );
+	results.assign( lat.size() * years, ofxSolarClimate() );
+	if ( results.empty() ){
+		siteDaysPerSecond = 0.0;
+		return;
+	}
+
+	size_t blocks = ( lat.size() + blockSize - 1 ) / blockSize;
+	int n = threads > 0 ? threads : (int)max( 1u, thread::hardware_concurrency() );
+	n = (int)min( (size_t)n, blocks );
+
+	/* Blocks are handed out in order to whichever thread asks next */
+	atomic<size_t> next( 0 );
+	auto work = [&]{
+		for ( size_t block = next++; block < blocks; block = next++ )
+			reduce( block * blockSize, min( ( block + 1 ) * blockSize, lat.size() ) );
+	};
+
+	if ( n == 1 ){
+		work();
+	}else{
+		vector<thread> workers;
+		for ( int i = 0; i < n; i++ )
+			workers.push_back( thread( work ) );
+		for ( size_t i = 0; i < workers.size(); i++ )
+			workers[i].join();
+	}
+
+	double days = (double)( days_since_2000_Jan_0(endYear + 1, 1, 1) - days_since_2000_Jan_0(startYear, 1, 1) );
+	double seconds = chrono::duration<double>( chrono::steady_clock::now() - t0 ).count();
+	siteDaysPerSecond = seconds > 0.0 ? days * lat.size() / seconds : 0.0;
+}
+
+void ofxSolarClimatology::reduce( size_t firstSite, size_t lastSite )
+	/**********************************************************************/
+	/* Folds every day of every year into the results of the sites        */
+	/* [firstSite, lastSite), one date at a time for all of them          */
+	/**********************************************************************/
+{
+	size_t count = lastSite - firstSite;
+	vector<double> rise( count ), set( count ), dayleng( count ), astrlen( count ), sum( count );
+	vector<int> rs( count );
+	ofxSolarBatchOutput out;
+	memset( &out, 0, sizeof(out) );
+	out.rise = rise.data();
+	out.set = set.data();
+	out.dayleng = dayleng.data();
+	out.astrlen = astrlen.data();
+	out.rs = rs.data();
+
+	for ( int y = 0; y < years; y++ ){
+		int year = startYear + y, month = 1, day = 1;
+		ofxSolarClimate *climate = &results[firstSite * years + y];
+		for ( size_t i = 0; i < count; i++ ){
+			climate[i * years].year = year;
+			sum[i] = 0.0;
+		}
+
+		for ( ; year == startYear + y; ofxSolar::nextDay( &year, &month, &day ) ){
+			ofxSolarBatch::calculate( year, month, day, count, &lat[firstSite], &lon[firstSite],
+				&tzUsed[firstSite], out );
+
+			for ( size_t i = 0; i < count; i++ ){
+				ofxSolarClimate &c = climate[i * years];
+				const ofxSolarTimeZone *zone = zones.empty() ? NULL : zones[firstSite + i].get();
+				if ( zone && rs[i] == 0 ){
+					double hours[2] = { rise[i], set[i] };
+					zone->localize( year, month, day, hours, 2 );
+					rise[i] = hours[0];
+					set[i] = hours[1];
+				}
+
+				if ( c.days == 0 || dayleng[i] < c.minDayLength )
+					c.minDayLength = dayleng[i];
+				if ( c.days == 0 || dayleng[i] > c.maxDayLength )
+					c.maxDayLength = dayleng[i];
+				sum[i] += dayleng[i];
+				c.darkness += 24.0 - astrlen[i];
+				c.days++;
+
+				/* The first date wins ties */
+				if ( rs[i] == 0 ){
+					if ( c.earliestSunsetMonth == 0 || set[i] < c.earliestSunset ){
+						c.earliestSunset = set[i];
+						c.earliestSunsetMonth = month;
+						c.earliestSunsetDay = day;
+					}
+					if ( c.latestSunriseMonth == 0 || rise[i] > c.latestSunrise ){
+						c.latestSunrise = rise[i];
+						c.latestSunriseMonth = month;
+						c.latestSunriseDay = day;
+					}
+				}
+			}
+		}
+
+		for ( size_t i = 0; i < count; i++ )
+			climate[i * years].meanDayLength = sum[i] / climate[i * years].days;
+	}
+}
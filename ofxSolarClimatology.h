@@ -0,0 +1,85 @@
+/*
+
+ofxSolarClimatology - yearly day length statistics of many sites over
+many years
+
+For every site and calendar year: the shortest, longest and mean day,
+the hours of astronomical night, and the earliest sunset and latest
+sunrise with their dates. Days are computed and folded into per-site
+accumulators as they go, the sites x dates table is never stored.
+
+Days come from ofxSolarBatch::calculate(), one ephemeris per date for a
+block of sites, within 0.1 seconds of ofxSolar::dayEvents(). Worker
+threads take blocks of sites from a shared counter until none are left,
+so threads that finish early pick up the rest. Each site is reduced by
+one thread in date order, which makes the results the same bit for bit
+whatever the number of threads.
+
+Throughput, BM_climatology of example-benchmark, GCC -O2, one core of a
+virtualized x86-64 Xeon: 10 M site-days/s, so 100,000 sites over ten
+years, 365 M site-days, take about 40 seconds divided by the cores.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+class ofxSolarLocations;
+class ofxSolarTimeZone;
+
+/* One site and year. Times are local hours, dates are month and day of */
+/* the year; a year without any sunrise, in polar night or day, has 0   */
+/* in earliestSunsetMonth and latestSunriseMonth                        */
+
+struct ofxSolarClimate{
+	int    year, days;
+	double minDayLength, maxDayLength, meanDayLength;   /* Hours */
+	double darkness;                                     /* Hours of astronomical night in the year */
+	double earliestSunset, latestSunrise;
+	int    earliestSunsetMonth, earliestSunsetDay;
+	int    latestSunriseMonth, latestSunriseDay;
+};
+
+class ofxSolarClimatology{
+
+public:
+
+	ofxSolarClimatology();
+
+	void setup( const double *lat, const double *lon, const double *tz, size_t count );
+	void setup( const ofxSolarLocations &locations );
+
+	/* One zone per site for the local sunrise and sunset times, NULL */
+	/* keeps the site's tz                                            */
+	void setTimeZones( const vector<shared_ptr<const ofxSolarTimeZone> > &zones );
+
+	/* 0 = one per core */
+	void setThreads( int threads );
+
+	/* Every year from startYear to endYear, inclusive */
+	void calculate( int startYear, int endYear );
+
+	size_t size() const;
+	int getYears() const;
+
+	/* Site major, getYears() entries per site */
+	const vector<ofxSolarClimate> & getResults() const;
+	const ofxSolarClimate & get( size_t site, int year ) const;
+
+	/* Of the last calculate() */
+	double getSiteDaysPerSecond() const;
+
+private:
+
+	void reduce( size_t firstSite, size_t lastSite );
+
+	vector<double> lat, lon, tz, tzUsed;
+	vector<shared_ptr<const ofxSolarTimeZone> > zones;
+	int threads;
+
+	int startYear, years;
+	vector<ofxSolarClimate> results;
+	double siteDaysPerSecond;
+
+};
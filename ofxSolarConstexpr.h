@@ -0,0 +1,257 @@
+/*
+
+ofxSolarConstexpr - rise/set and twilight tables computed by the compiler
+
+For installations at a fixed place, the whole year's table can be
+generated at compile time from the same algorithm as sunriset(), and the
+program only indexes into it:
+
+	static constexpr ofxSolarConstYear berlin =
+		ofxSolarConst::year( 2026, LOCATION_BERLIN, TZ_CET );
+
+	const ofxSolarConstDay &today = berlin.get( 6, 21 );   // today.rise, today.set...
+
+ofxSolarConst has constexpr versions of the sind()/cosd()/acosd()/atan2d()
+macros, of revolution(), rev180(), GMST0(), sunpos(), sun_RA_dec() and of
+the diurnal arc. The sine and arctangent use argument reduction and
+Taylor series, the square root Newton's method, all within a few units
+in the last place of libm, so table entries match ofxSolar::dayEvents()
+within a few milliseconds, the precision of the floats they are stored
+in. maxError() checks that at runtime, ofxSolarVerify calls it.
+
+Needs C++14. GCC takes about a second per table. Clang stops constexpr
+evaluation after a million steps by default, raise that with
+-fconstexpr-steps if it complains. A table is 366 * 36 bytes. At
+latitude +-90 the diurnal arc divides by a zero cosine, which constant
+evaluation rejects, tables of the poles can only be built at runtime.
+get() asserts that the date is in the table's year.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+#include <cassert>
+
+/* Rise/set and twilight times of one day, hours local time, and the */
+/* return codes of sunriset()                                        */
+
+struct ofxSolarConstDay{
+	float rise, set, civ_start, civ_end, naut_start, naut_end, astr_start, astr_end;
+	signed char rs, civ, naut, astr;
+};
+
+struct ofxSolarConstYear{
+	int year;
+	long first;                  /* days_since_2000_Jan_0 of Jan 1 */
+	int days;                    /* 365 or 366 */
+	double lat, lon, tz;
+	ofxSolarConstDay day[366];   /* Jan 1 first */
+
+	constexpr int monthLength( int month ) const{
+		return (int)( month == 12 ? days_since_2000_Jan_0(year+1,1,1) - days_since_2000_Jan_0(year,12,1) :
+			days_since_2000_Jan_0(year,month+1,1) - days_since_2000_Jan_0(year,month,1) );
+	}
+
+	constexpr const ofxSolarConstDay & get( int month, int day ) const{
+		assert( month >= 1 && month <= 12 && day >= 1 && day <= monthLength( month ) );
+		return this->day[ days_since_2000_Jan_0(year,month,day) - first ];
+	}
+
+	/* Largest difference in hours against ofxSolar::dayEvents() over the year */
+	double maxError() const{
+		double error = 0.0;
+		int y = year, m = 1, d = 1;
+		for ( int i = 0; i < days; i++, ofxSolar::nextDay( &y, &m, &d ) ){
+			ofxSolarDay exact = ofxSolar::dayEvents( y, m, d, lat, lon, tz );
+			const ofxSolarConstDay &t = day[i];
+			const double diff[8] = { t.rise - exact.rise, t.set - exact.set,
+				t.civ_start - exact.civ_start, t.civ_end - exact.civ_end,
+				t.naut_start - exact.naut_start, t.naut_end - exact.naut_end,
+				t.astr_start - exact.astr_start, t.astr_end - exact.astr_end };
+			for ( int j = 0; j < 8; j++ )
+				error = max( error, fabs( diff[j] ) );
+		}
+		return error;
+	}
+};
+
+struct ofxSolarConst{
+
+	static constexpr double pi = 3.14159265358979323846;
+
+	static constexpr double floor( double x ){
+		return (double)(long long)x > x ? (double)(long long)x - 1.0 : (double)(long long)x;
+	}
+
+	static constexpr double revolution( double x ){
+		return x - 360.0 * floor( x * ( 1.0 / 360.0 ) );
+	}
+
+	static constexpr double rev180( double x ){
+		return x - 360.0 * floor( x * ( 1.0 / 360.0 ) + 0.5 );
+	}
+
+	/* sin and cos of x degrees, reduced to +-45 degrees exactly in degrees */
+
+	static constexpr double sinDeg( double x ){
+		double k = floor( x / 90.0 + 0.5 );
+		int quadrant = (int)( k - 4.0 * floor( k / 4.0 ) );
+		double r = ( x - 90.0 * k ) * ( pi / 180.0 );
+		double z = r * r;
+		double s = r * ( 1.0 - z / 6.0 * ( 1.0 - z / 20.0 * ( 1.0 - z / 42.0 * ( 1.0 - z / 72.0 *
+			( 1.0 - z / 110.0 * ( 1.0 - z / 156.0 * ( 1.0 - z / 210.0 ) ) ) ) ) ) );
+		double c = 1.0 - z / 2.0 * ( 1.0 - z / 12.0 * ( 1.0 - z / 30.0 * ( 1.0 - z / 56.0 *
+			( 1.0 - z / 90.0 * ( 1.0 - z / 132.0 * ( 1.0 - z / 182.0 * ( 1.0 - z / 240.0 ) ) ) ) ) ) );
+		/* 0.0 - s rather than -s: sinDeg(180) and cosDeg(90) are +0, like the */
+		/* tiny positive results of libm. A -0 cosine at latitude +90 would    */
+		/* turn the infinite cost of the diurnal arc around                    */
+		return quadrant == 0 ? s : quadrant == 1 ? c : quadrant == 2 ? 0.0 - s : 0.0 - c;
+	}
+
+	static constexpr double cosDeg( double x ){
+		return sinDeg( x + 90.0 );
+	}
+
+	static constexpr double sqrt( double x ){
+		if ( x <= 0.0 )
+			return 0.0;
+		/* Scale into 0.25..4 by powers of 4, then Newton */
+		double scale = 1.0;
+		while ( x > 4.0 ){ x *= 0.25; scale *= 2.0; }
+		while ( x < 0.25 ){ x *= 4.0; scale *= 0.5; }
+		double y = 0.5 * ( 1.0 + x );
+		for ( int i = 0; i < 6; i++ )
+			y = 0.5 * ( y + x / y );
+		return y * scale;
+	}
+
+	/* Radians */
+	static constexpr double atan( double x ){
+		if ( x < 0.0 )
+			return -atan( -x );
+		if ( x > 1.0 )
+			return pi / 2.0 - atan( 1.0 / x );
+		/* Shift by 30 degrees below tan(15 degrees), the series is then short */
+		double offset = 0.0;
+		if ( x > 0.2679491924311227 ){
+			const double sqrt3 = 1.7320508075688772;
+			x = ( x * sqrt3 - 1.0 ) / ( sqrt3 + x );
+			offset = pi / 6.0;
+		}
+		double z = x * x, term = x, sum = 0.0;
+		for ( int n = 1; n < 28; n += 2 ){
+			sum += term / n;
+			term *= -z;
+		}
+		return offset + sum;
+	}
+
+	static constexpr double atan2Deg( double y, double x ){
+		return ( x > 0.0 ? atan( y / x ) :
+			x < 0.0 ? ( y >= 0.0 ? atan( y / x ) + pi : atan( y / x ) - pi ) :
+			y > 0.0 ? pi / 2.0 : y < 0.0 ? -pi / 2.0 : 0.0 ) * ( 180.0 / pi );
+	}
+
+	static constexpr double acosDeg( double x ){
+		return atan2Deg( sqrt( ( 1.0 - x ) * ( 1.0 + x ) ), x );
+	}
+
+	/* Same as ofxSolar::GMST0(), sunpos() and sun_RA_dec() */
+
+	static constexpr double GMST0( double d ){
+		return revolution( ( 180.0 + 356.0470 + 282.9404 ) + ( 0.9856002585 + 4.70935E-5 ) * d );
+	}
+
+	static constexpr void sunpos( double d, double *lon, double *r ){
+		double M = revolution( 356.0470 + 0.9856002585 * d );
+		double w = 282.9404 + 4.70935E-5 * d;
+		double e = 0.016709 - 1.151E-9 * d;
+		double E = M + e * ( 180.0 / pi ) * sinDeg(M) * ( 1.0 + e * cosDeg(M) );
+		double x = cosDeg(E) - e;
+		double y = sqrt( 1.0 - e*e ) * sinDeg(E);
+		*r = sqrt( x*x + y*y );
+		*lon = atan2Deg( y, x ) + w;
+		if ( *lon >= 360.0 )
+			*lon -= 360.0;
+	}
+
+	static constexpr void sun_RA_dec( double d, double *RA, double *dec, double *r ){
+		double lon = 0.0;
+		sunpos( d, &lon, r );
+		double x = *r * cosDeg(lon);
+		double y = *r * sinDeg(lon);
+		double obl_ecl = 23.4393 - 3.563E-7 * d;
+		double z = y * sinDeg(obl_ecl);
+		y = y * cosDeg(obl_ecl);
+		*RA = atan2Deg( y, x );
+		*dec = atan2Deg( z, sqrt( x*x + y*y ) );
+	}
+
+	/* Same as ofxSolar::dayState() and diurnalArc() */
+
+	static constexpr ofxSolarDayState dayState( long daynum, double lon ){
+		ofxSolarDayState state = {};
+		double sdec = 0.0;
+		state.d = daynum + 0.5 - lon/360.0;
+		double sidtime = revolution( GMST0(state.d) + 180.0 + lon );
+		sun_RA_dec( state.d, &state.sRA, &sdec, &state.sr );
+		state.sin_sdec = sinDeg(sdec);
+		state.cos_sdec = cosDeg(sdec);
+		state.tsouth = 12.0 - rev180(sidtime - state.sRA)/15.0;
+		return state;
+	}
+
+	static constexpr int diurnalArc( const ofxSolarDayState &state, double lat, double altit, int upper_limb, double *t ){
+		if ( upper_limb )
+			altit -= 0.2666 / state.sr;
+		double cost = ( sinDeg(altit) - sinDeg(lat) * state.sin_sdec ) / ( cosDeg(lat) * state.cos_sdec );
+		if ( cost >= 1.0 ){
+			*t = 0.0;
+			return -1;
+		}
+		if ( cost <= -1.0 ){
+			*t = 12.0;
+			return +1;
+		}
+		*t = acosDeg(cost)/15.0;
+		return 0;
+	}
+
+	/* The table of a whole year, lat and lon as in LOCATION_*, tz as in TZ_* */
+
+	static constexpr ofxSolarConstYear year( int year, double lat, double lon, double tz ){
+		ofxSolarConstYear table = {};
+		table.year = year;
+		table.first = days_since_2000_Jan_0(year,1,1);
+		table.days = (int)( days_since_2000_Jan_0(year+1,1,1) - table.first );
+		table.lat = lat;
+		table.lon = lon;
+		table.tz = tz;
+
+		for ( int i = 0; i < table.days; i++ ){
+			ofxSolarDayState state = dayState( table.first + i, lon );
+			ofxSolarConstDay &day = table.day[i];
+			double t = 0.0;
+
+			day.rs = (signed char)diurnalArc( state, lat, -35.0/60.0, 1, &t );
+			day.rise = (float)( state.tsouth - t + tz );
+			day.set = (float)( state.tsouth + t + tz );
+
+			day.civ = (signed char)diurnalArc( state, lat, -6.0, 0, &t );
+			day.civ_start = (float)( state.tsouth - t + tz );
+			day.civ_end = (float)( state.tsouth + t + tz );
+
+			day.naut = (signed char)diurnalArc( state, lat, -12.0, 0, &t );
+			day.naut_start = (float)( state.tsouth - t + tz );
+			day.naut_end = (float)( state.tsouth + t + tz );
+
+			day.astr = (signed char)diurnalArc( state, lat, -18.0, 0, &t );
+			day.astr_start = (float)( state.tsouth - t + tz );
+			day.astr_end = (float)( state.tsouth + t + tz );
+		}
+		return table;
+	}
+
+};
@@ -0,0 +1,488 @@
+#include "ofxSolarExport.h"
+#include "ofxSolarLocations.h"
+#include "ofxSolarTimeZone.h"
+
+#ifndef TARGET_WIN32
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+static_assert( sizeof(ofxSolarExportHeader) == 32, "ofxSolarExportHeader must be 32 bytes" );
+
+static const char exportMagic[8] = { 'o', 'f', 'x', 'S', 'o', 'l', 'E', 'x' };
+
+static const char * const eventNames[8] = {
+	"sunrise", "sunset", "civil_start", "civil_end", "nautical_start", "nautical_end",
+	"astronomical_start", "astronomical_end"
+};
+
+/* Largest CSV/NDJSON row without the site name, see rowSize() */
+static const size_t textRowSize = 8 * ( OFXSOLAR_ISO_LENGTH + 24 ) + 96;
+
+/* Binary columns per row: site, daynum, 9 floats, 4 codes */
+static const size_t binaryRowSize = 4 + 4 + 9 * 4 + 4;
+
+static inline char * put2( char *p, int v ){
+	p[0] = (char)( '0' + v / 10 );
+	p[1] = (char)( '0' + v % 10 );
+	return p + 2;
+}
+
+static inline char * putText( char *p, const char *text ){
+	while ( *text )
+		*p++ = *text++;
+	return p;
+}
+
+static inline char * putUnsigned( char *p, uint64_t v ){
+	char digits[20];
+	int n = 0;
+	do{
+		digits[n++] = (char)( '0' + v % 10 );
+		v /= 10;
+	}while ( v );
+	while ( n )
+		*p++ = digits[--n];
+	return p;
+}
+
+/* 0..24 hours with four decimals */
+static inline char * putHours( char *p, double hours ){
+	long v = (long)floor( hours * 10000.0 + 0.5 );
+	p = putUnsigned( p, (uint64_t)( v / 10000 ) );
+	*p++ = '.';
+	v %= 10000;
+	p = put2( p, (int)( v / 100 ) );
+	return put2( p, (int)( v % 100 ) );
+}
+
+static inline char * putDate( char *p, int year, int month, int day ){
+	p = put2( p, year / 100 );
+	p = put2( p, year % 100 );
+	*p++ = '-';
+	p = put2( p, month );
+	*p++ = '-';
+	return put2( p, day );
+}
+
+/* Site names: quoted for CSV when needed, escaped for JSON */
+
+static char * putCsvName( char *p, const string &name ){
+	if ( name.find_first_of( ",\"\r\n" ) == string::npos ){
+		memcpy( p, name.data(), name.size() );
+		return p + name.size();
+	}
+	*p++ = '"';
+	for ( size_t i = 0; i < name.size(); i++ ){
+		if ( name[i] == '"' )
+			*p++ = '"';
+		*p++ = name[i];
+	}
+	*p++ = '"';
+	return p;
+}
+
+static char * putJsonName( char *p, const string &name ){
+	static const char hex[] = "0123456789abcdef";
+	*p++ = '"';
+	for ( size_t i = 0; i < name.size(); i++ ){
+		unsigned char c = name[i];
+		if ( c == '"' || c == '\\' ){
+			*p++ = '\\';
+			*p++ = (char)c;
+		}else if ( c < 0x20 ){
+			p = putText( p, "\\u00" );
+			*p++ = hex[c >> 4];
+			*p++ = hex[c & 15];
+		}else{
+			*p++ = (char)c;
+		}
+	}
+	*p++ = '"';
+	return p;
+}
+
+
+ofxSolarExporter::ofxSolarExporter(){
+	precision = OFXSOLAR_PRECISION_DEFAULT;
+	memset( &stats, 0, sizeof(stats) );
+	setup( OFXSOLAR_EXPORT_CSV );
+}
+
+void ofxSolarExporter::setup( ofxSolarExportFormat format, size_t bufferSize, int threads ){
+	this->format = format;
+	this->bufferSize = max( bufferSize, (size_t)4096 );
+	this->threads = threads;
+}
+
+void ofxSolarExporter::setPrecision( ofxSolarPrecision precision ){
+	this->precision = precision;
+}
+
+void ofxSolarExporter::setSites( const double *lat, const double *lon, const double *tz, size_t count ){
+	this->lat.assign( lat, lat + count );
+	this->lon.assign( lon, lon + count );
+	this->tz.assign( tz, tz + count );
+	names.clear();
+	zones.clear();
+}
+
+void ofxSolarExporter::setSites( const ofxSolarLocations &locations ){
+	setSites( locations.getLatitudes(), locations.getLongitudes(), locations.getTimezones(), locations.size() );
+	names.resize( locations.size() );
+	for ( size_t i = 0; i < names.size(); i++ )
+		names[i] = locations.getName( i );
+}
+
+void ofxSolarExporter::setTimeZones( const vector<shared_ptr<const ofxSolarTimeZone> > &zones ){
+	this->zones = zones;
+	this->zones.resize( lat.size() );
+}
+
+ofxSolarExportStats ofxSolarExporter::getStats() const{
+	return stats;
+}
+
+size_t ofxSolarExporter::rowSize() const{
+	return format == OFXSOLAR_EXPORT_BINARY ? binaryRowSize : textRowSize;
+}
+
+
+/* Computing and formatting */
+
+/* Events in UT and the offset in hours of each event of a site and date */
+
+static void siteDay( int year, int month, int day, double lat, double lon, double tz,
+	const ofxSolarTimeZone *zone, ofxSolarPrecision precision, ofxSolarDay *events, double offsets[8] ){
+	*events = ofxSolar::dayEvents( year, month, day, lat, lon, 0.0, precision );
+	const double hours[8] = { events->rise, events->set, events->civ_start, events->civ_end,
+		events->naut_start, events->naut_end, events->astr_start, events->astr_end };
+	if ( zone ){
+		int64_t base = ofxSolarTimeZone::daysFromCivil( year, month, day ) * 86400;
+		for ( int i = 0; i < 8; i++ )
+			offsets[i] = zone->getOffsetSeconds( base + (int64_t)floor( hours[i] * 3600.0 ) ) / 3600.0;
+	}else{
+		for ( int i = 0; i < 8; i++ )
+			offsets[i] = tz;
+	}
+}
+
+char * ofxSolarExporter::formatSite( const Range &range, size_t site, char *p ) const{
+	const ofxSolarTimeZone *zone = site < zones.size() ? zones[site].get() : NULL;
+	bool json = format == OFXSOLAR_EXPORT_NDJSON;
+
+	/* The site column is the same on every row */
+	char siteText[32];
+	char *siteEnd = putUnsigned( siteText, site );
+
+	int year = range.year, month = range.month, day = range.day;
+	for ( size_t i = 0; i < range.days; i++, ofxSolar::nextDay( &year, &month, &day ) ){
+		ofxSolarDay events;
+		double offsets[8];
+		siteDay( year, month, day, lat[site], lon[site], tz[site], zone, precision, &events, offsets );
+		const double hours[8] = { events.rise, events.set, events.civ_start, events.civ_end,
+			events.naut_start, events.naut_end, events.astr_start, events.astr_end };
+		const int codes[4] = { events.rs, events.civ, events.naut, events.astr };
+
+		if ( json ){
+			p = putText( p, "{\"site\":" );
+			if ( names.empty() ){
+				memcpy( p, siteText, siteEnd - siteText );
+				p += siteEnd - siteText;
+			}else{
+				p = putJsonName( p, names[site] );
+			}
+			p = putText( p, ",\"date\":\"" );
+			p = putDate( p, year, month, day );
+			*p++ = '"';
+		}else{
+			if ( names.empty() ){
+				memcpy( p, siteText, siteEnd - siteText );
+				p += siteEnd - siteText;
+			}else{
+				p = putCsvName( p, names[site] );
+			}
+			*p++ = ',';
+			p = putDate( p, year, month, day );
+		}
+
+		for ( int e = 0; e < 8; e++ ){
+			if ( json ){
+				*p++ = ',';
+				*p++ = '"';
+				p = putText( p, eventNames[e] );
+				p = putText( p, "\":" );
+			}else{
+				*p++ = ',';
+			}
+			char *iso = codes[e / 2] == 0 ? ofxSolar::formatIso( p + json, p + json + OFXSOLAR_ISO_LENGTH,
+				year, month, day, hours[e] + offsets[e], offsets[e] ) : NULL;
+			if ( iso ){
+				if ( json ){
+					*p = '"';
+					*iso++ = '"';
+				}
+				p = iso;
+			}else if ( json ){
+				p = putText( p, "null" );
+			}
+		}
+
+		p = putText( p, json ? ",\"day_length\":" : "," );
+		p = putHours( p, events.dayleng );
+		p = putText( p, json ? "}\n" : "\n" );
+	}
+	return p;
+}
+
+void ofxSolarExporter::formatBinary( const Range &range, size_t firstSite, size_t lastSite, vector<char> &out ) const{
+	uint32_t rows = (uint32_t)( ( lastSite - firstSite ) * range.days );
+	size_t size = 8 + (size_t)rows * binaryRowSize;
+	out.resize( max( out.size(), size ) );
+
+	char *p = out.data();
+	uint32_t first = (uint32_t)firstSite;
+	memcpy( p, &rows, 4 );
+	memcpy( p + 4, &first, 4 );
+
+	/* Column starts */
+	uint32_t *siteColumn = (uint32_t *)( p + 8 );
+	int32_t *dayColumn = (int32_t *)( siteColumn + rows );
+	float *floatColumns = (float *)( dayColumn + rows );
+	int8_t *codeColumns = (int8_t *)( floatColumns + 9 * (size_t)rows );
+
+	size_t row = 0;
+	for ( size_t site = firstSite; site < lastSite; site++ ){
+		const ofxSolarTimeZone *zone = site < zones.size() ? zones[site].get() : NULL;
+		int year = range.year, month = range.month, day = range.day;
+		for ( size_t i = 0; i < range.days; i++, row++, ofxSolar::nextDay( &year, &month, &day ) ){
+			ofxSolarDay events;
+			double offsets[8];
+			siteDay( year, month, day, lat[site], lon[site], tz[site], zone, precision, &events, offsets );
+			const double hours[9] = { events.rise, events.set, events.civ_start, events.civ_end,
+				events.naut_start, events.naut_end, events.astr_start, events.astr_end, events.dayleng };
+
+			siteColumn[row] = (uint32_t)site;
+			dayColumn[row] = (int32_t)( range.first + (long)i );
+			for ( int c = 0; c < 8; c++ )
+				floatColumns[c * (size_t)rows + row] = (float)( hours[c] + offsets[c] );
+			floatColumns[8 * (size_t)rows + row] = (float)hours[8];
+			codeColumns[row] = (int8_t)events.rs;
+			codeColumns[rows + row] = (int8_t)events.civ;
+			codeColumns[2 * (size_t)rows + row] = (int8_t)events.naut;
+			codeColumns[3 * (size_t)rows + row] = (int8_t)events.astr;
+		}
+	}
+}
+
+/* Formats sites [firstSite, lastSite) into out, returns the length */
+
+size_t ofxSolarExporter::formatChunk( const Range &range, size_t firstSite, size_t lastSite, vector<char> &out ) const{
+	if ( format == OFXSOLAR_EXPORT_BINARY ){
+		formatBinary( range, firstSite, lastSite, out );
+		return 8 + ( lastSite - firstSite ) * range.days * binaryRowSize;
+	}
+
+	size_t length = 0;
+	for ( size_t site = firstSite; site < lastSite; site++ ){
+		/* Escaped names are at most six times as long */
+		size_t name = names.empty() ? 20 : 6 * names[site].size() + 2;
+		size_t need = range.days * ( textRowSize + name );
+		if ( out.size() < length + need )
+			out.resize( max( length + need, out.size() * 2 ) );
+		length = formatSite( range, site, out.data() + length ) - out.data();
+	}
+	return length;
+}
+
+
+/* Writing */
+
+bool ofxSolarExporter::writeAll( FILE *file, const vector<char> *const *buffers, size_t count ){
+	(void)file;
+#ifdef TARGET_WIN32
+	for ( size_t i = 0; i < count; i++ )
+		if ( fwrite( buffers[i]->data(), 1, buffers[i]->size(), file ) != buffers[i]->size() )
+			return false;
+	return true;
+#else
+	int fd = fileno( file );
+	iovec iov[64];
+	size_t n = min( count, (size_t)64 );
+	for ( size_t i = 0; i < n; i++ ){
+		iov[i].iov_base = (void *)buffers[i]->data();
+		iov[i].iov_len = buffers[i]->size();
+	}
+
+	/* writev() may stop anywhere, continue from there */
+	iovec *v = iov;
+	while ( n > 0 ){
+		ssize_t written = writev( fd, v, (int)n );
+		if ( written < 0 ){
+			if ( errno == EINTR )
+				continue;
+			return false;
+		}
+		while ( n > 0 && (size_t)written >= v->iov_len ){
+			written -= v->iov_len;
+			v++;
+			n--;
+		}
+		if ( n > 0 ){
+			v->iov_base = (char *)v->iov_base + written;
+			v->iov_len -= written;
+		}
+	}
+	return count <= 64 || writeAll( file, buffers + 64, count - 64 );
+#endif
+}
+
+bool ofxSolarExporter::write( const string &path, int startYear, int startMonth, int startDay,
+	int endYear, int endMonth, int endDay ){
+	FILE *file = fopen( ofToDataPath(path).c_str(), "wb" );
+	if ( !file ){
+		ofLogError("ofxSolarExporter") << "couldn't create " << path;
+		return false;
+	}
+	bool ok = write( file, startYear, startMonth, startDay, endYear, endMonth, endDay );
+	if ( fclose( file ) != 0 && ok ){
+		ofLogError("ofxSolarExporter") << "couldn't write " << path;
+		ok = false;
+	}
+	return ok;
+}
+
+bool ofxSolarExporter::write( FILE *file, int startYear, int startMonth, int startDay,
+	int endYear, int endMonth, int endDay ){
+	auto t0 = chrono::steady_clock::now();
+	memset( &stats, 0, sizeof(stats) );
+
+	Range range;
+	range.year = startYear;
+	range.month = startMonth;
+	range.day = startDay;
+	range.first = days_since_2000_Jan_0(startYear,startMonth,startDay);
+	long last = days_since_2000_Jan_0(endYear,endMonth,endDay);
+	range.days = last >= range.first ? (size_t)( last - range.first + 1 ) : 0;
+	size_t sites = range.days ? lat.size() : 0;
+
+	/* The header first, through the same path as the chunks */
+	vector<char> header;
+	if ( format == OFXSOLAR_EXPORT_CSV ){
+		string line = "site,date";
+		for ( int e = 0; e < 8; e++ )
+			line += string( "," ) + eventNames[e];
+		line += ",day_length\n";
+		header.assign( line.begin(), line.end() );
+	}else if ( format == OFXSOLAR_EXPORT_BINARY ){
+		ofxSolarExportHeader h;
+		memset( &h, 0, sizeof(h) );
+		memcpy( h.magic, exportMagic, sizeof(exportMagic) );
+		h.version = 1;
+		h.byteOrder = 0x01020304;
+		h.sites = (uint32_t)sites;
+		h.days = (uint32_t)range.days;
+		h.firstDay = (int32_t)range.first;
+		header.assign( (const char *)&h, (const char *)&h + sizeof(h) );
+	}
+	fflush( file );
+	const vector<char> *first = &header;
+	if ( !header.empty() && !writeAll( file, &first, 1 ) ){
+		ofLogError("ofxSolarExporter") << "write failed";
+		return false;
+	}
+	stats.bytes = header.size();
+
+	/* Whole sites per chunk, about a buffer each */
+	size_t sitesPerChunk = max( (size_t)1, bufferSize / max( (size_t)1, range.days * rowSize() ) );
+	size_t chunks = ( sites + sitesPerChunk - 1 ) / sitesPerChunk;
+
+	int workers = threads > 0 ? threads : (int)max( 1u, thread::hardware_concurrency() );
+	workers = (int)min( (size_t)workers, max( chunks, (size_t)1 ) );
+
+	/* Chunk c is formatted into slot c % slots once chunk c - slots is written */
+	struct Slot{
+		vector<char> data;
+		bool ready;
+	};
+	size_t slots = 2 * workers;
+	vector<Slot> pool( slots );
+	for ( size_t i = 0; i < slots; i++ )
+		pool[i].ready = false;
+
+	mutex guard;
+	condition_variable changed;
+	size_t next = 0, written = 0;
+	bool failed = false;
+
+	auto work = [&]{
+		vector<char> buffer;
+		for ( ;; ){
+			size_t chunk;
+			{
+				unique_lock<mutex> lock( guard );
+				if ( next >= chunks || failed )
+					return;
+				chunk = next++;
+				changed.wait( lock, [&]{ return chunk < written + slots || failed; } );
+				if ( failed )
+					return;
+				/* The slot is free, take its buffer to format unlocked */
+				buffer.swap( pool[chunk % slots].data );
+			}
+			size_t firstSite = chunk * sitesPerChunk;
+			size_t length = formatChunk( range, firstSite, min( firstSite + sitesPerChunk, sites ), buffer );
+			buffer.resize( length );
+			{
+				lock_guard<mutex> lock( guard );
+				pool[chunk % slots].data.swap( buffer );
+				pool[chunk % slots].ready = true;
+			}
+			changed.notify_all();
+		}
+	};
+
+	vector<thread> pool_threads;
+	for ( int i = 0; i < workers && chunks > 0; i++ )
+		pool_threads.push_back( thread( work ) );
+
+	/* Writes every run of finished chunks in order */
+	vector<const vector<char> *> ready;
+	while ( written < chunks && !failed ){
+		size_t begin, count = 0;
+		{
+			unique_lock<mutex> lock( guard );
+			changed.wait( lock, [&]{ return pool[written % slots].ready; } );
+			begin = written;
+			ready.clear();
+			while ( begin + count < chunks && count < slots && pool[( begin + count ) % slots].ready ){
+				ready.push_back( &pool[( begin + count ) % slots].data );
+				count++;
+			}
+		}
+		bool ok = writeAll( file, ready.data(), count );
+		{
+			lock_guard<mutex> lock( guard );
+			for ( size_t i = 0; i < count; i++ ){
+				Slot &slot = pool[( begin + i ) % slots];
+				stats.bytes += slot.data.size();
+				slot.ready = false;
+			}
+			written += count;
+			if ( !ok )
+				failed = true;
+		}
+		changed.notify_all();
+	}
+
+	for ( size_t i = 0; i < pool_threads.size(); i++ )
+		pool_threads[i].join();
+
+	stats.seconds = chrono::duration<double>( chrono::steady_clock::now() - t0 ).count();
+	if ( failed ){
+		ofLogError("ofxSolarExporter") << "write failed";
+		return false;
+	}
+	stats.rows = (uint64_t)sites * range.days;
+	return true;
+}
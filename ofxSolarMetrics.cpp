@@ -0,0 +1,231 @@
+#include "ofxSolarMetrics.h"
+
+#include <cstdarg>
+
+static const char * const metricNames[OFXSOLAR_METRIC_COUNT] = {
+	"calculateSunMap", "update", "sunriset", "dayLength", "dayEvents", "sunpos", "format"
+};
+
+/* Counters of one thread, written only by that thread */
+
+struct ofxSolarMetricsCounters{
+	atomic<uint64_t> count[OFXSOLAR_METRIC_COUNT];
+	atomic<uint64_t> ticks[OFXSOLAR_METRIC_COUNT];
+	atomic<uint64_t> buckets[OFXSOLAR_METRIC_COUNT][OFXSOLAR_METRICS_BUCKETS];
+
+	ofxSolarMetricsCounters(){
+		for ( int m = 0; m < OFXSOLAR_METRIC_COUNT; m++ ){
+			count[m] = ticks[m] = 0;
+			for ( int b = 0; b < OFXSOLAR_METRICS_BUCKETS; b++ )
+				buckets[m][b] = 0;
+		}
+	}
+};
+
+/* Plain sums for the snapshot */
+
+struct ofxSolarMetricsTotals{
+	uint64_t count[OFXSOLAR_METRIC_COUNT];
+	uint64_t ticks[OFXSOLAR_METRIC_COUNT];
+	uint64_t buckets[OFXSOLAR_METRIC_COUNT][OFXSOLAR_METRICS_BUCKETS];
+
+	void add( const ofxSolarMetricsCounters &counters ){
+		for ( int m = 0; m < OFXSOLAR_METRIC_COUNT; m++ ){
+			count[m] += counters.count[m].load( memory_order_relaxed );
+			ticks[m] += counters.ticks[m].load( memory_order_relaxed );
+			for ( int b = 0; b < OFXSOLAR_METRICS_BUCKETS; b++ )
+				buckets[m][b] += counters.buckets[m][b].load( memory_order_relaxed );
+		}
+	}
+};
+
+/* Live threads, what exited threads counted, and the totals at reset() */
+
+static mutex metricsGuard;
+static vector<ofxSolarMetricsCounters *> metricsThreads;
+static ofxSolarMetricsTotals metricsRetired, metricsBaseline;
+
+/* The tick clock against the steady clock, from the start of the process */
+
+static const uint64_t metricsStartTicks = ofxSolarMetrics::ticks();
+static const chrono::steady_clock::time_point metricsStartTime = chrono::steady_clock::now();
+
+struct ofxSolarMetricsThread{
+	ofxSolarMetricsCounters counters;
+
+	ofxSolarMetricsThread(){
+		lock_guard<mutex> lock( metricsGuard );
+		metricsThreads.push_back( &counters );
+	}
+	~ofxSolarMetricsThread(){
+		lock_guard<mutex> lock( metricsGuard );
+		metricsRetired.add( counters );
+		metricsThreads.erase( find( metricsThreads.begin(), metricsThreads.end(), &counters ) );
+	}
+};
+
+/* Four buckets per power of two, exact below 8 ticks */
+
+static inline int bucketOf( uint64_t ticks ){
+	if ( ticks < 8 )
+		return (int)ticks;
+#if defined(_MSC_VER)
+	unsigned long e;
+	_BitScanReverse64( &e, ticks );
+#else
+	int e = 63 - __builtin_clzll( ticks );
+#endif
+	return 8 + ( e - 3 ) * 4 + (int)( ( ticks >> ( e - 2 ) ) & 3 );
+}
+
+/* Middle of a bucket in ticks */
+
+static inline double bucketValue( int bucket ){
+	if ( bucket < 8 )
+		return bucket;
+	int e = ( bucket - 8 ) / 4 + 3, sub = ( bucket - 8 ) % 4;
+	double low = ldexp( 4.0 + sub, e - 2 );
+	return low + ldexp( 0.5, e - 2 );
+}
+
+static inline void bump( atomic<uint64_t> &counter, uint64_t value ){
+	counter.store( counter.load( memory_order_relaxed ) + value, memory_order_relaxed );
+}
+
+void ofxSolarMetrics::record( ofxSolarMetric metric, uint64_t ticks ){
+	static thread_local ofxSolarMetricsThread thread;
+	ofxSolarMetricsCounters &counters = thread.counters;
+	bump( counters.count[metric], 1 );
+	bump( counters.ticks[metric], ticks );
+	bump( counters.buckets[metric][ bucketOf( ticks ) ], 1 );
+}
+
+bool ofxSolarMetrics::isEnabled(){
+#ifdef OFXSOLAR_INSTRUMENT
+	return true;
+#else
+	return false;
+#endif
+}
+
+/* Totals of all threads, metricsGuard held */
+
+static void metricsTotals( ofxSolarMetricsTotals *totals ){
+	*totals = metricsRetired;
+	for ( size_t i = 0; i < metricsThreads.size(); i++ )
+		totals->add( *metricsThreads[i] );
+}
+
+static double secondsPerTick(){
+	uint64_t ticks = ofxSolarMetrics::ticks() - metricsStartTicks;
+	double seconds = chrono::duration<double>( chrono::steady_clock::now() - metricsStartTime ).count();
+
+	/* Too early to tell, wait a little */
+	if ( seconds < 0.01 ){
+		this_thread::sleep_for( chrono::milliseconds( 10 ) );
+		return secondsPerTick();
+	}
+	return ticks > 0 ? seconds / ticks : 0.0;
+}
+
+ofxSolarMetricsSnapshot ofxSolarMetrics::snapshot(){
+	ofxSolarMetricsSnapshot snapshot;
+	memset( &snapshot, 0, sizeof(snapshot) );
+	snapshot.enabled = isEnabled();
+
+	unique_ptr<ofxSolarMetricsTotals> totals( new ofxSolarMetricsTotals );
+	{
+		lock_guard<mutex> lock( metricsGuard );
+		metricsTotals( totals.get() );
+		for ( int m = 0; m < OFXSOLAR_METRIC_COUNT; m++ ){
+			totals->count[m] -= metricsBaseline.count[m];
+			totals->ticks[m] -= metricsBaseline.ticks[m];
+			for ( int b = 0; b < OFXSOLAR_METRICS_BUCKETS; b++ )
+				totals->buckets[m][b] -= metricsBaseline.buckets[m][b];
+		}
+	}
+
+	double tick = secondsPerTick();
+	for ( int m = 0; m < OFXSOLAR_METRIC_COUNT; m++ ){
+		ofxSolarMetricSummary &summary = snapshot.metric[m];
+		summary.name = metricNames[m];
+		summary.count = totals->count[m];
+		summary.seconds = totals->ticks[m] * tick;
+		summary.mean = summary.count ? summary.seconds / summary.count : 0.0;
+
+		/* Percentiles from the histogram */
+		const double quantiles[3] = { 0.5, 0.9, 0.99 };
+		double *values[3] = { &summary.p50, &summary.p90, &summary.p99 };
+		uint64_t seen = 0;
+		int q = 0;
+		for ( int b = 0; b < OFXSOLAR_METRICS_BUCKETS && q < 3 && summary.count; b++ ){
+			seen += totals->buckets[m][b];
+			while ( q < 3 && seen >= quantiles[q] * summary.count && seen > 0 )
+				*values[q++] = bucketValue( b ) * tick;
+		}
+	}
+	return snapshot;
+}
+
+void ofxSolarMetrics::reset(){
+	lock_guard<mutex> lock( metricsGuard );
+	metricsTotals( &metricsBaseline );
+}
+
+
+/* Export */
+
+static void appendf( string &text, const char *format, ... ){
+	char line[256];
+	va_list args;
+	va_start( args, format );
+	int n = vsnprintf( line, sizeof(line), format, args );
+	va_end( args );
+	if ( n > 0 )
+		text.append( line, min( (size_t)n, sizeof(line) - 1 ) );
+}
+
+string ofxSolarMetrics::toPrometheus(){
+	return toPrometheus( snapshot() );
+}
+
+string ofxSolarMetrics::toPrometheus( const ofxSolarMetricsSnapshot &snapshot ){
+	string text;
+	text += "# HELP ofxsolar_instrumented 1 if ofxSolar was built with OFXSOLAR_INSTRUMENT\n";
+	text += "# TYPE ofxsolar_instrumented gauge\n";
+	appendf( text, "ofxsolar_instrumented %d\n", snapshot.enabled ? 1 : 0 );
+	text += "# HELP ofxsolar_call_seconds Time spent in ofxSolar functions, inclusive\n";
+	text += "# TYPE ofxsolar_call_seconds summary\n";
+	for ( int m = 0; m < OFXSOLAR_METRIC_COUNT; m++ ){
+		const ofxSolarMetricSummary &s = snapshot.metric[m];
+		if ( !s.name )
+			continue;
+		appendf( text, "ofxsolar_call_seconds{function=\"%s\",quantile=\"0.5\"} %.9g\n", s.name, s.p50 );
+		appendf( text, "ofxsolar_call_seconds{function=\"%s\",quantile=\"0.9\"} %.9g\n", s.name, s.p90 );
+		appendf( text, "ofxsolar_call_seconds{function=\"%s\",quantile=\"0.99\"} %.9g\n", s.name, s.p99 );
+		appendf( text, "ofxsolar_call_seconds_sum{function=\"%s\"} %.9g\n", s.name, s.seconds );
+		appendf( text, "ofxsolar_call_seconds_count{function=\"%s\"} %llu\n", s.name, (unsigned long long)s.count );
+	}
+	return text;
+}
+
+string ofxSolarMetrics::toJson(){
+	return toJson( snapshot() );
+}
+
+string ofxSolarMetrics::toJson( const ofxSolarMetricsSnapshot &snapshot ){
+	string text;
+	appendf( text, "{\"enabled\":%s,\"functions\":[", snapshot.enabled ? "true" : "false" );
+	bool first = true;
+	for ( int m = 0; m < OFXSOLAR_METRIC_COUNT; m++ ){
+		const ofxSolarMetricSummary &s = snapshot.metric[m];
+		if ( !s.name )
+			continue;
+		appendf( text, "%s{\"name\":\"%s\",\"count\":%llu,\"seconds\":%.9g,\"mean\":%.9g,"
+			"\"p50\":%.9g,\"p90\":%.9g,\"p99\":%.9g}", first ? "" : ",", s.name,
+			(unsigned long long)s.count, s.seconds, s.mean, s.p50, s.p90, s.p99 );
+		first = false;
+	}
+	text += "]}\n";
+	return text;
+}
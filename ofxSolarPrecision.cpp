@@ -0,0 +1,227 @@
+/*
+
+The fast and accurate tiers of ofxSolar::dayEvents()
+
+OFXSOLAR_PRECISION_FAST evaluates the same algorithm as sunriset() in
+single precision. Only the reduction of the day number dependent angles
+is done in double, sine and cosine are short polynomials after reduction
+to +-45 degrees, the arctangent a polynomial on 0..1, and the declination
+is taken from the rectangular coordinates without an arctangent.
+
+OFXSOLAR_PRECISION_DEFAULT is sunriset(): one ephemeris evaluation at
+local noon, the declination is held for the whole day.
+
+OFXSOLAR_PRECISION_ACCURATE starts from that and then, for every event on
+its own, re-evaluates sun_RA_dec() at the event instant and moves the
+instant to where the hour angle meets the one required by the declination
+of that instant, until it moves less than 0.01 seconds, usually in three
+or four steps. When the Sun doesn't reach the altitude at the converged
+instant the return code is -1 or +1 as in sunriset() and the times are
+those of the default tier.
+
+Errors against ofxSolarReference.inl, the dataset that
+ofxSolarVerify::reference() checks (Meeus' low precision solar
+coordinates, about 0.01 degrees, apparent longitude, iterated to each
+event; the LOCATION_* sites and latitudes from pole to pole, solstices
+and equinoxes of 1801-2099, see ofxSolarReference.py). Rise/set and the three twilights in seconds, over
+the same latitude bands reference() reports; example-verify prints the
+maxima, the time per dayEvents() is BM_dayEvents* of example-benchmark on
+one core of a virtualized x86-64 Xeon, GCC -O2:
+
+	                |lat| <= 60             all latitudes           time per
+	                median  99%     max     median  99%     max     dayEvents()
+	FAST            9.3     69      144     9.8     235     526     205-290 ns
+	DEFAULT         9.3     69      144     9.8     235     526     235-350 ns
+	ACCURATE        0.75    2.4     6.1     0.80    4.1     12.3    6-8.5 us
+
+The polar day and night codes of all three tiers match the reference's on
+all 2521 events where either has one. The fast tier stays within 0.25
+seconds of the default one for the well conditioned events of
+ofxSolarVerify::differential(), its error is the default tier's. That
+comes from holding the noon declination, worst where the Sun moves fast
+in declination, at high latitudes, and for longitudes near 180 degrees
+where sunriset() returns events up to a day away from the noon it
+evaluated. The reference leaves out the events where the Sun only just
+reaches the altitude, |cos H0| > 0.97; there a hundredth of a degree
+moves the event by minutes, for the accurate tier too.
+
+*/
+
+#include "ofxSolar.h"
+
+#define RADEG_F   ( (float)RADEG )
+#define DEGRAD_F  ( (float)DEGRAD )
+
+/* Sine and cosine of x degrees, |x| up to a few thousand */
+
+static inline void sincosDegF( float x, float *s, float *c ){
+	float k = floorf( x * ( 1.0f / 90.0f ) + 0.5f );
+	float r = ( x - 90.0f * k ) * DEGRAD_F;
+	float z = r * r;
+	float sn = r * ( 1.0f + z * ( -1.6666654e-1f + z * ( 8.3321608e-3f + z * -1.9515296e-4f ) ) );
+	float cs = 1.0f + z * ( -0.5f + z * ( 4.1666645e-2f + z * ( -1.3887316e-3f + z * 2.4433157e-5f ) ) );
+
+	switch ( (int)k & 3 ){
+	case 0:  *s = sn;  *c = cs;  break;
+	case 1:  *s = cs;  *c = -sn; break;
+	case 2:  *s = -sn; *c = -cs; break;
+	default: *s = -cs; *c = sn;  break;
+	}
+}
+
+/* Degrees */
+
+static inline float atan2DegF( float y, float x ){
+	float ax = fabsf(x), ay = fabsf(y);
+	float hi = max( ax, ay ), lo = min( ax, ay );
+	float a = hi > 0.0f ? lo / hi : 0.0f;
+	float z = a * a;
+	float r = a * ( 0.99997726f + z * ( -0.33262347f + z * ( 0.19354346f + z * ( -0.11643287f +
+		z * ( 0.05265332f + z * -0.01172120f ) ) ) ) );
+	if ( ay > ax )
+		r = 1.57079633f - r;
+	if ( x < 0.0f )
+		r = 3.14159265f - r;
+	return ( y < 0.0f ? -r : r ) * RADEG_F;
+}
+
+static inline float acosDegF( float x ){
+	return atan2DegF( sqrtf( ( 1.0f - x ) * ( 1.0f + x ) ), x );
+}
+
+/* Half diurnal arc in hours and return code, as ofxSolar::diurnalArc() */
+
+static inline int diurnalArcF( float sin_altit, float sin_lat, float cos_lat, float sin_dec, float cos_dec, float *t ){
+	float cost = ( sin_altit - sin_lat * sin_dec ) / ( cos_lat * cos_dec );
+	if ( cost >= 1.0f ){
+		*t = 0.0f;
+		return -1;
+	}
+	if ( cost <= -1.0f ){
+		*t = 12.0f;
+		return +1;
+	}
+	*t = acosDegF( cost ) / 15.0f;
+	return 0;
+}
+
+void ofxSolar::dayEventsFast( long daynum, double lat, double lon, double tz, ofxSolarDay *events ){
+	static const float sin6 = (float)sind(-6.0), sin12 = (float)sind(-12.0), sin18 = (float)sind(-18.0);
+	float s, c, t;
+
+	/* Day number dependent angles are reduced in double, the rest is float */
+	double d = daynum + 0.5 - lon/360.0;
+	float M = (float)revolution( 356.0470 + 0.9856002585 * d );
+	float w = (float)( 282.9404 + 4.70935E-5 * d );
+	float e = (float)( 0.016709 - 1.151E-9 * d );
+	float obl_ecl = (float)( 23.4393 - 3.563E-7 * d );
+
+	/* sunpos() */
+	sincosDegF( M, &s, &c );
+	float E = M + e * RADEG_F * s * ( 1.0f + e * c );
+	sincosDegF( E, &s, &c );
+	float x = c - e;
+	float y = sqrtf( 1.0f - e*e ) * s;
+	float r = sqrtf( x*x + y*y );
+	float slon = atan2DegF( y, x ) + w;
+
+	/* sun_RA_dec(), the declination from its sine and cosine */
+	sincosDegF( slon, &s, &c );
+	x = r * c;
+	y = r * s;
+	sincosDegF( obl_ecl, &s, &c );
+	float z = y * s;
+	y = y * c;
+	float RA = atan2DegF( y, x );
+	float sin_dec = z / r, cos_dec = sqrtf( x*x + y*y ) / r;
+
+	/* Local sidereal time and the time when Sun is at south, hours UT */
+	double sidtime = revolution( GMST0(d) + 180.0 + lon );
+	float tsouth = (float)( 12.0 - rev180( sidtime - RA ) / 15.0 + tz );
+
+	float sin_lat, cos_lat, sin_rs;
+	sincosDegF( (float)lat, &sin_lat, &cos_lat );
+	cos_lat = fabsf( cos_lat );    /* -0 at +90 would flip the sign of the infinite cost */
+	sincosDegF( -35.0f/60.0f - 0.2666f / r, &sin_rs, &c );
+
+	events->rs = diurnalArcF( sin_rs, sin_lat, cos_lat, sin_dec, cos_dec, &t );
+	events->rise = tsouth - t;
+	events->set  = tsouth + t;
+	events->dayleng = 2.0f * t;
+
+	events->civ = diurnalArcF( sin6, sin_lat, cos_lat, sin_dec, cos_dec, &t );
+	events->civ_start = tsouth - t;
+	events->civ_end   = tsouth + t;
+	events->civlen = 2.0f * t;
+
+	events->naut = diurnalArcF( sin12, sin_lat, cos_lat, sin_dec, cos_dec, &t );
+	events->naut_start = tsouth - t;
+	events->naut_end   = tsouth + t;
+	events->nautlen = 2.0f * t;
+
+	events->astr = diurnalArcF( sin18, sin_lat, cos_lat, sin_dec, cos_dec, &t );
+	events->astr_start = tsouth - t;
+	events->astr_end   = tsouth + t;
+	events->astrlen = 2.0f * t;
+}
+
+
+/* Moves *t, hours UT after daynum 0h, to the instant when the Sun crosses */
+/* altit, rising for sign -1, setting for +1. Returns the return code of   */
+/* sunriset() at that instant.                                             */
+
+static int refineEvent( long daynum, double lat, double lon, double altit, int upper_limb, double sign, double *t ){
+	int rc = 0;
+
+	for ( int i = 0; i < 8; i++ ){
+		double d = daynum + *t / 24.0;
+		double sRA, sdec, sr;
+		ofxSolar::sun_RA_dec( d, &sRA, &sdec, &sr );
+
+		double alt = upper_limb ? altit - 0.2666 / sr : altit;
+		double cost = ( sind(alt) - sind(lat) * sind(sdec) ) / ( cosd(lat) * cosd(sdec) );
+		rc = cost >= 1.0 ? -1 : cost <= -1.0 ? +1 : 0;
+		double ha = sign * ( rc < 0 ? 0.0 : rc > 0 ? 180.0 : acosd(cost) );
+
+		/* Local hour angle now, GMST = GMST0 + UT, and the step to the target */
+		double lha = ofxSolar::GMST0(d) + ( d - floor(d) ) * 360.0 + lon - sRA;
+		double step = ofxSolar::rev180( ha - lha ) / ( 15.0 * ( 1.0 + ( 0.9856002585 + 4.70935E-5 ) / 360.0 ) );
+		*t += step;
+		if ( fabs(step) < 0.01 / 3600.0 )
+			break;
+	}
+	return rc;
+}
+
+void ofxSolar::dayEventsAccurate( long daynum, double lat, double lon, double tz, ofxSolarDay *events ){
+	static const double altitude[4] = { -35.0/60.0, -6.0, -12.0, -18.0 };
+	double *start[4] = { &events->rise, &events->civ_start, &events->naut_start, &events->astr_start };
+	double *end[4] = { &events->set, &events->civ_end, &events->naut_end, &events->astr_end };
+	double *length[4] = { &events->dayleng, &events->civlen, &events->nautlen, &events->astrlen };
+	int *code[4] = { &events->rs, &events->civ, &events->naut, &events->astr };
+
+	/* The default tier is the starting point and the fallback */
+	ofxSolarDayState state = dayState( daynum, lon );
+	dayEvents( state, lat, tz, events );
+
+	for ( int i = 0; i < 4; i++ ){
+		double t;
+		diurnalArc( state, lat, altitude[i], i == 0, &t );
+		double rise = state.tsouth - t, set = state.tsouth + t;
+		int rcRise = refineEvent( daynum, lat, lon, altitude[i], i == 0, -1.0, &rise );
+		int rcSet = refineEvent( daynum, lat, lon, altitude[i], i == 0, +1.0, &set );
+
+		if ( rcRise == 0 && rcSet == 0 ){
+			*start[i] = rise + tz;
+			*end[i] = set + tz;
+			*length[i] = set - rise;
+			*code[i] = 0;
+		}else if ( *code[i] == 0 ){
+			/* The noon ephemeris has a crossing, the event instants don't */
+			*code[i] = rcRise != 0 ? rcRise : rcSet;
+			*length[i] = *code[i] > 0 ? 24.0 : 0.0;
+			*start[i] = state.tsouth - *length[i] / 2.0 + tz;
+			*end[i] = state.tsouth + *length[i] / 2.0 + tz;
+		}
+	}
+}
@@ -0,0 +1,201 @@
+#include "ofxSolarRaster.h"
+#include "ofxSolarBatch.h"
+
+ofxSolarRaster::ofxSolarRaster(){
+	threads = 0;
+	setup( 360, 180 );
+}
+
+void ofxSolarRaster::setup( int width, int height, double west, double south, double east, double north ){
+	this->width = max( width, 1 );
+	this->height = max( height, 1 );
+	this->west = west;
+	this->north = north;
+	lonStep = ( east - west ) / this->width;
+	latStep = ( north - south ) / this->height;
+}
+
+void ofxSolarRaster::setThreads( int threads ){
+	this->threads = threads;
+}
+
+int ofxSolarRaster::getWidth() const{
+	return width;
+}
+int ofxSolarRaster::getHeight() const{
+	return height;
+}
+double ofxSolarRaster::getLatitude( int row ) const{
+	return north - ( row + 0.5 ) * latStep;
+}
+double ofxSolarRaster::getLongitude( int column ) const{
+	return west + ( column + 0.5 ) * lonStep;
+}
+
+void ofxSolarRaster::parallelRows( int first, int last, const function<void( int, int )> &rows ) const{
+	int n = threads > 0 ? threads : max( 1u, thread::hardware_concurrency() );
+	/* Don't bother with threads for less than about 64k cells each */
+	n = min( n, (int)( (size_t)( last - first ) * width / 65536 ) + 1 );
+
+	if ( n == 1 ){
+		rows( first, last );
+		return;
+	}
+	vector<thread> workers;
+	int block = ( last - first + n - 1 ) / n;
+	for ( int begin = first; begin < last; begin += block )
+		workers.push_back( thread( rows, begin, min( begin + block, last ) ) );
+	for ( size_t i = 0; i < workers.size(); i++ )
+		workers[i].join();
+}
+
+
+/* Day length: with the Sun's declination dec and the altitude altit of the */
+/* column's local noon, the cosine of the diurnal arc of ofxSolar::         */
+/* diurnalArc() is                                                          */
+/*                                                                          */
+/*   cost = sin(altit)/(cos(lat)*cos(dec)) - tan(lat)*tan(dec)              */
+/*        = a[column]/cos(lat) - b[column]*tan(lat)                         */
+
+void ofxSolarRaster::dayLengthColumns( int year, int month, int day, double altit, bool upper_limb, Columns &columns ) const{
+	long daynum = days_since_2000_Jan_0(year,month,day);
+	vector<double> d( width ), RA( width ), dec( width ), r( width );
+
+	for ( int i = 0; i < width; i++ )
+		d[i] = daynum + 0.5 - getLongitude(i)/360.0;
+	ofxSolarBatch::sun_RA_dec( d.data(), width, RA.data(), dec.data(), r.data() );
+
+	columns.a.resize( width );
+	columns.b.resize( width );
+	for ( int i = 0; i < width; i++ ){
+		double alt = upper_limb ? altit - 0.2666 / r[i] : altit;
+		columns.a[i] = sind(alt) / cosd(dec[i]);
+		columns.b[i] = tand(dec[i]);
+	}
+}
+
+void ofxSolarRaster::dayLengthRows( const Columns &columns, int begin, int end, float *out ) const{
+	const double *a = columns.a.data(), *b = columns.b.data();
+
+	for ( int row = begin; row < end; row++, out += width ){
+		double lat = getLatitude(row);
+		double inv_cos_lat = 1.0 / cosd(lat), tan_lat = tand(lat);
+
+		/* Clamped like diurnalArc(): cost >= 1 is 0 hours, cost <= -1 is 24 */
+		for ( int i = 0; i < width; i++ ){
+			double cost = a[i] * inv_cos_lat - b[i] * tan_lat;
+			cost = cost > 1.0 ? 1.0 : cost < -1.0 ? -1.0 : cost;
+			out[i] = (float)( acos(cost) * ( 2.0 * RADEG / 15.0 ) );
+		}
+	}
+}
+
+void ofxSolarRaster::dayLength( int year, int month, int day, float *out, double altit, bool upper_limb ) const{
+	Columns columns;
+	dayLengthColumns( year, month, day, altit, upper_limb, columns );
+	parallelRows( 0, height, [&]( int begin, int end ){
+		dayLengthRows( columns, begin, end, out + (size_t)begin * width );
+	} );
+}
+
+
+/* Elevation: sin(elevation) = sin(lat)*sin(dec) + cos(lat)*cos(dec)*cos(H), */
+/* a[column] = cos(H) at the column's longitude                              */
+
+void ofxSolarRaster::elevationColumns( double d, Columns &columns, double *sin_dec, double *cos_dec, double *sr ) const{
+	double sRA, sdec;
+
+	ofxSolar::sun_RA_dec( d, &sRA, &sdec, sr );
+	*sin_dec = sind(sdec);
+	*cos_dec = cosd(sdec);
+
+	/* Hour angle at Greenwich, GMST = GMST0 + UT */
+	double ha0 = ofxSolar::GMST0(d) + ( d - floor(d) ) * 360.0 - sRA;
+	columns.a.resize( width );
+	for ( int i = 0; i < width; i++ )
+		columns.a[i] = cosd( ha0 + getLongitude(i) );
+}
+
+void ofxSolarRaster::elevationRows( const Columns &columns, double sin_dec, double cos_dec, int begin, int end, float *out ) const{
+	const double *cos_ha = columns.a.data();
+
+	for ( int row = begin; row < end; row++, out += width ){
+		double lat = getLatitude(row);
+		double s = sind(lat) * sin_dec, k = cosd(lat) * cos_dec;
+
+		for ( int i = 0; i < width; i++ ){
+			double v = s + k * cos_ha[i];
+			v = v > 1.0 ? 1.0 : v < -1.0 ? -1.0 : v;
+			out[i] = (float)( asin(v) * RADEG );
+		}
+	}
+}
+
+void ofxSolarRaster::elevation( double d, float *out ) const{
+	Columns columns;
+	double sin_dec, cos_dec, sr;
+	elevationColumns( d, columns, &sin_dec, &cos_dec, &sr );
+	parallelRows( 0, height, [&]( int begin, int end ){
+		elevationRows( columns, sin_dec, cos_dec, begin, end, out + (size_t)begin * width );
+	} );
+}
+
+void ofxSolarRaster::zones( double d, unsigned char *out ) const{
+	Columns columns;
+	double sin_dec, cos_dec, sr;
+	elevationColumns( d, columns, &sin_dec, &cos_dec, &sr );
+
+	/* Sines of the thresholds, the same altitudes as ofxSolar::dayEvents() */
+	const double astr = sind(-18.0), naut = sind(-12.0), civ = sind(-6.0);
+	const double rs = sind( -35.0/60.0 - 0.2666 / sr );
+	const double *cos_ha = columns.a.data();
+
+	parallelRows( 0, height, [&]( int begin, int end ){
+		unsigned char *p = out + (size_t)begin * width;
+		for ( int row = begin; row < end; row++, p += width ){
+			double lat = getLatitude(row);
+			double s = sind(lat) * sin_dec, k = cosd(lat) * cos_dec;
+
+			for ( int i = 0; i < width; i++ ){
+				double v = s + k * cos_ha[i];
+				p[i] = (unsigned char)( ( v > astr ) + ( v > naut ) + ( v > civ ) + ( v > rs ) );
+			}
+		}
+	} );
+}
+
+
+void ofxSolarRaster::tiles( int tileWidth, int tileHeight, TileCallback callback,
+	const function<void( int, int, float * )> &rows ) const{
+	tileWidth = max( 1, min( tileWidth, width ) );
+	tileHeight = max( 1, min( tileHeight, height ) );
+
+	/* One band of tile rows at a time, the tiles point into it */
+	vector<float> band( (size_t)tileHeight * width );
+	for ( int y = 0; y < height; y += tileHeight ){
+		int h = min( tileHeight, height - y );
+		parallelRows( y, y + h, [&]( int begin, int end ){
+			rows( begin, end, band.data() + (size_t)( begin - y ) * width );
+		} );
+		for ( int x = 0; x < width; x += tileWidth )
+			callback( x, y, min( tileWidth, width - x ), h, band.data() + x, width );
+	}
+}
+
+void ofxSolarRaster::dayLengthTiles( int year, int month, int day, int tileWidth, int tileHeight,
+	TileCallback callback, double altit, bool upper_limb ) const{
+	Columns columns;
+	dayLengthColumns( year, month, day, altit, upper_limb, columns );
+	tiles( tileWidth, tileHeight, callback, [&]( int begin, int end, float *out ){
+		dayLengthRows( columns, begin, end, out );
+	} );
+}
+
+void ofxSolarRaster::elevationTiles( double d, int tileWidth, int tileHeight, TileCallback callback ) const{
+	Columns columns;
+	double sin_dec, cos_dec, sr;
+	elevationColumns( d, columns, &sin_dec, &cos_dec, &sr );
+	tiles( tileWidth, tileHeight, callback, [&]( int begin, int end, float *out ){
+		elevationRows( columns, sin_dec, cos_dec, begin, end, out );
+	} );
+}
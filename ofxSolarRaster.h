@@ -0,0 +1,99 @@
+/*
+
+ofxSolarRaster - day length, solar elevation and day/twilight zones for
+every cell of a latitude/longitude grid
+
+Cells are row major, the first row is the northern edge, the first column
+the western edge, values are taken at the cell centers. All outputs go to
+caller owned buffers of width * height elements.
+
+The work is split so that the inner loops over the columns are plain
+arithmetic the compiler can vectorize:
+
+	dayLength()  the ephemeris at local noon only depends on the longitude,
+	             it is evaluated once per column (with the array version
+	             of sun_RA_dec() in ofxSolarBatch), the latitude once per
+	             row, the cell is a few multiplications and an arccosine.
+	elevation()  at one instant the declination is the same everywhere,
+	             the hour angle is evaluated once per column, the latitude
+	             once per row, the cell is an arcsine.
+	zones()      compares the sine of the elevation against the twilight
+	             thresholds, no trigonometry per cell at all.
+
+Rows are split into blocks over threads, setThreads(0), the default, uses
+all cores. The tile variants never hold more than a band of tileHeight
+rows and hand out tiles in row major order as they are done, for rasters
+that don't fit in memory.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+/* Values of zones() */
+
+enum ofxSolarZone{
+	OFXSOLAR_ZONE_NIGHT,
+	OFXSOLAR_ZONE_ASTRONOMICAL,   /* Sun between -18 and -12 degrees */
+	OFXSOLAR_ZONE_NAUTICAL,       /* Between -12 and -6 */
+	OFXSOLAR_ZONE_CIVIL,          /* Between -6 and -35' */
+	OFXSOLAR_ZONE_DAY             /* Upper limb above -35', as sunriset() */
+};
+
+class ofxSolarRaster{
+
+public:
+
+	/* Called with each tile, stride is the distance between rows in elements */
+	typedef function<void( int x, int y, int width, int height, const float *data, size_t stride )> TileCallback;
+
+	ofxSolarRaster();
+
+	/* Degrees, default the whole world */
+	void setup( int width, int height, double west = -180.0, double south = -90.0,
+		double east = 180.0, double north = 90.0 );
+	void setThreads( int threads );
+
+	int getWidth() const;
+	int getHeight() const;
+	double getLatitude( int row ) const;
+	double getLongitude( int column ) const;
+
+	/* Hours above altit, rise/set by default, 0 for polar night, 24 for polar day */
+	void dayLength( int year, int month, int day, float *out,
+		double altit = -35.0/60.0, bool upper_limb = true ) const;
+
+	/* Degrees, geometric, d = days since 2000 Jan 0.0 UT */
+	void elevation( double d, float *out ) const;
+
+	/* One ofxSolarZone per cell */
+	void zones( double d, unsigned char *out ) const;
+
+	void dayLengthTiles( int year, int month, int day, int tileWidth, int tileHeight,
+		TileCallback callback, double altit = -35.0/60.0, bool upper_limb = true ) const;
+	void elevationTiles( double d, int tileWidth, int tileHeight, TileCallback callback ) const;
+
+private:
+
+	struct Columns{
+		vector<double> a, b;        /* Per column terms, see ofxSolarRaster.cpp */
+	};
+
+	void dayLengthColumns( int year, int month, int day, double altit, bool upper_limb, Columns &columns ) const;
+	void elevationColumns( double d, Columns &columns, double *sin_dec, double *cos_dec, double *sr ) const;
+
+	void dayLengthRows( const Columns &columns, int begin, int end, float *out ) const;
+	void elevationRows( const Columns &columns, double sin_dec, double cos_dec, int begin, int end, float *out ) const;
+
+	/* Calls rows( begin, end ) for blocks of [first, last) on the threads */
+	void parallelRows( int first, int last, const function<void( int, int )> &rows ) const;
+
+	void tiles( int tileWidth, int tileHeight, TileCallback callback,
+		const function<void( int, int, float * )> &rows ) const;
+
+	int width, height;
+	double west, north, lonStep, latStep;
+	int threads;
+
+};
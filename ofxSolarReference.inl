@@ -0,0 +1,4491 @@
+/* Generated by ofxSolarReference.py, do not edit */
+
+static const ofxSolarReferenceSite referenceSites[] = {
+	{ "tokyo", LOCATION_TOKYO },
+	{ "beijing", LOCATION_BEIJING },
+	{ "newdelhi", LOCATION_NEWDELHI },
+	{ "moscow", LOCATION_MOSCOW },
+	{ "ankara", LOCATION_ANKARA },
+	{ "cairo", LOCATION_CAIRO },
+	{ "kiev", LOCATION_KIEV },
+	{ "istanbul", LOCATION_ISTANBUL },
+	{ "helsinki", LOCATION_HELSINKI },
+	{ "warshaw", LOCATION_WARSHAW },
+	{ "budapest", LOCATION_BUDAPEST },
+	{ "stockholm", LOCATION_STOCKHOLM },
+	{ "vienna", LOCATION_VIENNA },
+	{ "prague", LOCATION_PRAGUE },
+	{ "berlin", LOCATION_BERLIN },
+	{ "copenhagen", LOCATION_COPENHAGEN },
+	{ "rome", LOCATION_ROME },
+	{ "munich", LOCATION_MUNICH },
+	{ "oslo", LOCATION_OSLO },
+	{ "hamburg", LOCATION_HAMBURG },
+	{ "frankfurtam", LOCATION_FRANKFURTAM },
+	{ "cologne", LOCATION_COLOGNE },
+	{ "amsterdam", LOCATION_AMSTERDAM },
+	{ "brussels", LOCATION_BRUSSELS },
+	{ "paris", LOCATION_PARIS },
+	{ "london", LOCATION_LONDON },
+	{ "madrid", LOCATION_MADRID },
+	{ "rabat", LOCATION_RABAT },
+	{ "lisbon", LOCATION_LISBON },
+	{ "reykjavik", LOCATION_REYKJAVIK },
+	{ "nuuk", LOCATION_NUUK },
+	{ "newyork", LOCATION_NEWYORK },
+	{ "ottawa", LOCATION_OTTAWA },
+	{ "washingtondc", LOCATION_WASHINGTONDC },
+	{ "toronto", LOCATION_TORONTO },
+	{ "austintx", LOCATION_AUSTINTX },
+	{ "milwaukee", LOCATION_MILWAUKEE },
+	{ "mexicocity", LOCATION_MEXICOCITY },
+	{ "regina", LOCATION_REGINA },
+	{ "sanfrancisco", LOCATION_SANFRANCISCO },
+	{ "vancouver", LOCATION_VANCOUVER },
+	{ "sydney", LOCATION_SYDNEY },
+	{ "johannesburg", LOCATION_JOHANNESBURG },
+	{ "capetown", LOCATION_CAPETOWN },
+	{ "saopaulo", LOCATION_SAOPAULO },
+	{ "buenosaires", LOCATION_BUENOSAIRES },
+	{ "lima", LOCATION_LIMA },
+	{ "-90,0", -90.000, 0.000 },
+	{ "-90,100.5", -90.000, 100.500 },
+	{ "-90,-150.25", -90.000, -150.250 },
+	{ "-80,0", -80.000, 0.000 },
+	{ "-80,100.5", -80.000, 100.500 },
+	{ "-80,-150.25", -80.000, -150.250 },
+	{ "-70,0", -70.000, 0.000 },
+	{ "-70,100.5", -70.000, 100.500 },
+	{ "-70,-150.25", -70.000, -150.250 },
+	{ "-60,0", -60.000, 0.000 },
+	{ "-60,100.5", -60.000, 100.500 },
+	{ "-60,-150.25", -60.000, -150.250 },
+	{ "-50,0", -50.000, 0.000 },
+	{ "-50,100.5", -50.000, 100.500 },
+	{ "-50,-150.25", -50.000, -150.250 },
+	{ "-40,0", -40.000, 0.000 },
+	{ "-40,100.5", -40.000, 100.500 },
+	{ "-40,-150.25", -40.000, -150.250 },
+	{ "-30,0", -30.000, 0.000 },
+	{ "-30,100.5", -30.000, 100.500 },
+	{ "-30,-150.25", -30.000, -150.250 },
+	{ "-20,0", -20.000, 0.000 },
+	{ "-20,100.5", -20.000, 100.500 },
+	{ "-20,-150.25", -20.000, -150.250 },
+	{ "-10,0", -10.000, 0.000 },
+	{ "-10,100.5", -10.000, 100.500 },
+	{ "-10,-150.25", -10.000, -150.250 },
+	{ "+0,0", 0.000, 0.000 },
+	{ "+0,100.5", 0.000, 100.500 },
+	{ "+0,-150.25", 0.000, -150.250 },
+	{ "+10,0", 10.000, 0.000 },
+	{ "+10,100.5", 10.000, 100.500 },
+	{ "+10,-150.25", 10.000, -150.250 },
+	{ "+20,0", 20.000, 0.000 },
+	{ "+20,100.5", 20.000, 100.500 },
+	{ "+20,-150.25", 20.000, -150.250 },
+	{ "+30,0", 30.000, 0.000 },
+	{ "+30,100.5", 30.000, 100.500 },
+	{ "+30,-150.25", 30.000, -150.250 },
+	{ "+40,0", 40.000, 0.000 },
+	{ "+40,100.5", 40.000, 100.500 },
+	{ "+40,-150.25", 40.000, -150.250 },
+	{ "+50,0", 50.000, 0.000 },
+	{ "+50,100.5", 50.000, 100.500 },
+	{ "+50,-150.25", 50.000, -150.250 },
+	{ "+60,0", 60.000, 0.000 },
+	{ "+60,100.5", 60.000, 100.500 },
+	{ "+60,-150.25", 60.000, -150.250 },
+	{ "+70,0", 70.000, 0.000 },
+	{ "+70,100.5", 70.000, 100.500 },
+	{ "+70,-150.25", 70.000, -150.250 },
+	{ "+80,0", 80.000, 0.000 },
+	{ "+80,100.5", 80.000, 100.500 },
+	{ "+80,-150.25", 80.000, -150.250 },
+	{ "+90,0", 90.000, 0.000 },
+	{ "+90,100.5", 90.000, 100.500 },
+	{ "+90,-150.25", 90.000, -150.250 },
+};
+
+static const ofxSolarReferenceDate referenceDates[] = {
+	{ 1801, 1, 1 }, { 1801, 3, 20 }, { 1801, 6, 21 }, { 1801, 9, 23 }, { 1801, 12, 21 }, { 1801, 1, 1 },
+	{ 1850, 3, 20 }, { 1850, 6, 21 }, { 1850, 9, 23 }, { 1850, 12, 21 }, { 1850, 6, 8 }, { 1900, 3, 20 },
+	{ 1900, 6, 21 }, { 1900, 9, 23 }, { 1900, 12, 21 }, { 1900, 11, 15 }, { 1950, 3, 20 }, { 1950, 6, 21 },
+	{ 1950, 9, 23 }, { 1950, 12, 21 }, { 1950, 4, 22 }, { 2000, 3, 20 }, { 2000, 6, 21 }, { 2000, 9, 23 },
+	{ 2000, 12, 21 }, { 2000, 9, 1 }, { 2026, 3, 20 }, { 2026, 6, 21 }, { 2026, 9, 23 }, { 2026, 12, 21 },
+	{ 2026, 2, 8 }, { 2050, 3, 20 }, { 2050, 6, 21 }, { 2050, 9, 23 }, { 2050, 12, 21 }, { 2050, 7, 15 },
+	{ 2099, 3, 20 }, { 2099, 6, 21 }, { 2099, 9, 23 }, { 2099, 12, 21 }, { 2099, 12, 22 }, { 2099, 12, 31 },
+};
+
+/* Site, date, codes of rise/set and the three twilights, their times */
+/* in seconds UT from 0h of the date                                  */
+static const ofxSolarReferenceRow referenceRows[] = {
+	{ 0, 0, { 0, 0, 0, 0 }, { -7736, 27502, -9431, 29197, -11344, 31110, -13208, 32974 } },
+	{ 0, 1, { 0, 0, 0, 0 }, { -11636, 31926, -13157, 33450, -14938, 35235, -16740, 37041 } },
+	{ 0, 2, { 0, 0, 0, 0 }, { -16528, 35973, -18331, 37776, -20573, 40018, -23064, 42509 } },
+	{ 0, 3, { 0, 0, 0, 0 }, { -12684, 31067, -14209, 32590, -15996, 34373, -17807, 36179 } },
+	{ 0, 4, { 0, 0, 0, 0 }, { -7990, 27082, -9692, 28784, -11612, 30704, -13482, 32573 } },
+	{ 0, 5, { 0, 0, 0, 0 }, { -7736, 27502, -9431, 29197, -11344, 31110, -13208, 32974 } },
+	{ 0, 6, { 0, 0, 0, 0 }, { -11649, 31930, -13170, 33454, -14952, 35239, -16753, 37045 } },
+	{ 0, 7, { 0, 0, 0, 0 }, { -16518, 35979, -18321, 37782, -20562, 40023, -23052, 42514 } },
+	{ 0, 8, { 0, 0, 0, 0 }, { -12677, 31056, -14201, 32578, -15988, 34361, -17799, 36167 } },
+	{ 0, 9, { 0, 0, 0, 0 }, { -7997, 27080, -9698, 28781, -11618, 30702, -13487, 32571 } },
+	{ 0, 10, { 0, 0, 0, 0 }, { -16533, 35683, -18318, 37470, -20529, 39686, -22973, 42135 } },
+	{ 0, 11, { 0, 0, 0, 0 }, { -11640, 31924, -13161, 33448, -14942, 35233, -16744, 37039 } },
+	{ 0, 12, { 0, 0, 0, 0 }, { -16509, 35985, -18312, 37788, -20553, 40029, -23043, 42519 } },
+	{ 0, 13, { 0, 0, 0, 0 }, { -12677, 31068, -14202, 32590, -15989, 34374, -17800, 36179 } },
+	{ 0, 14, { 0, 0, 0, 0 }, { -8007, 27073, -9708, 28774, -11628, 30694, -13497, 32563 } },
+	{ 0, 15, { 0, 0, 0, 0 }, { -9845, 27290, -11466, 28911, -13313, 30758, -15127, 32571 } },
+	{ 0, 16, { 0, 0, 0, 0 }, { -11633, 31915, -13154, 33438, -14935, 35223, -16736, 37029 } },
+	{ 0, 17, { 0, 0, 0, 0 }, { -16504, 35989, -18306, 37791, -20547, 40032, -23037, 42522 } },
+	{ 0, 18, { 0, 0, 0, 0 }, { -12681, 31078, -14206, 32601, -15993, 34384, -17804, 36190 } },
+	{ 0, 19, { 0, 0, 0, 0 }, { -8019, 27062, -9721, 28763, -11641, 30683, -13510, 32552 } },
+	{ 0, 20, { 0, 0, 0, 0 }, { -14365, 33550, -15958, 35148, -17866, 37062, -19855, 39061 } },
+	{ 0, 21, { 0, 0, 0, 0 }, { -11711, 31956, -13233, 33480, -15015, 35266, -16819, 37075 } },
+	{ 0, 22, { 0, 0, 0, 0 }, { -16485, 36004, -18288, 37807, -20528, 40047, -23017, 42536 } },
+	{ 0, 23, { 0, 0, 0, 0 }, { -12639, 31001, -14163, 32522, -15949, 34304, -17757, 36107 } },
+	{ 0, 24, { 0, 0, 0, 0 }, { -8002, 27081, -9703, 28782, -11623, 30702, -13492, 32571 } },
+	{ 0, 25, { 0, 0, 0, 0 }, { -13638, 32914, -15201, 34472, -17057, 36323, -18974, 38232 } },
+	{ 0, 26, { 0, 0, 0, 0 }, { -11686, 31941, -13207, 33465, -14989, 35251, -16792, 37058 } },
+	{ 0, 27, { 0, 0, 0, 0 }, { -16484, 36006, -18286, 37808, -20526, 40049, -23016, 42538 } },
+	{ 0, 28, { 0, 0, 0, 0 }, { -12649, 31028, -14174, 32550, -15960, 34333, -17769, 36137 } },
+	{ 0, 29, { 0, 0, 0, 0 }, { -8013, 27070, -9715, 28772, -11634, 30692, -13503, 32560 } },
+	{ 0, 30, { 0, 0, 0, 0 }, { -8683, 29717, -10266, 31301, -12079, 33115, -13868, 34906 } },
+	{ 0, 31, { 0, 0, 0, 0 }, { -11702, 31950, -13223, 33474, -15006, 35260, -16809, 37068 } },
+	{ 0, 32, { 0, 0, 0, 0 }, { -16476, 36011, -18278, 37813, -20518, 40053, -23007, 42542 } },
+	{ 0, 33, { 0, 0, 0, 0 }, { -12639, 31013, -14164, 32534, -15950, 34316, -17758, 36120 } },
+	{ 0, 34, { 0, 0, 0, 0 }, { -8012, 27074, -9714, 28775, -11633, 30695, -13502, 32564 } },
+	{ 0, 35, { 0, 0, 0, 0 }, { -15815, 35835, -17571, 37587, -19735, 39746, -22105, 42106 } },
+	{ 0, 36, { 0, 0, 0, 0 }, { -11716, 31953, -13237, 33477, -15019, 35263, -16823, 37071 } },
+	{ 0, 37, { 0, 0, 0, 0 }, { -16468, 36018, -18270, 37820, -20510, 40060, -22999, 42548 } },
+	{ 0, 38, { 0, 0, 0, 0 }, { -12632, 31002, -14156, 32523, -15942, 34305, -17749, 36108 } },
+	{ 0, 39, { 0, 0, 0, 0 }, { -8016, 27070, -9718, 28772, -11637, 30691, -13506, 32560 } },
+	{ 0, 40, { 0, 0, 0, 0 }, { -7986, 27101, -9688, 28802, -11607, 30722, -13476, 32590 } },
+	{ 0, 41, { 0, 0, 0, 0 }, { -7793, 27443, -9488, 29137, -11401, 31051, -13265, 32915 } },
+	{ 1, 0, { 0, 0, 0, 0 }, { -1409, 32401, -3226, 34218, -5262, 36254, -7235, 38228 } },
+	{ 1, 1, { 0, 0, 0, 0 }, { -6033, 37548, -7644, 39163, -9535, 41058, -11455, 42985 } },
+	{ 1, 2, { 0, 0, 0, 0 }, { -11694, 42362, -13660, 44329, -16162, 46831, -19082, 49752 } },
+	{ 1, 3, { 0, 0, 0, 0 }, { -7092, 36689, -8708, 38302, -10606, 40195, -12538, 42121 } },
+	{ 1, 4, { 0, 0, 0, 0 }, { -1646, 31964, -3472, 33790, -5516, 35834, -7495, 37813 } },
+	{ 1, 5, { 0, 0, 0, 0 }, { -1409, 32401, -3226, 34218, -5262, 36254, -7235, 38228 } },
+	{ 1, 6, { 0, 0, 0, 0 }, { -6047, 37553, -7659, 39168, -9549, 41063, -11471, 42991 } },
+	{ 1, 7, { 0, 0, 0, 0 }, { -11684, 42368, -13649, 44334, -16151, 46835, -19069, 49755 } },
+	{ 1, 8, { 0, 0, 0, 0 }, { -7083, 36676, -8699, 38289, -10597, 40182, -12528, 42107 } },
+	{ 1, 9, { 0, 0, 0, 0 }, { -1653, 31962, -3479, 33788, -5523, 35832, -7501, 37810 } },
+	{ 1, 10, { 0, 0, 0, 0 }, { -11672, 42048, -13615, 43994, -16075, 46459, -18916, 49311 } },
+	{ 1, 11, { 0, 0, 0, 0 }, { -6037, 37546, -7648, 39161, -9539, 41056, -11459, 42983 } },
+	{ 1, 12, { 0, 0, 0, 0 }, { -11674, 42374, -13640, 44340, -16141, 46841, -19059, 49760 } },
+	{ 1, 13, { 0, 0, 0, 0 }, { -7085, 36689, -8701, 38302, -10599, 40195, -12531, 42121 } },
+	{ 1, 14, { 0, 0, 0, 0 }, { -1663, 31955, -3489, 33781, -5533, 35825, -7512, 37803 } },
+	{ 1, 15, { 0, 0, 0, 0 }, { -3689, 32354, -5418, 34083, -7378, 36041, -9296, 37959 } },
+	{ 1, 16, { 0, 0, 0, 0 }, { -6028, 37535, -7639, 39150, -9530, 41045, -11450, 42971 } },
+	{ 1, 17, { 0, 0, 0, 0 }, { -11669, 42377, -13634, 44343, -16135, 46844, -19053, 49762 } },
+	{ 1, 18, { 0, 0, 0, 0 }, { -7090, 36701, -8706, 38313, -10604, 40207, -12537, 42133 } },
+	{ 1, 19, { 0, 0, 0, 0 }, { -1676, 31944, -3502, 33770, -5545, 35814, -7524, 37792 } },
+	{ 1, 20, { 0, 0, 0, 0 }, { -9124, 39536, -10825, 41242, -12877, 43304, -15049, 45488 } },
+	{ 1, 21, { 0, 0, 0, 0 }, { -6116, 37586, -7728, 39202, -9620, 41099, -11544, 43029 } },
+	{ 1, 22, { 0, 0, 0, 0 }, { -11650, 42392, -13615, 44358, -16115, 46858, -19032, 49775 } },
+	{ 1, 23, { 0, 0, 0, 0 }, { -7038, 36613, -8653, 38225, -10549, 40116, -12478, 42039 } },
+	{ 1, 24, { 0, 0, 0, 0 }, { -1659, 31963, -3484, 33789, -5528, 35833, -7507, 37811 } },
+	{ 1, 25, { 0, 0, 0, 0 }, { -8280, 38768, -9942, 40425, -11929, 42405, -14001, 44467 } },
+	{ 1, 26, { 0, 0, 0, 0 }, { -6088, 37568, -7699, 39183, -9591, 41080, -11513, 43008 } },
+	{ 1, 27, { 0, 0, 0, 0 }, { -11648, 42394, -13613, 44359, -16114, 46860, -19031, 49777 } },
+	{ 1, 28, { 0, 0, 0, 0 }, { -7051, 36644, -8667, 38256, -10564, 40148, -12494, 42072 } },
+	{ 1, 29, { 0, 0, 0, 0 }, { -1670, 31953, -3496, 33779, -5539, 35822, -7518, 37801 } },
+	{ 1, 30, { 0, 0, 0, 0 }, { -2644, 34904, -4326, 36587, -6246, 38509, -8139, 40403 } },
+	{ 1, 31, { 0, 0, 0, 0 }, { -6106, 37579, -7718, 39194, -9610, 41091, -11533, 43021 } },
+	{ 1, 32, { 0, 0, 0, 0 }, { -11640, 42398, -13605, 44363, -16105, 46863, -19021, 49779 } },
+	{ 1, 33, { 0, 0, 0, 0 }, { -7039, 36626, -8655, 38238, -10551, 40130, -12480, 42053 } },
+	{ 1, 34, { 0, 0, 0, 0 }, { -1669, 31957, -3495, 33782, -5538, 35826, -7517, 37804 } },
+	{ 1, 35, { 0, 0, 0, 0 }, { -10901, 42140, -12806, 44039, -15200, 46425, -17921, 49132 } },
+	{ 1, 36, { 0, 0, 0, 0 }, { -6121, 37583, -7733, 39198, -9625, 41095, -11549, 43026 } },
+	{ 1, 37, { 0, 0, 0, 0 }, { -11632, 42405, -13597, 44370, -16097, 46870, -19013, 49786 } },
+	{ 1, 38, { 0, 0, 0, 0 }, { -7030, 36613, -8645, 38226, -10541, 40117, -12470, 42039 } },
+	{ 1, 39, { 0, 0, 0, 0 }, { -1673, 31953, -3499, 33779, -5542, 35822, -7521, 37801 } },
+	{ 1, 40, { 0, 0, 0, 0 }, { -1644, 31984, -3469, 33809, -5512, 35853, -7491, 37831 } },
+	{ 1, 41, { 0, 0, 0, 0 }, { -1465, 32341, -3282, 34159, -5319, 36195, -7292, 38168 } },
+	{ 2, 0, { 0, 0, 0, 0 }, { 6256, 43539, 4709, 45086, 2945, 46849, 1215, 48579 } },
+	{ 2, 1, { 0, 0, 0, 0 }, { 3361, 46935, 1953, 48344, 308, 49992, -1347, 51650 } },
+	{ 2, 2, { 0, 0, 0, 0 }, { -420, 49889, -2035, 51504, -3995, 53464, -6081, 55550 } },
+	{ 2, 3, { 0, 0, 0, 0 }, { 2362, 46043, 951, 47451, -697, 49097, -2358, 50755 } },
+	{ 2, 4, { 0, 0, 0, 0 }, { 5984, 43139, 4431, 44692, 2662, 46461, 927, 48196 } },
+	{ 2, 5, { 0, 0, 0, 0 }, { 6256, 43539, 4709, 45086, 2945, 46849, 1215, 48579 } },
+	{ 2, 6, { 0, 0, 0, 0 }, { 3350, 46937, 1942, 48346, 297, 49993, -1358, 51652 } },
+	{ 2, 7, { 0, 0, 0, 0 }, { -411, 49896, -2025, 51510, -3985, 53470, -6071, 55556 } },
+	{ 2, 8, { 0, 0, 0, 0 }, { 2367, 46034, 956, 47442, -692, 49088, -2352, 50745 } },
+	{ 2, 9, { 0, 0, 0, 0 }, { 5978, 43136, 4425, 44689, 2656, 46458, 922, 48192 } },
+	{ 2, 10, { 0, 0, 0, 0 }, { -466, 49636, -2068, 51240, -4009, 53183, -6069, 55247 } },
+	{ 2, 11, { 0, 0, 0, 0 }, { 3357, 46933, 1950, 48342, 305, 49989, -1350, 51648 } },
+	{ 2, 12, { 0, 0, 0, 0 }, { -402, 49902, -2016, 51517, -3976, 53477, -6061, 55562 } },
+	{ 2, 13, { 0, 0, 0, 0 }, { 2367, 46045, 957, 47453, -691, 49099, -2352, 50756 } },
+	{ 2, 14, { 0, 0, 0, 0 }, { 5968, 43128, 4416, 44681, 2647, 46450, 912, 48185 } },
+	{ 2, 15, { 0, 0, 0, 0 }, { 4396, 43077, 2906, 44567, 1198, 46276, -487, 47960 } },
+	{ 2, 16, { 0, 0, 0, 0 }, { 3362, 46925, 1955, 48335, 310, 49982, -1345, 51640 } },
+	{ 2, 17, { 0, 0, 0, 0 }, { -397, 49906, -2011, 51521, -3971, 53480, -6056, 55566 } },
+	{ 2, 18, { 0, 0, 0, 0 }, { 2365, 46053, 955, 47461, -693, 49107, -2354, 50765 } },
+	{ 2, 19, { 0, 0, 0, 0 }, { 5956, 43117, 4404, 44670, 2635, 46439, 900, 48173 } },
+	{ 2, 20, { 0, 0, 0, 0 }, { 1157, 48035, -305, 49500, -2039, 51239, -3820, 53026 } },
+	{ 2, 21, { 0, 0, 0, 0 }, { 3298, 46952, 1890, 48362, 245, 50010, -1412, 51670 } },
+	{ 2, 22, { 0, 0, 0, 0 }, { -378, 49922, -1993, 51536, -3952, 53496, -6037, 55581 } },
+	{ 2, 23, { 0, 0, 0, 0 }, { 2393, 45990, 983, 47398, -664, 49042, -2323, 50698 } },
+	{ 2, 24, { 0, 0, 0, 0 }, { 5973, 43136, 4421, 44689, 2652, 46458, 918, 48192 } },
+	{ 2, 25, { 0, 0, 0, 0 }, { 1744, 47554, 306, 48989, -1391, 50682, -3121, 52407 } },
+	{ 2, 26, { 0, 0, 0, 0 }, { 3319, 46942, 1911, 48352, 266, 50000, -1390, 51659 } },
+	{ 2, 27, { 0, 0, 0, 0 }, { -377, 49924, -1991, 51538, -3950, 53497, -6035, 55582 } },
+	{ 2, 28, { 0, 0, 0, 0 }, { 2387, 46013, 977, 47421, -671, 49066, -2330, 50722 } },
+	{ 2, 29, { 0, 0, 0, 0 }, { 5962, 43126, 4410, 44678, 2641, 46447, 907, 48181 } },
+	{ 2, 30, { 0, 0, 0, 0 }, { 5694, 45355, 4236, 46814, 2557, 48493, 896, 50155 } },
+	{ 2, 31, { 0, 0, 0, 0 }, { 3305, 46948, 1898, 48358, 252, 50006, -1404, 51665 } },
+	{ 2, 32, { 0, 0, 0, 0 }, { -370, 49929, -1984, 51543, -3943, 53502, -6028, 55587 } },
+	{ 2, 33, { 0, 0, 0, 0 }, { 2394, 46000, 984, 47408, -663, 49053, -2322, 50709 } },
+	{ 2, 34, { 0, 0, 0, 0 }, { 5964, 43129, 4411, 44681, 2642, 46450, 908, 48184 } },
+	{ 2, 35, { 0, 0, 0, 0 }, { 191, 49856, -1389, 51434, -3298, 53340, -5314, 55350 } },
+	{ 2, 36, { 0, 0, 0, 0 }, { 3294, 46949, 1886, 48358, 241, 50006, -1416, 51667 } },
+	{ 2, 37, { 0, 0, 0, 0 }, { -362, 49936, -1976, 51550, -3935, 53509, -6020, 55593 } },
+	{ 2, 38, { 0, 0, 0, 0 }, { 2400, 45991, 990, 47399, -658, 49044, -2317, 50700 } },
+	{ 2, 39, { 0, 0, 0, 0 }, { 5959, 43125, 4407, 44678, 2638, 46446, 904, 48181 } },
+	{ 2, 40, { 0, 0, 0, 0 }, { 5989, 43156, 4437, 44708, 2668, 46477, 934, 48211 } },
+	{ 2, 41, { 0, 0, 0, 0 }, { 6199, 43480, 4652, 45027, 2888, 46790, 1158, 48520 } },
+	{ 3, 0, { 0, 0, 0, 0 }, { 21585, 47234, 18810, 50010, 15901, 52919, 13190, 55631 } },
+	{ 3, 1, { 0, 0, 0, 0 }, { 12810, 56538, 10610, 58746, 7989, 61381, 5221, 64169 } },
+	{ 3, 2, { 0, 0, 1, 1 }, { 2613, 65872, -1077, 69563, 0, 0, 0, 0 } },
+	{ 3, 3, { 0, 0, 0, 0 }, { 11705, 55663, 9494, 57865, 6852, 60494, 4050, 63275 } },
+	{ 3, 4, { 0, 0, 0, 0 }, { 21464, 46677, 18654, 49486, 15723, 52417, 12999, 55142 } },
+	{ 3, 5, { 0, 0, 0, 0 }, { 21585, 47234, 18810, 50010, 15901, 52919, 13190, 55631 } },
+	{ 3, 6, { 0, 0, 0, 0 }, { 12788, 56550, 10588, 58759, 7966, 61395, 5196, 64185 } },
+	{ 3, 7, { 0, 0, 1, 1 }, { 2626, 65874, -1061, 69562, 0, 0, 0, 0 } },
+	{ 3, 8, { 0, 0, 0, 0 }, { 11722, 55642, 9511, 57844, 6870, 60472, 4071, 63251 } },
+	{ 3, 9, { 0, 0, 0, 0 }, { 21454, 46678, 18646, 49486, 15715, 52417, 12991, 55141 } },
+	{ 3, 10, { 0, 0, 2, 1 }, { 2827, 65386, -710, 68942, 0, 0, 0, 0 } },
+	{ 3, 11, { 0, 0, 0, 0 }, { 12806, 56537, 10606, 58745, 7984, 61380, 5216, 64168 } },
+	{ 3, 12, { 0, 0, 1, 1 }, { 2637, 65879, -1049, 69565, 0, 0, 0, 0 } },
+	{ 3, 13, { 0, 0, 0, 0 }, { 11714, 55661, 9504, 57863, 6862, 60491, 4061, 63272 } },
+	{ 3, 14, { 0, 0, 0, 0 }, { 21442, 46672, 18634, 49481, 15704, 52411, 12980, 55135 } },
+	{ 3, 15, { 0, 0, 0, 0 }, { 18225, 48240, 15725, 50738, 13003, 53457, 10394, 56063 } },
+	{ 3, 16, { 0, 0, 0, 0 }, { 12822, 56518, 10622, 58726, 8001, 61360, 5235, 64147 } },
+	{ 3, 17, { 0, 0, 1, 1 }, { 2644, 65881, -1041, 69567, 0, 0, 0, 0 } },
+	{ 3, 18, { 0, 0, 0, 0 }, { 11703, 55678, 9492, 57881, 6850, 60510, 4046, 63292 } },
+	{ 3, 19, { 0, 0, 0, 0 }, { 21428, 46663, 18620, 49471, 15690, 52401, 12967, 55124 } },
+	{ 3, 20, { 0, 0, 0, 0 }, { 7750, 60507, 5281, 62994, 2057, 66254, -2053, 70462 } },
+	{ 3, 21, { 0, 0, 0, 0 }, { 12681, 56622, 10479, 58832, 7852, 61473, 5072, 64274 } },
+	{ 3, 22, { 0, 0, 1, 1 }, { 2665, 65892, -1018, 69575, 0, 0, 0, 0 } },
+	{ 3, 23, { 0, 0, 0, 0 }, { 11808, 55538, 9599, 57739, 6964, 60361, 4176, 63128 } },
+	{ 3, 24, { 0, 0, 0, 0 }, { 21444, 46684, 18636, 49492, 15707, 52421, 12983, 55145 } },
+	{ 3, 25, { 0, 0, 0, 0 }, { 9261, 58992, 6917, 61323, 3968, 64247, 540, 67626 } },
+	{ 3, 26, { 0, 0, 0, 0 }, { 12727, 56586, 10527, 58795, 7901, 61434, 5126, 64230 } },
+	{ 3, 27, { 0, 0, 1, 1 }, { 2667, 65895, -1016, 69578, 0, 0, 0, 0 } },
+	{ 3, 28, { 0, 0, 0, 0 }, { 11778, 55586, 9568, 57787, 6931, 60411, 4138, 63183 } },
+	{ 3, 29, { 0, 0, 0, 0 }, { 21432, 46674, 18625, 49481, 15695, 52411, 12972, 55134 } },
+	{ 3, 30, { 0, 0, 0, 0 }, { 18570, 51520, 16206, 53888, 13575, 56522, 11008, 59095 } },
+	{ 3, 31, { 0, 0, 0, 0 }, { 12698, 56608, 10497, 58818, 7870, 61458, 5092, 64258 } },
+	{ 3, 32, { 0, 0, 1, 1 }, { 2677, 65896, -1005, 69577, 0, 0, 0, 0 } },
+	{ 3, 33, { 0, 0, 0, 0 }, { 11801, 55557, 9592, 57757, 6956, 60380, 4166, 63149 } },
+	{ 3, 34, { 0, 0, 0, 0 }, { 21431, 46680, 18624, 49486, 15695, 52416, 12972, 55139 } },
+	{ 3, 35, { 0, 0, 2, 1 }, { 3968, 65049, 665, 68325, 0, 0, 0, 0 } },
+	{ 3, 36, { 0, 0, 0, 0 }, { 12676, 56619, 10474, 58829, 7847, 61471, 5067, 64272 } },
+	{ 3, 37, { 0, 0, 1, 1 }, { 2686, 65902, -996, 69583, 0, 0, 0, 0 } },
+	{ 3, 38, { 0, 0, 0, 0 }, { 11819, 55536, 9610, 57737, 6975, 60358, 4188, 63125 } },
+	{ 3, 39, { 0, 0, 0, 0 }, { 21426, 46677, 18620, 49483, 15690, 52413, 12967, 55136 } },
+	{ 3, 40, { 0, 0, 0, 0 }, { 21456, 46708, 18649, 49515, 15720, 52444, 12997, 55167 } },
+	{ 3, 41, { 0, 0, 0, 0 }, { 21531, 47172, 18755, 49949, 15846, 52858, 13135, 55570 } },
+	{ 4, 0, { 0, 0, 0, 0 }, { 18640, 52464, 16824, 54280, 14789, 56316, 12816, 58288 } },
+	{ 4, 1, { 0, 0, 0, 0 }, { 13994, 57611, 12382, 59226, 10492, 61121, 8571, 63049 } },
+	{ 4, 2, { 0, 0, 0, 0 }, { 8360, 62412, 6394, 64378, 3893, 66879, 975, 69799 } },
+	{ 4, 3, { 0, 0, 0, 0 }, { 12971, 56715, 11355, 58327, 9458, 60220, 7527, 62144 } },
+	{ 4, 4, { 0, 0, 0, 0 }, { 18408, 52022, 16582, 53847, 14539, 55891, 12560, 57870 } },
+	{ 4, 5, { 0, 0, 0, 0 }, { 18640, 52464, 16824, 54280, 14789, 56316, 12816, 58288 } },
+	{ 4, 6, { 0, 0, 0, 0 }, { 13979, 57617, 12368, 59231, 10477, 61127, 8555, 63055 } },
+	{ 4, 7, { 0, 0, 0, 0 }, { 8371, 62418, 6405, 64383, 3905, 66884, 987, 69801 } },
+	{ 4, 8, { 0, 0, 0, 0 }, { 12980, 56702, 11364, 58315, 9467, 60207, 7537, 62131 } },
+	{ 4, 9, { 0, 0, 0, 0 }, { 18402, 52020, 16576, 53845, 14532, 55889, 12554, 57867 } },
+	{ 4, 10, { 0, 0, 0, 0 }, { 8376, 62103, 6434, 64049, 3973, 66515, 1130, 69367 } },
+	{ 4, 11, { 0, 0, 0, 0 }, { 13990, 57610, 12379, 59224, 10488, 61120, 8567, 63047 } },
+	{ 4, 12, { 0, 0, 0, 0 }, { 8380, 62424, 6415, 64389, 3915, 66889, 998, 69807 } },
+	{ 4, 13, { 0, 0, 0, 0 }, { 12978, 56715, 11362, 58328, 9465, 60220, 7534, 62144 } },
+	{ 4, 14, { 0, 0, 0, 0 }, { 18391, 52013, 16566, 53838, 14522, 55882, 12544, 57860 } },
+	{ 4, 15, { 0, 0, 0, 0 }, { 16374, 52394, 14645, 54123, 12685, 56082, 10766, 58000 } },
+	{ 4, 16, { 0, 0, 0, 0 }, { 13998, 57599, 12387, 59213, 10497, 61108, 8576, 63035 } },
+	{ 4, 17, { 0, 0, 0, 0 }, { 8385, 62427, 6420, 64393, 3920, 66893, 1004, 69809 } },
+	{ 4, 18, { 0, 0, 0, 0 }, { 12973, 56727, 11357, 58339, 9460, 60232, 7529, 62156 } },
+	{ 4, 19, { 0, 0, 0, 0 }, { 18379, 52002, 16553, 53827, 14510, 55871, 12532, 57849 } },
+	{ 4, 20, { 0, 0, 0, 0 }, { 10906, 59598, 9205, 61305, 7151, 63368, 4977, 65554 } },
+	{ 4, 21, { 0, 0, 0, 0 }, { 13910, 57650, 12298, 59265, 10406, 61162, 8482, 63093 } },
+	{ 4, 22, { 0, 0, 0, 0 }, { 8405, 62442, 6440, 64407, 3940, 66906, 1025, 69821 } },
+	{ 4, 23, { 0, 0, 0, 0 }, { 13025, 56639, 11410, 58251, 9514, 60141, 7587, 62062 } },
+	{ 4, 24, { 0, 0, 0, 0 }, { 18395, 52022, 16570, 53847, 14527, 55890, 12549, 57868 } },
+	{ 4, 25, { 0, 0, 0, 0 }, { 11783, 58795, 10122, 60451, 8137, 62428, 6068, 64488 } },
+	{ 4, 26, { 0, 0, 0, 0 }, { 13939, 57632, 12328, 59247, 10436, 61143, 8513, 63073 } },
+	{ 4, 27, { 0, 0, 0, 0 }, { 8406, 62444, 6441, 64409, 3942, 66908, 1026, 69823 } },
+	{ 4, 28, { 0, 0, 0, 0 }, { 13011, 56670, 11396, 58282, 9500, 60173, 7571, 62095 } },
+	{ 4, 29, { 0, 0, 0, 0 }, { 18384, 52011, 16559, 53836, 14516, 55880, 12538, 57858 } },
+	{ 4, 30, { 0, 0, 0, 0 }, { 17389, 54971, 15708, 56653, 13789, 58574, 11897, 60467 } },
+	{ 4, 31, { 0, 0, 0, 0 }, { 13921, 57643, 12309, 59258, 10417, 61154, 8493, 63085 } },
+	{ 4, 32, { 0, 0, 0, 0 }, { 8414, 62448, 6450, 64412, 3951, 66911, 1036, 69826 } },
+	{ 4, 33, { 0, 0, 0, 0 }, { 13023, 56652, 11408, 58264, 9513, 60155, 7585, 62076 } },
+	{ 4, 34, { 0, 0, 0, 0 }, { 18385, 52015, 16560, 53840, 14516, 55883, 12538, 57861 } },
+	{ 4, 35, { 0, 0, 0, 0 }, { 9160, 62179, 7257, 64077, 4867, 66459, 2149, 69162 } },
+	{ 4, 36, { 0, 0, 0, 0 }, { 13906, 57647, 12294, 59262, 10402, 61159, 8477, 63090 } },
+	{ 4, 37, { 0, 0, 0, 0 }, { 8422, 62455, 6458, 64419, 3959, 66918, 1044, 69832 } },
+	{ 4, 38, { 0, 0, 0, 0 }, { 13033, 56640, 11418, 58251, 9522, 60142, 7595, 62063 } },
+	{ 4, 39, { 0, 0, 0, 0 }, { 18381, 52012, 16555, 53837, 14512, 55880, 12534, 57858 } },
+	{ 4, 40, { 0, 0, 0, 0 }, { 18410, 52042, 16585, 53868, 14542, 55911, 12564, 57888 } },
+	{ 4, 41, { 0, 0, 0, 0 }, { 18584, 52404, 16768, 54220, 14732, 56256, 12760, 58228 } },
+	{ 5, 0, { 0, 0, 0, 0 }, { 17486, 54389, 15915, 55961, 14125, 57750, 12373, 59502 } },
+	{ 5, 1, { 0, 0, 0, 0 }, { 14388, 57978, 12961, 59407, 11292, 61079, 9611, 62763 } },
+	{ 5, 2, { 0, 0, 0, 0 }, { 10413, 61133, 8766, 62779, 6760, 64786, 4611, 66935 } },
+	{ 5, 3, { 0, 0, 0, 0 }, { 13398, 57074, 11968, 58502, 10295, 60171, 8609, 61854 } },
+	{ 5, 4, { 0, 0, 0, 0 }, { 17221, 53983, 15642, 55561, 13847, 57356, 12090, 59114 } },
+	{ 5, 5, { 0, 0, 0, 0 }, { 17486, 54389, 15915, 55961, 14125, 57750, 12373, 59502 } },
+	{ 5, 6, { 0, 0, 0, 0 }, { 14376, 57980, 12949, 59409, 11281, 61081, 9599, 62766 } },
+	{ 5, 7, { 0, 0, 0, 0 }, { 10422, 61139, 8776, 62785, 6770, 64791, 4621, 66940 } },
+	{ 5, 8, { 0, 0, 0, 0 }, { 13403, 57064, 11973, 58492, 10301, 60161, 8615, 61844 } },
+	{ 5, 9, { 0, 0, 0, 0 }, { 17215, 53980, 15637, 55558, 13842, 57353, 12084, 59111 } },
+	{ 5, 10, { 0, 0, 0, 0 }, { 10372, 60875, 8739, 62510, 6753, 64499, 4632, 66623 } },
+	{ 5, 11, { 0, 0, 0, 0 }, { 14384, 57976, 12957, 59405, 11289, 61076, 9608, 62761 } },
+	{ 5, 12, { 0, 0, 0, 0 }, { 10431, 61146, 8785, 62792, 6779, 64798, 4631, 66946 } },
+	{ 5, 13, { 0, 0, 0, 0 }, { 13404, 57075, 11974, 58503, 10301, 60172, 8615, 61855 } },
+	{ 5, 14, { 0, 0, 0, 0 }, { 17205, 53973, 15627, 55551, 13832, 57346, 12074, 59103 } },
+	{ 5, 15, { 0, 0, 0, 0 }, { 15586, 53962, 14073, 55475, 12341, 57208, 10633, 58915 } },
+	{ 5, 16, { 0, 0, 0, 0 }, { 14390, 57968, 12963, 59397, 11294, 61068, 9614, 62752 } },
+	{ 5, 17, { 0, 0, 0, 0 }, { 10436, 61150, 8790, 62796, 6784, 64801, 4636, 66950 } },
+	{ 5, 18, { 0, 0, 0, 0 }, { 13401, 57084, 11971, 58512, 10299, 60181, 8612, 61864 } },
+	{ 5, 19, { 0, 0, 0, 0 }, { 17193, 53962, 15615, 55540, 13820, 57334, 12062, 59092 } },
+	{ 5, 20, { 0, 0, 0, 0 }, { 12087, 59177, 10602, 60666, 8837, 62435, 7020, 64259 } },
+	{ 5, 21, { 0, 0, 0, 0 }, { 14323, 57998, 12896, 59427, 11226, 61099, 9544, 62785 } },
+	{ 5, 22, { 0, 0, 0, 0 }, { 10455, 61165, 8809, 62811, 6804, 64816, 4656, 66964 } },
+	{ 5, 23, { 0, 0, 0, 0 }, { 13431, 57018, 12002, 58445, 10331, 60114, 8646, 61795 } },
+	{ 5, 24, { 0, 0, 0, 0 }, { 17210, 53981, 15632, 55559, 13837, 57353, 12080, 59111 } },
+	{ 5, 25, { 0, 0, 0, 0 }, { 12716, 58649, 11257, 60105, 9533, 61824, 7772, 63580 } },
+	{ 5, 26, { 0, 0, 0, 0 }, { 14345, 57987, 12917, 59416, 11248, 61088, 9566, 62774 } },
+	{ 5, 27, { 0, 0, 0, 0 }, { 10456, 61167, 8811, 62813, 6805, 64818, 4657, 66966 } },
+	{ 5, 28, { 0, 0, 0, 0 }, { 13425, 57042, 11995, 58469, 10323, 60138, 8638, 61820 } },
+	{ 5, 29, { 0, 0, 0, 0 }, { 17199, 53970, 15621, 55548, 13826, 57343, 12069, 59100 } },
+	{ 5, 30, { 0, 0, 0, 0 }, { 16843, 56281, 15364, 57761, 13662, 59463, 11979, 61147 } },
+	{ 5, 31, { 0, 0, 0, 0 }, { 14331, 57993, 12903, 59423, 11234, 61095, 9552, 62781 } },
+	{ 5, 32, { 0, 0, 0, 0 }, { 10464, 61172, 8818, 62817, 6813, 64823, 4665, 66970 } },
+	{ 5, 33, { 0, 0, 0, 0 }, { 13432, 57028, 12003, 58456, 10331, 60125, 8647, 61806 } },
+	{ 5, 34, { 0, 0, 0, 0 }, { 17200, 53974, 15622, 55551, 13827, 57346, 12070, 59103 } },
+	{ 5, 35, { 0, 0, 0, 0 }, { 11046, 61075, 9437, 62682, 7486, 64628, 5415, 66693 } },
+	{ 5, 36, { 0, 0, 0, 0 }, { 14319, 57994, 12891, 59424, 11222, 61096, 9539, 62782 } },
+	{ 5, 37, { 0, 0, 0, 0 }, { 10472, 61179, 8826, 62825, 6821, 64829, 4673, 66977 } },
+	{ 5, 38, { 0, 0, 0, 0 }, { 13438, 57019, 12008, 58447, 10337, 60115, 8653, 61796 } },
+	{ 5, 39, { 0, 0, 0, 0 }, { 17196, 53970, 15618, 55548, 13823, 57342, 12066, 59100 } },
+	{ 5, 40, { 0, 0, 0, 0 }, { 17225, 54001, 15648, 55578, 13853, 57373, 12096, 59130 } },
+	{ 5, 41, { 0, 0, 0, 0 }, { 17430, 54330, 15858, 55902, 14069, 57691, 12316, 59443 } },
+	{ 6, 0, { 0, 0, 0, 0 }, { 21549, 50686, 19234, 53001, 16725, 55511, 14342, 57894 } },
+	{ 6, 1, { 0, 0, 0, 0 }, { 14535, 58216, 12592, 60164, 10294, 62471, 7914, 64865 } },
+	{ 6, 2, { 0, 0, 0, 1 }, { 6322, 65579, 3594, 68308, -496, 72398, 0, 0 } },
+	{ 6, 3, { 0, 0, 0, 0 }, { 13467, 57329, 11517, 59273, 9206, 61575, 6804, 63963 } },
+	{ 6, 4, { 0, 0, 0, 0 }, { 21376, 50182, 19042, 52517, 16517, 55041, 14125, 57433 } },
+	{ 6, 5, { 0, 0, 0, 0 }, { 21549, 50686, 19234, 53001, 16725, 55511, 14342, 57894 } },
+	{ 6, 6, { 0, 0, 0, 0 }, { 14516, 58225, 12574, 60174, 10275, 62482, 7893, 64876 } },
+	{ 6, 7, { 0, 0, 0, 1 }, { 6334, 65582, 3607, 68310, -480, 72398, 0, 0 } },
+	{ 6, 8, { 0, 0, 0, 0 }, { 13480, 57311, 11530, 59255, 9220, 61557, 6820, 63943 } },
+	{ 6, 9, { 0, 0, 0, 0 }, { 21368, 50182, 19034, 52516, 16510, 55040, 14117, 57432 } },
+	{ 6, 10, { 0, 0, 0, 1 }, { 6440, 65178, 3773, 67853, -133, 71783, 0, 0 } },
+	{ 6, 11, { 0, 0, 0, 0 }, { 14531, 58214, 12588, 60163, 10290, 62470, 7909, 64864 } },
+	{ 6, 12, { 0, 0, 0, 1 }, { 6345, 65588, 3618, 68315, -467, 72401, 0, 0 } },
+	{ 6, 13, { 0, 0, 0, 0 }, { 13475, 57328, 11525, 59272, 9214, 61573, 6814, 63961 } },
+	{ 6, 14, { 0, 0, 0, 0 }, { 21356, 50176, 19023, 52509, 16499, 55033, 14107, 57425 } },
+	{ 6, 15, { 0, 0, 0, 0 }, { 18685, 51202, 16539, 53347, 14156, 55728, 11850, 58032 } },
+	{ 6, 16, { 0, 0, 0, 0 }, { 14544, 58199, 12601, 60147, 10304, 62454, 7924, 64846 } },
+	{ 6, 17, { 0, 0, 0, 1 }, { 6350, 65591, 3624, 68318, -460, 72403, 0, 0 } },
+	{ 6, 18, { 0, 0, 0, 0 }, { 13467, 57343, 11516, 59287, 9205, 61589, 6803, 63978 } },
+	{ 6, 19, { 0, 0, 0, 0 }, { 21343, 50166, 19010, 52499, 16486, 55023, 14094, 57415 } },
+	{ 6, 20, { 0, 0, 0, 0 }, { 10289, 61366, 8173, 63493, 5521, 66165, 2495, 69228 } },
+	{ 6, 21, { 0, 0, 0, 0 }, { 14424, 58281, 12481, 60231, 10179, 62542, 7791, 64943 } },
+	{ 6, 22, { 0, 0, 0, 1 }, { 6371, 65603, 3645, 68329, -437, 72411, 0, 0 } },
+	{ 6, 23, { 0, 0, 0, 0 }, { 13550, 57224, 11601, 59167, 9294, 61465, 6901, 63845 } },
+	{ 6, 24, { 0, 0, 0, 0 }, { 21359, 50186, 19026, 52519, 16503, 55043, 14111, 57435 } },
+	{ 6, 25, { 0, 0, 0, 0 }, { 11539, 60146, 9502, 62174, 7004, 64656, 4268, 67367 } },
+	{ 6, 26, { 0, 0, 0, 0 }, { 14464, 58253, 12521, 60202, 10220, 62512, 7835, 64910 } },
+	{ 6, 27, { 0, 0, 0, 1 }, { 6373, 65605, 3647, 68331, -435, 72413, 0, 0 } },
+	{ 6, 28, { 0, 0, 0, 0 }, { 13526, 57265, 11577, 59208, 9269, 61507, 6873, 63890 } },
+	{ 6, 29, { 0, 0, 0, 0 }, { 21348, 50176, 19015, 52509, 16491, 55032, 14099, 57424 } },
+	{ 6, 30, { 0, 0, 0, 0 }, { 19317, 54182, 17260, 56242, 14942, 58562, 12671, 60837 } },
+	{ 6, 31, { 0, 0, 0, 0 }, { 14439, 58270, 12495, 60220, 10194, 62530, 7807, 64930 } },
+	{ 6, 32, { 0, 0, 0, 1 }, { 6382, 65608, 3656, 68334, -424, 72413, 0, 0 } },
+	{ 6, 33, { 0, 0, 0, 0 }, { 13545, 57240, 11596, 59183, 9289, 61482, 6895, 63863 } },
+	{ 6, 34, { 0, 0, 0, 0 }, { 21347, 50181, 19015, 52513, 16491, 55037, 14100, 57428 } },
+	{ 6, 35, { 0, 0, 0, 2 }, { 7414, 65036, 4849, 67588, 1223, 71183, 0, 0 } },
+	{ 6, 36, { 0, 0, 0, 0 }, { 14419, 58279, 12476, 60228, 10174, 62539, 7786, 64941 } },
+	{ 6, 37, { 0, 0, 0, 1 }, { 6390, 65615, 3665, 68340, -414, 72418, 0, 0 } },
+	{ 6, 38, { 0, 0, 0, 0 }, { 13559, 57223, 11610, 59166, 9304, 61463, 6911, 63843 } },
+	{ 6, 39, { 0, 0, 0, 0 }, { 21343, 50178, 19010, 52510, 16487, 55033, 14095, 57425 } },
+	{ 6, 40, { 0, 0, 0, 0 }, { 21372, 50209, 19040, 52541, 16517, 55065, 14125, 57456 } },
+	{ 6, 41, { 0, 0, 0, 0 }, { 21494, 50625, 19179, 52940, 16669, 55450, 14286, 57834 } },
+	{ 7, 0, { 0, 0, 0, 0 }, { 19774, 53198, 17921, 55051, 15849, 57123, 13845, 59128 } },
+	{ 7, 1, { 0, 0, 0, 0 }, { 14925, 58549, 13287, 60190, 11364, 62118, 9407, 64081 } },
+	{ 7, 2, { 0, 0, 0, 0 }, { 9075, 63565, 7058, 65582, 4473, 68167, 1400, 71241 } },
+	{ 7, 3, { 0, 0, 0, 0 }, { 13899, 57652, 12257, 59290, 10327, 61215, 8360, 63175 } },
+	{ 7, 4, { 0, 0, 0, 0 }, { 19547, 52751, 17684, 54614, 15603, 56695, 13592, 58706 } },
+	{ 7, 5, { 0, 0, 0, 0 }, { 19774, 53198, 17921, 55051, 15849, 57123, 13845, 59128 } },
+	{ 7, 6, { 0, 0, 0, 0 }, { 14910, 58554, 13272, 60196, 11349, 62124, 9392, 64088 } },
+	{ 7, 7, { 0, 0, 0, 0 }, { 9085, 63570, 7069, 65586, 4485, 68171, 1413, 71243 } },
+	{ 7, 8, { 0, 0, 0, 0 }, { 13909, 57638, 12266, 59277, 10337, 61202, 8370, 63161 } },
+	{ 7, 9, { 0, 0, 0, 0 }, { 19540, 52749, 17677, 54612, 15597, 56692, 13586, 58703 } },
+	{ 7, 10, { 0, 0, 0, 0 }, { 9099, 63249, 7107, 65244, 4566, 67790, 1582, 70786 } },
+	{ 7, 11, { 0, 0, 0, 0 }, { 14921, 58547, 13283, 60188, 11360, 62116, 9403, 64080 } },
+	{ 7, 12, { 0, 0, 0, 0 }, { 9095, 63576, 7079, 65592, 4495, 68177, 1424, 71248 } },
+	{ 7, 13, { 0, 0, 0, 0 }, { 13907, 57652, 12264, 59291, 10334, 61215, 8368, 63175 } },
+	{ 7, 14, { 0, 0, 0, 0 }, { 19530, 52742, 17667, 54605, 15586, 56685, 13576, 58696 } },
+	{ 7, 15, { 0, 0, 0, 0 }, { 17460, 53174, 15699, 54936, 13705, 56928, 11756, 58876 } },
+	{ 7, 16, { 0, 0, 0, 0 }, { 14930, 58536, 13292, 60177, 11369, 62105, 9413, 64067 } },
+	{ 7, 17, { 0, 0, 0, 0 }, { 9100, 63580, 7085, 65596, 4500, 68180, 1430, 71251 } },
+	{ 7, 18, { 0, 0, 0, 0 }, { 13901, 57663, 12259, 59302, 10329, 61227, 8361, 63188 } },
+	{ 7, 19, { 0, 0, 0, 0 }, { 19517, 52731, 17654, 54594, 15574, 56674, 13563, 58685 } },
+	{ 7, 20, { 0, 0, 0, 0 }, { 11736, 60637, 10003, 62376, 7905, 64484, 5675, 66728 } },
+	{ 7, 21, { 0, 0, 0, 0 }, { 14839, 58589, 13201, 60231, 11276, 62161, 9316, 64128 } },
+	{ 7, 22, { 0, 0, 0, 0 }, { 9120, 63594, 7104, 65610, 4521, 68193, 1451, 71262 } },
+	{ 7, 23, { 0, 0, 0, 0 }, { 13956, 57573, 12314, 59211, 10386, 61134, 8423, 63091 } },
+	{ 7, 24, { 0, 0, 0, 0 }, { 19534, 52751, 17671, 54614, 15591, 56694, 13580, 58705 } },
+	{ 7, 25, { 0, 0, 0, 0 }, { 12647, 59796, 10957, 61481, 8933, 63497, 6816, 65603 } },
+	{ 7, 26, { 0, 0, 0, 0 }, { 14869, 58571, 13231, 60212, 11307, 62141, 9348, 64107 } },
+	{ 7, 27, { 0, 0, 0, 0 }, { 9121, 63596, 7106, 65611, 4522, 68195, 1453, 71264 } },
+	{ 7, 28, { 0, 0, 0, 0 }, { 13941, 57605, 12300, 59243, 10371, 61167, 8407, 63124 } },
+	{ 7, 29, { 0, 0, 0, 0 }, { 19523, 52741, 17660, 54603, 15580, 56683, 13569, 58694 } },
+	{ 7, 30, { 0, 0, 0, 0 }, { 18441, 55787, 16731, 57499, 14780, 59451, 12858, 61375 } },
+	{ 7, 31, { 0, 0, 0, 0 }, { 14849, 58582, 13211, 60224, 11287, 62153, 9327, 64120 } },
+	{ 7, 32, { 0, 0, 0, 0 }, { 9129, 63600, 7114, 65615, 4531, 68198, 1463, 71267 } },
+	{ 7, 33, { 0, 0, 0, 0 }, { 13954, 57586, 12312, 59225, 10384, 61148, 8421, 63105 } },
+	{ 7, 34, { 0, 0, 0, 0 }, { 19523, 52744, 17661, 54607, 15581, 56687, 13570, 58698 } },
+	{ 7, 35, { 0, 0, 0, 0 }, { 9898, 63307, 7950, 65250, 5486, 67705, 2648, 70526 } },
+	{ 7, 36, { 0, 0, 0, 0 }, { 14834, 58586, 13196, 60228, 11271, 62158, 9311, 64125 } },
+	{ 7, 37, { 0, 0, 0, 0 }, { 9137, 63607, 7122, 65622, 4539, 68205, 1471, 71273 } },
+	{ 7, 38, { 0, 0, 0, 0 }, { 13964, 57573, 12322, 59212, 10394, 61134, 8432, 63091 } },
+	{ 7, 39, { 0, 0, 0, 0 }, { 19519, 52741, 17656, 54604, 15576, 56684, 13566, 58694 } },
+	{ 7, 40, { 0, 0, 0, 0 }, { 19548, 52772, 17686, 54634, 15606, 56714, 13596, 58725 } },
+	{ 7, 41, { 0, 0, 0, 0 }, { 19718, 53138, 17865, 54991, 15793, 57063, 13788, 59068 } },
+	{ 8, 0, { 0, 0, 0, 0 }, { 26691, 48220, 23264, 51648, 19861, 55052, 16767, 58147 } },
+	{ 8, 1, { 0, 0, 0, 0 }, { 15825, 59624, 13333, 62127, 10333, 65146, 7081, 68432 } },
+	{ 8, 2, { 0, 2, 1, 1 }, { 3173, 71402, 0, 0, 0, 0, 0, 0 } },
+	{ 8, 3, { 0, 0, 0, 0 }, { 14696, 58746, 12189, 61241, 9160, 64250, 5852, 67523 } },
+	{ 8, 4, { 0, 0, 0, 0 }, { 26650, 47581, 23158, 51073, 19718, 54513, 16606, 57625 } },
+	{ 8, 5, { 0, 0, 0, 0 }, { 26691, 48220, 23264, 51648, 19861, 55052, 16767, 58147 } },
+	{ 8, 6, { 0, 0, 0, 0 }, { 15800, 59639, 13307, 62143, 10306, 65164, 7051, 68453 } },
+	{ 8, 7, { 0, 2, 1, 1 }, { 3189, 71401, 0, 0, 0, 0, 0, 0 } },
+	{ 8, 8, { 0, 0, 0, 0 }, { 14716, 58722, 12209, 61217, 9182, 64224, 5879, 67493 } },
+	{ 8, 9, { 0, 0, 0, 0 }, { 26638, 47584, 23148, 51075, 19709, 54513, 16598, 57624 } },
+	{ 8, 10, { 0, 0, 1, 1 }, { 3542, 70778, -2215, 76639, 0, 0, 0, 0 } },
+	{ 8, 11, { 0, 0, 0, 0 }, { 15820, 59623, 13328, 62126, 10328, 65146, 7076, 68431 } },
+	{ 8, 12, { 0, 2, 1, 1 }, { 3201, 71404, 0, 0, 0, 0, 0, 0 } },
+	{ 8, 13, { 0, 0, 0, 0 }, { 14706, 58743, 12199, 61238, 9171, 64246, 5865, 67519 } },
+	{ 8, 14, { 0, 0, 0, 0 }, { 26625, 47580, 23135, 51070, 19697, 54507, 16586, 57619 } },
+	{ 8, 15, { 0, 0, 0, 0 }, { 22675, 49874, 19731, 52815, 16609, 55933, 13653, 58884 } },
+	{ 8, 16, { 0, 0, 0, 0 }, { 15839, 59601, 13347, 62104, 10349, 65122, 7100, 68404 } },
+	{ 8, 17, { 0, 2, 1, 1 }, { 3209, 71406, 0, 0, 0, 0, 0, 0 } },
+	{ 8, 18, { 0, 0, 0, 0 }, { 14692, 58763, 12185, 61259, 9155, 64268, 5846, 67544 } },
+	{ 8, 19, { 0, 0, 0, 0 }, { 26610, 47571, 23121, 51060, 19684, 54497, 16573, 57609 } },
+	{ 8, 20, { 0, 0, 0, 2 }, { 9875, 64491, 6959, 67436, 2877, 71592, 0, 0 } },
+	{ 8, 21, { 0, 0, 0, 0 }, { 15675, 59728, 13181, 62234, 10172, 65263, 6899, 68571 } },
+	{ 8, 22, { 0, 2, 1, 1 }, { 3232, 71414, 0, 0, 0, 0, 0, 0 } },
+	{ 8, 23, { 0, 0, 0, 0 }, { 14820, 58600, 12316, 61092, 9298, 64091, 6014, 67342 } },
+	{ 8, 24, { 0, 0, 0, 0 }, { 26625, 47594, 23137, 51082, 19700, 54519, 16589, 57630 } },
+	{ 8, 25, { 0, 0, 0, 0 }, { 11695, 62628, 8983, 65319, 5441, 68819, 816, 73320 } },
+	{ 8, 26, { 0, 0, 0, 0 }, { 15730, 59685, 13236, 62190, 10231, 65215, 6966, 68514 } },
+	{ 8, 27, { 0, 2, 1, 1 }, { 3234, 71417, 0, 0, 0, 0, 0, 0 } },
+	{ 8, 28, { 0, 0, 0, 0 }, { 14782, 58655, 12277, 61148, 9256, 64151, 5964, 67409 } },
+	{ 8, 29, { 0, 0, 0, 0 }, { 26613, 47584, 23125, 51072, 19688, 54508, 16577, 57619 } },
+	{ 8, 30, { 0, 0, 0, 0 }, { 22659, 53528, 19928, 56262, 16937, 59258, 14036, 62168 } },
+	{ 8, 31, { 0, 0, 0, 0 }, { 15695, 59711, 13201, 62217, 10193, 65245, 6924, 68549 } },
+	{ 8, 32, { 0, 2, 1, 1 }, { 3245, 71416, 0, 0, 0, 0, 0, 0 } },
+	{ 8, 33, { 0, 0, 0, 0 }, { 14811, 58621, 12307, 61114, 9287, 64114, 6001, 67367 } },
+	{ 8, 34, { 0, 0, 0, 0 }, { 26610, 47591, 23123, 51078, 19687, 54514, 16577, 57624 } },
+	{ 8, 35, { 0, 0, 1, 1 }, { 4948, 70131, 152, 74843, 0, 0, 0, 0 } },
+	{ 8, 36, { 0, 0, 0, 0 }, { 15670, 59726, 13176, 62232, 10166, 65261, 6893, 68569 } },
+	{ 8, 37, { 0, 2, 1, 1 }, { 3255, 71422, 0, 0, 0, 0, 0, 0 } },
+	{ 8, 38, { 0, 0, 0, 0 }, { 14832, 58596, 12328, 61089, 9310, 64087, 6028, 67337 } },
+	{ 8, 39, { 0, 0, 0, 0 }, { 26605, 47588, 23119, 51075, 19683, 54511, 16572, 57621 } },
+	{ 8, 40, { 0, 0, 0, 0 }, { 26634, 47621, 23148, 51107, 19712, 54543, 16602, 57653 } },
+	{ 8, 41, { 0, 0, 0, 0 }, { 26639, 48156, 23211, 51585, 19807, 54990, 16713, 58085 } },
+	{ 9, 0, { 0, 0, 0, 0 }, { 24341, 52440, 21897, 54885, 19272, 57510, 16792, 59991 } },
+	{ 9, 1, { 0, 0, 0, 0 }, { 16798, 60500, 14778, 62526, 12384, 64931, 9891, 67439 } },
+	{ 9, 2, { 0, 0, 0, 1 }, { 8005, 68441, 5040, 71406, 197, 76251, 0, 0 } },
+	{ 9, 3, { 0, 0, 0, 0 }, { 15726, 59609, 13698, 61630, 11290, 64028, 8773, 66530 } },
+	{ 9, 4, { 0, 0, 0, 0 }, { 24184, 51920, 21717, 54387, 19074, 57030, 16583, 59520 } },
+	{ 9, 5, { 0, 0, 0, 0 }, { 24341, 52440, 21897, 54885, 19272, 57510, 16792, 59991 } },
+	{ 9, 6, { 0, 0, 0, 0 }, { 16778, 60511, 14758, 62537, 12364, 64942, 9869, 67452 } },
+	{ 9, 7, { 0, 0, 0, 1 }, { 8017, 68444, 5054, 71408, 216, 76247, 0, 0 } },
+	{ 9, 8, { 0, 0, 0, 0 }, { 15741, 59590, 13713, 61611, 11305, 64009, 8790, 66509 } },
+	{ 9, 9, { 0, 0, 0, 0 }, { 24175, 51920, 21708, 54387, 19066, 57029, 16576, 59519 } },
+	{ 9, 10, { 0, 0, 0, 1 }, { 8147, 68018, 5262, 70914, 729, 75486, 0, 0 } },
+	{ 9, 11, { 0, 0, 0, 0 }, { 16793, 60499, 14774, 62525, 12380, 64929, 9886, 67438 } },
+	{ 9, 12, { 0, 0, 0, 1 }, { 8028, 68449, 5065, 71413, 231, 76249, 0, 0 } },
+	{ 9, 13, { 0, 0, 0, 0 }, { 15735, 59607, 13707, 61629, 11299, 64027, 8782, 66528 } },
+	{ 9, 14, { 0, 0, 0, 0 }, { 24163, 51914, 21697, 54381, 19055, 57022, 16565, 59513 } },
+	{ 9, 15, { 0, 0, 0, 0 }, { 21338, 53092, 19089, 55340, 16606, 57821, 14209, 60215 } },
+	{ 9, 16, { 0, 0, 0, 0 }, { 16807, 60483, 14788, 62509, 12395, 64912, 9902, 67419 } },
+	{ 9, 17, { 0, 0, 0, 1 }, { 8034, 68452, 5072, 71415, 239, 76250, 0, 0 } },
+	{ 9, 18, { 0, 0, 0, 0 }, { 15725, 59623, 13697, 61645, 11288, 64043, 8771, 66546 } },
+	{ 9, 19, { 0, 0, 0, 0 }, { 24150, 51904, 21684, 54370, 19042, 57012, 16552, 59502 } },
+	{ 9, 20, { 0, 0, 0, 0 }, { 12304, 63899, 10086, 66131, 7274, 68966, 3983, 72306 } },
+	{ 9, 21, { 0, 0, 0, 0 }, { 16681, 60572, 14661, 62599, 12262, 65008, 9760, 67525 } },
+	{ 9, 22, { 0, 0, 0, 1 }, { 8055, 68465, 5093, 71426, 264, 76254, 0, 0 } },
+	{ 9, 23, { 0, 0, 0, 0 }, { 15815, 59498, 13789, 61518, 11385, 63911, 8878, 66404 } },
+	{ 9, 24, { 0, 0, 0, 0 }, { 24166, 51925, 21700, 54391, 19059, 57032, 16569, 59522 } },
+	{ 9, 25, { 0, 0, 0, 0 }, { 13641, 62582, 11513, 64699, 8887, 67308, 5967, 70198 } },
+	{ 9, 26, { 0, 0, 0, 0 }, { 16723, 60541, 14703, 62568, 12306, 64975, 9808, 67489 } },
+	{ 9, 27, { 0, 0, 0, 1 }, { 8056, 68467, 5095, 71428, 266, 76256, 0, 0 } },
+	{ 9, 28, { 0, 0, 0, 0 }, { 15790, 59541, 13763, 61561, 11357, 63956, 8847, 66452 } },
+	{ 9, 29, { 0, 0, 0, 0 }, { 24155, 51915, 21689, 54380, 19047, 57022, 16558, 59512 } },
+	{ 9, 30, { 0, 0, 0, 0 }, { 21878, 56168, 19731, 58318, 17320, 60731, 14961, 63095 } },
+	{ 9, 31, { 0, 0, 0, 0 }, { 16696, 60560, 14676, 62587, 12278, 64995, 9778, 67511 } },
+	{ 9, 32, { 0, 0, 0, 1 }, { 8065, 68469, 5105, 71429, 280, 76254, 0, 0 } },
+	{ 9, 33, { 0, 0, 0, 0 }, { 15810, 59515, 13783, 61535, 11379, 63929, 8871, 66423 } },
+	{ 9, 34, { 0, 0, 0, 0 }, { 24154, 51920, 21689, 54385, 19047, 57026, 16558, 59516 } },
+	{ 9, 35, { 0, 0, 0, 1 }, { 9171, 67819, 6416, 70559, 2319, 74610, 0, 0 } },
+	{ 9, 36, { 0, 0, 0, 0 }, { 16676, 60569, 14656, 62596, 12257, 65005, 9755, 67523 } },
+	{ 9, 37, { 0, 0, 0, 1 }, { 8074, 68475, 5114, 71435, 289, 76258, 0, 0 } },
+	{ 9, 38, { 0, 0, 0, 0 }, { 15825, 59496, 13799, 61516, 11395, 63910, 8888, 66402 } },
+	{ 9, 39, { 0, 0, 0, 0 }, { 24149, 51917, 21684, 54382, 19043, 57023, 16553, 59513 } },
+	{ 9, 40, { 0, 0, 0, 0 }, { 24179, 51948, 21713, 54413, 19073, 57054, 16583, 59544 } },
+	{ 9, 41, { 0, 0, 0, 0 }, { 24286, 52379, 21842, 54823, 19216, 57450, 16736, 59930 } },
+	{ 10, 0, { 0, 0, 0, 0 }, { 23528, 54204, 21393, 56340, 19049, 58684, 16807, 60926 } },
+	{ 10, 1, { 0, 0, 0, 0 }, { 17287, 60953, 15457, 62788, 13298, 64954, 11077, 67185 } },
+	{ 10, 2, { 0, 0, 0, 2 }, { 9933, 67464, 7501, 69897, 4129, 73270, 0, 0 } },
+	{ 10, 3, { 0, 0, 0, 0 }, { 16240, 60056, 14404, 61887, 12234, 64049, 9998, 66275 } },
+	{ 10, 4, { 0, 0, 0, 0 }, { 23336, 53720, 21185, 55871, 18828, 58228, 16578, 60478 } },
+	{ 10, 5, { 0, 0, 0, 0 }, { 23528, 54204, 21393, 56340, 19049, 58684, 16807, 60926 } },
+	{ 10, 6, { 0, 0, 0, 0 }, { 17270, 60961, 15439, 62796, 13280, 64963, 11059, 67195 } },
+	{ 10, 7, { 0, 0, 0, 2 }, { 9945, 67469, 7513, 69900, 4143, 73271, 0, 0 } },
+	{ 10, 8, { 0, 0, 0, 0 }, { 16252, 60040, 14416, 61871, 12247, 64032, 10012, 66258 } },
+	{ 10, 9, { 0, 0, 0, 0 }, { 23328, 53719, 21177, 55870, 18821, 58226, 16571, 60477 } },
+	{ 10, 10, { 0, 0, 0, 0 }, { 10014, 67097, 7625, 69492, 4354, 72776, -517, 77707 } },
+	{ 10, 11, { 0, 0, 0, 0 }, { 17283, 60951, 15453, 62786, 13294, 64953, 11073, 67184 } },
+	{ 10, 12, { 0, 0, 0, 2 }, { 9955, 67474, 7523, 69906, 4154, 73276, 0, 0 } },
+	{ 10, 13, { 0, 0, 0, 0 }, { 16248, 60055, 14412, 61887, 12243, 64048, 10006, 66274 } },
+	{ 10, 14, { 0, 0, 0, 0 }, { 23317, 53713, 21166, 55864, 18810, 58220, 16560, 60470 } },
+	{ 10, 15, { 0, 0, 0, 0 }, { 20870, 54516, 18870, 56516, 16632, 58752, 14457, 60925 } },
+	{ 10, 16, { 0, 0, 0, 0 }, { 17295, 60937, 15465, 62772, 13306, 64938, 11086, 67169 } },
+	{ 10, 17, { 0, 0, 0, 2 }, { 9960, 67478, 7529, 69909, 4160, 73278, 0, 0 } },
+	{ 10, 18, { 0, 0, 0, 0 }, { 16241, 60069, 14404, 61901, 12234, 64063, 9997, 66289 } },
+	{ 10, 19, { 0, 0, 0, 0 }, { 23304, 53702, 21154, 55853, 18798, 58209, 16548, 60459 } },
+	{ 10, 20, { 0, 0, 0, 0 }, { 13415, 63728, 11443, 65708, 9007, 68160, 6312, 70880 } },
+	{ 10, 21, { 0, 0, 0, 0 }, { 17185, 61010, 15354, 62846, 13192, 65015, 10966, 67252 } },
+	{ 10, 22, { 0, 0, 0, 2 }, { 9980, 67491, 7550, 69921, 4182, 73289, 0, 0 } },
+	{ 10, 23, { 0, 0, 0, 0 }, { 16314, 59960, 14478, 61791, 12312, 63949, 10082, 66169 } },
+	{ 10, 24, { 0, 0, 0, 0 }, { 23320, 53723, 21170, 55873, 18814, 58229, 16564, 60479 } },
+	{ 10, 25, { 0, 0, 0, 0 }, { 14550, 62636, 12643, 64536, 10326, 66841, 7838, 69311 } },
+	{ 10, 26, { 0, 0, 0, 0 }, { 17221, 60984, 15391, 62820, 13230, 64989, 11006, 67223 } },
+	{ 10, 27, { 0, 0, 0, 2 }, { 9982, 67493, 7552, 69923, 4184, 73291, 0, 0 } },
+	{ 10, 28, { 0, 0, 0, 0 }, { 16294, 59998, 14458, 61829, 12291, 63988, 10058, 66210 } },
+	{ 10, 29, { 0, 0, 0, 0 }, { 23309, 53712, 21159, 55863, 18803, 58219, 16553, 60468 } },
+	{ 10, 30, { 0, 0, 0, 0 }, { 21623, 57369, 19696, 59298, 17514, 61482, 15372, 63627 } },
+	{ 10, 31, { 0, 0, 0, 0 }, { 17198, 61000, 15367, 62836, 13206, 65005, 10980, 67241 } },
+	{ 10, 32, { 0, 0, 0, 2 }, { 9991, 67496, 7561, 69926, 4194, 73293, 0, 0 } },
+	{ 10, 33, { 0, 0, 0, 0 }, { 16310, 59975, 14475, 61806, 12308, 63965, 10077, 66186 } },
+	{ 10, 34, { 0, 0, 0, 0 }, { 23309, 53717, 21159, 55867, 18803, 58223, 16554, 60472 } },
+	{ 10, 35, { 0, 0, 0, 0 }, { 10924, 67028, 8610, 69333, 5505, 72419, 1267, 76596 } },
+	{ 10, 36, { 0, 0, 0, 0 }, { 17180, 61007, 15349, 62843, 13188, 65012, 10961, 67249 } },
+	{ 10, 37, { 0, 0, 0, 2 }, { 9999, 67503, 7569, 69932, 4203, 73298, 0, 0 } },
+	{ 10, 38, { 0, 0, 0, 0 }, { 16323, 59959, 14487, 61790, 12322, 63949, 10092, 66168 } },
+	{ 10, 39, { 0, 0, 0, 0 }, { 23305, 53714, 21155, 55864, 18799, 58219, 16550, 60469 } },
+	{ 10, 40, { 0, 0, 0, 0 }, { 23334, 53745, 21184, 55895, 18829, 58250, 16579, 60500 } },
+	{ 10, 41, { 0, 0, 0, 0 }, { 23473, 54143, 21337, 56279, 18993, 58624, 16751, 60866 } },
+	{ 11, 0, { 0, 0, 0, 0 }, { 27885, 50331, 24614, 53603, 21321, 56896, 18311, 59907 } },
+	{ 11, 1, { 0, 0, 0, 0 }, { 17478, 61270, 15049, 63710, 12131, 66646, 8988, 69820 } },
+	{ 11, 2, { 0, 0, 1, 1 }, { 5391, 72488, -133, 78016, 0, 0, 0, 0 } },
+	{ 11, 3, { 0, 0, 0, 0 }, { 16363, 60385, 13919, 62817, 10975, 65743, 7782, 68905 } },
+	{ 11, 4, { 0, 0, 0, 0 }, { 27826, 49710, 24498, 53038, 21172, 56364, 18145, 59391 } },
+	{ 11, 5, { 0, 0, 0, 0 }, { 27885, 50331, 24614, 53603, 21321, 56896, 18311, 59907 } },
+	{ 11, 6, { 0, 0, 0, 0 }, { 17454, 61285, 15024, 63726, 12105, 66663, 8959, 69840 } },
+	{ 11, 7, { 0, 0, 1, 1 }, { 5406, 72488, -109, 78005, 0, 0, 0, 0 } },
+	{ 11, 8, { 0, 0, 0, 0 }, { 16382, 60361, 13939, 62793, 10997, 65718, 7807, 68876 } },
+	{ 11, 9, { 0, 0, 0, 0 }, { 27815, 49713, 24488, 53039, 21164, 56364, 18136, 59391 } },
+	{ 11, 10, { 0, 0, 1, 1 }, { 5718, 71901, 718, 76963, 0, 0, 0, 0 } },
+	{ 11, 11, { 0, 0, 0, 0 }, { 17474, 61269, 15044, 63709, 12126, 66645, 8982, 69820 } },
+	{ 11, 12, { 0, 0, 1, 1 }, { 5419, 72491, -91, 78004, 0, 0, 0, 0 } },
+	{ 11, 13, { 0, 0, 0, 0 }, { 16373, 60382, 13930, 62814, 10986, 65740, 7794, 68901 } },
+	{ 11, 14, { 0, 0, 0, 0 }, { 27801, 49709, 24476, 53034, 21152, 56358, 18125, 59385 } },
+	{ 11, 15, { 0, 0, 0, 0 }, { 24027, 51826, 21183, 54669, 18148, 57700, 15267, 60577 } },
+	{ 11, 16, { 0, 0, 0, 0 }, { 17492, 61248, 15063, 63688, 12147, 66623, 9006, 69794 } },
+	{ 11, 17, { 0, 0, 1, 1 }, { 5426, 72493, -80, 78003, 0, 0, 0, 0 } },
+	{ 11, 18, { 0, 0, 0, 0 }, { 16359, 60402, 13916, 62834, 10971, 65761, 7776, 68924 } },
+	{ 11, 19, { 0, 0, 0, 0 }, { 27787, 49699, 24462, 53025, 21138, 56348, 18111, 59375 } },
+	{ 11, 20, { 0, 0, 0, 2 }, { 11718, 65946, 8902, 68788, 5030, 72724, 0, 0 } },
+	{ 11, 21, { 0, 0, 0, 0 }, { 17333, 61370, 14902, 63813, 11975, 66758, 8813, 69952 } },
+	{ 11, 22, { 0, 0, 1, 1 }, { 5449, 72502, -51, 78000, 0, 0, 0, 0 } },
+	{ 11, 23, { 0, 0, 0, 0 }, { 16483, 60243, 14042, 62673, 11107, 65590, 7936, 68731 } },
+	{ 11, 24, { 0, 0, 0, 0 }, { 27802, 49722, 24477, 53046, 21154, 56369, 18127, 59396 } },
+	{ 11, 25, { 0, 0, 0, 0 }, { 13480, 64150, 10849, 66762, 7444, 70129, 3141, 74333 } },
+	{ 11, 26, { 0, 0, 0, 0 }, { 17386, 61329, 14955, 63770, 12032, 66712, 8877, 69898 } },
+	{ 11, 27, { 0, 0, 1, 1 }, { 5450, 72504, -49, 78003, 0, 0, 0, 0 } },
+	{ 11, 28, { 0, 0, 0, 0 }, { 16446, 60297, 14005, 62727, 11067, 65647, 7888, 68796 } },
+	{ 11, 29, { 0, 0, 0, 0 }, { 27790, 49712, 24466, 53036, 21143, 56359, 18116, 59386 } },
+	{ 11, 30, { 0, 0, 0, 0 }, { 24084, 55404, 21434, 58058, 18522, 60976, 15692, 63813 } },
+	{ 11, 31, { 0, 0, 0, 0 }, { 17353, 61354, 14921, 63797, 11996, 66740, 8836, 69931 } },
+	{ 11, 32, { 0, 0, 1, 1 }, { 5462, 72505, -32, 77996, 0, 0, 0, 0 } },
+	{ 11, 33, { 0, 0, 0, 0 }, { 16474, 60264, 14033, 62694, 11097, 65612, 7923, 68755 } },
+	{ 11, 34, { 0, 0, 0, 0 }, { 27788, 49718, 24464, 53042, 21142, 56364, 18115, 59391 } },
+	{ 11, 35, { 0, 0, 1, 1 }, { 7062, 71328, 2704, 75624, 0, 0, 0, 0 } },
+	{ 11, 36, { 0, 0, 0, 0 }, { 17328, 61368, 14896, 63811, 11970, 66756, 8807, 69950 } },
+	{ 11, 37, { 0, 0, 1, 1 }, { 5471, 72510, -21, 77998, 0, 0, 0, 0 } },
+	{ 11, 38, { 0, 0, 0, 0 }, { 16494, 60240, 14054, 62670, 11120, 65586, 7949, 68727 } },
+	{ 11, 39, { 0, 0, 0, 0 }, { 27783, 49716, 24460, 53039, 21137, 56361, 18111, 59388 } },
+	{ 11, 40, { 0, 0, 0, 0 }, { 27811, 49748, 24489, 53071, 21166, 56393, 18140, 59419 } },
+	{ 11, 41, { 0, 0, 0, 0 }, { 27833, 50267, 24560, 53540, 21267, 56834, 18256, 59846 } },
+	{ 12, 0, { 0, 0, 0, 0 }, { 24345, 54673, 22170, 56848, 19789, 59229, 17516, 61503 } },
+	{ 12, 1, { 0, 0, 0, 0 }, { 17927, 61599, 16071, 63460, 13881, 65658, 11625, 67925 } },
+	{ 12, 2, { 0, 0, 0, 2 }, { 10381, 68302, 7886, 70797, 4377, 74307, 0, 0 } },
+	{ 12, 3, { 0, 0, 0, 0 }, { 16878, 60701, 15016, 62558, 12815, 64751, 10542, 67013 } },
+	{ 12, 4, { 0, 0, 0, 0 }, { 24158, 54184, 21966, 56375, 19572, 58769, 17290, 61051 } },
+	{ 12, 5, { 0, 0, 0, 0 }, { 24345, 54673, 22170, 56848, 19789, 59229, 17516, 61503 } },
+	{ 12, 6, { 0, 0, 0, 0 }, { 17909, 61607, 16054, 63468, 13863, 65667, 11606, 67935 } },
+	{ 12, 7, { 0, 0, 0, 2 }, { 10392, 68306, 7898, 70800, 4391, 74308, 0, 0 } },
+	{ 12, 8, { 0, 0, 0, 0 }, { 16891, 60685, 15029, 62542, 12828, 64734, 10556, 66995 } },
+	{ 12, 9, { 0, 0, 0, 0 }, { 24150, 54183, 21959, 56374, 19565, 58768, 17283, 61050 } },
+	{ 12, 10, { 0, 0, 0, 2 }, { 10469, 67928, 8021, 70382, 4626, 73792, 0, 0 } },
+	{ 12, 11, { 0, 0, 0, 0 }, { 17923, 61598, 16067, 63458, 13877, 65656, 11620, 67924 } },
+	{ 12, 12, { 0, 0, 0, 2 }, { 10402, 68312, 7909, 70806, 4402, 74313, 0, 0 } },
+	{ 12, 13, { 0, 0, 0, 0 }, { 16887, 60700, 15024, 62557, 12824, 64750, 10551, 67012 } },
+	{ 12, 14, { 0, 0, 0, 0 }, { 24139, 54177, 21948, 56368, 19554, 58761, 17272, 61043 } },
+	{ 12, 15, { 0, 0, 0, 0 }, { 21643, 55029, 19609, 57061, 17339, 59330, 15135, 61532 } },
+	{ 12, 16, { 0, 0, 0, 0 }, { 17935, 61583, 16079, 63444, 13890, 65641, 11634, 67908 } },
+	{ 12, 17, { 0, 0, 0, 2 }, { 10408, 68315, 7915, 70809, 4409, 74315, 0, 0 } },
+	{ 12, 18, { 0, 0, 0, 0 }, { 16879, 60714, 15016, 62572, 12815, 64765, 10541, 67027 } },
+	{ 12, 19, { 0, 0, 0, 0 }, { 24126, 54166, 21935, 56357, 19542, 58750, 17260, 61032 } },
+	{ 12, 20, { 0, 0, 0, 0 }, { 13969, 64460, 11966, 66473, 9482, 68973, 6716, 71766 } },
+	{ 12, 21, { 0, 0, 0, 0 }, { 17823, 61658, 15966, 63520, 13773, 65721, 11511, 67995 } },
+	{ 12, 22, { 0, 0, 0, 2 }, { 10429, 68328, 7936, 70821, 4431, 74325, 0, 0 } },
+	{ 12, 23, { 0, 0, 0, 0 }, { 16954, 60603, 15093, 62459, 12896, 64649, 10629, 66905 } },
+	{ 12, 24, { 0, 0, 0, 0 }, { 24142, 54187, 21951, 56377, 19558, 58771, 17277, 61052 } },
+	{ 12, 25, { 0, 0, 0, 0 }, { 15134, 63336, 13197, 65265, 10841, 67608, 8299, 70130 } },
+	{ 12, 26, { 0, 0, 0, 0 }, { 17860, 61632, 16004, 63493, 13812, 65693, 11552, 67965 } },
+	{ 12, 27, { 0, 0, 0, 2 }, { 10430, 68330, 7937, 70823, 4433, 74327, 0, 0 } },
+	{ 12, 28, { 0, 0, 0, 0 }, { 16933, 60642, 15072, 62498, 12873, 64689, 10604, 66947 } },
+	{ 12, 29, { 0, 0, 0, 0 }, { 24131, 54176, 21940, 56367, 19547, 58760, 17265, 61042 } },
+	{ 12, 30, { 0, 0, 0, 0 }, { 22366, 57912, 20409, 59871, 18197, 62085, 16026, 64260 } },
+	{ 12, 31, { 0, 0, 0, 0 }, { 17836, 61648, 15980, 63509, 13787, 65710, 11526, 67983 } },
+	{ 12, 32, { 0, 0, 0, 2 }, { 10439, 68333, 7946, 70825, 4443, 74328, 0, 0 } },
+	{ 12, 33, { 0, 0, 0, 0 }, { 16950, 60619, 15089, 62475, 12891, 64665, 10624, 66921 } },
+	{ 12, 34, { 0, 0, 0, 0 }, { 24130, 54181, 21940, 56371, 19547, 58764, 17266, 61046 } },
+	{ 12, 35, { 0, 0, 0, 0 }, { 11395, 67841, 9027, 70199, 5818, 73387, 1248, 77879 } },
+	{ 12, 36, { 0, 0, 0, 0 }, { 17818, 61655, 15962, 63517, 13768, 65718, 11506, 67992 } },
+	{ 12, 37, { 0, 0, 0, 2 }, { 10447, 68340, 7955, 70832, 4452, 74334, 0, 0 } },
+	{ 12, 38, { 0, 0, 0, 0 }, { 16963, 60603, 15102, 62459, 12905, 64648, 10639, 66904 } },
+	{ 12, 39, { 0, 0, 0, 0 }, { 24126, 54178, 21936, 56368, 19543, 58761, 17262, 61042 } },
+	{ 12, 40, { 0, 0, 0, 0 }, { 24155, 54209, 21965, 56399, 19573, 58792, 17291, 61073 } },
+	{ 12, 41, { 0, 0, 0, 0 }, { 24290, 54612, 22115, 56787, 19734, 59168, 17460, 61443 } },
+	{ 13, 0, { 0, 0, 0, 0 }, { 25307, 54648, 23017, 56939, 20530, 59426, 18166, 61791 } },
+	{ 13, 1, { 0, 0, 0, 0 }, { 18389, 62077, 16461, 64011, 14181, 66300, 11822, 68672 } },
+	{ 13, 2, { 0, 0, 0, 1 }, { 10295, 69325, 7608, 72012, 3632, 75989, 0, 0 } },
+	{ 13, 3, { 0, 0, 0, 0 }, { 17333, 61179, 15398, 63109, 13106, 65392, 10727, 67758 } },
+	{ 13, 4, { 0, 0, 0, 0 }, { 25133, 54146, 22824, 56455, 20322, 58957, 17948, 61331 } },
+	{ 13, 5, { 0, 0, 0, 0 }, { 25307, 54648, 23017, 56939, 20530, 59426, 18166, 61791 } },
+	{ 13, 6, { 0, 0, 0, 0 }, { 18371, 62087, 16443, 64020, 14162, 66310, 11802, 68683 } },
+	{ 13, 7, { 0, 0, 0, 1 }, { 10307, 69329, 7621, 72015, 3648, 75989, 0, 0 } },
+	{ 13, 8, { 0, 0, 0, 0 }, { 17346, 61162, 15411, 63092, 13120, 65374, 10742, 67739 } },
+	{ 13, 9, { 0, 0, 0, 0 }, { 25125, 54145, 22816, 56454, 20314, 58956, 17941, 61329 } },
+	{ 13, 10, { 0, 0, 0, 2 }, { 10406, 68930, 7778, 71566, 3969, 75397, 0, 0 } },
+	{ 13, 11, { 0, 0, 0, 0 }, { 18385, 62076, 16457, 64010, 14177, 66298, 11817, 68671 } },
+	{ 13, 12, { 0, 0, 0, 1 }, { 10317, 69334, 7632, 72020, 3660, 75993, 0, 0 } },
+	{ 13, 13, { 0, 0, 0, 0 }, { 17341, 61178, 15406, 63108, 13114, 65391, 10736, 67757 } },
+	{ 13, 14, { 0, 0, 0, 0 }, { 25114, 54139, 22805, 56448, 20303, 58949, 17930, 61323 } },
+	{ 13, 15, { 0, 0, 0, 0 }, { 22475, 55132, 20348, 57257, 17984, 59619, 15695, 61906 } },
+	{ 13, 16, { 0, 0, 0, 0 }, { 18398, 62061, 16470, 63994, 14191, 66282, 11832, 68654 } },
+	{ 13, 17, { 0, 0, 0, 1 }, { 10323, 69337, 7638, 72023, 3667, 75995, 0, 0 } },
+	{ 13, 18, { 0, 0, 0, 0 }, { 17333, 61193, 15397, 63123, 13105, 65406, 10725, 67773 } },
+	{ 13, 19, { 0, 0, 0, 0 }, { 25101, 54129, 22792, 56437, 20291, 58939, 17917, 61312 } },
+	{ 13, 20, { 0, 0, 0, 0 }, { 14192, 65179, 12095, 67287, 9471, 69930, 6491, 72945 } },
+	{ 13, 21, { 0, 0, 0, 0 }, { 18280, 62142, 16351, 64076, 14067, 66369, 11701, 68749 } },
+	{ 13, 22, { 0, 0, 0, 1 }, { 10344, 69350, 7659, 72034, 3690, 76003, 0, 0 } },
+	{ 13, 23, { 0, 0, 0, 0 }, { 17415, 61076, 15481, 63004, 13193, 65283, 10822, 67642 } },
+	{ 13, 24, { 0, 0, 0, 0 }, { 25117, 54149, 22808, 56458, 20307, 58959, 17934, 61332 } },
+	{ 13, 25, { 0, 0, 0, 0 }, { 15436, 63966, 13416, 65977, 10943, 68435, 8242, 71112 } },
+	{ 13, 26, { 0, 0, 0, 0 }, { 18319, 62114, 16390, 64048, 14108, 66339, 11744, 68716 } },
+	{ 13, 27, { 0, 0, 0, 1 }, { 10345, 69352, 7661, 72036, 3692, 76005, 0, 0 } },
+	{ 13, 28, { 0, 0, 0, 0 }, { 17392, 61116, 15457, 63045, 13168, 65325, 10794, 67687 } },
+	{ 13, 29, { 0, 0, 0, 0 }, { 25105, 54139, 22797, 56447, 20296, 58948, 17923, 61322 } },
+	{ 13, 30, { 0, 0, 0, 0 }, { 23115, 58102, 21075, 60144, 18776, 62446, 16521, 64704 } },
+	{ 13, 31, { 0, 0, 0, 0 }, { 18294, 62131, 16365, 64065, 14082, 66357, 11717, 68736 } },
+	{ 13, 32, { 0, 0, 0, 1 }, { 10354, 69355, 7670, 72038, 3703, 76005, 0, 0 } },
+	{ 13, 33, { 0, 0, 0, 0 }, { 17410, 61092, 15476, 63020, 13188, 65300, 10816, 67660 } },
+	{ 13, 34, { 0, 0, 0, 0 }, { 25105, 54144, 22797, 56452, 20296, 58953, 17923, 61326 } },
+	{ 13, 35, { 0, 0, 0, 2 }, { 11375, 68794, 8846, 71311, 5299, 74829, 0, 0 } },
+	{ 13, 36, { 0, 0, 0, 0 }, { 18275, 62139, 16346, 64074, 14063, 66366, 11696, 68746 } },
+	{ 13, 37, { 0, 0, 0, 1 }, { 10363, 69361, 7679, 72044, 3712, 76010, 0, 0 } },
+	{ 13, 38, { 0, 0, 0, 0 }, { 17424, 61075, 15490, 63003, 13202, 65282, 10832, 67640 } },
+	{ 13, 39, { 0, 0, 0, 0 }, { 25100, 54141, 22793, 56449, 20292, 58950, 17919, 61322 } },
+	{ 13, 40, { 0, 0, 0, 0 }, { 25130, 54172, 22822, 56480, 20321, 58981, 17948, 61354 } },
+	{ 13, 41, { 0, 0, 0, 0 }, { 25252, 54587, 22962, 56878, 20474, 59366, 18110, 61731 } },
+	{ 14, 0, { 0, 0, 0, 0 }, { 26266, 54180, 23799, 56648, 21152, 59295, 18655, 61793 } },
+	{ 14, 1, { 0, 0, 0, 0 }, { 18625, 62336, 16592, 64376, 14181, 66798, 11666, 69328 } },
+	{ 14, 2, { 0, 0, 0, 1 }, { 9730, 70380, 6719, 73391, 1697, 78416, 0, 0 } },
+	{ 14, 3, { 0, 0, 0, 0 }, { 17557, 61440, 15516, 63475, 13089, 65890, 10551, 68413 } },
+	{ 14, 4, { 0, 0, 0, 0 }, { 26113, 53656, 23621, 56148, 20957, 58812, 18448, 61321 } },
+	{ 14, 5, { 0, 0, 0, 0 }, { 26266, 54180, 23799, 56648, 21152, 59295, 18655, 61793 } },
+	{ 14, 6, { 0, 0, 0, 0 }, { 18606, 62347, 16572, 64387, 14160, 66810, 11644, 69341 } },
+	{ 14, 7, { 0, 0, 0, 1 }, { 9743, 70383, 6733, 73393, 1717, 78411, 0, 0 } },
+	{ 14, 8, { 0, 0, 0, 0 }, { 17572, 61421, 15530, 63456, 13105, 65871, 10569, 68392 } },
+	{ 14, 9, { 0, 0, 0, 0 }, { 26104, 53656, 23613, 56148, 20949, 58811, 18441, 61319 } },
+	{ 14, 10, { 0, 0, 0, 1 }, { 9877, 69954, 6948, 72893, 2273, 77611, 0, 0 } },
+	{ 14, 11, { 0, 0, 0, 0 }, { 18621, 62335, 16588, 64375, 14176, 66797, 11662, 69327 } },
+	{ 14, 12, { 0, 0, 0, 1 }, { 9753, 70388, 6744, 73398, 1732, 78412, 0, 0 } },
+	{ 14, 13, { 0, 0, 0, 0 }, { 17566, 61438, 15524, 63473, 13098, 65889, 10561, 68411 } },
+	{ 14, 14, { 0, 0, 0, 0 }, { 26092, 53651, 23601, 56141, 20938, 58805, 18430, 61313 } },
+	{ 14, 15, { 0, 0, 0, 0 }, { 23240, 54854, 20972, 57121, 18470, 59620, 16057, 62031 } },
+	{ 14, 16, { 0, 0, 0, 0 }, { 18635, 62318, 16602, 64358, 14191, 66780, 11678, 69308 } },
+	{ 14, 17, { 0, 0, 0, 1 }, { 9759, 70391, 6751, 73400, 1740, 78413, 0, 0 } },
+	{ 14, 18, { 0, 0, 0, 0 }, { 17557, 61454, 15514, 63490, 13088, 65906, 10549, 68429 } },
+	{ 14, 19, { 0, 0, 0, 0 }, { 26079, 53640, 23588, 56131, 20925, 58794, 18417, 61302 } },
+	{ 14, 20, { 0, 0, 0, 0 }, { 14088, 65780, 11851, 68031, 9009, 70897, 5664, 74292 } },
+	{ 14, 21, { 0, 0, 0, 0 }, { 18508, 62409, 16474, 64450, 14058, 66877, 11535, 69416 } },
+	{ 14, 22, { 0, 0, 0, 1 }, { 9780, 70403, 6773, 73410, 1766, 78415, 0, 0 } },
+	{ 14, 23, { 0, 0, 0, 0 }, { 17648, 61328, 15607, 63361, 13186, 65772, 10658, 68285 } },
+	{ 14, 24, { 0, 0, 0, 0 }, { 26095, 53662, 23604, 56152, 20941, 58815, 18434, 61323 } },
+	{ 14, 25, { 0, 0, 0, 0 }, { 15444, 64441, 13300, 66574, 10651, 69206, 7696, 72129 } },
+	{ 14, 26, { 0, 0, 0, 0 }, { 18550, 62377, 16516, 64418, 14102, 66843, 11582, 69378 } },
+	{ 14, 27, { 0, 0, 0, 1 }, { 9782, 70405, 6774, 73413, 1768, 78419, 0, 0 } },
+	{ 14, 28, { 0, 0, 0, 0 }, { 17622, 61371, 15581, 63405, 13158, 65818, 10626, 68334 } },
+	{ 14, 29, { 0, 0, 0, 0 }, { 26083, 53651, 23593, 56141, 20930, 58804, 18422, 61312 } },
+	{ 14, 30, { 0, 0, 0, 0 }, { 23760, 57951, 21596, 60117, 19169, 62547, 16794, 64927 } },
+	{ 14, 31, { 0, 0, 0, 0 }, { 18523, 62396, 16489, 64438, 14074, 66864, 11552, 69401 } },
+	{ 14, 32, { 0, 0, 0, 1 }, { 9791, 70408, 6785, 73414, 1782, 78415, 0, 0 } },
+	{ 14, 33, { 0, 0, 0, 0 }, { 17642, 61345, 15602, 63379, 13180, 65790, 10651, 68304 } },
+	{ 14, 34, { 0, 0, 0, 0 }, { 26083, 53656, 23593, 56146, 20930, 58809, 18422, 61316 } },
+	{ 14, 35, { 0, 0, 0, 1 }, { 10912, 69741, 8120, 72517, 3924, 76664, 0, 0 } },
+	{ 14, 36, { 0, 0, 0, 0 }, { 18503, 62406, 16469, 64447, 14053, 66874, 11529, 69413 } },
+	{ 14, 37, { 0, 0, 0, 1 }, { 9800, 70414, 6794, 73420, 1792, 78419, 0, 0 } },
+	{ 14, 38, { 0, 0, 0, 0 }, { 17658, 61326, 15617, 63360, 13196, 65771, 10669, 68283 } },
+	{ 14, 39, { 0, 0, 0, 0 }, { 26078, 53653, 23588, 56143, 20926, 58806, 18418, 61313 } },
+	{ 14, 40, { 0, 0, 0, 0 }, { 26107, 53685, 23617, 56175, 20955, 58837, 18448, 61345 } },
+	{ 14, 41, { 0, 0, 0, 0 }, { 26212, 54118, 23744, 56587, 21097, 59234, 18599, 61733 } },
+	{ 15, 0, { 0, 0, 0, 0 }, { 27565, 53277, 24798, 56044, 21896, 58946, 19191, 61653 } },
+	{ 15, 1, { 0, 0, 0, 0 }, { 18809, 62555, 16613, 64759, 13996, 67389, 11234, 70172 } },
+	{ 15, 2, { 0, 0, 1, 1 }, { 8656, 71849, 4987, 75519, 0, 0, 0, 0 } },
+	{ 15, 3, { 0, 0, 0, 0 }, { 17723, 61661, 15517, 63858, 12881, 66481, 10087, 69254 } },
+	{ 15, 4, { 0, 0, 0, 0 }, { 27446, 52717, 24645, 55519, 21720, 58443, 19002, 61161 } },
+	{ 15, 5, { 0, 0, 0, 0 }, { 27565, 53277, 24798, 56044, 21896, 58946, 19191, 61653 } },
+	{ 15, 6, { 0, 0, 0, 0 }, { 18787, 62567, 16591, 64771, 13973, 67403, 11209, 70187 } },
+	{ 15, 7, { 0, 0, 1, 1 }, { 8669, 71851, 5003, 75518, 0, 0, 0, 0 } },
+	{ 15, 8, { 0, 0, 0, 0 }, { 17740, 61640, 15534, 63838, 12899, 66459, 10107, 69230 } },
+	{ 15, 9, { 0, 0, 0, 0 }, { 27436, 52718, 24636, 55518, 21712, 58442, 18994, 61161 } },
+	{ 15, 10, { 0, 0, 2, 1 }, { 8865, 71367, 5345, 74906, 0, 0, 0, 0 } },
+	{ 15, 11, { 0, 0, 0, 0 }, { 18804, 62554, 16608, 64758, 13991, 67388, 11229, 70171 } },
+	{ 15, 12, { 0, 0, 1, 1 }, { 8680, 71855, 5015, 75521, 0, 0, 0, 0 } },
+	{ 15, 13, { 0, 0, 0, 0 }, { 17732, 61658, 15526, 63856, 12891, 66478, 10097, 69251 } },
+	{ 15, 14, { 0, 0, 0, 0 }, { 27424, 52713, 24624, 55513, 21701, 58436, 18982, 61154 } },
+	{ 15, 15, { 0, 0, 0, 0 }, { 24222, 54262, 21728, 56755, 19011, 59469, 16406, 62071 } },
+	{ 15, 16, { 0, 0, 0, 0 }, { 18820, 62535, 16625, 64739, 14009, 67368, 11248, 70149 } },
+	{ 15, 17, { 0, 0, 1, 1 }, { 8687, 71858, 5023, 75523, 0, 0, 0, 0 } },
+	{ 15, 18, { 0, 0, 0, 0 }, { 17721, 61676, 15514, 63874, 12878, 66497, 10083, 69271 } },
+	{ 15, 19, { 0, 0, 0, 0 }, { 27410, 52703, 24611, 55503, 21688, 58426, 18970, 61144 } },
+	{ 15, 20, { 0, 0, 0, 0 }, { 13762, 66511, 11298, 68993, 8082, 72244, 3990, 76433 } },
+	{ 15, 21, { 0, 0, 0, 0 }, { 18680, 62639, 16482, 64845, 13859, 67481, 11085, 70277 } },
+	{ 15, 22, { 0, 0, 1, 1 }, { 8709, 71869, 5046, 75531, 0, 0, 0, 0 } },
+	{ 15, 23, { 0, 0, 0, 0 }, { 17826, 61536, 15621, 63732, 12992, 66348, 10212, 69108 } },
+	{ 15, 24, { 0, 0, 0, 0 }, { 27426, 52725, 24627, 55524, 21704, 58447, 18986, 61165 } },
+	{ 15, 25, { 0, 0, 0, 0 }, { 15288, 64982, 12949, 67307, 10010, 70222, 6598, 73585 } },
+	{ 15, 26, { 0, 0, 0, 0 }, { 18726, 62603, 16530, 64808, 13909, 67442, 11139, 70233 } },
+	{ 15, 27, { 0, 0, 1, 1 }, { 8710, 71871, 5048, 75533, 0, 0, 0, 0 } },
+	{ 15, 28, { 0, 0, 0, 0 }, { 17795, 61584, 15590, 63780, 12959, 66399, 10174, 69163 } },
+	{ 15, 29, { 0, 0, 0, 0 }, { 27414, 52715, 24615, 55514, 21692, 58436, 18974, 61154 } },
+	{ 15, 30, { 0, 0, 0, 0 }, { 24555, 57554, 22197, 59915, 19571, 62544, 17010, 65112 } },
+	{ 15, 31, { 0, 0, 0, 0 }, { 18697, 62625, 16500, 64831, 13878, 67466, 11105, 70260 } },
+	{ 15, 32, { 0, 0, 1, 1 }, { 8720, 71873, 5059, 75533, 0, 0, 0, 0 } },
+	{ 15, 33, { 0, 0, 0, 0 }, { 17819, 61554, 15614, 63751, 12984, 66368, 10202, 69129 } },
+	{ 15, 34, { 0, 0, 0, 0 }, { 27413, 52720, 24614, 55519, 21692, 58441, 18974, 61159 } },
+	{ 15, 35, { 0, 0, 2, 1 }, { 10012, 71024, 6726, 74284, 0, 0, 0, 0 } },
+	{ 15, 36, { 0, 0, 0, 0 }, { 18675, 62636, 16477, 64842, 13854, 67479, 11080, 70274 } },
+	{ 15, 37, { 0, 0, 1, 1 }, { 8729, 71879, 5069, 75538, 0, 0, 0, 0 } },
+	{ 15, 38, { 0, 0, 0, 0 }, { 17836, 61534, 15632, 63730, 13003, 66346, 10223, 69105 } },
+	{ 15, 39, { 0, 0, 0, 0 }, { 27408, 52718, 24610, 55516, 21688, 58438, 18970, 61156 } },
+	{ 15, 40, { 0, 0, 0, 0 }, { 27437, 52749, 24639, 55547, 21717, 58470, 18999, 61187 } },
+	{ 15, 41, { 0, 0, 0, 0 }, { 27511, 53214, 24743, 55983, 21841, 58885, 19136, 61592 } },
+	{ 16, 0, { 0, 0, 0, 0 }, { 23894, 56989, 22010, 58874, 19907, 60976, 17876, 63008 } },
+	{ 16, 1, { 0, 0, 0, 0 }, { 18873, 62509, 17213, 64172, 15263, 66128, 13276, 68122 } },
+	{ 16, 2, { 0, 0, 0, 0 }, { 12848, 67702, 10788, 69762, 8128, 72422, 4911, 75639 } },
+	{ 16, 3, { 0, 0, 0, 0 }, { 17852, 61604, 16187, 63265, 14230, 65217, 12233, 67208 } },
+	{ 16, 4, { 0, 0, 0, 0 }, { 23673, 56537, 21777, 58432, 19665, 60544, 17627, 62582 } },
+	{ 16, 5, { 0, 0, 0, 0 }, { 23894, 56989, 22010, 58874, 19907, 60976, 17876, 63008 } },
+	{ 16, 6, { 0, 0, 0, 0 }, { 18858, 62515, 17198, 64178, 15247, 66134, 13260, 68129 } },
+	{ 16, 7, { 0, 0, 0, 0 }, { 12859, 67707, 10799, 69766, 8140, 72426, 4925, 75641 } },
+	{ 16, 8, { 0, 0, 0, 0 }, { 17861, 61591, 16197, 63252, 14240, 65204, 12243, 67193 } },
+	{ 16, 9, { 0, 0, 0, 0 }, { 23665, 56535, 21770, 58430, 19659, 60542, 17620, 62580 } },
+	{ 16, 10, { 0, 0, 0, 0 }, { 12877, 67380, 10843, 69418, 8232, 72035, 5117, 75164 } },
+	{ 16, 11, { 0, 0, 0, 0 }, { 18869, 62507, 17209, 64171, 15259, 66126, 13272, 68120 } },
+	{ 16, 12, { 0, 0, 0, 0 }, { 12868, 67713, 10809, 69772, 8150, 72431, 4936, 75646 } },
+	{ 16, 13, { 0, 0, 0, 0 }, { 17859, 61604, 16194, 63266, 14237, 65217, 12240, 67207 } },
+	{ 16, 14, { 0, 0, 0, 0 }, { 23655, 56528, 21760, 58423, 19648, 60535, 17610, 62573 } },
+	{ 16, 15, { 0, 0, 0, 0 }, { 21543, 57001, 19754, 58789, 17732, 60810, 15757, 62784 } },
+	{ 16, 16, { 0, 0, 0, 0 }, { 18878, 62495, 17218, 64159, 15268, 66114, 13282, 68108 } },
+	{ 16, 17, { 0, 0, 0, 0 }, { 12873, 67716, 10814, 69776, 8156, 72434, 4942, 75649 } },
+	{ 16, 18, { 0, 0, 0, 0 }, { 17853, 61616, 16189, 63278, 14231, 65230, 12233, 67220 } },
+	{ 16, 19, { 0, 0, 0, 0 }, { 23642, 56517, 21747, 58412, 19636, 60524, 17598, 62562 } },
+	{ 16, 20, { 0, 0, 0, 0 }, { 15602, 64681, 13841, 66447, 11706, 68593, 9426, 70887 } },
+	{ 16, 21, { 0, 0, 0, 0 }, { 18785, 62551, 17124, 64216, 15172, 66173, 13182, 68171 } },
+	{ 16, 22, { 0, 0, 0, 0 }, { 12893, 67731, 10834, 69789, 8176, 72447, 4964, 75659 } },
+	{ 16, 23, { 0, 0, 0, 0 }, { 17911, 61524, 16246, 63184, 14291, 65134, 12298, 67120 } },
+	{ 16, 24, { 0, 0, 0, 0 }, { 23659, 56537, 21764, 58432, 19653, 60543, 17615, 62581 } },
+	{ 16, 25, { 0, 0, 0, 0 }, { 16546, 63802, 14831, 65512, 12774, 67560, 10618, 69705 } },
+	{ 16, 26, { 0, 0, 0, 0 }, { 18816, 62532, 17155, 64196, 15204, 66153, 13215, 68149 } },
+	{ 16, 27, { 0, 0, 0, 0 }, { 12895, 67732, 10836, 69791, 8178, 72449, 4965, 75661 } },
+	{ 16, 28, { 0, 0, 0, 0 }, { 17895, 61556, 16231, 63217, 14275, 65168, 12280, 67155 } },
+	{ 16, 29, { 0, 0, 0, 0 }, { 23648, 56527, 21753, 58421, 19642, 60533, 17604, 62571 } },
+	{ 16, 30, { 0, 0, 0, 0 }, { 22490, 59648, 20755, 61384, 18778, 63363, 16830, 65312 } },
+	{ 16, 31, { 0, 0, 0, 0 }, { 18796, 62544, 17135, 64208, 15184, 66165, 13194, 68162 } },
+	{ 16, 32, { 0, 0, 0, 0 }, { 12903, 67736, 10844, 69795, 8187, 72452, 4975, 75663 } },
+	{ 16, 33, { 0, 0, 0, 0 }, { 17909, 61537, 16244, 63198, 14289, 65148, 12295, 67135 } },
+	{ 16, 34, { 0, 0, 0, 0 }, { 23648, 56531, 21754, 58425, 19642, 60536, 17604, 62574 } },
+	{ 16, 35, { 0, 0, 0, 0 }, { 13692, 67421, 11705, 69403, 9178, 71919, 6231, 74848 } },
+	{ 16, 36, { 0, 0, 0, 0 }, { 18780, 62548, 17120, 64213, 15168, 66170, 13177, 68168 } },
+	{ 16, 37, { 0, 0, 0, 0 }, { 12911, 67743, 10852, 69801, 8195, 72459, 4984, 75669 } },
+	{ 16, 38, { 0, 0, 0, 0 }, { 17919, 61524, 16254, 63185, 14299, 65134, 12306, 67120 } },
+	{ 16, 39, { 0, 0, 0, 0 }, { 23644, 56527, 21749, 58422, 19638, 60533, 17600, 62571 } },
+	{ 16, 40, { 0, 0, 0, 0 }, { 23673, 56558, 21779, 58453, 19668, 60564, 17630, 62602 } },
+	{ 16, 41, { 0, 0, 0, 0 }, { 23839, 56929, 21954, 58814, 19851, 60917, 17819, 62949 } },
+	{ 17, 0, { 0, 0, 0, 0 }, { 25479, 55842, 23308, 58013, 20931, 60391, 18660, 62661 } },
+	{ 17, 1, { 0, 0, 0, 0 }, { 19077, 62751, 17224, 64609, 15037, 66804, 12784, 69068 } },
+	{ 17, 2, { 0, 0, 0, 2 }, { 11552, 69434, 9064, 71922, 5569, 75418, 0, 0 } },
+	{ 17, 3, { 0, 0, 0, 0 }, { 18031, 61850, 16172, 63705, 13974, 65894, 11705, 68153 } },
+	{ 17, 4, { 0, 0, 0, 0 }, { 25291, 55354, 23104, 57541, 20714, 59931, 18435, 62210 } },
+	{ 17, 5, { 0, 0, 0, 0 }, { 25479, 55842, 23308, 58013, 20931, 60391, 18660, 62661 } },
+	{ 17, 6, { 0, 0, 0, 0 }, { 19059, 62760, 17206, 64618, 15018, 66813, 12765, 69078 } },
+	{ 17, 7, { 0, 0, 0, 2 }, { 11564, 69438, 9076, 71925, 5583, 75419, 0, 0 } },
+	{ 17, 8, { 0, 0, 0, 0 }, { 18044, 61834, 16184, 63688, 13987, 65878, 11719, 68135 } },
+	{ 17, 9, { 0, 0, 0, 0 }, { 25283, 55353, 23096, 57540, 20707, 59930, 18428, 62208 } },
+	{ 17, 10, { 0, 0, 0, 2 }, { 11639, 69061, 9197, 71509, 5815, 74905, 0, 0 } },
+	{ 17, 11, { 0, 0, 0, 0 }, { 19073, 62750, 17220, 64608, 15033, 66803, 12780, 69067 } },
+	{ 17, 12, { 0, 0, 0, 2 }, { 11574, 69443, 9086, 71931, 5594, 75423, 0, 0 } },
+	{ 17, 13, { 0, 0, 0, 0 }, { 18039, 61849, 16180, 63704, 13982, 65893, 11713, 68151 } },
+	{ 17, 14, { 0, 0, 0, 0 }, { 25272, 55347, 23086, 57533, 20696, 59923, 18417, 62202 } },
+	{ 17, 15, { 0, 0, 0, 0 }, { 22782, 56192, 20752, 58221, 18485, 60487, 16284, 62686 } },
+	{ 17, 16, { 0, 0, 0, 0 }, { 19084, 62735, 17232, 64594, 15045, 66788, 12793, 69051 } },
+	{ 17, 17, { 0, 0, 0, 2 }, { 11579, 69447, 9092, 71934, 5601, 75426, 0, 0 } },
+	{ 17, 18, { 0, 0, 0, 0 }, { 18032, 61864, 16172, 63718, 13974, 65908, 11704, 68167 } },
+	{ 17, 19, { 0, 0, 0, 0 }, { 25259, 55336, 23073, 57523, 20683, 59912, 18405, 62191 } },
+	{ 17, 20, { 0, 0, 0, 0 }, { 15128, 65603, 13128, 67613, 10649, 70108, 7890, 72894 } },
+	{ 17, 21, { 0, 0, 0, 0 }, { 18973, 62810, 17119, 64669, 14929, 66867, 12670, 69137 } },
+	{ 17, 22, { 0, 0, 0, 2 }, { 11600, 69460, 9113, 71946, 5623, 75436, 0, 0 } },
+	{ 17, 23, { 0, 0, 0, 0 }, { 18107, 61753, 16248, 63606, 14054, 65793, 11791, 68044 } },
+	{ 17, 24, { 0, 0, 0, 0 }, { 25275, 55357, 23089, 57543, 20700, 59932, 18421, 62211 } },
+	{ 17, 25, { 0, 0, 0, 0 }, { 16292, 64480, 14359, 66405, 12007, 68745, 9471, 71261 } },
+	{ 17, 26, { 0, 0, 0, 0 }, { 19010, 62784, 17156, 64643, 14967, 66840, 12711, 69107 } },
+	{ 17, 27, { 0, 0, 0, 2 }, { 11601, 69462, 9115, 71948, 5625, 75438, 0, 0 } },
+	{ 17, 28, { 0, 0, 0, 0 }, { 18086, 61791, 16227, 63645, 14032, 65832, 11767, 68086 } },
+	{ 17, 29, { 0, 0, 0, 0 }, { 25264, 55346, 23078, 57533, 20688, 59922, 18410, 62200 } },
+	{ 17, 30, { 0, 0, 0, 0 }, { 23505, 59075, 21552, 61030, 19343, 63242, 17175, 65413 } },
+	{ 17, 31, { 0, 0, 0, 0 }, { 18986, 62800, 17133, 64659, 14943, 66856, 12685, 69125 } },
+	{ 17, 32, { 0, 0, 0, 2 }, { 11610, 69465, 9124, 71951, 5635, 75439, 0, 0 } },
+	{ 17, 33, { 0, 0, 0, 0 }, { 18103, 61768, 16244, 63622, 14050, 65809, 11786, 68061 } },
+	{ 17, 34, { 0, 0, 0, 0 }, { 25264, 55351, 23078, 57537, 20689, 59926, 18410, 62204 } },
+	{ 17, 35, { 0, 0, 0, 0 }, { 12565, 68974, 10202, 71327, 7005, 74504, 2473, 78959 } },
+	{ 17, 36, { 0, 0, 0, 0 }, { 18968, 62807, 17114, 64666, 14924, 66864, 12665, 69134 } },
+	{ 17, 37, { 0, 0, 0, 2 }, { 11618, 69471, 9133, 71957, 5644, 75445, 0, 0 } },
+	{ 17, 38, { 0, 0, 0, 0 }, { 18116, 61752, 16257, 63605, 14063, 65792, 11801, 68043 } },
+	{ 17, 39, { 0, 0, 0, 0 }, { 25260, 55348, 23074, 57534, 20685, 59923, 18406, 62201 } },
+	{ 17, 40, { 0, 0, 0, 0 }, { 25289, 55379, 23103, 57565, 20714, 59954, 18436, 62232 } },
+	{ 17, 41, { 0, 0, 0, 0 }, { 25424, 55781, 23253, 57953, 20875, 60330, 18605, 62601 } },
+	{ 18, 0, { 0, 0, 0, 0 }, { 29951, 51771, 26574, 55149, 23205, 58518, 20138, 61586 } },
+	{ 18, 1, { 0, 0, 0, 0 }, { 19223, 63031, 16750, 65515, 13776, 68508, 10557, 71759 } },
+	{ 18, 2, { 0, 2, 1, 1 }, { 6756, 74627, 0, 0, 0, 0, 0, 0 } },
+	{ 18, 3, { 0, 0, 0, 0 }, { 18109, 62140, 15622, 64615, 12620, 67598, 9350, 70835 } },
+	{ 18, 4, { 0, 0, 0, 0 }, { 29905, 51136, 26465, 54576, 23062, 57979, 19976, 61065 } },
+	{ 18, 5, { 0, 0, 0, 0 }, { 29951, 51771, 26574, 55149, 23205, 58518, 20138, 61586 } },
+	{ 18, 6, { 0, 0, 0, 0 }, { 19198, 63046, 16725, 65530, 13750, 68526, 10528, 71780 } },
+	{ 18, 7, { 0, 2, 1, 1 }, { 6772, 74627, 0, 0, 0, 0, 0, 0 } },
+	{ 18, 8, { 0, 0, 0, 0 }, { 18129, 62116, 15643, 64591, 12642, 67572, 9376, 70806 } },
+	{ 18, 9, { 0, 0, 0, 0 }, { 29894, 51139, 26456, 54577, 23053, 57979, 19968, 61065 } },
+	{ 18, 10, { 0, 0, 1, 1 }, { 7109, 74018, 1622, 79591, 0, 0, 0, 0 } },
+	{ 18, 11, { 0, 0, 0, 0 }, { 19218, 63030, 16746, 65514, 13771, 68507, 10552, 71759 } },
+	{ 18, 12, { 0, 2, 1, 1 }, { 6784, 74630, 0, 0, 0, 0, 0, 0 } },
+	{ 18, 13, { 0, 0, 0, 0 }, { 18119, 62136, 15633, 64612, 12631, 67594, 9362, 70830 } },
+	{ 18, 14, { 0, 0, 0, 0 }, { 29880, 51135, 26443, 54572, 23041, 57974, 19956, 61059 } },
+	{ 18, 15, { 0, 0, 0, 0 }, { 25990, 53367, 23077, 56278, 19982, 59369, 17049, 62297 } },
+	{ 18, 16, { 0, 0, 0, 0 }, { 19237, 63009, 16765, 65492, 13792, 68484, 10576, 71732 } },
+	{ 18, 17, { 0, 2, 1, 1 }, { 6792, 74632, 0, 0, 0, 0, 0, 0 } },
+	{ 18, 18, { 0, 0, 0, 0 }, { 18106, 62157, 15618, 64633, 12615, 67616, 9343, 70855 } },
+	{ 18, 19, { 0, 0, 0, 0 }, { 29866, 51126, 26429, 54562, 23028, 57964, 19943, 61049 } },
+	{ 18, 20, { 0, 0, 0, 2 }, { 13333, 67838, 10447, 70752, 6430, 74840, 0, 0 } },
+	{ 18, 21, { 0, 0, 0, 0 }, { 19075, 63134, 16600, 65620, 13616, 68624, 10377, 71897 } },
+	{ 18, 22, { 0, 2, 1, 1 }, { 6815, 74640, 0, 0, 0, 0, 0, 0 } },
+	{ 18, 23, { 0, 0, 0, 0 }, { 18232, 61995, 15748, 64468, 12756, 67441, 9509, 70656 } },
+	{ 18, 24, { 0, 0, 0, 0 }, { 29880, 51149, 26444, 54584, 23043, 57985, 19959, 61070 } },
+	{ 18, 25, { 0, 0, 0, 0 }, { 15145, 65986, 12459, 68651, 8961, 72108, 4446, 76508 } },
+	{ 18, 26, { 0, 0, 0, 0 }, { 19129, 63091, 16655, 65576, 13675, 68576, 10444, 71840 } },
+	{ 18, 27, { 0, 2, 1, 1 }, { 6817, 74643, 0, 0, 0, 0, 0, 0 } },
+	{ 18, 28, { 0, 0, 0, 0 }, { 18195, 62049, 15710, 64523, 12714, 67500, 9459, 70722 } },
+	{ 18, 29, { 0, 0, 0, 0 }, { 29868, 51138, 26433, 54574, 23032, 57975, 19947, 61059 } },
+	{ 18, 30, { 0, 0, 0, 0 }, { 25987, 57007, 23282, 59716, 20316, 62687, 17437, 65574 } },
+	{ 18, 31, { 0, 0, 0, 0 }, { 19095, 63117, 16620, 65604, 13638, 68605, 10402, 71875 } },
+	{ 18, 32, { 0, 2, 1, 1 }, { 6828, 74642, 0, 0, 0, 0, 0, 0 } },
+	{ 18, 33, { 0, 0, 0, 0 }, { 18223, 62016, 15739, 64489, 12746, 67463, 9496, 70681 } },
+	{ 18, 34, { 0, 0, 0, 0 }, { 29866, 51145, 26431, 54580, 23031, 57980, 19947, 61065 } },
+	{ 18, 35, { 0, 0, 1, 1 }, { 8501, 73389, 3855, 77958, 0, 0, 0, 0 } },
+	{ 18, 36, { 0, 0, 0, 0 }, { 19070, 63132, 16595, 65618, 13611, 68621, 10372, 71895 } },
+	{ 18, 37, { 0, 2, 1, 1 }, { 6837, 74648, 0, 0, 0, 0, 0, 0 } },
+	{ 18, 38, { 0, 0, 0, 0 }, { 18244, 61992, 15760, 64465, 12769, 67437, 9522, 70651 } },
+	{ 18, 39, { 0, 0, 0, 0 }, { 29861, 51143, 26427, 54577, 23026, 57977, 19942, 61062 } },
+	{ 18, 40, { 0, 0, 0, 0 }, { 29889, 51175, 26456, 54609, 23055, 58009, 19972, 61093 } },
+	{ 18, 41, { 0, 0, 0, 0 }, { 29898, 51707, 26520, 55086, 23151, 58456, 20083, 61524 } },
+	{ 19, 0, { 0, 0, 0, 0 }, { 27420, 54662, 24865, 57218, 22141, 59942, 19580, 62504 } },
+	{ 19, 1, { 0, 0, 0, 0 }, { 19438, 63161, 17355, 65252, 14880, 67737, 12291, 70343 } },
+	{ 19, 2, { 0, 0, 0, 1 }, { 10163, 71583, 6975, 74771, 1087, 80663, 0, 0 } },
+	{ 19, 3, { 0, 0, 0, 0 }, { 18366, 62263, 16274, 64348, 13784, 66827, 11169, 69425 } },
+	{ 19, 4, { 0, 0, 0, 0 }, { 27277, 54128, 24695, 56710, 21952, 59453, 19380, 62025 } },
+	{ 19, 5, { 0, 0, 0, 0 }, { 27420, 54662, 24865, 57218, 22141, 59942, 19580, 62504 } },
+	{ 19, 6, { 0, 0, 0, 0 }, { 19417, 63173, 17334, 65263, 14859, 67749, 12269, 70357 } },
+	{ 19, 7, { 0, 0, 0, 1 }, { 10175, 71586, 6990, 74772, 1112, 80652, 0, 0 } },
+	{ 19, 8, { 0, 0, 0, 0 }, { 18382, 62244, 16290, 64329, 13801, 66807, 11188, 69403 } },
+	{ 19, 9, { 0, 0, 0, 0 }, { 27268, 54128, 24686, 56710, 21944, 59452, 19372, 62024 } },
+	{ 19, 10, { 0, 0, 0, 1 }, { 10327, 71141, 7237, 74244, 1930, 79618, 0, 0 } },
+	{ 19, 11, { 0, 0, 0, 0 }, { 19433, 63160, 17350, 65250, 14876, 67736, 12287, 70342 } },
+	{ 19, 12, { 0, 0, 0, 1 }, { 10186, 71591, 7001, 74777, 1130, 80651, 0, 0 } },
+	{ 19, 13, { 0, 0, 0, 0 }, { 18375, 62262, 16283, 64347, 13793, 66825, 11179, 69422 } },
+	{ 19, 14, { 0, 0, 0, 0 }, { 27256, 54122, 24675, 56704, 21933, 59446, 19361, 62018 } },
+	{ 19, 15, { 0, 0, 0, 0 }, { 24300, 55428, 21965, 57762, 19397, 60327, 16925, 62796 } },
+	{ 19, 16, { 0, 0, 0, 0 }, { 19448, 63143, 17365, 65233, 14892, 67718, 12304, 70322 } },
+	{ 19, 17, { 0, 0, 0, 1 }, { 10192, 71594, 7008, 74779, 1141, 80650, 0, 0 } },
+	{ 19, 18, { 0, 0, 0, 0 }, { 18365, 62278, 16273, 64363, 13782, 66842, 11167, 69441 } },
+	{ 19, 19, { 0, 0, 0, 0 }, { 27243, 54112, 24662, 56694, 21920, 59435, 19348, 62007 } },
+	{ 19, 20, { 0, 0, 0, 0 }, { 14743, 66764, 12437, 69084, 9486, 72062, 5942, 75667 } },
+	{ 19, 21, { 0, 0, 0, 0 }, { 19317, 63237, 17232, 65329, 14753, 67820, 12154, 70436 } },
+	{ 19, 22, { 0, 0, 0, 1 }, { 10214, 71606, 7030, 74789, 1170, 80646, 0, 0 } },
+	{ 19, 23, { 0, 0, 0, 0 }, { 18460, 62147, 16370, 64231, 13885, 66704, 11281, 69292 } },
+	{ 19, 24, { 0, 0, 0, 0 }, { 27259, 54134, 24678, 56715, 21936, 59456, 19365, 62028 } },
+	{ 19, 25, { 0, 0, 0, 0 }, { 16153, 65364, 13950, 67556, 11215, 70271, 8130, 73320 } },
+	{ 19, 26, { 0, 0, 0, 0 }, { 19360, 63205, 17276, 65296, 14799, 67785, 12204, 70397 } },
+	{ 19, 27, { 0, 0, 0, 1 }, { 10215, 71608, 7032, 74791, 1172, 80649, 0, 0 } },
+	{ 19, 28, { 0, 0, 0, 0 }, { 18433, 62192, 16342, 64276, 13855, 66751, 11248, 69342 } },
+	{ 19, 29, { 0, 0, 0, 0 }, { 27247, 54123, 24666, 56704, 21925, 59445, 19353, 62017 } },
+	{ 19, 30, { 0, 0, 0, 0 }, { 24762, 58585, 22539, 60811, 20051, 63302, 17619, 65739 } },
+	{ 19, 31, { 0, 0, 0, 0 }, { 19332, 63225, 17248, 65316, 14770, 67806, 12173, 70421 } },
+	{ 19, 32, { 0, 0, 0, 1 }, { 10225, 71610, 7042, 74792, 1190, 80642, 0, 0 } },
+	{ 19, 33, { 0, 0, 0, 0 }, { 18455, 62165, 16364, 64249, 13879, 66723, 11274, 69311 } },
+	{ 19, 34, { 0, 0, 0, 0 }, { 27246, 54129, 24666, 56709, 21925, 59450, 19353, 62021 } },
+	{ 19, 35, { 0, 0, 0, 1 }, { 11396, 70890, 8466, 73801, 3856, 78344, 0, 0 } },
+	{ 19, 36, { 0, 0, 0, 0 }, { 19312, 63235, 17227, 65327, 14748, 67817, 12149, 70433 } },
+	{ 19, 37, { 0, 0, 0, 1 }, { 10233, 71616, 7051, 74798, 1201, 80644, 0, 0 } },
+	{ 19, 38, { 0, 0, 0, 0 }, { 18471, 62146, 16380, 64229, 13896, 66702, 11292, 69289 } },
+	{ 19, 39, { 0, 0, 0, 0 }, { 27242, 54126, 24661, 56706, 21921, 59447, 19349, 62018 } },
+	{ 19, 40, { 0, 0, 0, 0 }, { 27271, 54157, 24690, 56738, 21950, 59478, 19378, 62050 } },
+	{ 19, 41, { 0, 0, 0, 0 }, { 27366, 54600, 24810, 57157, 22086, 59881, 19525, 62443 } },
+	{ 20, 0, { 0, 0, 0, 0 }, { 26691, 56020, 24399, 58312, 21910, 60801, 19545, 63167 } },
+	{ 20, 1, { 0, 0, 0, 0 }, { 19764, 63456, 17836, 65391, 15555, 67681, 13194, 70054 } },
+	{ 20, 2, { 0, 0, 0, 1 }, { 11666, 70709, 8976, 73399, 4993, 77383, 0, 0 } },
+	{ 20, 3, { 0, 0, 0, 0 }, { 18712, 62555, 16775, 64485, 14482, 66769, 12102, 69137 } },
+	{ 20, 4, { 0, 0, 0, 0 }, { 26517, 55517, 24206, 57828, 21703, 60332, 19328, 62706 } },
+	{ 20, 5, { 0, 0, 0, 0 }, { 26691, 56020, 24399, 58312, 21910, 60801, 19545, 63167 } },
+	{ 20, 6, { 0, 0, 0, 0 }, { 19746, 63466, 17817, 65400, 15535, 67691, 13173, 70066 } },
+	{ 20, 7, { 0, 0, 0, 1 }, { 11678, 70713, 8989, 73402, 5009, 77383, 0, 0 } },
+	{ 20, 8, { 0, 0, 0, 0 }, { 18725, 62538, 16789, 64468, 14496, 66751, 12118, 69117 } },
+	{ 20, 9, { 0, 0, 0, 0 }, { 26509, 55517, 24199, 57827, 21695, 60330, 19321, 62705 } },
+	{ 20, 10, { 0, 0, 0, 2 }, { 11776, 70315, 9146, 72954, 5331, 76790, 0, 0 } },
+	{ 20, 11, { 0, 0, 0, 0 }, { 19760, 63455, 17831, 65389, 15550, 67679, 13189, 70053 } },
+	{ 20, 12, { 0, 0, 0, 1 }, { 11688, 70719, 9000, 73407, 5021, 77386, 0, 0 } },
+	{ 20, 13, { 0, 0, 0, 0 }, { 18720, 62554, 16784, 64484, 14491, 66768, 12111, 69135 } },
+	{ 20, 14, { 0, 0, 0, 0 }, { 26498, 55511, 24188, 57821, 21685, 60324, 19310, 62698 } },
+	{ 20, 15, { 0, 0, 0, 0 }, { 23858, 56503, 21730, 58630, 19365, 60994, 17075, 63282 } },
+	{ 20, 16, { 0, 0, 0, 0 }, { 19773, 63440, 17844, 65374, 15564, 67663, 13204, 70036 } },
+	{ 20, 17, { 0, 0, 0, 1 }, { 11694, 70722, 9006, 73409, 5029, 77388, 0, 0 } },
+	{ 20, 18, { 0, 0, 0, 0 }, { 18711, 62569, 16775, 64499, 14482, 66784, 12101, 69152 } },
+	{ 20, 19, { 0, 0, 0, 0 }, { 26485, 55500, 24175, 57810, 21672, 60313, 19297, 62687 } },
+	{ 20, 20, { 0, 0, 0, 0 }, { 15565, 66560, 13466, 68670, 10841, 71315, 7857, 74334 } },
+	{ 20, 21, { 0, 0, 0, 0 }, { 19655, 63521, 17725, 65456, 15440, 67750, 13072, 70131 } },
+	{ 20, 22, { 0, 0, 0, 1 }, { 11714, 70734, 9028, 73421, 5052, 77396, 0, 0 } },
+	{ 20, 23, { 0, 0, 0, 0 }, { 18793, 62451, 16859, 64380, 14569, 66661, 12197, 69020 } },
+	{ 20, 24, { 0, 0, 0, 0 }, { 26501, 55521, 24191, 57831, 21688, 60333, 19314, 62708 } },
+	{ 20, 25, { 0, 0, 0, 0 }, { 16813, 65343, 14792, 67355, 12318, 69815, 9615, 72493 } },
+	{ 20, 26, { 0, 0, 0, 0 }, { 19694, 63493, 17764, 65428, 15481, 67720, 13116, 70098 } },
+	{ 20, 27, { 0, 0, 0, 1 }, { 11716, 70736, 9029, 73423, 5053, 77398, 0, 0 } },
+	{ 20, 28, { 0, 0, 0, 0 }, { 18770, 62492, 16835, 64421, 14544, 66703, 12170, 69065 } },
+	{ 20, 29, { 0, 0, 0, 0 }, { 26489, 55511, 24180, 57820, 21677, 60323, 19303, 62697 } },
+	{ 20, 30, { 0, 0, 0, 0 }, { 24494, 59478, 22453, 61521, 20153, 63824, 17898, 66083 } },
+	{ 20, 31, { 0, 0, 0, 0 }, { 19669, 63510, 17739, 65445, 15455, 67739, 13088, 70119 } },
+	{ 20, 32, { 0, 0, 0, 1 }, { 11725, 70739, 9039, 73425, 5065, 77398, 0, 0 } },
+	{ 20, 33, { 0, 0, 0, 0 }, { 18789, 62467, 16854, 64397, 14564, 66677, 12191, 69038 } },
+	{ 20, 34, { 0, 0, 0, 0 }, { 26489, 55515, 24179, 57825, 21677, 60327, 19303, 62701 } },
+	{ 20, 35, { 0, 0, 0, 2 }, { 12748, 70176, 10217, 72695, 6666, 76218, 0, 0 } },
+	{ 20, 36, { 0, 0, 0, 0 }, { 19650, 63518, 17720, 65454, 15436, 67747, 13067, 70129 } },
+	{ 20, 37, { 0, 0, 0, 1 }, { 11733, 70746, 9047, 73431, 5074, 77404, 0, 0 } },
+	{ 20, 38, { 0, 0, 0, 0 }, { 18803, 62450, 16868, 64379, 14579, 66659, 12207, 69019 } },
+	{ 20, 39, { 0, 0, 0, 0 }, { 26485, 55512, 24175, 57822, 21673, 60324, 19299, 62698 } },
+	{ 20, 40, { 0, 0, 0, 0 }, { 26514, 55544, 24204, 57853, 21702, 60355, 19328, 62729 } },
+	{ 20, 41, { 0, 0, 0, 0 }, { 26636, 55959, 24344, 58251, 21855, 60741, 19489, 63107 } },
+	{ 21, 0, { 0, 0, 0, 0 }, { 27343, 56157, 24988, 58512, 22443, 61058, 20030, 63471 } },
+	{ 21, 1, { 0, 0, 0, 0 }, { 20155, 63856, 18188, 65829, 15860, 68167, 13443, 70596 } },
+	{ 21, 2, { 0, 0, 0, 1 }, { 11768, 71395, 8969, 74195, 4676, 78489, 0, 0 } },
+	{ 21, 3, { 0, 0, 0, 0 }, { 19099, 62954, 17124, 64922, 14783, 67254, 12346, 69677 } },
+	{ 21, 4, { 0, 0, 0, 0 }, { 27177, 55646, 24801, 58021, 22240, 60583, 19817, 63006 } },
+	{ 21, 5, { 0, 0, 0, 0 }, { 27343, 56157, 24988, 58512, 22443, 61058, 20030, 63471 } },
+	{ 21, 6, { 0, 0, 0, 0 }, { 20136, 63865, 18169, 65839, 15840, 68177, 13422, 70608 } },
+	{ 21, 7, { 0, 0, 0, 1 }, { 11780, 71399, 8982, 74197, 4692, 78488, 0, 0 } },
+	{ 21, 8, { 0, 0, 0, 0 }, { 19112, 62936, 17138, 64904, 14797, 67235, 12362, 69657 } },
+	{ 21, 9, { 0, 0, 0, 0 }, { 27168, 55646, 24794, 58021, 22233, 60582, 19810, 63005 } },
+	{ 21, 10, { 0, 0, 0, 1 }, { 11891, 70990, 9158, 73732, 5077, 77840, 0, 0 } },
+	{ 21, 11, { 0, 0, 0, 0 }, { 20150, 63854, 18184, 65827, 15855, 68165, 13439, 70595 } },
+	{ 21, 12, { 0, 0, 0, 1 }, { 11791, 71404, 8993, 74202, 4705, 78491, 0, 0 } },
+	{ 21, 13, { 0, 0, 0, 0 }, { 19107, 62953, 17133, 64921, 14792, 67253, 12355, 69675 } },
+	{ 21, 14, { 0, 0, 0, 0 }, { 27157, 55640, 24782, 58014, 22222, 60575, 19799, 62998 } },
+	{ 21, 15, { 0, 0, 0, 0 }, { 24441, 56707, 22263, 58885, 19848, 61297, 17513, 63630 } },
+	{ 21, 16, { 0, 0, 0, 0 }, { 20164, 63839, 18197, 65812, 15869, 68149, 13454, 70578 } },
+	{ 21, 17, { 0, 0, 0, 1 }, { 11797, 71407, 8999, 74205, 4713, 78492, 0, 0 } },
+	{ 21, 18, { 0, 0, 0, 0 }, { 19098, 62968, 17123, 64937, 14782, 67269, 12344, 69692 } },
+	{ 21, 19, { 0, 0, 0, 0 }, { 27144, 55630, 24769, 58004, 22209, 60565, 19786, 62987 } },
+	{ 21, 20, { 0, 0, 0, 0 }, { 15832, 67084, 13683, 69245, 10980, 71968, 7873, 75116 } },
+	{ 21, 21, { 0, 0, 0, 0 }, { 20042, 63923, 18074, 65897, 15742, 68239, 13318, 70677 } },
+	{ 21, 22, { 0, 0, 0, 1 }, { 11817, 71419, 9021, 74216, 4737, 78499, 0, 0 } },
+	{ 21, 23, { 0, 0, 0, 0 }, { 19184, 62847, 17210, 64814, 14873, 67142, 12445, 69557 } },
+	{ 21, 24, { 0, 0, 0, 0 }, { 27160, 55651, 24786, 58025, 22225, 60585, 19803, 63008 } },
+	{ 21, 25, { 0, 0, 0, 0 }, { 17121, 65821, 15056, 67876, 12519, 70397, 9728, 73162 } },
+	{ 21, 26, { 0, 0, 0, 0 }, { 20082, 63894, 18115, 65868, 15784, 68208, 13363, 70643 } },
+	{ 21, 27, { 0, 0, 0, 1 }, { 11819, 71421, 9022, 74218, 4738, 78502, 0, 0 } },
+	{ 21, 28, { 0, 0, 0, 0 }, { 19159, 62889, 17186, 64856, 14847, 67185, 12416, 69603 } },
+	{ 21, 29, { 0, 0, 0, 0 }, { 27148, 55640, 24774, 58014, 22214, 60574, 19791, 62997 } },
+	{ 21, 30, { 0, 0, 0, 0 }, { 25033, 59728, 22948, 61815, 20602, 64165, 18303, 66468 } },
+	{ 21, 31, { 0, 0, 0, 0 }, { 20057, 63912, 18089, 65886, 15757, 68227, 13335, 70664 } },
+	{ 21, 32, { 0, 0, 0, 1 }, { 11828, 71424, 9032, 74220, 4750, 78501, 0, 0 } },
+	{ 21, 33, { 0, 0, 0, 0 }, { 19179, 62863, 17205, 64831, 14868, 67159, 12439, 69575 } },
+	{ 21, 34, { 0, 0, 0, 0 }, { 27148, 55645, 24774, 58019, 22214, 60579, 19792, 63001 } },
+	{ 21, 35, { 0, 0, 0, 2 }, { 12886, 70824, 10265, 73432, 6505, 77157, 0, 0 } },
+	{ 21, 36, { 0, 0, 0, 0 }, { 20037, 63920, 18070, 65895, 15737, 68237, 13313, 70675 } },
+	{ 21, 37, { 0, 0, 0, 1 }, { 11837, 71431, 9041, 74226, 4760, 78506, 0, 0 } },
+	{ 21, 38, { 0, 0, 0, 0 }, { 19193, 62846, 17220, 64813, 14883, 67141, 12455, 69555 } },
+	{ 21, 39, { 0, 0, 0, 0 }, { 27143, 55642, 24770, 58016, 22210, 60576, 19787, 62998 } },
+	{ 21, 40, { 0, 0, 0, 0 }, { 27172, 55674, 24799, 58047, 22239, 60607, 19817, 63029 } },
+	{ 21, 41, { 0, 0, 0, 0 }, { 27288, 56096, 24933, 58451, 22387, 60997, 19974, 63411 } },
+	{ 22, 0, { 0, 0, 0, 0 }, { 28263, 56270, 25807, 58726, 23171, 61363, 20682, 63852 } },
+	{ 22, 1, { 0, 0, 0, 0 }, { 20665, 64380, 18638, 66413, 16235, 68827, 13731, 71347 } },
+	{ 22, 2, { 0, 0, 0, 1 }, { 11825, 72371, 8837, 75359, 3905, 80293, 0, 0 } },
+	{ 22, 3, { 0, 0, 0, 0 }, { 19604, 63478, 17569, 65506, 15151, 67913, 12624, 70425 } },
+	{ 22, 4, { 0, 0, 0, 0 }, { 28109, 55746, 25629, 58226, 22975, 60880, 20476, 63379 } },
+	{ 22, 5, { 0, 0, 0, 0 }, { 28263, 56270, 25807, 58726, 23171, 61363, 20682, 63852 } },
+	{ 22, 6, { 0, 0, 0, 0 }, { 20645, 64391, 18619, 66424, 16215, 68838, 13709, 71359 } },
+	{ 22, 7, { 0, 0, 0, 1 }, { 11838, 72374, 8851, 75361, 3924, 80289, 0, 0 } },
+	{ 22, 8, { 0, 0, 0, 0 }, { 19618, 63459, 17583, 65487, 15167, 67894, 12641, 70404 } },
+	{ 22, 9, { 0, 0, 0, 0 }, { 28100, 55746, 25621, 58226, 22968, 60879, 20468, 63378 } },
+	{ 22, 10, { 0, 0, 0, 1 }, { 11968, 71947, 9061, 74866, 4455, 79512, 0, 0 } },
+	{ 22, 11, { 0, 0, 0, 0 }, { 20661, 64379, 18634, 66412, 16231, 68826, 13726, 71346 } },
+	{ 22, 12, { 0, 0, 0, 1 }, { 11848, 72379, 8862, 75365, 3938, 80290, 0, 0 } },
+	{ 22, 13, { 0, 0, 0, 0 }, { 19612, 63476, 17577, 65505, 15160, 67911, 12634, 70423 } },
+	{ 22, 14, { 0, 0, 0, 0 }, { 28089, 55741, 25610, 58220, 22957, 60872, 20457, 63372 } },
+	{ 22, 15, { 0, 0, 0, 0 }, { 25251, 56928, 22993, 59185, 20500, 61676, 18095, 64079 } },
+	{ 22, 16, { 0, 0, 0, 0 }, { 20675, 64363, 18648, 66396, 16246, 68809, 13743, 71327 } },
+	{ 22, 17, { 0, 0, 0, 1 }, { 11854, 72382, 8868, 75368, 3947, 80291, 0, 0 } },
+	{ 22, 18, { 0, 0, 0, 0 }, { 19603, 63492, 17567, 65521, 15150, 67928, 12622, 70441 } },
+	{ 22, 19, { 0, 0, 0, 0 }, { 28075, 55731, 25597, 58209, 22944, 60862, 20445, 63361 } },
+	{ 22, 20, { 0, 0, 0, 0 }, { 16150, 67802, 13921, 70044, 11094, 72895, 7773, 76265 } },
+	{ 22, 21, { 0, 0, 0, 0 }, { 20548, 64452, 18520, 66487, 16113, 68905, 13600, 71434 } },
+	{ 22, 22, { 0, 0, 0, 1 }, { 11875, 72394, 8890, 75378, 3973, 80294, 0, 0 } },
+	{ 22, 23, { 0, 0, 0, 0 }, { 19693, 63366, 17660, 65393, 15247, 67795, 12730, 70298 } },
+	{ 22, 24, { 0, 0, 0, 0 }, { 28091, 55752, 25613, 58230, 22960, 60882, 20461, 63381 } },
+	{ 22, 25, { 0, 0, 0, 0 }, { 17504, 66466, 15368, 68591, 12731, 71210, 9794, 74117 } },
+	{ 22, 26, { 0, 0, 0, 0 }, { 20590, 64421, 18563, 66455, 16157, 68872, 13647, 71397 } },
+	{ 22, 27, { 0, 0, 0, 1 }, { 11877, 72396, 8892, 75380, 3974, 80297, 0, 0 } },
+	{ 22, 28, { 0, 0, 0, 0 }, { 19667, 63409, 17633, 65437, 15219, 67841, 12698, 70346 } },
+	{ 22, 29, { 0, 0, 0, 0 }, { 28079, 55741, 25601, 58220, 22949, 60872, 20450, 63371 } },
+	{ 22, 30, { 0, 0, 0, 0 }, { 25774, 60021, 23619, 62179, 21200, 64601, 18832, 66973 } },
+	{ 22, 31, { 0, 0, 0, 0 }, { 20563, 64440, 18536, 66474, 16129, 68892, 13617, 71419 } },
+	{ 22, 32, { 0, 0, 0, 1 }, { 11886, 72398, 8902, 75382, 3988, 80294, 0, 0 } },
+	{ 22, 33, { 0, 0, 0, 0 }, { 19688, 63383, 17654, 65410, 15241, 67813, 12722, 70317 } },
+	{ 22, 34, { 0, 0, 0, 0 }, { 28079, 55746, 25601, 58224, 22949, 60876, 20450, 63375 } },
+	{ 22, 35, { 0, 0, 0, 1 }, { 13001, 71737, 10228, 74495, 6083, 78593, 0, 0 } },
+	{ 22, 36, { 0, 0, 0, 0 }, { 20543, 64449, 18515, 66484, 16108, 68902, 13595, 71431 } },
+	{ 22, 37, { 0, 0, 0, 1 }, { 11895, 72405, 8911, 75388, 3998, 80298, 0, 0 } },
+	{ 22, 38, { 0, 0, 0, 0 }, { 19703, 63365, 17670, 65392, 15257, 67794, 12740, 70296 } },
+	{ 22, 39, { 0, 0, 0, 0 }, { 28074, 55743, 25596, 58221, 22944, 60873, 20446, 63372 } },
+	{ 22, 40, { 0, 0, 0, 0 }, { 28103, 55775, 25626, 58253, 22974, 60905, 20475, 63403 } },
+	{ 22, 41, { 0, 0, 0, 0 }, { 28208, 56208, 25752, 58665, 23116, 61302, 20626, 63791 } },
+	{ 23, 0, { 0, 0, 0, 0 }, { 27936, 56854, 25595, 59196, 23061, 61731, 20657, 64135 } },
+	{ 23, 1, { 0, 0, 0, 0 }, { 20799, 64501, 18840, 66466, 16521, 68794, 14116, 71213 } },
+	{ 23, 2, { 0, 0, 0, 1 }, { 12472, 71982, 9695, 74759, 5468, 78987, 0, 0 } },
+	{ 23, 3, { 0, 0, 0, 0 }, { 19746, 63597, 17779, 65558, 15447, 67880, 13022, 70292 } },
+	{ 23, 4, { 0, 0, 0, 0 }, { 27769, 56344, 25407, 58707, 22857, 61256, 20444, 63670 } },
+	{ 23, 5, { 0, 0, 0, 0 }, { 27936, 56854, 25595, 59196, 23061, 61731, 20657, 64135 } },
+	{ 23, 6, { 0, 0, 0, 0 }, { 20781, 64510, 18821, 66476, 16502, 68805, 14095, 71225 } },
+	{ 23, 7, { 0, 0, 0, 1 }, { 12484, 71985, 9708, 74762, 5485, 78986, 0, 0 } },
+	{ 23, 8, { 0, 0, 0, 0 }, { 19760, 63579, 17793, 65540, 15462, 67861, 13038, 70272 } },
+	{ 23, 9, { 0, 0, 0, 0 }, { 27761, 56344, 25399, 58706, 22850, 61255, 20436, 63669 } },
+	{ 23, 10, { 0, 0, 0, 1 }, { 12592, 71579, 9880, 74300, 5855, 78351, 0, 0 } },
+	{ 23, 11, { 0, 0, 0, 0 }, { 20795, 64499, 18836, 66465, 16517, 68793, 14112, 71212 } },
+	{ 23, 12, { 0, 0, 0, 1 }, { 12494, 71991, 9719, 74766, 5498, 78989, 0, 0 } },
+	{ 23, 13, { 0, 0, 0, 0 }, { 19755, 63596, 17788, 65556, 15456, 67878, 13031, 70290 } },
+	{ 23, 14, { 0, 0, 0, 0 }, { 27749, 56338, 25388, 58700, 22839, 61249, 20426, 63662 } },
+	{ 23, 15, { 0, 0, 0, 0 }, { 25050, 57390, 22881, 59557, 20476, 61960, 18150, 64283 } },
+	{ 23, 16, { 0, 0, 0, 0 }, { 20808, 64484, 18849, 66449, 16531, 68777, 14127, 71194 } },
+	{ 23, 17, { 0, 0, 0, 1 }, { 12500, 71994, 9725, 74769, 5505, 78990, 0, 0 } },
+	{ 23, 18, { 0, 0, 0, 0 }, { 19745, 63611, 17778, 65572, 15446, 67894, 13021, 70307 } },
+	{ 23, 19, { 0, 0, 0, 0 }, { 27736, 56328, 25375, 58689, 22826, 61238, 20413, 63651 } },
+	{ 23, 20, { 0, 0, 0, 0 }, { 16501, 67704, 14362, 69855, 11675, 72562, 8593, 75684 } },
+	{ 23, 21, { 0, 0, 0, 0 }, { 20688, 64567, 18727, 66534, 16405, 68866, 13992, 71293 } },
+	{ 23, 22, { 0, 0, 0, 1 }, { 12521, 72006, 9747, 74780, 5529, 78997, 0, 0 } },
+	{ 23, 23, { 0, 0, 0, 0 }, { 19830, 63491, 17865, 65450, 15537, 67768, 13120, 70172 } },
+	{ 23, 24, { 0, 0, 0, 0 }, { 27752, 56349, 25391, 58710, 22842, 61259, 20429, 63672 } },
+	{ 23, 25, { 0, 0, 0, 0 }, { 17784, 66448, 15727, 68495, 13203, 71003, 10431, 73750 } },
+	{ 23, 26, { 0, 0, 0, 0 }, { 20728, 64538, 18768, 66504, 16446, 68835, 14037, 71259 } },
+	{ 23, 27, { 0, 0, 0, 1 }, { 12522, 72008, 9748, 74782, 5531, 79000, 0, 0 } },
+	{ 23, 28, { 0, 0, 0, 0 }, { 19806, 63532, 17840, 65492, 15511, 67811, 13092, 70218 } },
+	{ 23, 29, { 0, 0, 0, 0 }, { 27741, 56338, 25380, 58699, 22831, 61248, 20418, 63661 } },
+	{ 23, 30, { 0, 0, 0, 0 }, { 25649, 60403, 23572, 62481, 21235, 64821, 18945, 67115 } },
+	{ 23, 31, { 0, 0, 0, 0 }, { 20702, 64556, 18742, 66522, 16420, 68854, 14008, 71280 } },
+	{ 23, 32, { 0, 0, 0, 1 }, { 12532, 72011, 9758, 74784, 5543, 78999, 0, 0 } },
+	{ 23, 33, { 0, 0, 0, 0 }, { 19825, 63507, 17860, 65467, 15532, 67785, 13114, 70190 } },
+	{ 23, 34, { 0, 0, 0, 0 }, { 27740, 56343, 25380, 58704, 22831, 61252, 20418, 63665 } },
+	{ 23, 35, { 0, 0, 0, 2 }, { 13583, 71418, 10980, 74008, 7265, 77690, 0, 0 } },
+	{ 23, 36, { 0, 0, 0, 0 }, { 20683, 64565, 18723, 66531, 16400, 68864, 13987, 71290 } },
+	{ 23, 37, { 0, 0, 0, 1 }, { 12540, 72018, 9767, 74790, 5552, 79004, 0, 0 } },
+	{ 23, 38, { 0, 0, 0, 0 }, { 19840, 63490, 17874, 65449, 15547, 67767, 13131, 70170 } },
+	{ 23, 39, { 0, 0, 0, 0 }, { 27736, 56340, 25375, 58701, 22827, 61249, 20414, 63662 } },
+	{ 23, 40, { 0, 0, 0, 0 }, { 27765, 56372, 25404, 58732, 22856, 61281, 20444, 63693 } },
+	{ 23, 41, { 0, 0, 0, 0 }, { 27882, 56793, 25540, 59135, 23005, 61670, 20601, 64074 } },
+	{ 24, 0, { 0, 0, 0, 0 }, { 27874, 57877, 25662, 60090, 23246, 62506, 20943, 64809 } },
+	{ 24, 1, { 0, 0, 0, 0 }, { 21286, 64971, 19406, 66856, 17186, 69084, 14896, 71386 } },
+	{ 24, 2, { 0, 0, 0, 2 }, { 13564, 71851, 11008, 74407, 7358, 78057, 0, 0 } },
+	{ 24, 3, { 0, 0, 0, 0 }, { 20243, 64065, 18356, 65946, 16126, 68168, 13818, 70464 } },
+	{ 24, 4, { 0, 0, 0, 0 }, { 27692, 57383, 25462, 59613, 23033, 62042, 20721, 64354 } },
+	{ 24, 5, { 0, 0, 0, 0 }, { 27874, 57877, 25662, 60090, 23246, 62506, 20943, 64809 } },
+	{ 24, 6, { 0, 0, 0, 0 }, { 21268, 64980, 19388, 66865, 17168, 69093, 14876, 71396 } },
+	{ 24, 7, { 0, 0, 0, 2 }, { 13576, 71855, 11021, 74410, 7373, 78058, 0, 0 } },
+	{ 24, 8, { 0, 0, 0, 0 }, { 20255, 64049, 18369, 65929, 16139, 68151, 13833, 70446 } },
+	{ 24, 9, { 0, 0, 0, 0 }, { 27684, 57382, 25455, 59611, 23026, 62041, 20714, 64353 } },
+	{ 24, 10, { 0, 0, 0, 2 }, { 13658, 71471, 11153, 73984, 7631, 77522, 0, 0 } },
+	{ 24, 11, { 0, 0, 0, 0 }, { 21281, 64970, 19402, 66855, 17182, 69083, 14892, 71385 } },
+	{ 24, 12, { 0, 0, 0, 2 }, { 13586, 71860, 11031, 74415, 7385, 78062, 0, 0 } },
+	{ 24, 13, { 0, 0, 0, 0 }, { 20251, 64064, 18365, 65945, 16134, 68167, 13827, 70463 } },
+	{ 24, 14, { 0, 0, 0, 0 }, { 27673, 57376, 25444, 59605, 23015, 62034, 20703, 64346 } },
+	{ 24, 15, { 0, 0, 0, 0 }, { 25132, 58270, 23068, 60333, 20767, 62633, 18535, 64863 } },
+	{ 24, 16, { 0, 0, 0, 0 }, { 21294, 64955, 19414, 66840, 17195, 69067, 14906, 71368 } },
+	{ 24, 17, { 0, 0, 0, 2 }, { 13591, 71864, 11037, 74418, 7391, 78065, 0, 0 } },
+	{ 24, 18, { 0, 0, 0, 0 }, { 20243, 64079, 18356, 65960, 16125, 68182, 13817, 70479 } },
+	{ 24, 19, { 0, 0, 0, 0 }, { 27660, 57366, 25431, 59595, 23002, 62023, 20690, 64335 } },
+	{ 24, 20, { 0, 0, 0, 0 }, { 17249, 67912, 15215, 69956, 12685, 72503, 9850, 75368 } },
+	{ 24, 21, { 0, 0, 0, 0 }, { 21180, 65032, 19300, 66918, 17076, 69149, 14780, 71458 } },
+	{ 24, 22, { 0, 0, 0, 2 }, { 13612, 71877, 11058, 74430, 7414, 78074, 0, 0 } },
+	{ 24, 23, { 0, 0, 0, 0 }, { 20320, 63965, 18435, 65845, 16208, 68064, 13908, 70353 } },
+	{ 24, 24, { 0, 0, 0, 0 }, { 27676, 57386, 25447, 59615, 23019, 62043, 20707, 64355 } },
+	{ 24, 25, { 0, 0, 0, 0 }, { 18447, 66751, 16483, 68706, 14089, 71087, 11497, 73658 } },
+	{ 24, 26, { 0, 0, 0, 0 }, { 21217, 65005, 19337, 66891, 17116, 69121, 14821, 71427 } },
+	{ 24, 27, { 0, 0, 0, 2 }, { 13613, 71879, 11060, 74432, 7416, 78076, 0, 0 } },
+	{ 24, 28, { 0, 0, 0, 0 }, { 20299, 64004, 18413, 65885, 16185, 68105, 13882, 70396 } },
+	{ 24, 29, { 0, 0, 0, 0 }, { 27665, 57376, 25436, 59604, 23007, 62033, 20696, 64345 } },
+	{ 24, 30, { 0, 0, 0, 0 }, { 25821, 61189, 23837, 63174, 21596, 65418, 19398, 67620 } },
+	{ 24, 31, { 0, 0, 0, 0 }, { 21193, 65021, 19313, 66907, 17091, 69138, 14795, 71446 } },
+	{ 24, 32, { 0, 0, 0, 2 }, { 13622, 71882, 11069, 74435, 7426, 78077, 0, 0 } },
+	{ 24, 33, { 0, 0, 0, 0 }, { 20316, 63981, 18431, 65861, 16203, 68080, 13902, 70370 } },
+	{ 24, 34, { 0, 0, 0, 0 }, { 27664, 57380, 25436, 59609, 23008, 62037, 20696, 64349 } },
+	{ 24, 35, { 0, 0, 0, 0 }, { 14601, 71365, 12182, 73774, 8870, 77063, 3911, 81917 } },
+	{ 24, 36, { 0, 0, 0, 0 }, { 21175, 65029, 19295, 66915, 17072, 69146, 14775, 71455 } },
+	{ 24, 37, { 0, 0, 0, 2 }, { 13631, 71888, 11078, 74441, 7435, 78082, 0, 0 } },
+	{ 24, 38, { 0, 0, 0, 0 }, { 20329, 63965, 18444, 65844, 16217, 68063, 13917, 70352 } },
+	{ 24, 39, { 0, 0, 0, 0 }, { 27660, 57377, 25432, 59606, 23003, 62034, 20692, 64345 } },
+	{ 24, 40, { 0, 0, 0, 0 }, { 27689, 57409, 25461, 59637, 23033, 62065, 20721, 64377 } },
+	{ 24, 41, { 0, 0, 0, 0 }, { 27819, 57816, 25606, 60029, 23190, 62445, 20887, 64749 } },
+	{ 25, 0, { 0, 0, 0, 0 }, { 29203, 57734, 26813, 60124, 24236, 62701, 21796, 65142 } },
+	{ 25, 1, { 0, 0, 0, 0 }, { 21868, 65578, 19880, 67572, 17525, 69937, 15078, 72398 } },
+	{ 25, 2, { 0, 0, 0, 1 }, { 13325, 73274, 10461, 76138, 5969, 80632, 0, 0 } },
+	{ 25, 3, { 0, 0, 0, 0 }, { 20814, 64672, 18818, 66661, 16450, 69019, 13982, 71473 } },
+	{ 25, 4, { 0, 0, 0, 0 }, { 29041, 57218, 26630, 59630, 24036, 62223, 21586, 64673 } },
+	{ 25, 5, { 0, 0, 0, 0 }, { 29203, 57734, 26813, 60124, 24236, 62701, 21796, 65142 } },
+	{ 25, 6, { 0, 0, 0, 0 }, { 21849, 65588, 19861, 67583, 17505, 69948, 15057, 72411 } },
+	{ 25, 7, { 0, 0, 0, 1 }, { 13337, 73278, 10475, 76140, 5987, 80629, 0, 0 } },
+	{ 25, 8, { 0, 0, 0, 0 }, { 20828, 64654, 18833, 66643, 16465, 69000, 13999, 71453 } },
+	{ 25, 9, { 0, 0, 0, 0 }, { 29033, 57218, 26622, 59629, 24029, 62222, 21579, 64672 } },
+	{ 25, 10, { 0, 0, 0, 1 }, { 13454, 72864, 10661, 75666, 6413, 79945, 0, 0 } },
+	{ 25, 11, { 0, 0, 0, 0 }, { 21864, 65577, 19876, 67571, 17521, 69936, 15074, 72397 } },
+	{ 25, 12, { 0, 0, 0, 1 }, { 13348, 73283, 10486, 76145, 6000, 80632, 0, 0 } },
+	{ 25, 13, { 0, 0, 0, 0 }, { 20823, 64671, 18827, 66660, 16459, 69018, 13992, 71471 } },
+	{ 25, 14, { 0, 0, 0, 0 }, { 29021, 57212, 26611, 59623, 24018, 62216, 21568, 64665 } },
+	{ 25, 15, { 0, 0, 0, 0 }, { 26265, 58319, 24058, 60525, 21616, 62965, 19256, 65322 } },
+	{ 25, 16, { 0, 0, 0, 0 }, { 21877, 65561, 19890, 67555, 17535, 69919, 15089, 72379 } },
+	{ 25, 17, { 0, 0, 0, 1 }, { 13353, 73286, 10492, 76148, 6008, 80633, 0, 0 } },
+	{ 25, 18, { 0, 0, 0, 0 }, { 20813, 64686, 18818, 66676, 16449, 69034, 13980, 71489 } },
+	{ 25, 19, { 0, 0, 0, 0 }, { 29008, 57202, 26598, 59612, 24005, 62205, 21555, 64655 } },
+	{ 25, 20, { 0, 0, 0, 0 }, { 17477, 68875, 15300, 71064, 12554, 73832, 9374, 77056 } },
+	{ 25, 21, { 0, 0, 0, 0 }, { 21754, 65647, 19765, 67643, 17406, 70011, 14951, 72481 } },
+	{ 25, 22, { 0, 0, 0, 1 }, { 13374, 73298, 10514, 76158, 6032, 80639, 0, 0 } },
+	{ 25, 23, { 0, 0, 0, 0 }, { 20901, 64563, 18906, 66552, 16543, 68905, 14084, 71351 } },
+	{ 25, 24, { 0, 0, 0, 0 }, { 29024, 57223, 26614, 59633, 24021, 62226, 21572, 64675 } },
+	{ 25, 25, { 0, 0, 0, 0 }, { 18793, 67582, 16703, 69662, 14132, 72217, 11291, 75030 } },
+	{ 25, 26, { 0, 0, 0, 0 }, { 21795, 65617, 19806, 67612, 17449, 69979, 14997, 72446 } },
+	{ 25, 27, { 0, 0, 0, 1 }, { 13376, 73300, 10515, 76161, 6034, 80641, 0, 0 } },
+	{ 25, 28, { 0, 0, 0, 0 }, { 20876, 64605, 18881, 66594, 16516, 68949, 14054, 71398 } },
+	{ 25, 29, { 0, 0, 0, 0 }, { 29013, 57212, 26602, 59623, 24010, 62215, 21560, 64664 } },
+	{ 25, 30, { 0, 0, 0, 0 }, { 26828, 61369, 24719, 63481, 22347, 65856, 20024, 68183 } },
+	{ 25, 31, { 0, 0, 0, 0 }, { 21769, 65636, 19780, 67631, 17422, 69999, 14968, 72468 } },
+	{ 25, 32, { 0, 0, 0, 1 }, { 13385, 73303, 10525, 76162, 6047, 80640, 0, 0 } },
+	{ 25, 33, { 0, 0, 0, 0 }, { 20896, 64580, 18901, 66568, 16537, 68923, 14077, 71369 } },
+	{ 25, 34, { 0, 0, 0, 0 }, { 29012, 57217, 26602, 59627, 24010, 62219, 21561, 64669 } },
+	{ 25, 35, { 0, 0, 0, 2 }, { 14464, 72680, 11791, 75340, 7906, 79186, 0, 0 } },
+	{ 25, 36, { 0, 0, 0, 0 }, { 21749, 65644, 19760, 67640, 17401, 70009, 14946, 72479 } },
+	{ 25, 37, { 0, 0, 0, 1 }, { 13394, 73309, 10534, 76168, 6056, 80645, 0, 0 } },
+	{ 25, 38, { 0, 0, 0, 0 }, { 20910, 64562, 18916, 66550, 16553, 68904, 14094, 71349 } },
+	{ 25, 39, { 0, 0, 0, 0 }, { 29007, 57214, 26598, 59624, 24006, 62216, 21556, 64665 } },
+	{ 25, 40, { 0, 0, 0, 0 }, { 29036, 57246, 26627, 59656, 24035, 62248, 21586, 64697 } },
+	{ 25, 41, { 0, 0, 0, 0 }, { 29148, 57672, 26758, 60063, 24181, 62641, 21741, 65081 } },
+	{ 26, 0, { 0, 0, 0, 0 }, { 27504, 61152, 25671, 62985, 23620, 65036, 21633, 67023 } },
+	{ 26, 1, { 0, 0, 0, 0 }, { 22756, 66392, 21133, 68019, 19227, 69929, 17290, 71873 } },
+	{ 26, 2, { 0, 0, 0, 0 }, { 17036, 71285, 15048, 73273, 12509, 75812, 9524, 78798 } },
+	{ 26, 3, { 0, 0, 0, 0 }, { 21747, 65480, 20120, 67104, 18208, 69010, 16262, 70950 } },
+	{ 26, 4, { 0, 0, 0, 0 }, { 27277, 60705, 25434, 62548, 23374, 64608, 21381, 66601 } },
+	{ 26, 5, { 0, 0, 0, 0 }, { 27504, 61152, 25671, 62985, 23620, 65036, 21633, 67023 } },
+	{ 26, 6, { 0, 0, 0, 0 }, { 22741, 66397, 21118, 68024, 19213, 69935, 17275, 71879 } },
+	{ 26, 7, { 0, 0, 0, 0 }, { 17046, 71290, 15059, 73278, 12521, 75816, 9537, 78801 } },
+	{ 26, 8, { 0, 0, 0, 0 }, { 21756, 65467, 20129, 67091, 18217, 68997, 16272, 70936 } },
+	{ 26, 9, { 0, 0, 0, 0 }, { 27270, 60704, 25427, 62546, 23367, 64606, 21374, 66599 } },
+	{ 26, 10, { 0, 0, 0, 0 }, { 17053, 70975, 15088, 72942, 12592, 75445, 9687, 78360 } },
+	{ 26, 11, { 0, 0, 0, 0 }, { 22752, 66390, 21129, 68017, 19224, 69927, 17286, 71871 } },
+	{ 26, 12, { 0, 0, 0, 0 }, { 17056, 71296, 15068, 73284, 12531, 75822, 9547, 78806 } },
+	{ 26, 13, { 0, 0, 0, 0 }, { 21754, 65480, 20127, 67104, 18215, 69010, 16269, 70950 } },
+	{ 26, 14, { 0, 0, 0, 0 }, { 27259, 60697, 25417, 62539, 23357, 64599, 21364, 66592 } },
+	{ 26, 15, { 0, 0, 0, 0 }, { 25222, 61093, 23478, 62837, 21503, 64811, 19570, 66743 } },
+	{ 26, 16, { 0, 0, 0, 0 }, { 22761, 66379, 21138, 68006, 19233, 69916, 17296, 71859 } },
+	{ 26, 17, { 0, 0, 0, 0 }, { 17061, 71300, 15074, 73288, 12536, 75825, 9553, 78808 } },
+	{ 26, 18, { 0, 0, 0, 0 }, { 21749, 65491, 20121, 67115, 18210, 69022, 16263, 70963 } },
+	{ 26, 19, { 0, 0, 0, 0 }, { 27247, 60686, 25405, 62528, 23345, 64588, 21352, 66581 } },
+	{ 26, 20, { 0, 0, 0, 0 }, { 19624, 68425, 17909, 70146, 15834, 72230, 13634, 74443 } },
+	{ 26, 21, { 0, 0, 0, 0 }, { 22671, 66431, 21048, 68059, 19141, 69971, 17200, 71918 } },
+	{ 26, 22, { 0, 0, 0, 0 }, { 17081, 71314, 15094, 73301, 12557, 75838, 9575, 78820 } },
+	{ 26, 23, { 0, 0, 0, 0 }, { 21802, 65402, 20175, 67026, 18266, 68931, 16323, 70867 } },
+	{ 26, 24, { 0, 0, 0, 0 }, { 27263, 60706, 25421, 62548, 23362, 64608, 21369, 66600 } },
+	{ 26, 25, { 0, 0, 0, 0 }, { 20530, 67589, 18857, 69258, 16855, 71252, 14765, 73331 } },
+	{ 26, 26, { 0, 0, 0, 0 }, { 22701, 66413, 21077, 68040, 19171, 69951, 17232, 71897 } },
+	{ 26, 27, { 0, 0, 0, 0 }, { 17082, 71316, 15095, 73303, 12558, 75840, 9576, 78822 } },
+	{ 26, 28, { 0, 0, 0, 0 }, { 21788, 65434, 20161, 67057, 18251, 68963, 16307, 70901 } },
+	{ 26, 29, { 0, 0, 0, 0 }, { 27252, 60695, 25410, 62537, 23351, 64597, 21358, 66590 } },
+	{ 26, 30, { 0, 0, 0, 0 }, { 26208, 63698, 24515, 65393, 22582, 67328, 20677, 69235 } },
+	{ 26, 31, { 0, 0, 0, 0 }, { 22682, 66424, 21058, 68051, 19152, 69963, 17211, 71910 } },
+	{ 26, 32, { 0, 0, 0, 0 }, { 17090, 71320, 15103, 73307, 12567, 75843, 9586, 78824 } },
+	{ 26, 33, { 0, 0, 0, 0 }, { 21801, 65416, 20174, 67039, 18264, 68944, 16321, 70881 } },
+	{ 26, 34, { 0, 0, 0, 0 }, { 27253, 60699, 25411, 62541, 23351, 64601, 21359, 66593 } },
+	{ 26, 35, { 0, 0, 0, 0 }, { 17850, 71035, 15927, 72953, 13505, 75367, 10736, 78120 } },
+	{ 26, 36, { 0, 0, 0, 0 }, { 22667, 66428, 21043, 68056, 19136, 69968, 17195, 71915 } },
+	{ 26, 37, { 0, 0, 0, 0 }, { 17098, 71327, 15112, 73314, 12576, 75850, 9594, 78830 } },
+	{ 26, 38, { 0, 0, 0, 0 }, { 21810, 65403, 20183, 67026, 18274, 68931, 16331, 70867 } },
+	{ 26, 39, { 0, 0, 0, 0 }, { 27248, 60696, 25407, 62538, 23347, 64597, 21355, 66590 } },
+	{ 26, 40, { 0, 0, 0, 0 }, { 27278, 60727, 25436, 62569, 23377, 64628, 21384, 66620 } },
+	{ 26, 41, { 0, 0, 0, 0 }, { 27448, 61092, 25615, 62925, 23564, 64976, 21577, 66963 } },
+	{ 27, 0, { 0, 0, 0, 0 }, { 27197, 62961, 25543, 64615, 23671, 66487, 21844, 68315 } },
+	{ 27, 1, { 0, 0, 0, 0 }, { 23515, 67127, 22024, 68621, 20279, 70369, 18516, 72137 } },
+	{ 27, 2, { 0, 0, 0, 0 }, { 18938, 70886, 17187, 72637, 15025, 74799, 12653, 77171 } },
+	{ 27, 3, { 0, 0, 0, 0 }, { 22526, 66212, 21032, 67704, 19283, 69449, 17514, 71214 } },
+	{ 27, 4, { 0, 0, 0, 0 }, { 26946, 62540, 25284, 64202, 23405, 66081, 21572, 67914 } },
+	{ 27, 5, { 0, 0, 0, 0 }, { 27197, 62961, 25543, 64615, 23671, 66487, 21844, 68315 } },
+	{ 27, 6, { 0, 0, 0, 0 }, { 23503, 67131, 22012, 68624, 20267, 70373, 18503, 72140 } },
+	{ 27, 7, { 0, 0, 0, 0 }, { 18948, 70892, 17197, 72643, 15036, 74805, 12665, 77176 } },
+	{ 27, 8, { 0, 0, 0, 0 }, { 22533, 66202, 21039, 67693, 19290, 69439, 17521, 71203 } },
+	{ 27, 9, { 0, 0, 0, 0 }, { 26939, 62538, 25278, 64199, 23399, 66078, 21566, 67911 } },
+	{ 27, 10, { 0, 0, 0, 0 }, { 18915, 70612, 17180, 72349, 15044, 74489, 12711, 76827 } },
+	{ 27, 11, { 0, 0, 0, 0 }, { 23511, 67126, 22021, 68619, 20276, 70367, 18513, 72135 } },
+	{ 27, 12, { 0, 0, 0, 0 }, { 18957, 70899, 17206, 72649, 15045, 74811, 12674, 77182 } },
+	{ 27, 13, { 0, 0, 0, 0 }, { 22532, 66213, 21039, 67705, 19289, 69450, 17520, 71215 } },
+	{ 27, 14, { 0, 0, 0, 0 }, { 26929, 62531, 25268, 64192, 23389, 66071, 21557, 67903 } },
+	{ 27, 15, { 0, 0, 0, 0 }, { 25168, 62656, 23581, 64242, 21771, 66053, 19991, 67832 } },
+	{ 27, 16, { 0, 0, 0, 0 }, { 23518, 67117, 22027, 68610, 20283, 70358, 18520, 72125 } },
+	{ 27, 17, { 0, 0, 0, 0 }, { 18962, 70903, 17211, 72653, 15050, 74814, 12680, 77185 } },
+	{ 27, 18, { 0, 0, 0, 0 }, { 22529, 66223, 21035, 67714, 19285, 69460, 17516, 71225 } },
+	{ 27, 19, { 0, 0, 0, 0 }, { 26917, 62520, 25256, 64181, 23377, 66060, 21545, 67892 } },
+	{ 27, 20, { 0, 0, 0, 0 }, { 20922, 68621, 19363, 70184, 17501, 72052, 15566, 73995 } },
+	{ 27, 21, { 0, 0, 0, 0 }, { 23443, 67154, 21952, 68648, 20206, 70397, 18441, 72167 } },
+	{ 27, 22, { 0, 0, 0, 0 }, { 18981, 70918, 17231, 72668, 15070, 74829, 12700, 77198 } },
+	{ 27, 23, { 0, 0, 0, 0 }, { 22567, 66149, 21074, 67640, 19326, 69384, 17559, 71147 } },
+	{ 27, 24, { 0, 0, 0, 0 }, { 26934, 62539, 25273, 64200, 23394, 66079, 21562, 67911 } },
+	{ 27, 25, { 0, 0, 0, 0 }, { 21655, 67976, 20128, 69500, 18316, 71307, 16453, 73163 } },
+	{ 27, 26, { 0, 0, 0, 0 }, { 23468, 67141, 21977, 68634, 20231, 70383, 18467, 72152 } },
+	{ 27, 27, { 0, 0, 0, 0 }, { 18983, 70920, 17232, 72670, 15071, 74830, 12702, 77200 } },
+	{ 27, 28, { 0, 0, 0, 0 }, { 22558, 66175, 21064, 67667, 19316, 69411, 17548, 71175 } },
+	{ 27, 29, { 0, 0, 0, 0 }, { 26923, 62528, 25262, 64189, 23383, 66068, 21551, 67901 } },
+	{ 27, 30, { 0, 0, 0, 0 }, { 26324, 65081, 24776, 66629, 23000, 68406, 21245, 70162 } },
+	{ 27, 31, { 0, 0, 0, 0 }, { 23452, 67149, 21961, 68642, 20215, 70392, 18450, 72161 } },
+	{ 27, 32, { 0, 0, 0, 0 }, { 18990, 70924, 17240, 72674, 15079, 74835, 12710, 77204 } },
+	{ 27, 33, { 0, 0, 0, 0 }, { 22567, 66160, 21074, 67651, 19326, 69396, 17559, 71159 } },
+	{ 27, 34, { 0, 0, 0, 0 }, { 26924, 62532, 25263, 64193, 23384, 66071, 21552, 67904 } },
+	{ 27, 35, { 0, 0, 0, 0 }, { 19635, 70761, 17928, 72464, 15837, 74549, 13574, 76805 } },
+	{ 27, 36, { 0, 0, 0, 0 }, { 23439, 67151, 21948, 68644, 20202, 70394, 18437, 72164 } },
+	{ 27, 37, { 0, 0, 0, 0 }, { 18998, 70931, 17248, 72681, 15088, 74841, 12718, 77210 } },
+	{ 27, 38, { 0, 0, 0, 0 }, { 22574, 66150, 21081, 67641, 19333, 69386, 17566, 71148 } },
+	{ 27, 39, { 0, 0, 0, 0 }, { 26920, 62529, 25259, 64189, 23380, 66068, 21548, 67900 } },
+	{ 27, 40, { 0, 0, 0, 0 }, { 26949, 62559, 25288, 64220, 23410, 66099, 21578, 67931 } },
+	{ 27, 41, { 0, 0, 0, 0 }, { 27141, 62902, 25487, 64555, 23614, 66428, 21787, 68255 } },
+	{ 28, 0, { 0, 0, 0, 0 }, { 28514, 62765, 26735, 64543, 24738, 66541, 22799, 68480 } },
+	{ 28, 1, { 0, 0, 0, 0 }, { 24068, 67699, 22484, 69286, 20627, 71148, 18742, 73039 } },
+	{ 28, 2, { 0, 0, 0, 0 }, { 18676, 72267, 16762, 74182, 14344, 76599, 11570, 79374 } },
+	{ 28, 3, { 0, 0, 0, 0 }, { 23067, 66784, 21479, 68368, 19616, 70227, 17723, 72114 } },
+	{ 28, 4, { 0, 0, 0, 0 }, { 28280, 62326, 26492, 64113, 24486, 66119, 22541, 68064 } },
+	{ 28, 5, { 0, 0, 0, 0 }, { 28514, 62765, 26735, 64543, 24738, 66541, 22799, 68480 } },
+	{ 28, 6, { 0, 0, 0, 0 }, { 24054, 67704, 22470, 69291, 20613, 71153, 18727, 73044 } },
+	{ 28, 7, { 0, 0, 0, 0 }, { 18687, 72272, 16773, 74187, 14356, 76604, 11582, 79377 } },
+	{ 28, 8, { 0, 0, 0, 0 }, { 23075, 66772, 21488, 68356, 19625, 70214, 17732, 72101 } },
+	{ 28, 9, { 0, 0, 0, 0 }, { 28273, 62324, 26486, 64111, 24480, 66117, 22535, 68061 } },
+	{ 28, 10, { 0, 0, 0, 0 }, { 18682, 71967, 16788, 73864, 14406, 76250, 11696, 78969 } },
+	{ 28, 11, { 0, 0, 0, 0 }, { 24064, 67697, 22481, 69284, 20623, 71146, 18738, 73037 } },
+	{ 28, 12, { 0, 0, 0, 0 }, { 18696, 72279, 16782, 74193, 14365, 76610, 11593, 79383 } },
+	{ 28, 13, { 0, 0, 0, 0 }, { 23074, 66784, 21486, 68369, 19623, 70227, 17730, 72114 } },
+	{ 28, 14, { 0, 0, 0, 0 }, { 28263, 62317, 26475, 64104, 24470, 66109, 22525, 68054 } },
+	{ 28, 15, { 0, 0, 0, 0 }, { 26306, 62634, 24609, 64330, 22683, 66256, 20796, 68142 } },
+	{ 28, 16, { 0, 0, 0, 0 }, { 24073, 67687, 22489, 69274, 20632, 71135, 18747, 73026 } },
+	{ 28, 17, { 0, 0, 0, 0 }, { 18701, 72282, 16787, 74196, 14371, 76613, 11598, 79386 } },
+	{ 28, 18, { 0, 0, 0, 0 }, { 23069, 66795, 21481, 68380, 19618, 70239, 17725, 72126 } },
+	{ 28, 19, { 0, 0, 0, 0 }, { 28250, 62306, 26463, 64093, 24458, 66098, 22513, 68043 } },
+	{ 28, 20, { 0, 0, 0, 0 }, { 21089, 69579, 19421, 71253, 17411, 73271, 15293, 75400 } },
+	{ 28, 21, { 0, 0, 0, 0 }, { 23987, 67735, 22403, 69322, 20544, 71186, 18656, 73080 } },
+	{ 28, 22, { 0, 0, 0, 0 }, { 18721, 72297, 16807, 74210, 14391, 76626, 11619, 79398 } },
+	{ 28, 23, { 0, 0, 0, 0 }, { 23118, 66710, 21531, 68295, 19670, 70151, 17780, 72036 } },
+	{ 28, 24, { 0, 0, 0, 0 }, { 28267, 62326, 26480, 64113, 24474, 66118, 22530, 68062 } },
+	{ 28, 25, { 0, 0, 0, 0 }, { 21948, 68795, 20318, 70421, 18374, 72358, 16354, 74369 } },
+	{ 28, 26, { 0, 0, 0, 0 }, { 24015, 67718, 22431, 69305, 20573, 71168, 18686, 73061 } },
+	{ 28, 27, { 0, 0, 0, 0 }, { 18722, 72299, 16809, 74212, 14393, 76628, 11621, 79400 } },
+	{ 28, 28, { 0, 0, 0, 0 }, { 23106, 66740, 21518, 68325, 19656, 70182, 17765, 72067 } },
+	{ 28, 29, { 0, 0, 0, 0 }, { 28256, 62315, 26469, 64102, 24463, 66107, 22519, 68052 } },
+	{ 28, 30, { 0, 0, 0, 0 }, { 27339, 65189, 25689, 66840, 23802, 68727, 21942, 70589 } },
+	{ 28, 31, { 0, 0, 0, 0 }, { 23997, 67728, 22413, 69315, 20554, 71179, 18667, 73072 } },
+	{ 28, 32, { 0, 0, 0, 0 }, { 18730, 72303, 16817, 74216, 14401, 76632, 11630, 79403 } },
+	{ 28, 33, { 0, 0, 0, 0 }, { 23117, 66723, 21530, 68307, 19668, 70164, 17778, 72049 } },
+	{ 28, 34, { 0, 0, 0, 0 }, { 28256, 62319, 26469, 64106, 24464, 66111, 22520, 68055 } },
+	{ 28, 35, { 0, 0, 0, 0 }, { 19457, 72053, 17601, 73905, 15283, 76214, 12684, 78801 } },
+	{ 28, 36, { 0, 0, 0, 0 }, { 23983, 67732, 22399, 69319, 20540, 71183, 18652, 73077 } },
+	{ 28, 37, { 0, 0, 0, 0 }, { 18738, 72310, 16825, 74223, 14409, 76638, 11639, 79409 } },
+	{ 28, 38, { 0, 0, 0, 0 }, { 23126, 66711, 21539, 68295, 19677, 70152, 17788, 72036 } },
+	{ 28, 39, { 0, 0, 0, 0 }, { 28252, 62315, 26465, 64102, 24460, 66107, 22516, 68052 } },
+	{ 28, 40, { 0, 0, 0, 0 }, { 28281, 62346, 26495, 64133, 24490, 66138, 22545, 68082 } },
+	{ 28, 41, { 0, 0, 0, 0 }, { 28458, 62705, 26679, 64483, 24682, 66481, 22743, 68420 } },
+	{ 29, 0, { 0, 0, 0, 0 }, { 40826, 56590, 36247, 61170, 32157, 65261, 28582, 68838 } },
+	{ 29, 1, { 0, 0, 0, 0 }, { 27014, 70941, 24165, 73806, 20685, 77316, 16746, 81314 } },
+	{ 29, 2, { 0, 1, 1, 1 }, { 10398, 86678, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 3, { 0, 0, 0, 0 }, { 25897, 70020, 23028, 72872, 19508, 76363, 15481, 80328 } },
+	{ 29, 4, { 0, 0, 0, 0 }, { 40966, 55769, 36217, 60517, 32064, 64670, 28461, 68274 } },
+	{ 29, 5, { 0, 0, 0, 0 }, { 40826, 56590, 36247, 61170, 32157, 65261, 28582, 68838 } },
+	{ 29, 6, { 0, 0, 0, 0 }, { 26986, 70960, 24136, 73826, 20653, 77338, 16708, 81343 } },
+	{ 29, 7, { 0, 1, 1, 1 }, { 10422, 86668, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 8, { 0, 0, 0, 0 }, { 25921, 69991, 23053, 72843, 19536, 76331, 15517, 80289 } },
+	{ 29, 9, { 0, 0, 0, 0 }, { 40950, 55776, 36206, 60520, 32054, 64671, 28451, 68274 } },
+	{ 29, 10, { 0, 1, 1, 1 }, { 11222, 85651, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 11, { 0, 0, 0, 0 }, { 27009, 70940, 24160, 73806, 20679, 77316, 16740, 81315 } },
+	{ 29, 12, { 0, 1, 1, 1 }, { 10439, 86667, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 13, { 0, 0, 0, 0 }, { 25908, 70015, 23040, 72868, 19521, 76357, 15497, 80320 } },
+	{ 29, 14, { 0, 0, 0, 0 }, { 40934, 55775, 36192, 60516, 32042, 64667, 28439, 68269 } },
+	{ 29, 15, { 0, 0, 0, 0 }, { 35708, 59333, 32128, 62909, 28494, 66539, 25113, 69913 } },
+	{ 29, 16, { 0, 0, 0, 0 }, { 27032, 70915, 24183, 73780, 20705, 77287, 16773, 81279 } },
+	{ 29, 17, { 0, 1, 1, 1 }, { 10449, 86666, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 18, { 0, 0, 0, 0 }, { 25891, 70039, 23022, 72892, 19500, 76384, 15471, 80352 } },
+	{ 29, 19, { 0, 0, 0, 0 }, { 40918, 55767, 36178, 60507, 32028, 64657, 28426, 68259 } },
+	{ 29, 20, { 0, 0, 0, 1 }, { 19995, 76893, 16432, 80507, 10539, 86659, 0, 0 } },
+	{ 29, 21, { 0, 0, 0, 0 }, { 26842, 71069, 23988, 73938, 20493, 77464, 16514, 81506 } },
+	{ 29, 22, { 0, 1, 1, 1 }, { 10479, 86663, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 23, { 0, 0, 0, 0 }, { 26046, 69849, 23182, 72697, 19679, 76171, 15698, 80095 } },
+	{ 29, 24, { 0, 0, 0, 0 }, { 40929, 55794, 36191, 60531, 32043, 64680, 28441, 68281 } },
+	{ 29, 25, { 0, 0, 0, 2 }, { 22237, 74554, 19044, 77715, 14590, 82085, 0, 0 } },
+	{ 29, 26, { 0, 0, 0, 0 }, { 26905, 71016, 24053, 73884, 20564, 77404, 16601, 81428 } },
+	{ 29, 27, { 0, 1, 1, 1 }, { 10481, 86667, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 28, { 0, 0, 0, 0 }, { 26000, 69912, 23134, 72762, 19625, 76242, 15629, 80179 } },
+	{ 29, 29, { 0, 0, 0, 0 }, { 40916, 55784, 36180, 60521, 32031, 64669, 28429, 68271 } },
+	{ 29, 30, { 0, 0, 0, 0 }, { 35150, 63540, 31940, 66756, 28506, 70197, 25197, 73517 } },
+	{ 29, 31, { 0, 0, 0, 0 }, { 26865, 71049, 24012, 73918, 20519, 77441, 16546, 81476 } },
+	{ 29, 32, { 0, 1, 1, 1 }, { 10499, 86659, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 33, { 0, 0, 0, 0 }, { 26034, 69872, 23169, 72722, 19664, 76197, 15678, 80125 } },
+	{ 29, 34, { 0, 0, 0, 0 }, { 40911, 55794, 36177, 60528, 32029, 64675, 28428, 68277 } },
+	{ 29, 35, { 0, 1, 1, 1 }, { 13285, 84233, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 36, { 0, 0, 0, 0 }, { 26836, 71067, 23983, 73936, 20487, 77463, 16508, 81504 } },
+	{ 29, 37, { 0, 1, 1, 1 }, { 10510, 86662, 0, 0, 0, 0, 0, 0 } },
+	{ 29, 38, { 0, 0, 0, 0 }, { 26059, 69844, 23195, 72693, 19693, 76166, 15714, 80087 } },
+	{ 29, 39, { 0, 0, 0, 0 }, { 40905, 55792, 36172, 60525, 32025, 64673, 28423, 68274 } },
+	{ 29, 40, { 0, 0, 0, 0 }, { 40932, 55827, 36200, 60559, 32053, 64705, 28452, 68306 } },
+	{ 29, 41, { 0, 0, 0, 0 }, { 40778, 56523, 36195, 61106, 32104, 65198, 28528, 68775 } },
+	{ 30, 0, { 0, 0, 0, 0 }, { 47999, 63720, 43409, 68311, 39314, 72407, 35735, 75988 } },
+	{ 30, 1, { 0, 0, 0, 0 }, { 34145, 78105, 31292, 80974, 27806, 84489, 23857, 88499 } },
+	{ 30, 2, { 0, 1, 1, 1 }, { 17499, 93875, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 3, { 0, 0, 0, 0 }, { 33059, 77151, 30188, 80007, 26665, 83500, 22636, 87467 } },
+	{ 30, 4, { 0, 0, 0, 0 }, { 48149, 62889, 43385, 67652, 39225, 71812, 35617, 75420 } },
+	{ 30, 5, { 0, 0, 0, 0 }, { 47999, 63720, 43409, 68311, 39314, 72407, 35735, 75988 } },
+	{ 30, 6, { 0, 0, 0, 0 }, { 34116, 78124, 31263, 80994, 27775, 84512, 23819, 88529 } },
+	{ 30, 7, { 0, 1, 1, 1 }, { 17524, 93865, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 8, { 0, 0, 0, 0 }, { 33084, 77123, 30213, 79978, 26693, 83468, 22672, 87429 } },
+	{ 30, 9, { 0, 0, 0, 0 }, { 48133, 62896, 43374, 67655, 39215, 71813, 35608, 75421 } },
+	{ 30, 10, { 0, 1, 1, 1 }, { 18322, 92851, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 11, { 0, 0, 0, 0 }, { 34140, 78104, 31287, 80973, 27801, 84489, 23851, 88500 } },
+	{ 30, 12, { 0, 1, 1, 1 }, { 17541, 93864, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 13, { 0, 0, 0, 0 }, { 33071, 77147, 30200, 80002, 26678, 83494, 22652, 87460 } },
+	{ 30, 14, { 0, 0, 0, 0 }, { 48116, 62895, 43360, 67651, 39203, 71808, 35596, 75415 } },
+	{ 30, 15, { 0, 0, 0, 0 }, { 42889, 66451, 39300, 70037, 35660, 73672, 32275, 77051 } },
+	{ 30, 16, { 0, 0, 0, 0 }, { 34163, 78079, 31311, 80947, 27827, 84461, 23883, 88464 } },
+	{ 30, 17, { 0, 1, 1, 1 }, { 17552, 93863, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 18, { 0, 0, 0, 0 }, { 33054, 77170, 30182, 80026, 26658, 83521, 22625, 87492 } },
+	{ 30, 19, { 0, 0, 0, 0 }, { 48101, 62887, 43346, 67642, 39189, 71799, 35582, 75405 } },
+	{ 30, 20, { 0, 0, 0, 1 }, { 27116, 84067, 23544, 87692, 17606, 93896, 0, 0 } },
+	{ 30, 21, { 0, 0, 0, 0 }, { 33972, 78233, 31116, 81106, 27614, 84639, 23624, 88692 } },
+	{ 30, 22, { 0, 1, 1, 1 }, { 17583, 93858, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 23, { 0, 0, 0, 0 }, { 33209, 76980, 30342, 79832, 26836, 83308, 22853, 87234 } },
+	{ 30, 24, { 0, 0, 0, 0 }, { 48111, 62914, 43359, 67666, 39203, 71822, 35597, 75428 } },
+	{ 30, 25, { 0, 0, 0, 2 }, { 29394, 81692, 26199, 84855, 21742, 89227, 0, 0 } },
+	{ 30, 26, { 0, 0, 0, 0 }, { 34036, 78180, 31181, 81052, 27685, 84578, 23711, 88614 } },
+	{ 30, 27, { 0, 1, 1, 1 }, { 17584, 93863, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 28, { 0, 0, 0, 0 }, { 33162, 77044, 30294, 79897, 26782, 83379, 22784, 87319 } },
+	{ 30, 29, { 0, 0, 0, 0 }, { 48099, 62904, 43347, 67656, 39192, 71811, 35586, 75417 } },
+	{ 30, 30, { 0, 0, 0, 0 }, { 42294, 70695, 39081, 73912, 35644, 77357, 32332, 80680 } },
+	{ 30, 31, { 0, 0, 0, 0 }, { 33996, 78213, 31139, 81086, 27640, 84616, 23656, 88662 } },
+	{ 30, 32, { 0, 1, 1, 1 }, { 17602, 93855, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 33, { 0, 0, 0, 0 }, { 33197, 77004, 30329, 79856, 26822, 83334, 22833, 87265 } },
+	{ 30, 34, { 0, 0, 0, 0 }, { 48093, 62914, 43345, 67663, 39190, 71817, 35584, 75423 } },
+	{ 30, 35, { 0, 1, 1, 1 }, { 20420, 91397, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 36, { 0, 0, 0, 0 }, { 33967, 78231, 31110, 81104, 27608, 84637, 23618, 88691 } },
+	{ 30, 37, { 0, 1, 1, 1 }, { 17613, 93858, 0, 0, 0, 0, 0, 0 } },
+	{ 30, 38, { 0, 0, 0, 0 }, { 33222, 76976, 30355, 79827, 26850, 83303, 22869, 87226 } },
+	{ 30, 39, { 0, 0, 0, 0 }, { 48087, 62913, 43340, 67661, 39185, 71815, 35580, 75420 } },
+	{ 30, 40, { 0, 0, 0, 0 }, { 48113, 62948, 43367, 67694, 39213, 71848, 35608, 75453 } },
+	{ 30, 41, { 0, 0, 0, 0 }, { 47951, 63652, 43357, 68246, 39261, 72344, 35681, 75925 } },
+	{ 31, 0, { 0, 0, 0, 0 }, { 44433, 77979, 42590, 79821, 40529, 81883, 38534, 83878 } },
+	{ 31, 1, { 0, 0, 0, 0 }, { 39608, 83278, 37978, 84912, 36063, 86831, 34115, 88786 } },
+	{ 31, 2, { 0, 0, 0, 0 }, { 33850, 88220, 31848, 90222, 29286, 92784, 26258, 95813 } },
+	{ 31, 3, { 0, 0, 0, 0 }, { 38630, 82333, 36995, 83964, 35075, 85879, 33119, 87828 } },
+	{ 31, 4, { 0, 0, 0, 0 }, { 44211, 77527, 42358, 79380, 40288, 81451, 38286, 83453 } },
+	{ 31, 5, { 0, 0, 0, 0 }, { 44433, 77979, 42590, 79821, 40529, 81883, 38534, 83878 } },
+	{ 31, 6, { 0, 0, 0, 0 }, { 39594, 83283, 37963, 84917, 36048, 86837, 34100, 88792 } },
+	{ 31, 7, { 0, 0, 0, 0 }, { 33861, 88225, 31859, 90227, 29298, 92788, 26271, 95815 } },
+	{ 31, 8, { 0, 0, 0, 0 }, { 38639, 82320, 37004, 83951, 35084, 85866, 33129, 87814 } },
+	{ 31, 9, { 0, 0, 0, 0 }, { 44204, 77525, 42352, 79378, 40281, 81448, 38279, 83450 } },
+	{ 31, 10, { 0, 0, 0, 0 }, { 33865, 87912, 31886, 89894, 29366, 92419, 26420, 95377 } },
+	{ 31, 11, { 0, 0, 0, 0 }, { 39604, 83276, 37974, 84910, 36059, 86830, 34111, 88784 } },
+	{ 31, 12, { 0, 0, 0, 0 }, { 33870, 88231, 31869, 90233, 29308, 92794, 26281, 95820 } },
+	{ 31, 13, { 0, 0, 0, 0 }, { 38637, 82333, 37002, 83965, 35082, 85880, 33127, 87828 } },
+	{ 31, 14, { 0, 0, 0, 0 }, { 44194, 77518, 42341, 79371, 40271, 81441, 38269, 83443 } },
+	{ 31, 15, { 0, 0, 0, 0 }, { 42150, 77914, 40396, 79667, 38411, 81651, 36470, 83592 } },
+	{ 31, 16, { 0, 0, 0, 0 }, { 39613, 83265, 37983, 84899, 36069, 86818, 34121, 88772 } },
+	{ 31, 17, { 0, 0, 0, 0 }, { 33876, 88235, 31874, 90236, 29314, 92797, 26288, 95823 } },
+	{ 31, 18, { 0, 0, 0, 0 }, { 38631, 82345, 36997, 83976, 35076, 85891, 33120, 87841 } },
+	{ 31, 19, { 0, 0, 0, 0 }, { 44181, 77508, 42329, 79360, 40259, 81430, 38257, 83432 } },
+	{ 31, 20, { 0, 0, 0, 0 }, { 36451, 85338, 34726, 87069, 32638, 89167, 30420, 91398 } },
+	{ 31, 21, { 0, 0, 0, 0 }, { 39523, 83318, 37892, 84952, 35976, 86874, 34024, 88832 } },
+	{ 31, 22, { 0, 0, 0, 0 }, { 33896, 88249, 31895, 90250, 29335, 92809, 26310, 95834 } },
+	{ 31, 23, { 0, 0, 0, 0 }, { 38685, 82255, 37051, 83886, 35133, 85799, 33181, 87745 } },
+	{ 31, 24, { 0, 0, 0, 0 }, { 44198, 77528, 42345, 79380, 40275, 81450, 38274, 83452 } },
+	{ 31, 25, { 0, 0, 0, 0 }, { 37395, 84461, 35714, 86137, 33702, 88141, 31602, 90231 } },
+	{ 31, 26, { 0, 0, 0, 0 }, { 39553, 83299, 37922, 84934, 36006, 86854, 34056, 88811 } },
+	{ 31, 27, { 0, 0, 0, 0 }, { 33897, 88251, 31896, 90252, 29336, 92812, 26311, 95836 } },
+	{ 31, 28, { 0, 0, 0, 0 }, { 38671, 82287, 37037, 83918, 35118, 85831, 33165, 87778 } },
+	{ 31, 29, { 0, 0, 0, 0 }, { 44187, 77517, 42334, 79369, 40264, 81439, 38263, 83441 } },
+	{ 31, 30, { 0, 0, 0, 0 }, { 43100, 80553, 41399, 82255, 39458, 84197, 37545, 86112 } },
+	{ 31, 31, { 0, 0, 0, 0 }, { 39534, 83310, 37903, 84945, 35987, 86866, 34036, 88824 } },
+	{ 31, 32, { 0, 0, 0, 0 }, { 33905, 88255, 31904, 90255, 29345, 92815, 26321, 95838 } },
+	{ 31, 33, { 0, 0, 0, 0 }, { 38684, 82268, 37050, 83899, 35131, 85813, 33179, 87758 } },
+	{ 31, 34, { 0, 0, 0, 0 }, { 44187, 77521, 42335, 79373, 40265, 81443, 38264, 83444 } },
+	{ 31, 35, { 0, 0, 0, 0 }, { 34678, 87954, 32743, 89883, 30303, 92315, 27504, 95098 } },
+	{ 31, 36, { 0, 0, 0, 0 }, { 39519, 83315, 37887, 84949, 35971, 86871, 34020, 88829 } },
+	{ 31, 37, { 0, 0, 0, 0 }, { 33913, 88261, 31913, 90262, 29353, 92821, 26330, 95844 } },
+	{ 31, 38, { 0, 0, 0, 0 }, { 38693, 82256, 37059, 83886, 35141, 85799, 33189, 87745 } },
+	{ 31, 39, { 0, 0, 0, 0 }, { 44183, 77518, 42331, 79370, 40261, 81440, 38259, 83441 } },
+	{ 31, 40, { 0, 0, 0, 0 }, { 44212, 77549, 42360, 79401, 40290, 81471, 38289, 83472 } },
+	{ 31, 41, { 0, 0, 0, 0 }, { 44377, 77919, 42535, 79761, 40473, 81823, 38478, 83818 } },
+	{ 32, 0, { 0, 0, 0, 0 }, { 45786, 77441, 43756, 79471, 41512, 81715, 39356, 83871 } },
+	{ 32, 1, { 0, 0, 0, 0 }, { 40002, 83704, 38241, 85470, 36166, 87551, 34040, 89686 } },
+	{ 32, 2, { 0, 0, 0, 0 }, { 33213, 89670, 30942, 91942, 27896, 94988, 23765, 99120 } },
+	{ 32, 3, { 0, 0, 0, 0 }, { 39014, 82755, 37247, 84517, 35166, 86592, 33029, 88719 } },
+	{ 32, 4, { 0, 0, 0, 0 }, { 45589, 76963, 43544, 79007, 41289, 81263, 39125, 83427 } },
+	{ 32, 5, { 0, 0, 0, 0 }, { 45786, 77441, 43756, 79471, 41512, 81715, 39356, 83871 } },
+	{ 32, 6, { 0, 0, 0, 0 }, { 39985, 83712, 38224, 85477, 36149, 87559, 34023, 89695 } },
+	{ 32, 7, { 0, 0, 0, 0 }, { 33224, 89675, 30953, 91946, 27909, 94990, 23782, 99118 } },
+	{ 32, 8, { 0, 0, 0, 0 }, { 39025, 82740, 37258, 84502, 35177, 86576, 33042, 88703 } },
+	{ 32, 9, { 0, 0, 0, 0 }, { 45581, 76962, 43537, 79006, 41282, 81261, 39118, 83425 } },
+	{ 32, 10, { 0, 0, 0, 0 }, { 33265, 89329, 31028, 91571, 28054, 94554, 24138, 98498 } },
+	{ 32, 11, { 0, 0, 0, 0 }, { 39998, 83703, 38237, 85469, 36162, 87550, 34036, 89685 } },
+	{ 32, 12, { 0, 0, 0, 0 }, { 33234, 89681, 30963, 91951, 27920, 94995, 23794, 99121 } },
+	{ 32, 13, { 0, 0, 0, 0 }, { 39021, 82754, 37255, 84516, 35173, 86591, 33037, 88718 } },
+	{ 32, 14, { 0, 0, 0, 0 }, { 45570, 76955, 43527, 78999, 41271, 81254, 39108, 83418 } },
+	{ 32, 15, { 0, 0, 0, 0 }, { 43272, 77601, 41358, 79515, 39207, 81664, 37113, 83757 } },
+	{ 32, 16, { 0, 0, 0, 0 }, { 40009, 83690, 38247, 85455, 36173, 87536, 34048, 89670 } },
+	{ 32, 17, { 0, 0, 0, 0 }, { 33240, 89684, 30969, 91955, 27926, 94998, 23802, 99123 } },
+	{ 32, 18, { 0, 0, 0, 0 }, { 39014, 82767, 37248, 84530, 35166, 86605, 33029, 88733 } },
+	{ 32, 19, { 0, 0, 0, 0 }, { 45558, 76945, 43514, 78988, 41259, 81244, 39095, 83407 } },
+	{ 32, 20, { 0, 0, 0, 0 }, { 36371, 86240, 34485, 88134, 32172, 90460, 29651, 93001 } },
+	{ 32, 21, { 0, 0, 0, 0 }, { 39906, 83756, 38144, 85522, 36067, 87606, 33936, 89746 } },
+	{ 32, 22, { 0, 0, 0, 0 }, { 33260, 89697, 30990, 91967, 27948, 95009, 23827, 99128 } },
+	{ 32, 23, { 0, 0, 0, 0 }, { 39081, 82665, 37316, 84426, 35237, 86499, 33106, 88621 } },
+	{ 32, 24, { 0, 0, 0, 0 }, { 45574, 76965, 43530, 79009, 41275, 81264, 39112, 83427 } },
+	{ 32, 25, { 0, 0, 0, 0 }, { 37475, 85185, 35648, 87006, 33441, 89202, 31097, 91532 } },
+	{ 32, 26, { 0, 0, 0, 0 }, { 39939, 83733, 38178, 85499, 36102, 87582, 33973, 89720 } },
+	{ 32, 27, { 0, 0, 0, 0 }, { 33262, 89699, 30992, 91969, 27949, 95011, 23828, 99131 } },
+	{ 32, 28, { 0, 0, 0, 0 }, { 39063, 82701, 37297, 84462, 35217, 86536, 33084, 88659 } },
+	{ 32, 29, { 0, 0, 0, 0 }, { 45562, 76955, 43519, 78998, 41264, 81253, 39101, 83416 } },
+	{ 32, 30, { 0, 0, 0, 0 }, { 44061, 80409, 42214, 82258, 40116, 84358, 38054, 86423 } },
+	{ 32, 31, { 0, 0, 0, 0 }, { 39918, 83747, 38156, 85513, 36079, 87597, 33949, 89736 } },
+	{ 32, 32, { 0, 0, 0, 0 }, { 33270, 89703, 31000, 91972, 27959, 95013, 23840, 99130 } },
+	{ 32, 33, { 0, 0, 0, 0 }, { 39078, 82680, 37313, 84441, 35233, 86514, 33102, 88636 } },
+	{ 32, 34, { 0, 0, 0, 0 }, { 45562, 76959, 43519, 79002, 41264, 81257, 39101, 83420 } },
+	{ 32, 35, { 0, 0, 0, 0 }, { 34155, 89283, 31982, 91448, 29139, 94277, 25570, 97811 } },
+	{ 32, 36, { 0, 0, 0, 0 }, { 39901, 83753, 38139, 85519, 36062, 87603, 33931, 89743 } },
+	{ 32, 37, { 0, 0, 0, 0 }, { 33278, 89709, 31009, 91979, 27968, 95019, 23850, 99135 } },
+	{ 32, 38, { 0, 0, 0, 0 }, { 39090, 82665, 37324, 84426, 35245, 86498, 33115, 88620 } },
+	{ 32, 39, { 0, 0, 0, 0 }, { 45558, 76956, 43515, 78999, 41260, 81254, 39097, 83417 } },
+	{ 32, 40, { 0, 0, 0, 0 }, { 45587, 76988, 43544, 79031, 41289, 81285, 39126, 83448 } },
+	{ 32, 41, { 0, 0, 0, 0 }, { 45731, 77380, 43700, 79410, 41456, 81655, 39300, 83811 } },
+	{ 33, 0, { 0, 0, 0, 0 }, { 44835, 79032, 43052, 80815, 41049, 82818, 39106, 84762 } },
+	{ 33, 1, { 0, 0, 0, 0 }, { 40339, 83999, 38751, 85590, 36888, 87458, 34997, 89355 } },
+	{ 33, 2, { 0, 0, 0, 0 }, { 34934, 88592, 33012, 90514, 30582, 92944, 27788, 95738 } },
+	{ 33, 3, { 0, 0, 0, 0 }, { 39365, 83055, 37774, 84643, 35906, 86507, 34008, 88398 } },
+	{ 33, 4, { 0, 0, 0, 0 }, { 44606, 78588, 42813, 80381, 40802, 82393, 38852, 84342 } },
+	{ 33, 5, { 0, 0, 0, 0 }, { 44835, 79032, 43052, 80815, 41049, 82818, 39106, 84762 } },
+	{ 33, 6, { 0, 0, 0, 0 }, { 40325, 84004, 38737, 85595, 36874, 87463, 34983, 89360 } },
+	{ 33, 7, { 0, 0, 0, 0 }, { 34944, 88597, 33023, 90519, 30594, 92948, 27800, 95742 } },
+	{ 33, 8, { 0, 0, 0, 0 }, { 39374, 83043, 37782, 84631, 35915, 86494, 34018, 88385 } },
+	{ 33, 9, { 0, 0, 0, 0 }, { 44599, 78586, 42806, 80379, 40795, 82390, 38846, 84340 } },
+	{ 33, 10, { 0, 0, 0, 0 }, { 34936, 88295, 33034, 90199, 30640, 92598, 27910, 95337 } },
+	{ 33, 11, { 0, 0, 0, 0 }, { 40335, 83998, 38747, 85589, 36885, 87456, 34993, 89353 } },
+	{ 33, 12, { 0, 0, 0, 0 }, { 34953, 88604, 33032, 90525, 30603, 92954, 27810, 95747 } },
+	{ 33, 13, { 0, 0, 0, 0 }, { 39372, 83055, 37781, 84644, 35913, 86507, 34016, 88399 } },
+	{ 33, 14, { 0, 0, 0, 0 }, { 44589, 78579, 42796, 80372, 40785, 82383, 38836, 84332 } },
+	{ 33, 15, { 0, 0, 0, 0 }, { 42631, 78890, 40928, 80592, 38997, 82523, 37105, 84414 } },
+	{ 33, 16, { 0, 0, 0, 0 }, { 40343, 83987, 38756, 85578, 36893, 87445, 35003, 89342 } },
+	{ 33, 17, { 0, 0, 0, 0 }, { 34959, 88607, 33037, 90529, 30609, 92957, 27816, 95750 } },
+	{ 33, 18, { 0, 0, 0, 0 }, { 39367, 83066, 37776, 84655, 35908, 86518, 34010, 88410 } },
+	{ 33, 19, { 0, 0, 0, 0 }, { 44577, 78568, 42784, 80361, 40773, 82372, 38823, 84321 } },
+	{ 33, 20, { 0, 0, 0, 0 }, { 37347, 85895, 35673, 87574, 33655, 89600, 31526, 91740 } },
+	{ 33, 21, { 0, 0, 0, 0 }, { 40258, 84036, 38669, 85627, 36805, 87496, 34911, 89396 } },
+	{ 33, 22, { 0, 0, 0, 0 }, { 34978, 88622, 33057, 90542, 30629, 92970, 27838, 95761 } },
+	{ 33, 23, { 0, 0, 0, 0 }, { 39417, 82981, 37826, 84569, 35960, 86431, 34065, 88319 } },
+	{ 33, 24, { 0, 0, 0, 0 }, { 44593, 78588, 42800, 80381, 40790, 82392, 38840, 84341 } },
+	{ 33, 25, { 0, 0, 0, 0 }, { 38236, 85077, 36602, 86707, 34653, 88649, 32628, 90665 } },
+	{ 33, 26, { 0, 0, 0, 0 }, { 40286, 84019, 38698, 85610, 36834, 87478, 34941, 89377 } },
+	{ 33, 27, { 0, 0, 0, 0 }, { 34980, 88623, 33059, 90544, 30631, 92972, 27839, 95764 } },
+	{ 33, 28, { 0, 0, 0, 0 }, { 39404, 83011, 37813, 84600, 35946, 86462, 34051, 88351 } },
+	{ 33, 29, { 0, 0, 0, 0 }, { 44582, 78578, 42789, 80370, 40779, 82381, 38829, 84330 } },
+	{ 33, 30, { 0, 0, 0, 0 }, { 43634, 81472, 41980, 83127, 40090, 85019, 38225, 86885 } },
+	{ 33, 31, { 0, 0, 0, 0 }, { 40268, 84029, 38680, 85620, 36815, 87489, 34922, 89389 } },
+	{ 33, 32, { 0, 0, 0, 0 }, { 34988, 88628, 33067, 90548, 30639, 92976, 27848, 95766 } },
+	{ 33, 33, { 0, 0, 0, 0 }, { 39416, 82994, 37825, 84582, 35958, 86444, 34064, 88333 } },
+	{ 33, 34, { 0, 0, 0, 0 }, { 44582, 78582, 42790, 80374, 40779, 82385, 38830, 84334 } },
+	{ 33, 35, { 0, 0, 0, 0 }, { 35724, 88366, 33862, 90223, 31535, 92542, 28922, 95142 } },
+	{ 33, 36, { 0, 0, 0, 0 }, { 40253, 84033, 38665, 85624, 36801, 87493, 34906, 89393 } },
+	{ 33, 37, { 0, 0, 0, 0 }, { 34996, 88634, 33075, 90555, 30648, 92982, 27857, 95772 } },
+	{ 33, 38, { 0, 0, 0, 0 }, { 39425, 82982, 37833, 84570, 35968, 86431, 34073, 88320 } },
+	{ 33, 39, { 0, 0, 0, 0 }, { 44578, 78578, 42786, 80371, 40775, 82381, 38826, 84330 } },
+	{ 33, 40, { 0, 0, 0, 0 }, { 44607, 78610, 42815, 80402, 40804, 82412, 38855, 84361 } },
+	{ 33, 41, { 0, 0, 0, 0 }, { 44779, 78972, 42996, 80755, 40993, 82758, 39049, 84702 } },
+	{ 34, 0, { 0, 0, 0, 0 }, { 46297, 78697, 44344, 80651, 42174, 82821, 40083, 84912 } },
+	{ 34, 1, { 0, 0, 0, 0 }, { 40890, 84581, 39181, 86294, 37171, 88310, 35117, 90372 } },
+	{ 34, 2, { 0, 0, 0, 0 }, { 34510, 90142, 32351, 92301, 29517, 95136, 25928, 98725 } },
+	{ 34, 3, { 0, 0, 0, 0 }, { 39908, 83631, 38194, 85341, 36178, 87352, 34115, 89407 } },
+	{ 34, 4, { 0, 0, 0, 0 }, { 46091, 78230, 44125, 80196, 41944, 82377, 39846, 84475 } },
+	{ 34, 5, { 0, 0, 0, 0 }, { 46297, 78697, 44344, 80651, 42174, 82821, 40083, 84912 } },
+	{ 34, 6, { 0, 0, 0, 0 }, { 40874, 84588, 39165, 86301, 37155, 88317, 35100, 90380 } },
+	{ 34, 7, { 0, 0, 0, 0 }, { 34521, 90147, 32363, 92305, 29529, 95139, 25943, 98725 } },
+	{ 34, 8, { 0, 0, 0, 0 }, { 39918, 83617, 38204, 85327, 36188, 87337, 34126, 89391 } },
+	{ 34, 9, { 0, 0, 0, 0 }, { 46084, 78228, 44118, 80194, 41937, 82375, 39839, 84473 } },
+	{ 34, 10, { 0, 0, 0, 0 }, { 34546, 89814, 32417, 91948, 29640, 94733, 26190, 98201 } },
+	{ 34, 11, { 0, 0, 0, 0 }, { 40886, 84580, 39177, 86293, 37167, 88309, 35113, 90371 } },
+	{ 34, 12, { 0, 0, 0, 0 }, { 34530, 90153, 32372, 92311, 29539, 95144, 25954, 98729 } },
+	{ 34, 13, { 0, 0, 0, 0 }, { 39915, 83631, 38202, 85341, 36185, 87351, 34122, 89406 } },
+	{ 34, 14, { 0, 0, 0, 0 }, { 46073, 78222, 44107, 80187, 41927, 82367, 39829, 84466 } },
+	{ 34, 15, { 0, 0, 0, 0 }, { 43877, 78767, 42027, 80615, 39943, 82698, 37911, 84730 } },
+	{ 34, 16, { 0, 0, 0, 0 }, { 40896, 84567, 39187, 86280, 37178, 88296, 35124, 90357 } },
+	{ 34, 17, { 0, 0, 0, 0 }, { 34536, 90156, 32378, 92314, 29545, 95147, 25961, 98732 } },
+	{ 34, 18, { 0, 0, 0, 0 }, { 39909, 83644, 38195, 85353, 36178, 87364, 34115, 89420 } },
+	{ 34, 19, { 0, 0, 0, 0 }, { 46060, 78211, 44095, 80176, 41915, 82357, 39816, 84455 } },
+	{ 34, 20, { 0, 0, 0, 0 }, { 37445, 86931, 35624, 88759, 33403, 90991, 31009, 93403 } },
+	{ 34, 21, { 0, 0, 0, 0 }, { 40798, 84628, 39089, 86342, 37076, 88360, 35018, 90427 } },
+	{ 34, 22, { 0, 0, 0, 0 }, { 34556, 90170, 32399, 92327, 29567, 95159, 25985, 98740 } },
+	{ 34, 23, { 0, 0, 0, 0 }, { 39971, 83546, 38258, 85255, 36244, 87264, 34185, 89314 } },
+	{ 34, 24, { 0, 0, 0, 0 }, { 46076, 78232, 44111, 80197, 41931, 82377, 39833, 84475 } },
+	{ 34, 25, { 0, 0, 0, 0 }, { 38488, 85944, 36719, 87706, 34592, 89824, 32349, 92055 } },
+	{ 34, 26, { 0, 0, 0, 0 }, { 40830, 84607, 39121, 86320, 37110, 88338, 35053, 90403 } },
+	{ 34, 27, { 0, 0, 0, 0 }, { 34558, 90172, 32400, 92329, 29568, 95161, 25986, 98743 } },
+	{ 34, 28, { 0, 0, 0, 0 }, { 39954, 83580, 38241, 85290, 36226, 87299, 34166, 89351 } },
+	{ 34, 29, { 0, 0, 0, 0 }, { 46065, 78221, 44100, 80186, 41920, 82366, 39822, 84464 } },
+	{ 34, 30, { 0, 0, 0, 0 }, { 44727, 81510, 42939, 83299, 40904, 85336, 38902, 87340 } },
+	{ 34, 31, { 0, 0, 0, 0 }, { 40810, 84620, 39100, 86333, 37088, 88352, 35031, 90417 } },
+	{ 34, 32, { 0, 0, 0, 0 }, { 34566, 90176, 32409, 92332, 29578, 95163, 25997, 98743 } },
+	{ 34, 33, { 0, 0, 0, 0 }, { 39968, 83560, 38255, 85269, 36241, 87278, 34182, 89329 } },
+	{ 34, 34, { 0, 0, 0, 0 }, { 46065, 78225, 44100, 80190, 41920, 82370, 39823, 84468 } },
+	{ 34, 35, { 0, 0, 0, 0 }, { 35406, 89803, 33333, 91870, 30662, 94529, 27450, 97716 } },
+	{ 34, 36, { 0, 0, 0, 0 }, { 40793, 84625, 39084, 86339, 37072, 88358, 35013, 90424 } },
+	{ 34, 37, { 0, 0, 0, 0 }, { 34574, 90182, 32417, 92339, 29586, 95170, 26006, 98749 } },
+	{ 34, 38, { 0, 0, 0, 0 }, { 39979, 83546, 38266, 85255, 36252, 87264, 34194, 89314 } },
+	{ 34, 39, { 0, 0, 0, 0 }, { 46061, 78222, 44096, 80187, 41916, 82367, 39818, 84464 } },
+	{ 34, 40, { 0, 0, 0, 0 }, { 46090, 78253, 44125, 80218, 41945, 82398, 39848, 84496 } },
+	{ 34, 41, { 0, 0, 0, 0 }, { 46242, 78637, 44289, 80590, 42118, 82761, 40027, 84852 } },
+	{ 35, 0, { 0, 0, 0, 0 }, { 48481, 85336, 46906, 86911, 45114, 88704, 43358, 90460 } },
+	{ 35, 1, { 0, 0, 0, 0 }, { 45322, 88952, 43892, 90385, 42219, 92060, 40534, 93749 } },
+	{ 35, 2, { 0, 0, 0, 0 }, { 41346, 92129, 39695, 93781, 37682, 95794, 35522, 97954 } },
+	{ 35, 3, { 0, 0, 0, 0 }, { 44370, 88008, 42937, 89439, 41261, 91111, 39572, 92797 } },
+	{ 35, 4, { 0, 0, 0, 0 }, { 48222, 84925, 46640, 86507, 44841, 88306, 43080, 90067 } },
+	{ 35, 5, { 0, 0, 0, 0 }, { 48481, 85336, 46906, 86911, 45114, 88704, 43358, 90460 } },
+	{ 35, 6, { 0, 0, 0, 0 }, { 45311, 88955, 43880, 90387, 42208, 92063, 40522, 93752 } },
+	{ 35, 7, { 0, 0, 0, 0 }, { 41356, 92136, 39705, 93787, 37692, 95800, 35533, 97959 } },
+	{ 35, 8, { 0, 0, 0, 0 }, { 44375, 87998, 42942, 89429, 41267, 91102, 39578, 92787 } },
+	{ 35, 9, { 0, 0, 0, 0 }, { 48216, 84922, 46634, 86504, 44835, 88303, 43074, 90064 } },
+	{ 35, 10, { 0, 0, 0, 0 }, { 41301, 91876, 39662, 93516, 37668, 95513, 35536, 97648 } },
+	{ 35, 11, { 0, 0, 0, 0 }, { 45319, 88950, 43888, 90383, 42216, 92058, 40530, 93747 } },
+	{ 35, 12, { 0, 0, 0, 0 }, { 41365, 92142, 39714, 93793, 37701, 95806, 35542, 97965 } },
+	{ 35, 13, { 0, 0, 0, 0 }, { 44376, 88009, 42943, 89440, 41267, 91113, 39578, 92798 } },
+	{ 35, 14, { 0, 0, 0, 0 }, { 48206, 84914, 46624, 86496, 44826, 88295, 43064, 90056 } },
+	{ 35, 15, { 0, 0, 0, 0 }, { 46587, 84890, 45070, 86407, 43332, 88144, 41621, 89856 } },
+	{ 35, 16, { 0, 0, 0, 0 }, { 45324, 88942, 43894, 90375, 42222, 92050, 40536, 93739 } },
+	{ 35, 17, { 0, 0, 0, 0 }, { 41370, 92146, 39719, 93797, 37706, 95810, 35548, 97969 } },
+	{ 35, 18, { 0, 0, 0, 0 }, { 44373, 88018, 42940, 89449, 41264, 91122, 39575, 92808 } },
+	{ 35, 19, { 0, 0, 0, 0 }, { 48194, 84903, 46612, 86485, 44813, 88284, 43052, 90045 } },
+	{ 35, 20, { 0, 0, 0, 0 }, { 43010, 90167, 41521, 91660, 39750, 93436, 37925, 95267 } },
+	{ 35, 21, { 0, 0, 0, 0 }, { 45257, 88972, 43826, 90405, 42153, 92082, 40466, 93773 } },
+	{ 35, 22, { 0, 0, 0, 0 }, { 41389, 92161, 39739, 93812, 37726, 95825, 35568, 97982 } },
+	{ 35, 23, { 0, 0, 0, 0 }, { 44404, 87951, 42971, 89382, 41297, 91054, 39609, 92738 } },
+	{ 35, 24, { 0, 0, 0, 0 }, { 48211, 84923, 46629, 86505, 44830, 88303, 43069, 90064 } },
+	{ 35, 25, { 0, 0, 0, 0 }, { 43678, 89594, 42217, 91052, 40490, 92774, 38726, 94533 } },
+	{ 35, 26, { 0, 0, 0, 0 }, { 45279, 88962, 43848, 90394, 42175, 92070, 40489, 93760 } },
+	{ 35, 27, { 0, 0, 0, 0 }, { 41391, 92163, 39740, 93814, 37727, 95826, 35569, 97984 } },
+	{ 35, 28, { 0, 0, 0, 0 }, { 44397, 87975, 42964, 89406, 41289, 91078, 39601, 92763 } },
+	{ 35, 29, { 0, 0, 0, 0 }, { 48200, 84912, 46618, 86494, 44820, 88293, 43058, 90054 } },
+	{ 35, 30, { 0, 0, 0, 0 }, { 47805, 87242, 46324, 88725, 44619, 90429, 42933, 92116 } },
+	{ 35, 31, { 0, 0, 0, 0 }, { 45265, 88968, 43834, 90401, 42161, 92077, 40474, 93768 } },
+	{ 35, 32, { 0, 0, 0, 0 }, { 41398, 92168, 39747, 93819, 37735, 95831, 35577, 97988 } },
+	{ 35, 33, { 0, 0, 0, 0 }, { 44405, 87962, 42972, 89393, 41297, 91065, 39610, 92749 } },
+	{ 35, 34, { 0, 0, 0, 0 }, { 48201, 84915, 46619, 86497, 44821, 88296, 43060, 90057 } },
+	{ 35, 35, { 0, 0, 0, 0 }, { 41991, 92056, 40378, 93666, 38422, 95618, 36344, 97689 } },
+	{ 35, 36, { 0, 0, 0, 0 }, { 45253, 88969, 43822, 90402, 42149, 92078, 40461, 93769 } },
+	{ 35, 37, { 0, 0, 0, 0 }, { 41406, 92175, 39756, 93825, 37743, 95838, 35586, 97995 } },
+	{ 35, 38, { 0, 0, 0, 0 }, { 44411, 87953, 42978, 89384, 41303, 91055, 39616, 92739 } },
+	{ 35, 39, { 0, 0, 0, 0 }, { 48197, 84912, 46615, 86494, 44817, 88292, 43056, 90053 } },
+	{ 35, 40, { 0, 0, 0, 0 }, { 48226, 84943, 46644, 86524, 44846, 88323, 43085, 90084 } },
+	{ 35, 41, { 0, 0, 0, 0 }, { 48425, 85276, 46850, 86852, 45057, 88644, 43301, 90400 } },
+	{ 36, 0, { 0, 0, 0, 0 }, { 48215, 80869, 46287, 82797, 44141, 84943, 42072, 87012 } },
+	{ 36, 1, { 0, 0, 0, 0 }, { 42933, 86624, 41242, 88319, 39253, 90314, 37223, 92352 } },
+	{ 36, 2, { 0, 0, 0, 0 }, { 36694, 92047, 34571, 94169, 31802, 96939, 28358, 100383 } },
+	{ 36, 3, { 0, 0, 0, 0 }, { 41956, 85671, 40260, 87363, 38265, 89352, 36227, 91383 } },
+	{ 36, 4, { 0, 0, 0, 0 }, { 48006, 80404, 46065, 82344, 43910, 84500, 41833, 86577 } },
+	{ 36, 5, { 0, 0, 0, 0 }, { 48215, 80869, 46287, 82797, 44141, 84943, 42072, 87012 } },
+	{ 36, 6, { 0, 0, 0, 0 }, { 42918, 86630, 41226, 88326, 39237, 90321, 37206, 92359 } },
+	{ 36, 7, { 0, 0, 0, 0 }, { 36705, 92051, 34583, 94173, 31814, 96942, 28372, 100384 } },
+	{ 36, 8, { 0, 0, 0, 0 }, { 41966, 85657, 40270, 87349, 38276, 89337, 36238, 91368 } },
+	{ 36, 9, { 0, 0, 0, 0 }, { 47998, 80403, 46058, 82343, 43903, 84498, 41826, 86575 } },
+	{ 36, 10, { 0, 0, 0, 0 }, { 36724, 91724, 34630, 93823, 31913, 96546, 28591, 99884 } },
+	{ 36, 11, { 0, 0, 0, 0 }, { 42929, 86622, 41238, 88318, 39249, 90312, 37219, 92350 } },
+	{ 36, 12, { 0, 0, 0, 0 }, { 36714, 92058, 34592, 94179, 31824, 96948, 28384, 100388 } },
+	{ 36, 13, { 0, 0, 0, 0 }, { 41964, 85671, 40268, 87363, 38273, 89352, 36235, 91382 } },
+	{ 36, 14, { 0, 0, 0, 0 }, { 47988, 80396, 46048, 82336, 43893, 84491, 41816, 86568 } },
+	{ 36, 15, { 0, 0, 0, 0 }, { 45827, 80905, 43999, 82733, 41937, 84793, 39925, 86804 } },
+	{ 36, 16, { 0, 0, 0, 0 }, { 42939, 86610, 41248, 88306, 39259, 90300, 37230, 92337 } },
+	{ 36, 17, { 0, 0, 0, 0 }, { 36719, 92061, 34598, 94183, 31830, 96951, 28390, 100391 } },
+	{ 36, 18, { 0, 0, 0, 0 }, { 41957, 85683, 40261, 87375, 38266, 89364, 36227, 91396 } },
+	{ 36, 19, { 0, 0, 0, 0 }, { 47975, 80385, 46035, 82325, 43880, 84480, 41804, 86557 } },
+	{ 36, 20, { 0, 0, 0, 0 }, { 39552, 88910, 37752, 90716, 35561, 92918, 33207, 95288 } },
+	{ 36, 21, { 0, 0, 0, 0 }, { 42843, 86670, 41151, 88366, 39160, 90362, 37125, 92405 } },
+	{ 36, 22, { 0, 0, 0, 0 }, { 36740, 92075, 34619, 94196, 31851, 96962, 28414, 100399 } },
+	{ 36, 23, { 0, 0, 0, 0 }, { 42018, 85587, 40322, 87278, 38330, 89265, 36295, 91292 } },
+	{ 36, 24, { 0, 0, 0, 0 }, { 47991, 80406, 46052, 82345, 43897, 84500, 41820, 86577 } },
+	{ 36, 25, { 0, 0, 0, 0 }, { 40577, 87942, 38828, 89685, 36728, 91777, 34517, 93976 } },
+	{ 36, 26, { 0, 0, 0, 0 }, { 42874, 86649, 41183, 88345, 39192, 90341, 37160, 92381 } },
+	{ 36, 27, { 0, 0, 0, 0 }, { 36741, 92077, 34620, 94198, 31853, 96965, 28415, 100402 } },
+	{ 36, 28, { 0, 0, 0, 0 }, { 42001, 85621, 40306, 87312, 38313, 89300, 36277, 91328 } },
+	{ 36, 29, { 0, 0, 0, 0 }, { 47980, 80395, 46041, 82334, 43886, 84490, 41809, 86566 } },
+	{ 36, 30, { 0, 0, 0, 0 }, { 46695, 83629, 44927, 85399, 42913, 87414, 40931, 89399 } },
+	{ 36, 31, { 0, 0, 0, 0 }, { 42854, 86661, 41162, 88357, 39171, 90354, 37138, 92395 } },
+	{ 36, 32, { 0, 0, 0, 0 }, { 36750, 92080, 34629, 94201, 31862, 96967, 28426, 100403 } },
+	{ 36, 33, { 0, 0, 0, 0 }, { 42015, 85601, 40320, 87292, 38327, 89280, 36292, 91307 } },
+	{ 36, 34, { 0, 0, 0, 0 }, { 47980, 80399, 46041, 82338, 43886, 84493, 41810, 86570 } },
+	{ 36, 35, { 0, 0, 0, 0 }, { 37576, 91723, 35534, 93758, 32918, 96363, 29809, 99449 } },
+	{ 36, 36, { 0, 0, 0, 0 }, { 42838, 86667, 41146, 88363, 39155, 90360, 37121, 92402 } },
+	{ 36, 37, { 0, 0, 0, 0 }, { 36758, 92087, 34637, 94208, 31871, 96973, 28435, 100408 } },
+	{ 36, 38, { 0, 0, 0, 0 }, { 42026, 85587, 40330, 87279, 38338, 89265, 36304, 91292 } },
+	{ 36, 39, { 0, 0, 0, 0 }, { 47976, 80396, 46037, 82335, 43882, 84490, 41806, 86566 } },
+	{ 36, 40, { 0, 0, 0, 0 }, { 48005, 80428, 46066, 82367, 43911, 84522, 41835, 86598 } },
+	{ 36, 41, { 0, 0, 0, 0 }, { 48160, 80808, 46231, 82737, 44086, 84882, 42016, 86952 } },
+	{ 37, 0, { 0, 0, 0, 0 }, { 47461, 87018, 46036, 88443, 44395, 90083, 42774, 91704 } },
+	{ 37, 1, { 0, 0, 0, 0 }, { 45661, 89265, 44352, 90576, 42823, 92106, 41291, 93640 } },
+	{ 37, 2, { 0, 0, 0, 0 }, { 43116, 91024, 41651, 92488, 39906, 94233, 38102, 96037 } },
+	{ 37, 3, { 0, 0, 0, 0 }, { 44722, 88330, 43411, 89640, 41881, 91168, 40347, 92700 } },
+	{ 37, 4, { 0, 0, 0, 0 }, { 47172, 86639, 45741, 88070, 44095, 89715, 42470, 91341 } },
+	{ 37, 5, { 0, 0, 0, 0 }, { 47461, 87018, 46036, 88443, 44395, 90083, 42774, 91704 } },
+	{ 37, 6, { 0, 0, 0, 0 }, { 45653, 89265, 44343, 90576, 42815, 92105, 41282, 93640 } },
+	{ 37, 7, { 0, 0, 0, 0 }, { 43125, 91031, 41660, 92495, 39916, 94240, 38112, 96044 } },
+	{ 37, 8, { 0, 0, 0, 0 }, { 44725, 88323, 43413, 89633, 41884, 91161, 40350, 92693 } },
+	{ 37, 9, { 0, 0, 0, 0 }, { 47166, 86636, 45736, 88066, 44090, 89711, 42464, 91337 } },
+	{ 37, 10, { 0, 0, 0, 0 }, { 43026, 90810, 41570, 92267, 39837, 94002, 38048, 95793 } },
+	{ 37, 11, { 0, 0, 0, 0 }, { 45658, 89263, 44348, 90574, 42820, 92103, 41288, 93638 } },
+	{ 37, 12, { 0, 0, 0, 0 }, { 43133, 91038, 41669, 92502, 39924, 94247, 38120, 96050 } },
+	{ 37, 13, { 0, 0, 0, 0 }, { 44727, 88332, 43416, 89642, 41886, 91170, 40352, 92702 } },
+	{ 37, 14, { 0, 0, 0, 0 }, { 47157, 86628, 45726, 88058, 44081, 89703, 42455, 91329 } },
+	{ 37, 15, { 0, 0, 0, 0 }, { 45869, 86278, 44488, 87660, 42895, 89253, 41316, 90832 } },
+	{ 37, 16, { 0, 0, 0, 0 }, { 45661, 89258, 44351, 90569, 42823, 92098, 41291, 93632 } },
+	{ 37, 17, { 0, 0, 0, 0 }, { 43138, 91042, 41674, 92506, 39929, 94251, 38125, 96054 } },
+	{ 37, 18, { 0, 0, 0, 0 }, { 44727, 88338, 43415, 89648, 41886, 91177, 40352, 92709 } },
+	{ 37, 19, { 0, 0, 0, 0 }, { 47145, 86616, 45715, 88047, 44069, 89692, 42444, 91318 } },
+	{ 37, 20, { 0, 0, 0, 0 }, { 44048, 89781, 42696, 91135, 41106, 92728, 39493, 94345 } },
+	{ 37, 21, { 0, 0, 0, 0 }, { 45613, 89268, 44303, 90580, 42775, 92110, 41242, 93645 } },
+	{ 37, 22, { 0, 0, 0, 0 }, { 43156, 91058, 41692, 92522, 39948, 94267, 38144, 96070 } },
+	{ 37, 23, { 0, 0, 0, 0 }, { 44738, 88291, 43427, 89601, 41898, 91129, 40365, 92660 } },
+	{ 37, 24, { 0, 0, 0, 0 }, { 47162, 86635, 45732, 88065, 44087, 89711, 42461, 91336 } },
+	{ 37, 25, { 0, 0, 0, 0 }, { 44482, 89465, 43151, 90794, 41590, 92352, 40013, 93926 } },
+	{ 37, 26, { 0, 0, 0, 0 }, { 45629, 89264, 44319, 90575, 42790, 92105, 41258, 93640 } },
+	{ 37, 27, { 0, 0, 0, 0 }, { 43158, 91060, 41694, 92524, 39949, 94268, 38146, 96071 } },
+	{ 37, 28, { 0, 0, 0, 0 }, { 44738, 88309, 43426, 89619, 41897, 91147, 40364, 92679 } },
+	{ 37, 29, { 0, 0, 0, 0 }, { 47151, 86624, 45721, 88055, 44076, 89700, 42450, 91325 } },
+	{ 37, 30, { 0, 0, 0, 0 }, { 47309, 88394, 45956, 89747, 44391, 91312, 42837, 92866 } },
+	{ 37, 31, { 0, 0, 0, 0 }, { 45618, 89266, 44309, 90577, 42780, 92108, 41247, 93642 } },
+	{ 37, 32, { 0, 0, 0, 0 }, { 43165, 91065, 41701, 92529, 39956, 94273, 38153, 96076 } },
+	{ 37, 33, { 0, 0, 0, 0 }, { 44741, 88300, 43430, 89610, 41901, 91138, 40367, 92669 } },
+	{ 37, 34, { 0, 0, 0, 0 }, { 47153, 86627, 45723, 88057, 44077, 89702, 42452, 91328 } },
+	{ 37, 35, { 0, 0, 0, 0 }, { 43619, 91098, 42180, 92535, 40471, 94241, 38712, 95998 } },
+	{ 37, 36, { 0, 0, 0, 0 }, { 45609, 89265, 44299, 90576, 42771, 92106, 41237, 93641 } },
+	{ 37, 37, { 0, 0, 0, 0 }, { 43172, 91072, 41709, 92536, 39964, 94280, 38161, 96083 } },
+	{ 37, 38, { 0, 0, 0, 0 }, { 44744, 88293, 43433, 89604, 41904, 91131, 40371, 92663 } },
+	{ 37, 39, { 0, 0, 0, 0 }, { 47149, 86624, 45719, 88054, 44074, 89699, 42448, 91324 } },
+	{ 37, 40, { 0, 0, 0, 0 }, { 47178, 86654, 45748, 88084, 44103, 89729, 42478, 91355 } },
+	{ 37, 41, { 0, 0, 0, 0 }, { 47404, 86959, 45979, 88384, 44338, 90024, 42717, 91645 } },
+	{ 38, 0, { 0, 0, 0, 0 }, { 53975, 83138, 51662, 85452, 49154, 87960, 46772, 90343 } },
+	{ 38, 1, { 0, 0, 0, 0 }, { 46913, 90680, 44970, 92629, 42671, 94938, 40287, 97335 } },
+	{ 38, 2, { 0, 0, 0, 1 }, { 38756, 98011, 36027, 100740, 31938, 104829, 0, 0 } },
+	{ 38, 3, { 0, 0, 0, 0 }, { 45930, 89707, 43981, 91650, 41672, 93950, 39274, 96335 } },
+	{ 38, 4, { 0, 0, 0, 0 }, { 53816, 82622, 51481, 84956, 48957, 87481, 46565, 89873 } },
+	{ 38, 5, { 0, 0, 0, 0 }, { 53975, 83138, 51662, 85452, 49154, 87960, 46772, 90343 } },
+	{ 38, 6, { 0, 0, 0, 0 }, { 46895, 90690, 44952, 92639, 42652, 94949, 40266, 97347 } },
+	{ 38, 7, { 0, 0, 0, 1 }, { 38768, 98014, 36040, 100742, 31954, 104828, 0, 0 } },
+	{ 38, 8, { 0, 0, 0, 0 }, { 45944, 89689, 43994, 91633, 41686, 93932, 39290, 96315 } },
+	{ 38, 9, { 0, 0, 0, 0 }, { 53807, 82622, 51474, 84955, 48949, 87479, 46557, 89872 } },
+	{ 38, 10, { 0, 0, 0, 1 }, { 38859, 97623, 36190, 100301, 32276, 104238, 0, 0 } },
+	{ 38, 11, { 0, 0, 0, 0 }, { 46909, 90679, 44966, 92628, 42667, 94937, 40283, 97334 } },
+	{ 38, 12, { 0, 0, 0, 1 }, { 38778, 98020, 36051, 100747, 31967, 104832, 0, 0 } },
+	{ 38, 13, { 0, 0, 0, 0 }, { 45938, 89706, 43989, 91649, 41680, 93949, 39283, 96333 } },
+	{ 38, 14, { 0, 0, 0, 0 }, { 53796, 82616, 51463, 84949, 48939, 87473, 46547, 89865 } },
+	{ 38, 15, { 0, 0, 0, 0 }, { 51150, 83602, 49001, 85750, 46616, 88132, 44309, 90437 } },
+	{ 38, 16, { 0, 0, 0, 0 }, { 46922, 90664, 44980, 92613, 42681, 94921, 40298, 97317 } },
+	{ 38, 17, { 0, 0, 0, 1 }, { 38784, 98023, 36057, 100750, 31974, 104834, 0, 0 } },
+	{ 38, 18, { 0, 0, 0, 0 }, { 45930, 89721, 43980, 91664, 41671, 93965, 39273, 96350 } },
+	{ 38, 19, { 0, 0, 0, 0 }, { 53783, 82605, 51450, 84939, 48926, 87462, 46534, 89854 } },
+	{ 38, 20, { 0, 0, 0, 0 }, { 42673, 93829, 40554, 95960, 37895, 98639, 34856, 101715 } },
+	{ 38, 21, { 0, 0, 0, 0 }, { 46803, 90746, 44859, 92696, 42556, 95009, 40164, 97414 } },
+	{ 38, 22, { 0, 0, 0, 1 }, { 38805, 98035, 36080, 100760, 31999, 104840, 0, 0 } },
+	{ 38, 23, { 0, 0, 0, 0 }, { 46013, 89602, 44065, 91544, 41760, 93840, 39370, 96217 } },
+	{ 38, 24, { 0, 0, 0, 0 }, { 53798, 82627, 51465, 84960, 48942, 87483, 46550, 89875 } },
+	{ 38, 25, { 0, 0, 0, 0 }, { 44002, 92525, 41967, 94551, 39474, 97028, 36748, 99731 } },
+	{ 38, 26, { 0, 0, 0, 0 }, { 46842, 90718, 44899, 92667, 42597, 94979, 40208, 97380 } },
+	{ 38, 27, { 0, 0, 0, 1 }, { 38807, 98037, 36081, 100762, 32000, 104843, 0, 0 } },
+	{ 38, 28, { 0, 0, 0, 0 }, { 45989, 89643, 44041, 91586, 41734, 93883, 39342, 96262 } },
+	{ 38, 29, { 0, 0, 0, 0 }, { 53787, 82616, 51454, 84949, 48931, 87472, 46539, 89864 } },
+	{ 38, 30, { 0, 0, 0, 0 }, { 51707, 86651, 49652, 88708, 47337, 91026, 45066, 93300 } },
+	{ 38, 31, { 0, 0, 0, 0 }, { 46817, 90735, 44873, 92685, 42571, 94997, 40180, 97401 } },
+	{ 38, 32, { 0, 0, 0, 1 }, { 38816, 98040, 36091, 100764, 32012, 104842, 0, 0 } },
+	{ 38, 33, { 0, 0, 0, 0 }, { 46008, 89618, 44060, 91561, 41754, 93857, 39364, 96235 } },
+	{ 38, 34, { 0, 0, 0, 0 }, { 53786, 82621, 51454, 84954, 48931, 87477, 46539, 89868 } },
+	{ 38, 35, { 0, 0, 0, 2 }, { 39868, 97442, 37309, 99989, 33695, 103572, 0, 0 } },
+	{ 38, 36, { 0, 0, 0, 0 }, { 46798, 90743, 44854, 92694, 42551, 95006, 40159, 97411 } },
+	{ 38, 37, { 0, 0, 0, 1 }, { 38825, 98046, 36100, 100770, 32022, 104847, 0, 0 } },
+	{ 38, 38, { 0, 0, 0, 0 }, { 46022, 89601, 44074, 91543, 41769, 93839, 39380, 96215 } },
+	{ 38, 39, { 0, 0, 0, 0 }, { 53782, 82618, 51449, 84951, 48926, 87474, 46535, 89865 } },
+	{ 38, 40, { 0, 0, 0, 0 }, { 53810, 82651, 51478, 84983, 48955, 87506, 46564, 89897 } },
+	{ 38, 41, { 0, 0, 0, 0 }, { 53921, 83077, 51607, 85390, 49099, 87899, 46717, 90282 } },
+	{ 39, 0, { 0, 0, 0, 0 }, { 55537, 90120, 53787, 91870, 51818, 93839, 49904, 95753 } },
+	{ 39, 1, { 0, 0, 0, 0 }, { 51221, 94894, 49658, 96461, 47824, 98299, 45965, 100163 } },
+	{ 39, 2, { 0, 0, 0, 0 }, { 46034, 99278, 44157, 101155, 41798, 103514, 39122, 106190 } },
+	{ 39, 3, { 0, 0, 0, 0 }, { 50268, 93932, 48701, 95496, 46863, 97329, 44999, 99188 } },
+	{ 39, 4, { 0, 0, 0, 0 }, { 55307, 89679, 53547, 91438, 51569, 93416, 49649, 95336 } },
+	{ 39, 5, { 0, 0, 0, 0 }, { 55537, 90120, 53787, 91870, 51818, 93839, 49904, 95753 } },
+	{ 39, 6, { 0, 0, 0, 0 }, { 51208, 94899, 49644, 96465, 47810, 98303, 45951, 100169 } },
+	{ 39, 7, { 0, 0, 0, 0 }, { 46045, 99283, 44168, 101160, 41810, 103518, 39134, 106194 } },
+	{ 39, 8, { 0, 0, 0, 0 }, { 50276, 93920, 48709, 95484, 46872, 97317, 45008, 99176 } },
+	{ 39, 9, { 0, 0, 0, 0 }, { 55300, 89677, 53541, 91436, 51563, 93414, 49643, 95334 } },
+	{ 39, 10, { 0, 0, 0, 0 }, { 46027, 98989, 44168, 100851, 41841, 103182, 39220, 105811 } },
+	{ 39, 11, { 0, 0, 0, 0 }, { 51218, 94893, 49654, 96459, 47821, 98297, 45961, 100162 } },
+	{ 39, 12, { 0, 0, 0, 0 }, { 46054, 99290, 44177, 101167, 41819, 103524, 39144, 106199 } },
+	{ 39, 13, { 0, 0, 0, 0 }, { 50275, 93933, 48708, 95497, 46870, 97330, 45006, 99189 } },
+	{ 39, 14, { 0, 0, 0, 0 }, { 55290, 89670, 53531, 91429, 51553, 93406, 49633, 95326 } },
+	{ 39, 15, { 0, 0, 0, 0 }, { 53385, 89923, 51711, 91596, 49809, 93497, 47945, 95361 } },
+	{ 39, 16, { 0, 0, 0, 0 }, { 51226, 94882, 49662, 96449, 47829, 98286, 45970, 100151 } },
+	{ 39, 17, { 0, 0, 0, 0 }, { 46059, 99293, 44182, 101170, 41825, 103528, 39150, 106202 } },
+	{ 39, 18, { 0, 0, 0, 0 }, { 50270, 93943, 48703, 95507, 46865, 97341, 45001, 99200 } },
+	{ 39, 19, { 0, 0, 0, 0 }, { 55277, 89659, 53518, 91418, 51541, 93395, 49621, 95315 } },
+	{ 39, 20, { 0, 0, 0, 0 }, { 48327, 96693, 46682, 98343, 44702, 100330, 42622, 102421 } },
+	{ 39, 21, { 0, 0, 0, 0 }, { 51142, 94928, 49578, 96495, 47743, 98335, 45881, 100202 } },
+	{ 39, 22, { 0, 0, 0, 0 }, { 46079, 99307, 44202, 101184, 41845, 103541, 39172, 106214 } },
+	{ 39, 23, { 0, 0, 0, 0 }, { 50317, 93861, 48750, 95424, 46914, 97256, 45053, 99112 } },
+	{ 39, 24, { 0, 0, 0, 0 }, { 55293, 89679, 53535, 91438, 51557, 93415, 49637, 95335 } },
+	{ 39, 25, { 0, 0, 0, 0 }, { 49201, 95893, 47594, 97495, 45681, 99402, 43698, 101376 } },
+	{ 39, 26, { 0, 0, 0, 0 }, { 51170, 94912, 49606, 96479, 47771, 98318, 45910, 100184 } },
+	{ 39, 27, { 0, 0, 0, 0 }, { 46080, 99309, 44204, 101186, 41847, 103543, 39173, 106216 } },
+	{ 39, 28, { 0, 0, 0, 0 }, { 50305, 93890, 48738, 95454, 46902, 97286, 45039, 99143 } },
+	{ 39, 29, { 0, 0, 0, 0 }, { 55283, 89668, 53524, 91427, 51546, 93404, 49627, 95324 } },
+	{ 39, 30, { 0, 0, 0, 0 }, { 54404, 92485, 52778, 94112, 50916, 95975, 49080, 97813 } },
+	{ 39, 31, { 0, 0, 0, 0 }, { 51152, 94922, 49588, 96489, 47753, 98328, 45892, 100195 } },
+	{ 39, 32, { 0, 0, 0, 0 }, { 46088, 99314, 44212, 101190, 41855, 103546, 39182, 106219 } },
+	{ 39, 33, { 0, 0, 0, 0 }, { 50316, 93873, 48749, 95437, 46913, 97269, 45051, 99125 } },
+	{ 39, 34, { 0, 0, 0, 0 }, { 55283, 89672, 53524, 91431, 51547, 93408, 49627, 95327 } },
+	{ 39, 35, { 0, 0, 0, 0 }, { 46807, 99069, 44986, 100885, 42722, 103142, 40206, 105646 } },
+	{ 39, 36, { 0, 0, 0, 0 }, { 51138, 94925, 49574, 96492, 47739, 98332, 45877, 100199 } },
+	{ 39, 37, { 0, 0, 0, 0 }, { 46097, 99320, 44220, 101197, 41864, 103553, 39191, 106225 } },
+	{ 39, 38, { 0, 0, 0, 0 }, { 50324, 93862, 48758, 95425, 46922, 97257, 45061, 99113 } },
+	{ 39, 39, { 0, 0, 0, 0 }, { 55279, 89668, 53520, 91427, 51543, 93404, 49623, 95324 } },
+	{ 39, 40, { 0, 0, 0, 0 }, { 55308, 89700, 53549, 91459, 51572, 93436, 49652, 95355 } },
+	{ 39, 41, { 0, 0, 0, 0 }, { 55482, 90060, 53732, 91810, 51762, 93780, 49848, 95694 } },
+	{ 40, 0, { 0, 0, 0, 0 }, { 58099, 87899, 55862, 90136, 53423, 92576, 51099, 94900 } },
+	{ 40, 1, { 0, 0, 0, 0 }, { 51353, 95119, 49457, 97021, 47215, 99271, 44898, 101600 } },
+	{ 40, 2, { 0, 0, 0, 2 }, { 43555, 102095, 40956, 104694, 37202, 108448, 0, 0 } },
+	{ 40, 3, { 0, 0, 0, 0 }, { 50383, 94136, 48481, 96032, 46231, 98274, 43903, 100590 } },
+	{ 40, 4, { 0, 0, 0, 0 }, { 57932, 87391, 55675, 89647, 53221, 92101, 50888, 94435 } },
+	{ 40, 5, { 0, 0, 0, 0 }, { 58099, 87899, 55862, 90136, 53423, 92576, 51099, 94900 } },
+	{ 40, 6, { 0, 0, 0, 0 }, { 51335, 95128, 49438, 97030, 47196, 99280, 44878, 101610 } },
+	{ 40, 7, { 0, 0, 0, 2 }, { 43567, 102098, 40968, 104697, 37217, 108449, 0, 0 } },
+	{ 40, 8, { 0, 0, 0, 0 }, { 50396, 94119, 48494, 96016, 46245, 98256, 43918, 100572 } },
+	{ 40, 9, { 0, 0, 0, 0 }, { 57924, 87390, 55668, 89646, 53214, 92100, 50881, 94433 } },
+	{ 40, 10, { 0, 0, 0, 2 }, { 43642, 101722, 41093, 104278, 37473, 107916, 0, 0 } },
+	{ 40, 11, { 0, 0, 0, 0 }, { 51349, 95117, 49453, 97019, 47211, 99269, 44894, 101599 } },
+	{ 40, 12, { 0, 0, 0, 2 }, { 43577, 102104, 40979, 104702, 37229, 108453, 0, 0 } },
+	{ 40, 13, { 0, 0, 0, 0 }, { 50392, 94135, 48489, 96032, 46240, 98273, 43912, 100589 } },
+	{ 40, 14, { 0, 0, 0, 0 }, { 57913, 87384, 55657, 89640, 53203, 92093, 50870, 94426 } },
+	{ 40, 15, { 0, 0, 0, 0 }, { 55361, 88275, 53273, 90361, 50949, 92684, 48697, 94934 } },
+	{ 40, 16, { 0, 0, 0, 0 }, { 51361, 95103, 49465, 97004, 47224, 99254, 44908, 101582 } },
+	{ 40, 17, { 0, 0, 0, 2 }, { 43583, 102107, 40985, 104705, 37235, 108455, 0, 0 } },
+	{ 40, 18, { 0, 0, 0, 0 }, { 50383, 94149, 48481, 96046, 46230, 98288, 43902, 100605 } },
+	{ 40, 19, { 0, 0, 0, 0 }, { 57900, 87373, 55644, 89629, 53191, 92083, 50858, 94415 } },
+	{ 40, 20, { 0, 0, 0, 0 }, { 47267, 98114, 45208, 100183, 42641, 102768, 39747, 105693 } },
+	{ 40, 21, { 0, 0, 0, 0 }, { 51246, 95181, 49349, 97084, 47104, 99338, 44780, 101674 } },
+	{ 40, 22, { 0, 0, 0, 2 }, { 43604, 102119, 41007, 104716, 37260, 108462, 0, 0 } },
+	{ 40, 23, { 0, 0, 0, 0 }, { 50462, 94034, 48561, 95930, 46315, 98168, 43994, 100478 } },
+	{ 40, 24, { 0, 0, 0, 0 }, { 57915, 87395, 55659, 89651, 53206, 92104, 50874, 94436 } },
+	{ 40, 25, { 0, 0, 0, 0 }, { 48553, 96857, 46572, 98829, 44156, 101232, 41534, 103832 } },
+	{ 40, 26, { 0, 0, 0, 0 }, { 51284, 95154, 49387, 97056, 47143, 99309, 44822, 101642 } },
+	{ 40, 27, { 0, 0, 0, 2 }, { 43605, 102122, 41008, 104718, 37261, 108465, 0, 0 } },
+	{ 40, 28, { 0, 0, 0, 0 }, { 50440, 94074, 48538, 95970, 46291, 98209, 43967, 100521 } },
+	{ 40, 29, { 0, 0, 0, 0 }, { 57904, 87384, 55648, 89640, 53195, 92093, 50863, 94425 } },
+	{ 40, 30, { 0, 0, 0, 0 }, { 55965, 91274, 53964, 93276, 51705, 95538, 49488, 97758 } },
+	{ 40, 31, { 0, 0, 0, 0 }, { 51260, 95170, 49363, 97073, 47118, 99326, 44795, 101661 } },
+	{ 40, 32, { 0, 0, 0, 2 }, { 43614, 102124, 41018, 104720, 37272, 108465, 0, 0 } },
+	{ 40, 33, { 0, 0, 0, 0 }, { 50458, 94050, 48557, 95946, 46310, 98185, 43988, 100495 } },
+	{ 40, 34, { 0, 0, 0, 0 }, { 57903, 87389, 55648, 89644, 53195, 92097, 50863, 94429 } },
+	{ 40, 35, { 0, 0, 0, 0 }, { 44626, 101569, 42174, 104010, 38794, 107365, 33541, 112489 } },
+	{ 40, 36, { 0, 0, 0, 0 }, { 51241, 95178, 49344, 97081, 47099, 99335, 44775, 101671 } },
+	{ 40, 37, { 0, 0, 0, 2 }, { 43623, 102131, 41027, 104726, 37281, 108471, 0, 0 } },
+	{ 40, 38, { 0, 0, 0, 0 }, { 50471, 94034, 48570, 95930, 46324, 98167, 44003, 100477 } },
+	{ 40, 39, { 0, 0, 0, 0 }, { 57899, 87386, 55644, 89641, 53191, 92094, 50859, 94426 } },
+	{ 40, 40, { 0, 0, 0, 0 }, { 57927, 87419, 55672, 89673, 53220, 92126, 50887, 94458 } },
+	{ 40, 41, { 0, 0, 0, 0 }, { 58045, 87837, 55807, 90075, 53368, 92515, 51044, 94839 } },
+	{ 41, 0, { 0, 0, 0, 0 }, { -18743, 33003, -20478, 34736, -22619, 36874, -24958, 39209 } },
+	{ 41, 1, { 0, 0, 0, 0 }, { -14536, 29273, -16027, 30761, -17774, 32505, -19542, 34268 } },
+	{ 41, 2, { 0, 0, 0, 0 }, { -10841, 24795, -12500, 26455, -14375, 28330, -16204, 30159 } },
+	{ 41, 3, { 0, 0, 0, 0 }, { -15329, 28292, -16817, 29782, -18558, 31527, -20318, 33291 } },
+	{ 41, 4, { 0, 0, 0, 0 }, { -19151, 32755, -20894, 34498, -23048, 36653, -25408, 39013 } },
+	{ 41, 5, { 0, 0, 0, 0 }, { -18743, 33003, -20478, 34736, -22619, 36874, -24958, 39209 } },
+	{ 41, 6, { 0, 0, 0, 0 }, { -14533, 29261, -16024, 30749, -17771, 32492, -19539, 34255 } },
+	{ 41, 7, { 0, 0, 0, 0 }, { -10835, 24805, -12494, 26465, -14369, 28340, -16197, 30168 } },
+	{ 41, 8, { 0, 0, 0, 0 }, { -15339, 28298, -16828, 29789, -18569, 31534, -20329, 33298 } },
+	{ 41, 9, { 0, 0, 0, 0 }, { -19153, 32749, -20896, 34492, -23050, 36646, -25409, 39006 } },
+	{ 41, 10, { 0, 0, 0, 0 }, { -11125, 24767, -12774, 26415, -14638, 28280, -16458, 30100 } },
+	{ 41, 11, { 0, 0, 0, 0 }, { -14538, 29269, -16029, 30758, -17777, 32501, -19545, 34265 } },
+	{ 41, 12, { 0, 0, 0, 0 }, { -10828, 24814, -12488, 26474, -14362, 28348, -16191, 30177 } },
+	{ 41, 13, { 0, 0, 0, 0 }, { -15328, 28298, -16816, 29789, -18557, 31533, -20317, 33297 } },
+	{ 41, 14, { 0, 0, 0, 0 }, { -19160, 32739, -20903, 34481, -23056, 36635, -25415, 38995 } },
+	{ 41, 15, { 0, 0, 0, 0 }, { -18950, 30956, -20588, 32598, -22575, 34592, -24687, 36714 } },
+	{ 41, 16, { 0, 0, 0, 0 }, { -14548, 29276, -16039, 30765, -17786, 32508, -19554, 34272 } },
+	{ 41, 17, { 0, 0, 0, 0 }, { -10824, 24819, -12484, 26479, -14358, 28353, -16187, 30182 } },
+	{ 41, 18, { 0, 0, 0, 0 }, { -15318, 28294, -16806, 29785, -18547, 31530, -20306, 33293 } },
+	{ 41, 19, { 0, 0, 0, 0 }, { -19171, 32726, -20914, 34469, -23067, 36623, -25426, 38982 } },
+	{ 41, 20, { 0, 0, 0, 0 }, { -13072, 26709, -14595, 28231, -16348, 29983, -18088, 31722 } },
+	{ 41, 21, { 0, 0, 0, 0 }, { -14510, 29202, -16001, 30690, -17747, 32432, -19512, 34193 } },
+	{ 41, 22, { 0, 0, 0, 0 }, { -10808, 24839, -12467, 26498, -14342, 28372, -16170, 30201 } },
+	{ 41, 23, { 0, 0, 0, 0 }, { -15392, 28333, -16880, 29824, -18623, 31570, -20385, 33336 } },
+	{ 41, 24, { 0, 0, 0, 0 }, { -19153, 32743, -20895, 34485, -23049, 36639, -25407, 38998 } },
+	{ 41, 25, { 0, 0, 0, 0 }, { -13584, 27436, -15086, 28939, -16823, 30677, -18555, 32413 } },
+	{ 41, 26, { 0, 0, 0, 0 }, { -14524, 29226, -16014, 30714, -17761, 32457, -19527, 34219 } },
+	{ 41, 27, { 0, 0, 0, 0 }, { -10807, 24840, -12466, 26499, -14340, 28374, -16169, 30202 } },
+	{ 41, 28, { 0, 0, 0, 0 }, { -15365, 28323, -16854, 29814, -18596, 31560, -20357, 33325 } },
+	{ 41, 29, { 0, 0, 0, 0 }, { -19163, 32732, -20905, 34474, -23059, 36628, -25417, 38987 } },
+	{ 41, 30, { 0, 0, 0, 0 }, { -16606, 32095, -18199, 33683, -20116, 35593, -22129, 37597 } },
+	{ 41, 31, { 0, 0, 0, 0 }, { -14516, 29210, -16006, 30698, -17753, 32441, -19519, 34202 } },
+	{ 41, 32, { 0, 0, 0, 0 }, { -10802, 24848, -12461, 26507, -14335, 28381, -16164, 30209 } },
+	{ 41, 33, { 0, 0, 0, 0 }, { -15380, 28332, -16869, 29823, -18611, 31569, -20372, 33335 } },
+	{ 41, 34, { 0, 0, 0, 0 }, { -19160, 32733, -20902, 34475, -23055, 36628, -25413, 38987 } },
+	{ 41, 35, { 0, 0, 0, 0 }, { -10914, 25479, -12542, 27106, -14386, 28951, -16192, 30756 } },
+	{ 41, 36, { 0, 0, 0, 0 }, { -14514, 29197, -16004, 30685, -17750, 32428, -19516, 34189 } },
+	{ 41, 37, { 0, 0, 0, 0 }, { -10795, 24856, -12454, 26515, -14328, 28389, -16156, 30217 } },
+	{ 41, 38, { 0, 0, 0, 0 }, { -15390, 28340, -16879, 29831, -18622, 31577, -20383, 33343 } },
+	{ 41, 39, { 0, 0, 0, 0 }, { -19163, 32729, -20905, 34471, -23058, 36624, -25416, 38982 } },
+	{ 41, 40, { 0, 0, 0, 0 }, { -19134, 32758, -20876, 34500, -23029, 36653, -25388, 39011 } },
+	{ 41, 41, { 0, 0, 0, 0 }, { -18802, 32947, -20537, 34680, -22678, 36818, -25017, 39154 } },
+	{ 42, 0, { 0, 0, 0, 0 }, { 11931, 61455, 10373, 63011, 8492, 64891, 6512, 66868 } },
+	{ 42, 1, { 0, 0, 0, 0 }, { 15065, 58772, 13686, 60149, 12075, 61758, 10453, 63377 } },
+	{ 42, 2, { 0, 0, 0, 0 }, { 17639, 55428, 16123, 56944, 14394, 58674, 12695, 60373 } },
+	{ 42, 3, { 0, 0, 0, 0 }, { 14206, 57838, 12829, 59217, 11221, 60827, 9603, 62447 } },
+	{ 42, 4, { 0, 0, 0, 0 }, { 11540, 61188, 9976, 62752, 8085, 64643, 6092, 66636 } },
+	{ 42, 5, { 0, 0, 0, 0 }, { 11931, 61455, 10373, 63011, 8492, 64891, 6512, 66868 } },
+	{ 42, 6, { 0, 0, 0, 0 }, { 15066, 58762, 13687, 60139, 12076, 61748, 10455, 63366 } },
+	{ 42, 7, { 0, 0, 0, 0 }, { 17646, 55438, 16130, 56954, 14401, 58683, 12702, 60382 } },
+	{ 42, 8, { 0, 0, 0, 0 }, { 14198, 57842, 12821, 59221, 11212, 60832, 9595, 62452 } },
+	{ 42, 9, { 0, 0, 0, 0 }, { 11537, 61182, 9973, 62746, 8083, 64637, 6090, 66629 } },
+	{ 42, 10, { 0, 0, 0, 0 }, { 17395, 55360, 15888, 56867, 14167, 58588, 12475, 60280 } },
+	{ 42, 11, { 0, 0, 0, 0 }, { 15063, 58769, 13684, 60146, 12072, 61755, 10451, 63373 } },
+	{ 42, 12, { 0, 0, 0, 0 }, { 17653, 55446, 16137, 56962, 14408, 58691, 12709, 60390 } },
+	{ 42, 13, { 0, 0, 0, 0 }, { 14208, 57843, 12831, 59222, 11222, 60833, 9605, 62453 } },
+	{ 42, 14, { 0, 0, 0, 0 }, { 11529, 61172, 9965, 62736, 8075, 64627, 6083, 66619 } },
+	{ 42, 15, { 0, 0, 0, 0 }, { 11442, 59666, 9953, 61158, 8172, 62943, 6325, 64797 } },
+	{ 42, 16, { 0, 0, 0, 0 }, { 15056, 58773, 13677, 60150, 12065, 61760, 10443, 63378 } },
+	{ 42, 17, { 0, 0, 0, 0 }, { 17657, 55451, 16141, 56967, 14412, 58696, 12713, 60395 } },
+	{ 42, 18, { 0, 0, 0, 0 }, { 14216, 57841, 12839, 59220, 11231, 60831, 9613, 62451 } },
+	{ 42, 19, { 0, 0, 0, 0 }, { 11518, 61160, 9955, 62724, 8065, 64614, 6072, 66607 } },
+	{ 42, 20, { 0, 0, 0, 0 }, { 15989, 56750, 14582, 58158, 12956, 59783, 11341, 61397 } },
+	{ 42, 21, { 0, 0, 0, 0 }, { 15078, 58714, 13699, 60090, 12089, 61699, 10469, 63316 } },
+	{ 42, 22, { 0, 0, 0, 0 }, { 17673, 55470, 16157, 56986, 14429, 58715, 12730, 60414 } },
+	{ 42, 23, { 0, 0, 0, 0 }, { 14157, 57865, 12779, 59244, 11170, 60855, 9552, 62477 } },
+	{ 42, 24, { 0, 0, 0, 0 }, { 11537, 61177, 9973, 62741, 8083, 64631, 6091, 66623 } },
+	{ 42, 25, { 0, 0, 0, 0 }, { 15606, 57330, 14217, 58719, 12607, 60330, 11003, 61936 } },
+	{ 42, 26, { 0, 0, 0, 0 }, { 15070, 58733, 13691, 60110, 12080, 61719, 10459, 63336 } },
+	{ 42, 27, { 0, 0, 0, 0 }, { 17674, 55472, 16159, 56987, 14430, 58716, 12731, 60415 } },
+	{ 42, 28, { 0, 0, 0, 0 }, { 14179, 57860, 12801, 59239, 11193, 60850, 9574, 62471 } },
+	{ 42, 29, { 0, 0, 0, 0 }, { 11526, 61166, 9963, 62730, 8073, 64620, 6081, 66612 } },
+	{ 42, 30, { 0, 0, 0, 0 }, { 13654, 60949, 12201, 62399, 10472, 64124, 8691, 65898 } },
+	{ 42, 31, { 0, 0, 0, 0 }, { 15074, 58720, 13696, 60097, 12085, 61706, 10465, 63323 } },
+	{ 42, 32, { 0, 0, 0, 0 }, { 17680, 55479, 16164, 56995, 14435, 58723, 12737, 60422 } },
+	{ 42, 33, { 0, 0, 0, 0 }, { 14167, 57866, 12790, 59245, 11181, 60857, 9562, 62478 } },
+	{ 42, 34, { 0, 0, 0, 0 }, { 11529, 61167, 9966, 62731, 8076, 64621, 6084, 66613 } },
+	{ 42, 35, { 0, 0, 0, 0 }, { 17661, 56009, 16171, 57499, 14467, 59202, 12790, 60879 } },
+	{ 42, 36, { 0, 0, 0, 0 }, { 15074, 58709, 13696, 60086, 12085, 61695, 10465, 63312 } },
+	{ 42, 37, { 0, 0, 0, 0 }, { 17687, 55487, 16171, 57002, 14443, 58731, 12744, 60430 } },
+	{ 42, 38, { 0, 0, 0, 0 }, { 14159, 57871, 12782, 59250, 11172, 60862, 9554, 62483 } },
+	{ 42, 39, { 0, 0, 0, 0 }, { 11526, 61163, 9962, 62727, 8073, 64617, 6081, 66608 } },
+	{ 42, 40, { 0, 0, 0, 0 }, { 11556, 61192, 9992, 62756, 8102, 64645, 6111, 66637 } },
+	{ 42, 41, { 0, 0, 0, 0 }, { 11872, 61399, 10314, 62955, 8433, 64835, 6453, 66813 } },
+	{ 43, 0, { 0, 0, 0, 0 }, { 13129, 64887, 11393, 66621, 9250, 68761, 6908, 71099 } },
+	{ 43, 1, { 0, 0, 0, 0 }, { 17348, 61111, 15856, 62600, 14108, 64345, 12339, 66109 } },
+	{ 43, 2, { 0, 0, 0, 0 }, { 21044, 56657, 19382, 58318, 17506, 60195, 15675, 62025 } },
+	{ 43, 3, { 0, 0, 0, 0 }, { 16508, 60175, 15019, 61667, 13275, 63414, 11513, 65181 } },
+	{ 43, 4, { 0, 0, 0, 0 }, { 12715, 64646, 10970, 66392, 8813, 68549, 6448, 70915 } },
+	{ 43, 5, { 0, 0, 0, 0 }, { 13129, 64887, 11393, 66621, 9250, 68761, 6908, 71099 } },
+	{ 43, 6, { 0, 0, 0, 0 }, { 17351, 61099, 15859, 62588, 14111, 64332, 12343, 66096 } },
+	{ 43, 7, { 0, 0, 0, 0 }, { 21050, 56667, 19388, 58328, 17512, 60204, 15682, 62034 } },
+	{ 43, 8, { 0, 0, 0, 0 }, { 16498, 60182, 15008, 61674, 13264, 63421, 11502, 65188 } },
+	{ 43, 9, { 0, 0, 0, 0 }, { 12713, 64640, 10968, 66385, 8811, 68542, 6446, 70907 } },
+	{ 43, 10, { 0, 0, 0, 0 }, { 20764, 56621, 19114, 58272, 17247, 60139, 15425, 61961 } },
+	{ 43, 11, { 0, 0, 0, 0 }, { 17346, 61107, 15854, 62597, 14106, 64342, 12337, 66105 } },
+	{ 43, 12, { 0, 0, 0, 0 }, { 21056, 56675, 19395, 58337, 17519, 60213, 15689, 62043 } },
+	{ 43, 13, { 0, 0, 0, 0 }, { 16509, 60182, 15020, 61674, 13276, 63421, 11514, 65187 } },
+	{ 43, 14, { 0, 0, 0, 0 }, { 12706, 64630, 10961, 66375, 8804, 68532, 6440, 70896 } },
+	{ 43, 15, { 0, 0, 0, 0 }, { 12895, 62854, 11254, 64500, 9261, 66499, 7142, 68628 } },
+	{ 43, 16, { 0, 0, 0, 0 }, { 17337, 61114, 15845, 62604, 14096, 64349, 12328, 66113 } },
+	{ 43, 17, { 0, 0, 0, 0 }, { 21060, 56681, 19399, 58342, 17523, 60218, 15693, 62048 } },
+	{ 43, 18, { 0, 0, 0, 0 }, { 16519, 60178, 15029, 61670, 13286, 63417, 11524, 65183 } },
+	{ 43, 19, { 0, 0, 0, 0 }, { 12695, 64617, 10950, 66362, 8794, 68519, 6430, 70884 } },
+	{ 43, 20, { 0, 0, 0, 0 }, { 18818, 58546, 17293, 60071, 15537, 61825, 13795, 63566 } },
+	{ 43, 21, { 0, 0, 0, 0 }, { 17374, 61040, 15883, 62529, 14136, 64272, 12370, 66034 } },
+	{ 43, 22, { 0, 0, 0, 0 }, { 21076, 56700, 19415, 58361, 17539, 60237, 15709, 62067 } },
+	{ 43, 23, { 0, 0, 0, 0 }, { 16445, 60216, 14955, 61709, 13210, 63457, 11446, 65226 } },
+	{ 43, 24, { 0, 0, 0, 0 }, { 12714, 64634, 10969, 66378, 8813, 68535, 6449, 70899 } },
+	{ 43, 25, { 0, 0, 0, 0 }, { 18258, 59315, 16756, 60819, 15018, 62559, 13284, 64295 } },
+	{ 43, 26, { 0, 0, 0, 0 }, { 17361, 61064, 15869, 62553, 14122, 64297, 12355, 66060 } },
+	{ 43, 27, { 0, 0, 0, 0 }, { 21077, 56702, 19416, 58363, 17540, 60239, 15710, 62069 } },
+	{ 43, 28, { 0, 0, 0, 0 }, { 16472, 60207, 14982, 61699, 13237, 63447, 11474, 65215 } },
+	{ 43, 29, { 0, 0, 0, 0 }, { 12704, 64623, 10959, 66367, 8802, 68524, 6439, 70888 } },
+	{ 43, 30, { 0, 0, 0, 0 }, { 15276, 63950, 13684, 65538, 11766, 67448, 9754, 69451 } },
+	{ 43, 31, { 0, 0, 0, 0 }, { 17369, 61048, 15877, 62537, 14130, 64281, 12363, 66043 } },
+	{ 43, 32, { 0, 0, 0, 0 }, { 21082, 56709, 19421, 58370, 17545, 60246, 15716, 62076 } },
+	{ 43, 33, { 0, 0, 0, 0 }, { 16457, 60216, 14967, 61709, 13222, 63457, 11458, 65225 } },
+	{ 43, 34, { 0, 0, 0, 0 }, { 12707, 64623, 10963, 66368, 8806, 68524, 6443, 70888 } },
+	{ 43, 35, { 0, 0, 0, 0 }, { 20955, 57350, 19327, 58978, 17481, 60824, 15675, 62630 } },
+	{ 43, 36, { 0, 0, 0, 0 }, { 17371, 61035, 15879, 62524, 14132, 64268, 12366, 66030 } },
+	{ 43, 37, { 0, 0, 0, 0 }, { 21089, 56717, 19428, 58378, 17553, 60254, 15723, 62084 } },
+	{ 43, 38, { 0, 0, 0, 0 }, { 16446, 60223, 14956, 61716, 13211, 63464, 11447, 65233 } },
+	{ 43, 39, { 0, 0, 0, 0 }, { 12703, 64619, 10959, 66364, 8803, 68520, 6440, 70883 } },
+	{ 43, 40, { 0, 0, 0, 0 }, { 12733, 64648, 10989, 66392, 8833, 68548, 6470, 70911 } },
+	{ 43, 41, { 0, 0, 0, 0 }, { 13070, 64831, 11334, 66565, 9191, 68706, 6848, 71044 } },
+	{ 44, 0, { 0, 0, 0, 0 }, { 30212, 79035, 28700, 80546, 26883, 82361, 24988, 84254 } },
+	{ 44, 1, { 0, 0, 0, 0 }, { 33004, 76677, 31655, 78024, 30080, 79597, 28497, 81177 } },
+	{ 44, 2, { 0, 0, 0, 0 }, { 35224, 73697, 33745, 75176, 32054, 76868, 30388, 78533 } },
+	{ 44, 3, { 0, 0, 0, 0 }, { 32121, 75761, 30773, 77110, 29200, 78684, 27620, 80266 } },
+	{ 44, 4, { 0, 0, 0, 0 }, { 29826, 78763, 28307, 80281, 26482, 82106, 24575, 84013 } },
+	{ 44, 5, { 0, 0, 0, 0 }, { 30212, 79035, 28700, 80546, 26883, 82361, 24988, 84254 } },
+	{ 44, 6, { 0, 0, 0, 0 }, { 33004, 76667, 31656, 78014, 30080, 79587, 28498, 81167 } },
+	{ 44, 7, { 0, 0, 0, 0 }, { 35231, 73707, 33752, 75185, 32061, 76877, 30395, 78542 } },
+	{ 44, 8, { 0, 0, 0, 0 }, { 32113, 75764, 30765, 77113, 29193, 78688, 27613, 80270 } },
+	{ 44, 9, { 0, 0, 0, 0 }, { 29823, 78757, 28304, 80275, 26480, 82100, 24573, 84007 } },
+	{ 44, 10, { 0, 0, 0, 0 }, { 34993, 73616, 33522, 75087, 31838, 76771, 30179, 78430 } },
+	{ 44, 11, { 0, 0, 0, 0 }, { 33001, 76673, 31653, 78021, 30078, 79594, 28495, 81174 } },
+	{ 44, 12, { 0, 0, 0, 0 }, { 35238, 73715, 33759, 75194, 32068, 76885, 30402, 78550 } },
+	{ 44, 13, { 0, 0, 0, 0 }, { 32123, 75766, 30775, 77115, 29202, 78690, 27622, 80272 } },
+	{ 44, 14, { 0, 0, 0, 0 }, { 29815, 78747, 28297, 80266, 26472, 82090, 24566, 83997 } },
+	{ 44, 15, { 0, 0, 0, 0 }, { 29632, 77326, 28182, 78779, 26454, 80511, 24671, 82298 } },
+	{ 44, 16, { 0, 0, 0, 0 }, { 32995, 76677, 31646, 78025, 30071, 79598, 28488, 81178 } },
+	{ 44, 17, { 0, 0, 0, 0 }, { 35242, 73720, 33763, 75199, 32072, 76890, 30407, 78555 } },
+	{ 44, 18, { 0, 0, 0, 0 }, { 32130, 75764, 30782, 77113, 29210, 78688, 27630, 80270 } },
+	{ 44, 19, { 0, 0, 0, 0 }, { 29804, 78735, 28286, 80253, 26461, 82078, 24555, 83985 } },
+	{ 44, 20, { 0, 0, 0, 0 }, { 33756, 74829, 32379, 76206, 30787, 77798, 29205, 79379 } },
+	{ 44, 21, { 0, 0, 0, 0 }, { 33013, 76623, 31664, 77970, 30090, 79542, 28508, 81121 } },
+	{ 44, 22, { 0, 0, 0, 0 }, { 35258, 73739, 33780, 75217, 32089, 76908, 30423, 78574 } },
+	{ 44, 23, { 0, 0, 0, 0 }, { 32076, 75783, 30728, 77132, 29154, 78708, 27573, 80291 } },
+	{ 44, 24, { 0, 0, 0, 0 }, { 29823, 78752, 28304, 80270, 26480, 82095, 24574, 84001 } },
+	{ 44, 25, { 0, 0, 0, 0 }, { 33410, 75364, 32051, 76723, 30476, 78299, 28905, 79871 } },
+	{ 44, 26, { 0, 0, 0, 0 }, { 33006, 76640, 31657, 77987, 30083, 79560, 28501, 81140 } },
+	{ 44, 27, { 0, 0, 0, 0 }, { 35260, 73740, 33781, 75219, 32090, 76910, 30425, 78575 } },
+	{ 44, 28, { 0, 0, 0, 0 }, { 32096, 75780, 30748, 77129, 29175, 78704, 27595, 80287 } },
+	{ 44, 29, { 0, 0, 0, 0 }, { 29812, 78741, 28294, 80259, 26469, 82084, 24563, 83990 } },
+	{ 44, 30, { 0, 0, 0, 0 }, { 31805, 78650, 30389, 80064, 28709, 81740, 26987, 83456 } },
+	{ 44, 31, { 0, 0, 0, 0 }, { 33010, 76629, 31661, 77976, 30087, 79548, 28505, 81128 } },
+	{ 44, 32, { 0, 0, 0, 0 }, { 35265, 73748, 33787, 75226, 32096, 76917, 30430, 78582 } },
+	{ 44, 33, { 0, 0, 0, 0 }, { 32085, 75785, 30738, 77134, 29164, 78710, 27583, 80293 } },
+	{ 44, 34, { 0, 0, 0, 0 }, { 29815, 78742, 28297, 80260, 26473, 82085, 24567, 83991 } },
+	{ 44, 35, { 0, 0, 0, 0 }, { 35273, 74246, 33819, 75700, 32153, 77366, 30509, 79010 } },
+	{ 44, 36, { 0, 0, 0, 0 }, { 33009, 76619, 31661, 77966, 30086, 79538, 28505, 81117 } },
+	{ 44, 37, { 0, 0, 0, 0 }, { 35272, 73756, 33794, 75234, 32103, 76925, 30438, 78590 } },
+	{ 44, 38, { 0, 0, 0, 0 }, { 32078, 75789, 30730, 77138, 29157, 78714, 27576, 80297 } },
+	{ 44, 39, { 0, 0, 0, 0 }, { 29811, 78738, 28293, 80256, 26469, 82081, 24563, 83986 } },
+	{ 44, 40, { 0, 0, 0, 0 }, { 29841, 78767, 28323, 80285, 26499, 82109, 24593, 84015 } },
+	{ 44, 41, { 0, 0, 0, 0 }, { 30153, 78978, 28641, 80490, 26824, 82305, 24929, 84198 } },
+	{ 45, 0, { 0, 0, 0, 0 }, { 31462, 83429, 29706, 85183, 27533, 87352, 25147, 89734 } },
+	{ 45, 1, { 0, 0, 0, 0 }, { 35786, 79527, 34282, 81029, 32520, 82788, 30736, 84567 } },
+	{ 45, 2, { 0, 0, 0, 0 }, { 39583, 74986, 37906, 76663, 36013, 78556, 34168, 80401 } },
+	{ 45, 3, { 0, 0, 0, 0 }, { 34920, 78619, 33418, 80123, 31660, 81885, 29882, 83668 } },
+	{ 45, 4, { 0, 0, 0, 0 }, { 31042, 83195, 29276, 84961, 27087, 87150, 24676, 89562 } },
+	{ 45, 5, { 0, 0, 0, 0 }, { 31462, 83429, 29706, 85183, 27533, 87352, 25147, 89734 } },
+	{ 45, 6, { 0, 0, 0, 0 }, { 35790, 79515, 34286, 81016, 32523, 82775, 30740, 84554 } },
+	{ 45, 7, { 0, 0, 0, 0 }, { 39589, 74996, 37912, 76673, 36019, 78566, 34175, 80410 } },
+	{ 45, 8, { 0, 0, 0, 0 }, { 34909, 78625, 33407, 80130, 31649, 81892, 29870, 83675 } },
+	{ 45, 9, { 0, 0, 0, 0 }, { 31040, 83189, 29274, 84954, 27086, 87143, 24675, 89554 } },
+	{ 45, 10, { 0, 0, 0, 0 }, { 39304, 74950, 37637, 76616, 35754, 78499, 33917, 80336 } },
+	{ 45, 11, { 0, 0, 0, 0 }, { 35784, 79524, 34280, 81025, 32518, 82784, 30734, 84563 } },
+	{ 45, 12, { 0, 0, 0, 0 }, { 39596, 75005, 37919, 76682, 36026, 78574, 34182, 80419 } },
+	{ 45, 13, { 0, 0, 0, 0 }, { 34921, 78625, 33419, 80129, 31661, 81891, 29882, 83674 } },
+	{ 45, 14, { 0, 0, 0, 0 }, { 31032, 83179, 29267, 84944, 27079, 87133, 24669, 89543 } },
+	{ 45, 15, { 0, 0, 0, 0 }, { 31234, 81383, 29576, 83046, 27558, 85071, 25405, 87235 } },
+	{ 45, 16, { 0, 0, 0, 0 }, { 35775, 79531, 34271, 81032, 32508, 82791, 30724, 84571 } },
+	{ 45, 17, { 0, 0, 0, 0 }, { 39600, 75010, 37922, 76687, 36030, 78579, 34185, 80424 } },
+	{ 45, 18, { 0, 0, 0, 0 }, { 34931, 78621, 33429, 80125, 31671, 81887, 29893, 83670 } },
+	{ 45, 19, { 0, 0, 0, 0 }, { 31022, 83167, 29256, 84932, 27069, 87120, 24659, 89530 } },
+	{ 45, 20, { 0, 0, 0, 0 }, { 37309, 76913, 35770, 78451, 34000, 80220, 32244, 81974 } },
+	{ 45, 21, { 0, 0, 0, 0 }, { 35814, 79455, 34310, 80956, 32549, 82713, 30767, 84490 } },
+	{ 45, 22, { 0, 0, 0, 0 }, { 39615, 75030, 37938, 76707, 36046, 78599, 34202, 80443 } },
+	{ 45, 23, { 0, 0, 0, 0 }, { 34855, 78661, 33353, 80165, 31593, 81929, 29813, 83714 } },
+	{ 45, 24, { 0, 0, 0, 0 }, { 31041, 83182, 29276, 84947, 27088, 87135, 24678, 89545 } },
+	{ 45, 25, { 0, 0, 0, 0 }, { 36705, 77724, 35191, 79240, 33439, 80994, 31691, 82744 } },
+	{ 45, 26, { 0, 0, 0, 0 }, { 35800, 79480, 34296, 80981, 32534, 82739, 30752, 84517 } },
+	{ 45, 27, { 0, 0, 0, 0 }, { 39617, 75031, 37940, 76708, 36047, 78600, 34203, 80445 } },
+	{ 45, 28, { 0, 0, 0, 0 }, { 34883, 78651, 33380, 80156, 31621, 81918, 29841, 83703 } },
+	{ 45, 29, { 0, 0, 0, 0 }, { 31030, 83172, 29265, 84937, 27078, 87124, 24668, 89534 } },
+	{ 45, 30, { 0, 0, 0, 0 }, { 33653, 82436, 32047, 84038, 30110, 85967, 28073, 87994 } },
+	{ 45, 31, { 0, 0, 0, 0 }, { 35808, 79464, 34304, 80965, 32543, 82723, 30761, 84500 } },
+	{ 45, 32, { 0, 0, 0, 0 }, { 39621, 75039, 37945, 76716, 36052, 78608, 34208, 80452 } },
+	{ 45, 33, { 0, 0, 0, 0 }, { 34867, 78660, 33365, 80165, 31606, 81928, 29825, 83713 } },
+	{ 45, 34, { 0, 0, 0, 0 }, { 31034, 83172, 29269, 84937, 27081, 87125, 24672, 89534 } },
+	{ 45, 35, { 0, 0, 0, 0 }, { 39475, 75695, 37833, 77338, 35972, 79199, 34152, 81019 } },
+	{ 45, 36, { 0, 0, 0, 0 }, { 35810, 79451, 34307, 80952, 32546, 82709, 30764, 84486 } },
+	{ 45, 37, { 0, 0, 0, 0 }, { 39628, 75047, 37952, 76724, 36060, 78616, 34215, 80460 } },
+	{ 45, 38, { 0, 0, 0, 0 }, { 34857, 78668, 33354, 80172, 31595, 81936, 29814, 83721 } },
+	{ 45, 39, { 0, 0, 0, 0 }, { 31030, 83168, 29265, 84933, 27078, 87120, 24669, 89529 } },
+	{ 45, 40, { 0, 0, 0, 0 }, { 31060, 83196, 29296, 84961, 27108, 87148, 24699, 89556 } },
+	{ 45, 41, { 0, 0, 0, 0 }, { 31402, 83374, 29646, 85128, 27473, 87298, 25087, 89679 } },
+	{ 46, 0, { 0, 0, 0, 0 }, { 38840, 85008, 37453, 86395, 35813, 88033, 34142, 89703 } },
+	{ 46, 1, { 0, 0, 0, 0 }, { 40329, 83952, 39065, 85215, 37592, 86688, 36116, 88162 } },
+	{ 46, 2, { 0, 0, 0, 0 }, { 41203, 82314, 39826, 83691, 38234, 85282, 36653, 86864 } },
+	{ 46, 3, { 0, 0, 0, 0 }, { 39424, 83036, 38160, 84301, 36688, 85774, 35214, 87249 } },
+	{ 46, 4, { 0, 0, 0, 0 }, { 38481, 84705, 37088, 86098, 35442, 87744, 33765, 89422 } },
+	{ 46, 5, { 0, 0, 0, 0 }, { 38840, 85008, 37453, 86395, 35813, 88033, 34142, 89703 } },
+	{ 46, 6, { 0, 0, 0, 0 }, { 40327, 83945, 39063, 85208, 37590, 86681, 36114, 88155 } },
+	{ 46, 7, { 0, 0, 0, 0 }, { 41210, 82323, 39833, 83700, 38242, 85291, 36661, 86872 } },
+	{ 46, 8, { 0, 0, 0, 0 }, { 39419, 83037, 38155, 84301, 36683, 85775, 35209, 87250 } },
+	{ 46, 9, { 0, 0, 0, 0 }, { 38477, 84700, 37085, 86093, 35439, 87738, 33761, 89416 } },
+	{ 46, 10, { 0, 0, 0, 0 }, { 41012, 82194, 39642, 83565, 38058, 85149, 36483, 86724 } },
+	{ 46, 11, { 0, 0, 0, 0 }, { 40326, 83949, 39063, 85212, 37589, 86685, 36114, 88159 } },
+	{ 46, 12, { 0, 0, 0, 0 }, { 41218, 82331, 39840, 83708, 38250, 85299, 36668, 86880 } },
+	{ 46, 13, { 0, 0, 0, 0 }, { 39427, 83041, 38163, 84305, 36691, 85778, 35216, 87253 } },
+	{ 46, 14, { 0, 0, 0, 0 }, { 38469, 84691, 37077, 86084, 35431, 87729, 33753, 89407 } },
+	{ 46, 15, { 0, 0, 0, 0 }, { 37966, 83578, 36624, 84921, 35045, 86502, 33445, 88106 } },
+	{ 46, 16, { 0, 0, 0, 0 }, { 40323, 83950, 39059, 85214, 37585, 86686, 36110, 88160 } },
+	{ 46, 17, { 0, 0, 0, 0 }, { 41222, 82335, 39845, 83712, 38254, 85303, 36673, 86884 } },
+	{ 46, 18, { 0, 0, 0, 0 }, { 39432, 83042, 38168, 84306, 36696, 85779, 35222, 87254 } },
+	{ 46, 19, { 0, 0, 0, 0 }, { 38458, 84679, 37065, 86072, 35420, 87717, 33742, 89395 } },
+	{ 46, 20, { 0, 0, 0, 0 }, { 40415, 82770, 39124, 84061, 37626, 85559, 36133, 87052 } },
+	{ 46, 21, { 0, 0, 0, 0 }, { 40322, 83914, 39058, 85177, 37585, 86649, 36110, 88123 } },
+	{ 46, 22, { 0, 0, 0, 0 }, { 41239, 82354, 39862, 83730, 38271, 85321, 36690, 86902 } },
+	{ 46, 23, { 0, 0, 0, 0 }, { 39396, 83042, 38132, 84306, 36660, 85780, 35185, 87255 } },
+	{ 46, 24, { 0, 0, 0, 0 }, { 38476, 84697, 37084, 86089, 35438, 87734, 33761, 89412 } },
+	{ 46, 25, { 0, 0, 0, 0 }, { 40283, 83071, 39008, 84346, 37527, 85827, 36049, 87305 } },
+	{ 46, 26, { 0, 0, 0, 0 }, { 40321, 83926, 39058, 85189, 37584, 86661, 36109, 88135 } },
+	{ 46, 27, { 0, 0, 0, 0 }, { 41240, 82355, 39863, 83732, 38273, 85323, 36691, 86904 } },
+	{ 46, 28, { 0, 0, 0, 0 }, { 39410, 83044, 38147, 84309, 36674, 85782, 35200, 87258 } },
+	{ 46, 29, { 0, 0, 0, 0 }, { 38465, 84686, 37073, 86078, 35428, 87724, 33750, 89401 } },
+	{ 46, 30, { 0, 0, 0, 0 }, { 39935, 85124, 38621, 86436, 37077, 87978, 35516, 89535 } },
+	{ 46, 31, { 0, 0, 0, 0 }, { 40321, 83918, 39057, 85181, 37584, 86653, 36109, 88127 } },
+	{ 46, 32, { 0, 0, 0, 0 }, { 41246, 82362, 39869, 83738, 38278, 85329, 36697, 86910 } },
+	{ 46, 33, { 0, 0, 0, 0 }, { 39404, 83045, 38140, 84310, 36667, 85783, 35193, 87259 } },
+	{ 46, 34, { 0, 0, 0, 0 }, { 38468, 84688, 37076, 86080, 35430, 87725, 33753, 89402 } },
+	{ 46, 35, { 0, 0, 0, 0 }, { 41380, 82729, 40023, 84085, 38454, 85653, 36895, 87212 } },
+	{ 46, 36, { 0, 0, 0, 0 }, { 40318, 83910, 39054, 85173, 37581, 86646, 36106, 88119 } },
+	{ 46, 37, { 0, 0, 0, 0 }, { 41253, 82369, 39877, 83746, 38286, 85337, 36705, 86918 } },
+	{ 46, 38, { 0, 0, 0, 0 }, { 39399, 83046, 38136, 84311, 36663, 85785, 35188, 87260 } },
+	{ 46, 39, { 0, 0, 0, 0 }, { 38464, 84684, 37072, 86076, 35427, 87721, 33749, 89398 } },
+	{ 46, 40, { 0, 0, 0, 0 }, { 38494, 84713, 37102, 86105, 35457, 87750, 33779, 89427 } },
+	{ 46, 41, { 0, 0, 0, 0 }, { 38782, 84951, 37394, 86338, 35754, 87976, 34083, 89646 } },
+	{ 47, 0, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 1, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 2, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 3, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 4, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 5, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 6, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 7, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 8, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 9, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 10, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 11, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 12, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 13, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 14, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 15, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 16, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 17, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 18, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 19, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 20, { -1, -1, -1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 21, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 22, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 23, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 24, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 25, { -1, -1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 26, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 27, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 28, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 29, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 30, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 31, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 32, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 33, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 34, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 35, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 36, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 37, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 38, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 39, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 40, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 47, 41, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 0, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 1, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 2, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 3, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 4, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 5, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 6, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 7, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 8, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 9, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 10, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 11, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 12, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 13, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 14, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 15, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 16, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 17, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 18, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 19, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 20, { -1, -1, -1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 21, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 22, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 23, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 24, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 25, { -1, -1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 26, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 27, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 28, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 29, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 30, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 31, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 32, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 33, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 34, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 35, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 36, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 37, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 38, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 39, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 40, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 48, 41, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 0, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 1, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 2, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 3, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 4, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 5, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 6, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 7, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 8, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 9, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 10, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 11, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 12, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 13, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 14, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 15, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 16, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 17, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 18, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 19, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 20, { -1, -1, -1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 21, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 22, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 23, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 24, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 25, { -1, -1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 26, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 27, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 28, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 29, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 30, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 31, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 32, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 33, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 34, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 35, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 36, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 37, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 38, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 39, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 40, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 49, 41, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 0, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 1, { 0, 0, 1, 1 }, { 20437, 66604, 12548, 74290, 0, 0, 0, 0 } },
+	{ 50, 2, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29220, 57320 } },
+	{ 50, 3, { 0, 0, 1, 1 }, { 20144, 65626, 12538, 73420, 0, 0, 0, 0 } },
+	{ 50, 4, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 5, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 6, { 0, 0, 1, 1 }, { 20498, 66534, 12629, 74203, 0, 0, 0, 0 } },
+	{ 50, 7, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29211, 57345 } },
+	{ 50, 8, { 0, 0, 1, 1 }, { 20071, 65697, 12447, 73510, 0, 0, 0, 0 } },
+	{ 50, 9, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 10, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28039, 58145 } },
+	{ 50, 11, { 0, 0, 1, 1 }, { 20440, 66595, 12553, 74279, 0, 0, 0, 0 } },
+	{ 50, 12, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29210, 57362 } },
+	{ 50, 13, { 0, 0, 1, 1 }, { 20126, 65651, 12514, 73451, 0, 0, 0, 0 } },
+	{ 50, 14, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 15, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 16, { 0, 0, 1, 1 }, { 20371, 66661, 12464, 74361, 0, 0, 0, 0 } },
+	{ 50, 17, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29208, 57372 } },
+	{ 50, 18, { 0, 0, 1, 1 }, { 20185, 65597, 12586, 73382, 0, 0, 0, 0 } },
+	{ 50, 19, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 20, { -1, 0, 0, 0 }, { 0, 0, 30280, 55776, 21281, 64718, 12396, 73436 } },
+	{ 50, 21, { 0, 0, 1, 1 }, { 20830, 66171, 13056, 73758, 0, 0, 0, 0 } },
+	{ 50, 22, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29211, 57408 } },
+	{ 50, 23, { 0, 0, 1, 1 }, { 19695, 66059, 11980, 73979, 0, 0, 0, 0 } },
+	{ 50, 24, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 25, { 0, 0, 0, 2 }, { 32686, 53875, 24413, 62192, 16021, 70702, 0, 0 } },
+	{ 50, 26, { 0, 0, 1, 1 }, { 20675, 66335, 12858, 73959, 0, 0, 0, 0 } },
+	{ 50, 27, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29213, 57408 } },
+	{ 50, 28, { 0, 0, 1, 1 }, { 19854, 65914, 12178, 73789, 0, 0, 0, 0 } },
+	{ 50, 29, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 30, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 31, { 0, 0, 1, 1 }, { 20771, 66232, 12982, 73833, 0, 0, 0, 0 } },
+	{ 50, 32, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29207, 57427 } },
+	{ 50, 33, { 0, 0, 1, 1 }, { 19750, 66014, 12048, 73919, 0, 0, 0, 0 } },
+	{ 50, 34, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 35, { -1, -1, 0, 0 }, { 0, 0, 0, 0, 38816, 48392, 26411, 60815 } },
+	{ 50, 36, { 0, 0, 1, 1 }, { 20830, 66163, 13058, 73749, 0, 0, 0, 0 } },
+	{ 50, 37, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29211, 57439 } },
+	{ 50, 38, { 0, 0, 1, 1 }, { 19675, 66087, 11953, 74014, 0, 0, 0, 0 } },
+	{ 50, 39, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 40, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 50, 41, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 0, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 1, { 0, 0, 1, 1 }, { -3831, 42639, -11765, 50364, 0, 0, 0, 0 } },
+	{ 51, 2, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 5094, 33198 } },
+	{ 51, 3, { 0, 0, 1, 1 }, { -3822, 41362, -11396, 49118, 0, 0, 0, 0 } },
+	{ 51, 4, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 5, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 6, { 0, 0, 1, 1 }, { -3769, 42569, -11683, 50276, 0, 0, 0, 0 } },
+	{ 51, 7, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 5086, 33223 } },
+	{ 51, 8, { 0, 0, 1, 1 }, { -3896, 41432, -11486, 49207, 0, 0, 0, 0 } },
+	{ 51, 9, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 10, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 3875, 34062 } },
+	{ 51, 11, { 0, 0, 1, 1 }, { -3827, 42630, -11760, 50353, 0, 0, 0, 0 } },
+	{ 51, 12, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 5084, 33240 } },
+	{ 51, 13, { 0, 0, 1, 1 }, { -3840, 41388, -11419, 49149, 0, 0, 0, 0 } },
+	{ 51, 14, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 15, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 16, { 0, 0, 1, 1 }, { -3896, 42696, -11850, 50436, 0, 0, 0, 0 } },
+	{ 51, 17, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 5082, 33250 } },
+	{ 51, 18, { 0, 0, 1, 1 }, { -3781, 41334, -11348, 49081, 0, 0, 0, 0 } },
+	{ 51, 19, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 20, { -1, 0, 0, 0 }, { 0, 0, 6000, 31822, -2965, 40728, -11882, 49474 } },
+	{ 51, 21, { 0, 0, 1, 1 }, { -3437, 42206, -11250, 49827, 0, 0, 0, 0 } },
+	{ 51, 22, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 5088, 33283 } },
+	{ 51, 23, { 0, 0, 1, 1 }, { -4272, 41795, -11949, 49670, 0, 0, 0, 0 } },
+	{ 51, 24, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 25, { 0, 0, 0, 2 }, { 8774, 29556, 439, 37935, -7946, 46436, 0, 0 } },
+	{ 51, 26, { 0, 0, 1, 1 }, { -3592, 42370, -11451, 50029, 0, 0, 0, 0 } },
+	{ 51, 27, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 5089, 33284 } },
+	{ 51, 28, { 0, 0, 1, 1 }, { -4112, 41650, -11752, 49483, 0, 0, 0, 0 } },
+	{ 51, 29, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 30, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 31, { 0, 0, 1, 1 }, { -3496, 42267, -11326, 49902, 0, 0, 0, 0 } },
+	{ 51, 32, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 5084, 33302 } },
+	{ 51, 33, { 0, 0, 1, 1 }, { -4217, 41751, -11882, 49612, 0, 0, 0, 0 } },
+	{ 51, 34, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 35, { -1, -1, 0, 0 }, { 0, 0, 0, 0, 14888, 24077, 2354, 36628 } },
+	{ 51, 36, { 0, 0, 1, 1 }, { -3436, 42198, -11249, 49818, 0, 0, 0, 0 } },
+	{ 51, 37, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 5088, 33314 } },
+	{ 51, 38, { 0, 0, 1, 1 }, { -4291, 41823, -11975, 49706, 0, 0, 0, 0 } },
+	{ 51, 39, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 40, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 51, 41, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 0, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 1, { 0, 0, 1, 1 }, { 56716, 102433, 48892, 110063, 0, 0, 0, 0 } },
+	{ 52, 2, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65288, 93385 } },
+	{ 52, 3, { 0, 0, 1, 1 }, { 55975, 101902, 48316, 109757, 0, 0, 0, 0 } },
+	{ 52, 4, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 5, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 6, { 0, 0, 1, 1 }, { 56778, 102363, 48972, 109978, 0, 0, 0, 0 } },
+	{ 52, 7, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65278, 93411 } },
+	{ 52, 8, { 0, 0, 1, 1 }, { 55901, 101972, 48224, 109848, 0, 0, 0, 0 } },
+	{ 52, 9, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 10, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 64164, 94151 } },
+	{ 52, 11, { 0, 0, 1, 1 }, { 56720, 102424, 48897, 110053, 0, 0, 0, 0 } },
+	{ 52, 12, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65277, 93428 } },
+	{ 52, 13, { 0, 0, 1, 1 }, { 55957, 101927, 48292, 109788, 0, 0, 0, 0 } },
+	{ 52, 14, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 15, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 16, { 0, 0, 1, 1 }, { 56651, 102489, 48810, 110134, 0, 0, 0, 0 } },
+	{ 52, 17, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65276, 93437 } },
+	{ 52, 18, { 0, 0, 1, 1 }, { 56016, 101872, 48365, 109718, 0, 0, 0, 0 } },
+	{ 52, 19, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 20, { -1, 0, 0, 0 }, { 0, 0, 66582, 91586, 57529, 100583, 48688, 109263 } },
+	{ 52, 21, { 0, 0, 1, 1 }, { 57109, 102000, 49392, 109540, 0, 0, 0, 0 } },
+	{ 52, 22, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65274, 93477 } },
+	{ 52, 23, { 0, 0, 1, 1 }, { 55525, 102335, 47749, 110325, 0, 0, 0, 0 } },
+	{ 52, 24, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 25, { 0, 0, 0, 2 }, { 68440, 90226, 60255, 98457, 51851, 106982, 0, 0 } },
+	{ 52, 26, { 0, 0, 1, 1 }, { 56954, 102164, 49197, 109737, 0, 0, 0, 0 } },
+	{ 52, 27, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65277, 93476 } },
+	{ 52, 28, { 0, 0, 1, 1 }, { 55685, 102190, 47951, 110131, 0, 0, 0, 0 } },
+	{ 52, 29, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 30, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 31, { 0, 0, 1, 1 }, { 57051, 102061, 49319, 109613, 0, 0, 0, 0 } },
+	{ 52, 32, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65271, 93496 } },
+	{ 52, 33, { 0, 0, 1, 1 }, { 55580, 102290, 47819, 110264, 0, 0, 0, 0 } },
+	{ 52, 34, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 35, { -1, -1, 0, 0 }, { 0, 0, 0, 0, 74600, 84735, 62376, 96977 } },
+	{ 52, 36, { 0, 0, 1, 1 }, { 57110, 101992, 49393, 109530, 0, 0, 0, 0 } },
+	{ 52, 37, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65273, 93509 } },
+	{ 52, 38, { 0, 0, 1, 1 }, { 55505, 102363, 47723, 110361, 0, 0, 0, 0 } },
+	{ 52, 39, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 40, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 52, 41, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 0, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 1, { 0, 0, 0, 0 }, { 21255, 65940, 17559, 69605, 12778, 74316, 5915, 80855 } },
+	{ 53, 2, { -1, 0, 0, 0 }, { 0, 0, 35894, 50647, 29350, 57191, 24546, 61995 } },
+	{ 53, 3, { 0, 0, 0, 0 }, { 20634, 64988, 16976, 68676, 12299, 73420, 5928, 80075 } },
+	{ 53, 4, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 5, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 6, { 0, 0, 0, 0 }, { 21282, 65904, 17588, 69567, 12814, 74271, 5994, 80776 } },
+	{ 53, 7, { -1, 0, 0, 0 }, { 0, 0, 35887, 50671, 29350, 57208, 24547, 62011 } },
+	{ 53, 8, { 0, 0, 0, 0 }, { 20598, 65020, 16937, 68710, 12254, 73462, 5848, 80159 } },
+	{ 53, 9, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 10, { -1, 0, 0, 0 }, { 0, 0, 34870, 51342, 28671, 57539, 23950, 62257 } },
+	{ 53, 11, { 0, 0, 0, 0 }, { 21255, 65934, 17559, 69599, 12779, 74309, 5921, 80845 } },
+	{ 53, 12, { -1, 0, 0, 0 }, { 0, 0, 35886, 50687, 29353, 57220, 24550, 62022 } },
+	{ 53, 13, { 0, 0, 0, 0 }, { 20628, 65002, 16968, 68690, 12289, 73437, 5907, 80105 } },
+	{ 53, 14, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 15, { 0, 1, 1, 1 }, { 3157, 82044, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 16, { 0, 0, 0, 0 }, { 21221, 65965, 17524, 69632, 12736, 74349, 5834, 80920 } },
+	{ 53, 17, { -1, 0, 0, 0 }, { 0, 0, 35886, 50696, 29354, 57227, 24552, 62029 } },
+	{ 53, 18, { 0, 0, 0, 0 }, { 20658, 64977, 17000, 68665, 12326, 73405, 5971, 80041 } },
+	{ 53, 19, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 20, { 0, 0, 0, 0 }, { 29394, 56748, 25320, 60813, 21011, 65105, 16750, 69340 } },
+	{ 53, 21, { 0, 0, 0, 0 }, { 21432, 65718, 17747, 69374, 13010, 74044, 6393, 80380 } },
+	{ 53, 22, { -1, 0, 0, 0 }, { 0, 0, 35889, 50729, 29364, 57254, 24564, 62054 } },
+	{ 53, 23, { 0, 0, 0, 0 }, { 20411, 65190, 16741, 68889, 12021, 73681, 5425, 80607 } },
+	{ 53, 24, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 25, { 0, 0, 0, 0 }, { 26498, 59986, 22763, 63735, 18550, 67972, 14118, 72450 } },
+	{ 53, 26, { 0, 0, 0, 0 }, { 21360, 65801, 17671, 69460, 12917, 74145, 6210, 80556 } },
+	{ 53, 27, { -1, 0, 0, 0 }, { 0, 0, 35891, 50729, 29366, 57255, 24565, 62055 } },
+	{ 53, 28, { 0, 0, 0, 0 }, { 20493, 65125, 16827, 68820, 12122, 73595, 5607, 80423 } },
+	{ 53, 29, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 30, { 0, 1, 1, 1 }, { 10096, 77723, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 31, { 0, 0, 0, 0 }, { 21405, 65749, 17718, 69406, 12975, 74081, 6325, 80445 } },
+	{ 53, 32, { -1, 0, 0, 0 }, { 0, 0, 35887, 50746, 29366, 57267, 24567, 62067 } },
+	{ 53, 33, { 0, 0, 0, 0 }, { 20441, 65171, 16772, 68870, 12057, 73656, 5488, 80549 } },
+	{ 53, 34, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 35, { -1, 0, 0, 0 }, { 0, 0, 33652, 53522, 28031, 59147, 23477, 63706 } },
+	{ 53, 36, { 0, 0, 0, 0 }, { 21430, 65713, 17745, 69368, 13009, 74037, 6394, 80371 } },
+	{ 53, 37, { -1, 0, 0, 0 }, { 0, 0, 35891, 50758, 29372, 57277, 24573, 62076 } },
+	{ 53, 38, { 0, 0, 0, 0 }, { 20403, 65205, 16733, 68906, 12010, 73700, 5401, 80642 } },
+	{ 53, 39, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 40, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 53, 41, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 0, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 1, { 0, 0, 0, 0 }, { -2933, 41898, -6633, 45567, -11431, 50293, -18393, 56913 } },
+	{ 54, 2, { -1, 0, 0, 0 }, { 0, 0, 11768, 26525, 5226, 33068, 421, 37872 } },
+	{ 54, 3, { 0, 0, 0, 0 }, { -3408, 40801, -7063, 44486, -11726, 49214, -18029, 55788 } },
+	{ 54, 4, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 5, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 6, { 0, 0, 0, 0 }, { -2906, 41861, -6604, 45529, -11395, 50248, -18312, 56832 } },
+	{ 54, 7, { -1, 0, 0, 0 }, { 0, 0, 11762, 26548, 5225, 33084, 422, 37887 } },
+	{ 54, 8, { 0, 0, 0, 0 }, { -3445, 40834, -7102, 44520, -11771, 49256, -18107, 55870 } },
+	{ 54, 9, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 10, { -1, 0, 0, 0 }, { 0, 0, 10713, 27252, 4526, 33437, -191, 38151 } },
+	{ 54, 11, { 0, 0, 0, 0 }, { -2933, 41892, -6633, 45561, -11430, 50286, -18388, 56903 } },
+	{ 54, 12, { -1, 0, 0, 0 }, { 0, 0, 11761, 26564, 5228, 33097, 426, 37899 } },
+	{ 54, 13, { 0, 0, 0, 0 }, { -3415, 40815, -7071, 44500, -11736, 49231, -18049, 55817 } },
+	{ 54, 14, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 15, { 0, 1, 1, 1 }, { -20788, 57713, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 16, { 0, 0, 0, 0 }, { -2967, 41923, -6669, 45594, -11473, 50326, -18478, 56980 } },
+	{ 54, 17, { -1, 0, 0, 0 }, { 0, 0, 11760, 26574, 5229, 33104, 428, 37906 } },
+	{ 54, 18, { 0, 0, 0, 0 }, { -3385, 40791, -7040, 44475, -11699, 49200, -17987, 55756 } },
+	{ 54, 19, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 20, { 0, 0, 0, 0 }, { 5200, 32709, 1137, 36762, -3168, 41051, -7431, 45287 } },
+	{ 54, 21, { 0, 0, 0, 0 }, { -2756, 41676, -6445, 45335, -11198, 50019, -17900, 56426 } },
+	{ 54, 22, { -1, 0, 0, 0 }, { 0, 0, 11766, 26604, 5241, 33130, 440, 37930 } },
+	{ 54, 23, { 0, 0, 0, 0 }, { -3632, 41004, -7297, 44699, -12003, 49475, -18519, 56304 } },
+	{ 54, 24, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 25, { 0, 0, 0, 0 }, { 2456, 35799, -1284, 39553, -5497, 43790, -9921, 48259 } },
+	{ 54, 26, { 0, 0, 0, 0 }, { -2828, 41758, -6521, 45421, -11291, 50121, -18088, 56607 } },
+	{ 54, 27, { -1, 0, 0, 0 }, { 0, 0, 11768, 26605, 5242, 33131, 442, 37931 } },
+	{ 54, 28, { 0, 0, 0, 0 }, { -3550, 40939, -7212, 44630, -11903, 49389, -18342, 56126 } },
+	{ 54, 29, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 30, { 0, 1, 1, 1 }, { -14127, 53701, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 31, { 0, 0, 0, 0 }, { -2783, 41706, -6474, 45367, -11233, 50057, -17970, 56493 } },
+	{ 54, 32, { -1, 0, 0, 0 }, { 0, 0, 11764, 26622, 5242, 33143, 443, 37943 } },
+	{ 54, 33, { 0, 0, 0, 0 }, { -3602, 40985, -7267, 44680, -11967, 49450, -18458, 56248 } },
+	{ 54, 34, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 35, { -1, 0, 0, 0 }, { 0, 0, 9579, 29350, 3943, 34990, -615, 39554 } },
+	{ 54, 36, { 0, 0, 0, 0 }, { -2758, 41670, -6447, 45329, -11199, 50013, -17899, 56417 } },
+	{ 54, 37, { -1, 0, 0, 0 }, { 0, 0, 11768, 26633, 5248, 33153, 449, 37952 } },
+	{ 54, 38, { 0, 0, 0, 0 }, { -3639, 41019, -7306, 44716, -12014, 49494, -18543, 56338 } },
+	{ 54, 39, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 40, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 54, 41, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 0, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 1, { 0, 0, 0, 0 }, { 57416, 101884, 53726, 105544, 48970, 110232, 42246, 116657 } },
+	{ 55, 2, { -1, 0, 0, 0 }, { 0, 0, 71961, 86712, 65417, 93256, 60612, 98061 } },
+	{ 55, 3, { 0, 0, 0, 0 }, { 56579, 101147, 52915, 104841, 48216, 109608, 41736, 116395 } },
+	{ 55, 4, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 5, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 6, { 0, 0, 0, 0 }, { 57444, 101848, 53755, 105506, 49006, 110187, 42320, 116581 } },
+	{ 55, 7, { -1, 0, 0, 0 }, { 0, 0, 71953, 86736, 65416, 93273, 60613, 98076 } },
+	{ 55, 8, { 0, 0, 0, 0 }, { 56542, 101180, 52876, 104875, 48170, 109651, 41653, 116482 } },
+	{ 55, 9, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 10, { -1, 0, 0, 0 }, { 0, 0, 70984, 87357, 64766, 93573, 60041, 98296 } },
+	{ 55, 11, { 0, 0, 0, 0 }, { 57417, 101878, 53727, 105538, 48971, 110225, 42251, 116647 } },
+	{ 55, 12, { -1, 0, 0, 0 }, { 0, 0, 71953, 86752, 65419, 93285, 60617, 98088 } },
+	{ 55, 13, { 0, 0, 0, 0 }, { 56572, 101161, 52907, 104855, 48207, 109625, 41715, 116425 } },
+	{ 55, 14, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 15, { 0, 1, 1, 1 }, { 38944, 118441, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 16, { 0, 0, 0, 0 }, { 57383, 101909, 53692, 105571, 48928, 110264, 42168, 116719 } },
+	{ 55, 17, { -1, 0, 0, 0 }, { 0, 0, 71953, 86760, 65421, 93292, 60619, 98094 } },
+	{ 55, 18, { 0, 0, 0, 0 }, { 56602, 101136, 52939, 104829, 48244, 109593, 41781, 116358 } },
+	{ 55, 19, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 20, { 0, 0, 0, 0 }, { 65564, 92688, 61473, 96770, 57159, 101069, 52901, 105300 } },
+	{ 55, 21, { 0, 0, 0, 0 }, { 57594, 101663, 53914, 105314, 49200, 109962, 42702, 116198 } },
+	{ 55, 22, { -1, 0, 0, 0 }, { 0, 0, 71953, 86797, 65429, 93321, 60628, 98122 } },
+	{ 55, 23, { 0, 0, 0, 0 }, { 56355, 101349, 52680, 105055, 47936, 109872, 41215, 116953 } },
+	{ 55, 24, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 25, { 0, 0, 0, 0 }, { 62442, 96147, 58715, 99888, 54501, 104127, 50056, 108618 } },
+	{ 55, 26, { 0, 0, 0, 0 }, { 57522, 101745, 53838, 105399, 49108, 110062, 42527, 116369 } },
+	{ 55, 27, { -1, 0, 0, 0 }, { 0, 0, 71956, 86797, 65431, 93321, 60631, 98122 } },
+	{ 55, 28, { 0, 0, 0, 0 }, { 56437, 101284, 52766, 104985, 48038, 109785, 41404, 116758 } },
+	{ 55, 29, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 30, { 0, 1, 1, 1 }, { 46307, 113637, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 31, { 0, 0, 0, 0 }, { 57567, 101693, 53885, 105345, 49165, 109999, 42636, 116261 } },
+	{ 55, 32, { -1, 0, 0, 0 }, { 0, 0, 71950, 86815, 65430, 93335, 60631, 98134 } },
+	{ 55, 33, { 0, 0, 0, 0 }, { 56385, 101330, 52711, 105035, 47972, 109846, 41280, 116891 } },
+	{ 55, 34, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 35, { 2, 0, 0, 0 }, { 0, 0, 69640, 89659, 64042, 95261, 59494, 99815 } },
+	{ 55, 36, { 0, 0, 0, 0 }, { 57592, 101657, 53912, 105308, 49199, 109955, 42703, 116190 } },
+	{ 55, 37, { -1, 0, 0, 0 }, { 0, 0, 71954, 86827, 65436, 93345, 60637, 98144 } },
+	{ 55, 38, { 0, 0, 0, 0 }, { 56348, 101364, 52672, 105071, 47925, 109890, 41190, 116990 } },
+	{ 55, 39, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 40, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 55, 41, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 0, { 0, 0, 1, 1 }, { 9738, 77082, 3868, 82857, 0, 0, 0, 0 } },
+	{ 56, 1, { 0, 0, 0, 0 }, { 21525, 65721, 19029, 68205, 16011, 71202, 12714, 74465 } },
+	{ 56, 2, { 0, 0, 0, 0 }, { 32717, 53824, 29253, 57288, 25838, 60704, 22743, 63798 } },
+	{ 56, 3, { 0, 0, 0, 0 }, { 20793, 64780, 18311, 67273, 15321, 70282, 12075, 73561 } },
+	{ 56, 4, { 0, 2, 1, 1 }, { 9093, 77115, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 5, { 0, 0, 1, 1 }, { 9738, 77082, 3868, 82857, 0, 0, 0, 0 } },
+	{ 56, 6, { 0, 0, 0, 0 }, { 21540, 65696, 19045, 68180, 16029, 71176, 12735, 74435 } },
+	{ 56, 7, { 0, 0, 0, 0 }, { 32718, 53840, 29255, 57302, 25841, 60717, 22747, 63810 } },
+	{ 56, 8, { 0, 0, 0, 0 }, { 20769, 64800, 18286, 67293, 15295, 70304, 12046, 73587 } },
+	{ 56, 9, { 0, 2, 1, 1 }, { 9097, 77102, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 10, { 0, 0, 0, 0 }, { 32127, 54092, 28754, 57465, 25388, 60829, 22319, 63897 } },
+	{ 56, 11, { 0, 0, 0, 0 }, { 21524, 65716, 19028, 68200, 16011, 71197, 12713, 74460 } },
+	{ 56, 12, { 0, 0, 0, 0 }, { 32722, 53851, 29260, 57313, 25846, 60727, 22752, 63821 } },
+	{ 56, 13, { 0, 0, 0, 0 }, { 20790, 64790, 18308, 67283, 15317, 70293, 12070, 73573 } },
+	{ 56, 14, { 0, 2, 1, 1 }, { 9094, 77088, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 15, { 0, 0, 2, 1 }, { 11722, 72947, 8047, 76678, 0, 0, 0, 0 } },
+	{ 56, 16, { 0, 0, 0, 0 }, { 21502, 65736, 19006, 68220, 15987, 71219, 12686, 74485 } },
+	{ 56, 17, { 0, 0, 0, 0 }, { 32724, 53858, 29263, 57319, 25849, 60733, 22755, 63826 } },
+	{ 56, 18, { 0, 0, 0, 0 }, { 20810, 64776, 18328, 67269, 15339, 70277, 12095, 73554 } },
+	{ 56, 19, { 0, 2, 1, 1 }, { 9086, 77074, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 20, { 0, 0, 0, 0 }, { 26272, 59897, 23660, 62505, 20739, 65418, 17849, 68298 } },
+	{ 56, 21, { 0, 0, 0, 0 }, { 21628, 65573, 19136, 68054, 16128, 71042, 12853, 74284 } },
+	{ 56, 22, { 0, 0, 0, 0 }, { 32735, 53883, 29275, 57343, 25862, 60756, 22769, 63849 } },
+	{ 56, 23, { 0, 0, 0, 0 }, { 20648, 64903, 18163, 67399, 15162, 70419, 11894, 73723 } },
+	{ 56, 24, { 0, 2, 1, 1 }, { 9107, 77084, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 25, { 0, 0, 0, 0 }, { 24617, 61834, 22105, 64353, 19226, 67241, 16305, 70178 } },
+	{ 56, 26, { 0, 0, 0, 0 }, { 21585, 65627, 19091, 68109, 16080, 71101, 12796, 74351 } },
+	{ 56, 27, { 0, 0, 0, 0 }, { 32736, 53884, 29277, 57344, 25864, 60757, 22771, 63850 } },
+	{ 56, 28, { 0, 0, 0, 0 }, { 20702, 64865, 18218, 67361, 15222, 70377, 11961, 73671 } },
+	{ 56, 29, { 0, 2, 1, 1 }, { 9097, 77074, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 30, { 0, 0, 0, 1 }, { 15328, 72661, 12148, 75804, 7187, 80630, 0, 0 } },
+	{ 56, 31, { 0, 0, 0, 0 }, { 21611, 65593, 19119, 68074, 16109, 71064, 12831, 74308 } },
+	{ 56, 32, { 0, 0, 0, 0 }, { 32737, 53896, 29279, 57354, 25867, 60766, 22774, 63859 } },
+	{ 56, 33, { 0, 0, 0, 0 }, { 20669, 64893, 18184, 67390, 15185, 70408, 11919, 73709 } },
+	{ 56, 34, { 0, 2, 1, 1 }, { 9105, 77070, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 35, { 0, 0, 0, 0 }, { 31677, 55483, 28480, 58681, 25217, 61946, 22201, 64965 } },
+	{ 56, 36, { 0, 0, 0, 0 }, { 21625, 65568, 19133, 68049, 16125, 71037, 12850, 74278 } },
+	{ 56, 37, { 0, 0, 0, 0 }, { 32743, 53905, 29285, 57363, 25873, 60775, 22781, 63868 } },
+	{ 56, 38, { 0, 0, 0, 0 }, { 20645, 64914, 18159, 67411, 15158, 70432, 11889, 73736 } },
+	{ 56, 39, { 0, 2, 1, 1 }, { 9102, 77064, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 40, { 0, 2, 1, 1 }, { 9132, 77089, 0, 0, 0, 0, 0, 0 } },
+	{ 56, 41, { 0, 0, 1, 1 }, { 9675, 77032, 3798, 82820, 0, 0, 0, 0 } },
+	{ 57, 0, { 0, 0, 1, 1 }, { -14407, 52972, -20303, 58774, 0, 0, 0, 0 } },
+	{ 57, 1, { 0, 0, 0, 0 }, { -2636, 41652, -5133, 44136, -8154, 47138, -11461, 50409 } },
+	{ 57, 2, { 0, 0, 0, 0 }, { 8593, 29701, 5129, 33165, 1713, 36580, -1381, 39675 } },
+	{ 57, 3, { 0, 0, 0, 0 }, { -3276, 40620, -5757, 43112, -8744, 46118, -11982, 49389 } },
+	{ 57, 4, { 0, 2, 1, 1 }, { -15033, 52985, 0, 0, 0, 0, 0, 0 } },
+	{ 57, 5, { 0, 0, 1, 1 }, { -14407, 52972, -20303, 58774, 0, 0, 0, 0 } },
+	{ 57, 6, { 0, 0, 0, 0 }, { -2621, 41627, -5117, 44111, -8137, 47111, -11439, 50379 } },
+	{ 57, 7, { 0, 0, 0, 0 }, { 8594, 29717, 5131, 33179, 1717, 36593, -1377, 39687 } },
+	{ 57, 8, { 0, 0, 0, 0 }, { -3300, 40640, -5782, 43133, -8770, 46140, -12012, 49415 } },
+	{ 57, 9, { 0, 2, 1, 1 }, { -15030, 52973, 0, 0, 0, 0, 0, 0 } },
+	{ 57, 10, { 0, 0, 0, 0 }, { 7986, 29986, 4617, 33355, 1253, 36718, -1815, 39785 } },
+	{ 57, 11, { 0, 0, 0, 0 }, { -2637, 41647, -5134, 44132, -8155, 47133, -11461, 50404 } },
+	{ 57, 12, { 0, 0, 0, 0 }, { 8597, 29728, 5136, 33190, 1722, 36604, -1372, 39697 } },
+	{ 57, 13, { 0, 0, 0, 0 }, { -3279, 40630, -5760, 43123, -8748, 46129, -11987, 49401 } },
+	{ 57, 14, { 0, 2, 1, 1 }, { -15032, 52959, 0, 0, 0, 0, 0, 0 } },
+	{ 57, 15, { 0, 0, 2, 1 }, { -12358, 48782, -16019, 52498, 0, 0, 0, 0 } },
+	{ 57, 16, { 0, 0, 0, 0 }, { -2659, 41666, -5156, 44151, -8179, 47154, -11489, 50429 } },
+	{ 57, 17, { 0, 0, 0, 0 }, { 8599, 29735, 5138, 33196, 1724, 36610, -1369, 39703 } },
+	{ 57, 18, { 0, 0, 0, 0 }, { -3259, 40616, -5740, 43108, -8726, 46113, -11962, 49382 } },
+	{ 57, 19, { 0, 2, 1, 1 }, { -15040, 52944, 0, 0, 0, 0, 0, 0 } },
+	{ 57, 20, { 0, 0, 0, 0 }, { 2112, 35824, -498, 38429, -3417, 41340, -6307, 44221 } },
+	{ 57, 21, { 0, 0, 0, 0 }, { -2533, 41504, -5026, 43985, -8038, 46977, -11321, 50227 } },
+	{ 57, 22, { 0, 0, 0, 0 }, { 8611, 29759, 5152, 33219, 1739, 36632, -1354, 39725 } },
+	{ 57, 23, { 0, 0, 0, 0 }, { -3421, 40743, -5905, 43239, -8902, 46255, -12163, 49550 } },
+	{ 57, 24, { 0, 2, 1, 1 }, { -15021, 52956, 0, 0, 0, 0, 0, 0 } },
+	{ 57, 25, { 0, 0, 0, 0 }, { 546, 37676, -1968, 40196, -4846, 43084, -7766, 46019 } },
+	{ 57, 26, { 0, 0, 0, 0 }, { -2576, 41558, -5071, 44041, -8086, 47036, -11378, 50294 } },
+	{ 57, 27, { 0, 0, 0, 0 }, { 8613, 29760, 5153, 33220, 1740, 36633, -1353, 39726 } },
+	{ 57, 28, { 0, 0, 0, 0 }, { -3367, 40706, -5850, 43200, -8843, 46213, -12096, 49499 } },
+	{ 57, 29, { 0, 2, 1, 1 }, { -15029, 52945, 0, 0, 0, 0, 0, 0 } },
+	{ 57, 30, { 0, 0, 0, 1 }, { -8838, 48586, -12028, 51738, -17029, 56600, 0, 0 } },
+	{ 57, 31, { 0, 0, 0, 0 }, { -2550, 41524, -5044, 44006, -8056, 46999, -11343, 50251 } },
+	{ 57, 32, { 0, 0, 0, 0 }, { 8614, 29772, 5155, 33230, 1743, 36642, -1350, 39735 } },
+	{ 57, 33, { 0, 0, 0, 0 }, { -3401, 40734, -5884, 43229, -8880, 46244, -12138, 49536 } },
+	{ 57, 34, { 0, 2, 1, 1 }, { -15022, 52942, 0, 0, 0, 0, 0, 0 } },
+	{ 57, 35, { 0, 0, 0, 0 }, { 7583, 31334, 4382, 34536, 1115, 37805, -1902, 40824 } },
+	{ 57, 36, { 0, 0, 0, 0 }, { -2536, 41499, -5029, 43980, -8040, 46972, -11323, 50221 } },
+	{ 57, 37, { 0, 0, 0, 0 }, { 8620, 29781, 5162, 33239, 1750, 36651, -1343, 39744 } },
+	{ 57, 38, { 0, 0, 0, 0 }, { -3424, 40755, -5909, 43250, -8906, 46267, -12168, 49564 } },
+	{ 57, 39, { 0, 2, 1, 1 }, { -15025, 52936, 0, 0, 0, 0, 0, 0 } },
+	{ 57, 40, { 0, 2, 1, 1 }, { -14997, 52963, 0, 0, 0, 0, 0, 0 } },
+	{ 57, 41, { 0, 0, 1, 1 }, { -14469, 52922, -20371, 58734, 0, 0, 0, 0 } },
+	{ 58, 0, { 0, 0, 1, 1 }, { 45836, 113126, 40005, 118861, 0, 0, 0, 0 } },
+	{ 58, 1, { 0, 0, 0, 0 }, { 57646, 101705, 55152, 104187, 52140, 107180, 48854, 110431 } },
+	{ 58, 2, { 0, 0, 0, 0 }, { 68783, 89889, 65319, 93354, 61904, 96769, 58810, 99863 } },
+	{ 58, 3, { 0, 0, 0, 0 }, { 56777, 100899, 54293, 103394, 51298, 106409, 48041, 109700 } },
+	{ 58, 4, { 0, 2, 1, 1 }, { 45163, 113188, 0, 0, 0, 0, 0, 0 } },
+	{ 58, 5, { 0, 0, 1, 1 }, { 45836, 113126, 40005, 118861, 0, 0, 0, 0 } },
+	{ 58, 6, { 0, 0, 0, 0 }, { 57661, 101681, 55168, 104162, 52157, 107153, 48876, 110401 } },
+	{ 58, 7, { 0, 0, 0, 0 }, { 68784, 89905, 65321, 93368, 61907, 96782, 58813, 99876 } },
+	{ 58, 8, { 0, 0, 0, 0 }, { 56753, 100919, 54269, 103414, 51272, 106431, 48011, 109726 } },
+	{ 58, 9, { 0, 2, 1, 1 }, { 45167, 113175, 0, 0, 0, 0, 0, 0 } },
+	{ 58, 10, { 0, 0, 0, 0 }, { 68217, 90131, 64839, 93509, 61470, 96877, 58400, 99947 } },
+	{ 58, 11, { 0, 0, 0, 0 }, { 57645, 101701, 55151, 104182, 52139, 107175, 48854, 110426 } },
+	{ 58, 12, { 0, 0, 0, 0 }, { 68788, 89917, 65326, 93378, 61912, 96792, 58818, 99886 } },
+	{ 58, 13, { 0, 0, 0, 0 }, { 56774, 100909, 54290, 103404, 51294, 106419, 48036, 109711 } },
+	{ 58, 14, { 0, 2, 1, 1 }, { 45164, 113161, 0, 0, 0, 0, 0, 0 } },
+	{ 58, 15, { 0, 0, 2, 1 }, { 47724, 109074, 44026, 112828, 0, 0, 0, 0 } },
+	{ 58, 16, { 0, 0, 0, 0 }, { 57623, 101720, 55129, 104202, 52116, 107196, 48827, 110450 } },
+	{ 58, 17, { 0, 0, 0, 0 }, { 68790, 89923, 65329, 93384, 61915, 96798, 58821, 99892 } },
+	{ 58, 18, { 0, 0, 0, 0 }, { 56794, 100895, 54311, 103389, 51316, 106403, 48061, 109692 } },
+	{ 58, 19, { 0, 2, 1, 1 }, { 45155, 113147, 0, 0, 0, 0, 0, 0 } },
+	{ 58, 20, { 0, 0, 0, 0 }, { 62392, 95887, 59775, 98500, 56852, 101415, 53963, 104295 } },
+	{ 58, 21, { 0, 0, 0, 0 }, { 57749, 101557, 55258, 104037, 52256, 107020, 48993, 110250 } },
+	{ 58, 22, { 0, 0, 0, 0 }, { 68799, 89950, 65340, 93410, 61927, 96822, 58834, 99915 } },
+	{ 58, 23, { 0, 0, 0, 0 }, { 56631, 101022, 54145, 103520, 51139, 106546, 47859, 109862 } },
+	{ 58, 24, { 0, 2, 1, 1 }, { 45178, 113155, 0, 0, 0, 0, 0, 0 } },
+	{ 58, 25, { 0, 0, 0, 0 }, { 60603, 97952, 58094, 100469, 55215, 103357, 52291, 106296 } },
+	{ 58, 26, { 0, 0, 0, 0 }, { 57706, 101611, 55214, 104092, 52208, 107078, 48936, 110317 } },
+	{ 58, 27, { 0, 0, 0, 0 }, { 68801, 89951, 65342, 93410, 61929, 96823, 58836, 99916 } },
+	{ 58, 28, { 0, 0, 0, 0 }, { 56686, 100984, 54201, 103481, 51199, 106503, 47926, 109810 } },
+	{ 58, 29, { 0, 2, 1, 1 }, { 45168, 113145, 0, 0, 0, 0, 0, 0 } },
+	{ 58, 30, { 0, 0, 0, 1 }, { 51458, 108654, 48292, 111782, 43388, 116556, 0, 0 } },
+	{ 58, 31, { 0, 0, 0, 0 }, { 57732, 101577, 55241, 104057, 52238, 107041, 48971, 110275 } },
+	{ 58, 32, { 0, 0, 0, 0 }, { 68802, 89963, 65344, 93421, 61932, 96833, 58839, 99926 } },
+	{ 58, 33, { 0, 0, 0, 0 }, { 56652, 101012, 54166, 103510, 51162, 106535, 47884, 109848 } },
+	{ 58, 34, { 0, 2, 1, 1 }, { 45176, 113141, 0, 0, 0, 0, 0, 0 } },
+	{ 58, 35, { 0, 0, 0, 0 }, { 67697, 91588, 64508, 94779, 61249, 98039, 58236, 101056 } },
+	{ 58, 36, { 0, 0, 0, 0 }, { 57747, 101552, 55256, 104031, 52254, 107015, 48990, 110245 } },
+	{ 58, 37, { 0, 0, 0, 0 }, { 68807, 89972, 65350, 93430, 61938, 96842, 58845, 99935 } },
+	{ 58, 38, { 0, 0, 0, 0 }, { 56628, 101033, 54141, 103532, 51135, 106558, 47853, 109875 } },
+	{ 58, 39, { 0, 2, 1, 1 }, { 45174, 113135, 0, 0, 0, 0, 0, 0 } },
+	{ 58, 40, { 0, 2, 1, 1 }, { 45206, 113158, 0, 0, 0, 0, 0, 0 } },
+	{ 58, 41, { 0, 0, 1, 1 }, { 45771, 113078, 39931, 118827, 0, 0, 0, 0 } },
+	{ 59, 0, { 0, 0, 0, 2 }, { 14101, 72746, 11462, 75378, 7610, 79210, 0, 0 } },
+	{ 59, 1, { 0, 0, 0, 0 }, { 21658, 65614, 19726, 67540, 17436, 69821, 15058, 72187 } },
+	{ 59, 2, { 0, 0, 0, 0 }, { 28747, 57794, 26440, 60102, 23944, 62598, 21575, 64967 } },
+	{ 59, 3, { 0, 0, 0, 0 }, { 20868, 64679, 18942, 66610, 16664, 68897, 14304, 71269 } },
+	{ 59, 4, { 0, 0, 0, 1 }, { 13606, 72600, 10933, 75273, 6983, 79225, 0, 0 } },
+	{ 59, 5, { 0, 0, 0, 2 }, { 14101, 72746, 11462, 75378, 7610, 79210, 0, 0 } },
+	{ 59, 6, { 0, 0, 0, 0 }, { 21667, 65596, 19736, 67522, 17446, 69802, 15069, 72166 } },
+	{ 59, 7, { 0, 0, 0, 0 }, { 28751, 57806, 26445, 60113, 23949, 62609, 21580, 64978 } },
+	{ 59, 8, { 0, 0, 0, 0 }, { 20850, 64692, 18925, 66624, 16646, 68911, 14285, 71284 } },
+	{ 59, 9, { 0, 0, 0, 1 }, { 13605, 72591, 10934, 75264, 6986, 79212, 0, 0 } },
+	{ 59, 10, { 0, 0, 0, 0 }, { 28350, 57873, 26070, 60152, 23595, 62627, 21239, 64982 } },
+	{ 59, 11, { 0, 0, 0, 0 }, { 21656, 65610, 19725, 67536, 17435, 69817, 15056, 72182 } },
+	{ 59, 12, { 0, 0, 0, 0 }, { 28757, 57816, 26450, 60123, 23955, 62619, 21586, 64987 } },
+	{ 59, 13, { 0, 0, 0, 0 }, { 20867, 64687, 18941, 66618, 16663, 68905, 14303, 71278 } },
+	{ 59, 14, { 0, 0, 0, 1 }, { 13600, 72580, 10929, 75252, 6983, 79199, 0, 0 } },
+	{ 59, 15, { 0, 0, 0, 0 }, { 14716, 69904, 12390, 72244, 9301, 75362, 5231, 79517 } },
+	{ 59, 16, { 0, 0, 0, 0 }, { 21641, 65623, 19709, 67549, 17418, 69831, 15039, 72197 } },
+	{ 59, 17, { 0, 0, 0, 0 }, { 28760, 57822, 26453, 60128, 23958, 62624, 21590, 64992 } },
+	{ 59, 18, { 0, 0, 0, 0 }, { 20882, 64678, 18956, 66609, 16678, 68896, 14319, 71267 } },
+	{ 59, 19, { 0, 0, 0, 1 }, { 13590, 72567, 10919, 75239, 6975, 79185, 0, 0 } },
+	{ 59, 20, { 0, 0, 0, 0 }, { 24714, 61472, 22722, 63461, 20456, 65723, 18212, 67963 } },
+	{ 59, 21, { 0, 0, 0, 0 }, { 21722, 65505, 19791, 67430, 17505, 69707, 15134, 72066 } },
+	{ 59, 22, { 0, 0, 0, 0 }, { 28774, 57844, 26468, 60150, 23973, 62645, 21605, 65013 } },
+	{ 59, 23, { 0, 0, 0, 0 }, { 20764, 64760, 18837, 66693, 16555, 68984, 14188, 71364 } },
+	{ 59, 24, { 0, 0, 0, 1 }, { 13609, 72581, 10939, 75252, 6995, 79195, 0, 0 } },
+	{ 59, 25, { 0, 0, 0, 0 }, { 23630, 62802, 21686, 64750, 19446, 66994, 17198, 69249 } },
+	{ 59, 26, { 0, 0, 0, 0 }, { 21694, 65544, 19763, 67469, 17475, 69748, 15101, 72109 } },
+	{ 59, 27, { 0, 0, 0, 0 }, { 28776, 57845, 26470, 60151, 23974, 62646, 21606, 65014 } },
+	{ 59, 28, { 0, 0, 0, 0 }, { 20805, 64737, 18878, 66669, 16598, 68959, 14233, 71336 } },
+	{ 59, 29, { 0, 0, 0, 1 }, { 13600, 72570, 10929, 75241, 6986, 79185, 0, 0 } },
+	{ 59, 30, { 0, 0, 0, 0 }, { 17632, 70402, 15443, 72579, 12638, 75360, 9286, 78664 } },
+	{ 59, 31, { 0, 0, 0, 0 }, { 21711, 65519, 19780, 67444, 17493, 69722, 15121, 72081 } },
+	{ 59, 32, { 0, 0, 0, 0 }, { 28779, 57854, 26473, 60160, 23978, 62655, 21610, 65023 } },
+	{ 59, 33, { 0, 0, 0, 0 }, { 20780, 64755, 18854, 66688, 16572, 68978, 14206, 71358 } },
+	{ 59, 34, { 0, 0, 0, 1 }, { 13604, 72570, 10934, 75240, 6993, 79181, 0, 0 } },
+	{ 59, 35, { 0, 0, 0, 0 }, { 28289, 58864, 26067, 61087, 23635, 63520, 21307, 65849 } },
+	{ 59, 36, { 0, 0, 0, 0 }, { 21719, 65501, 19788, 67425, 17502, 69703, 15131, 72061 } },
+	{ 59, 37, { 0, 0, 0, 0 }, { 28786, 57863, 26480, 60168, 23985, 62663, 21617, 65031 } },
+	{ 59, 38, { 0, 0, 0, 0 }, { 20763, 64769, 18836, 66702, 16554, 68993, 14187, 71374 } },
+	{ 59, 39, { 0, 0, 0, 1 }, { 13601, 72565, 10931, 75235, 6990, 79176, 0, 0 } },
+	{ 59, 40, { 0, 0, 0, 1 }, { 13631, 72592, 10961, 75261, 7020, 79201, 0, 0 } },
+	{ 59, 41, { 0, 0, 0, 2 }, { 14040, 72692, 11401, 75325, 7547, 79160, 0, 0 } },
+	{ 60, 0, { 0, 0, 0, 2 }, { -10036, 48628, -12677, 51261, -16534, 55099, 0, 0 } },
+	{ 60, 1, { 0, 0, 0, 0 }, { -2488, 41531, -4421, 43457, -6712, 45739, -9094, 48108 } },
+	{ 60, 2, { 0, 0, 0, 0 }, { 4623, 33671, 2316, 35978, -180, 38474, -2549, 40843 } },
+	{ 60, 3, { 0, 0, 0, 0 }, { -3216, 40533, -5141, 42464, -7417, 44750, -9774, 47119 } },
+	{ 60, 4, { 0, 0, 0, 1 }, { -10521, 48471, -13194, 51144, -17143, 55095, 0, 0 } },
+	{ 60, 5, { 0, 0, 0, 2 }, { -10036, 48628, -12677, 51261, -16534, 55099, 0, 0 } },
+	{ 60, 6, { 0, 0, 0, 0 }, { -2479, 41512, -4411, 43439, -6702, 45720, -9082, 48087 } },
+	{ 60, 7, { 0, 0, 0, 0 }, { 4627, 33683, 2320, 35990, -175, 38486, -2544, 40854 } },
+	{ 60, 8, { 0, 0, 0, 0 }, { -3233, 40546, -5158, 42478, -7435, 44764, -9794, 47135 } },
+	{ 60, 9, { 0, 0, 0, 1 }, { -10522, 48463, -13194, 51135, -17140, 55083, 0, 0 } },
+	{ 60, 10, { 0, 0, 0, 0 }, { 4217, 33759, 1939, 36037, -536, 38512, -2891, 40866 } },
+	{ 60, 11, { 0, 0, 0, 0 }, { -2490, 41527, -4422, 43453, -6714, 45735, -9095, 48103 } },
+	{ 60, 12, { 0, 0, 0, 0 }, { 4633, 33693, 2326, 35999, -170, 38495, -2538, 40863 } },
+	{ 60, 13, { 0, 0, 0, 0 }, { -3216, 40542, -5142, 42473, -7419, 44758, -9776, 47128 } },
+	{ 60, 14, { 0, 0, 0, 1 }, { -10527, 48451, -13198, 51123, -17143, 55069, 0, 0 } },
+	{ 60, 15, { 0, 0, 0, 0 }, { -9381, 45756, -11704, 48093, -14785, 51203, -18833, 55334 } },
+	{ 60, 16, { 0, 0, 0, 0 }, { -2505, 41539, -4438, 43466, -6730, 45749, -9113, 48118 } },
+	{ 60, 17, { 0, 0, 0, 0 }, { 4636, 33699, 2329, 36005, -166, 38501, -2535, 40869 } },
+	{ 60, 18, { 0, 0, 0, 0 }, { -3202, 40533, -5127, 42464, -7403, 44749, -9760, 47118 } },
+	{ 60, 19, { 0, 0, 0, 1 }, { -10537, 48438, -13208, 51109, -17151, 55055, 0, 0 } },
+	{ 60, 20, { 0, 0, 0, 0 }, { 568, 37384, -1422, 39372, -3687, 41633, -5931, 43873 } },
+	{ 60, 21, { 0, 0, 0, 0 }, { -2425, 41422, -4356, 43347, -6643, 45625, -9017, 47986 } },
+	{ 60, 22, { 0, 0, 0, 0 }, { 4650, 33720, 2344, 36026, -151, 38521, -2519, 40889 } },
+	{ 60, 23, { 0, 0, 0, 0 }, { -3319, 40615, -5245, 42547, -7526, 44836, -9891, 47214 } },
+	{ 60, 24, { 0, 0, 0, 1 }, { -10518, 48453, -13189, 51124, -17132, 55068, 0, 0 } },
+	{ 60, 25, { 0, 0, 0, 0 }, { -455, 38658, -2400, 40606, -4640, 42851, -6887, 45105 } },
+	{ 60, 26, { 0, 0, 0, 0 }, { -2453, 41461, -4384, 43386, -6673, 45666, -9050, 48030 } },
+	{ 60, 27, { 0, 0, 0, 0 }, { 4652, 33721, 2346, 36027, -149, 38522, -2518, 40890 } },
+	{ 60, 28, { 0, 0, 0, 0 }, { -3278, 40591, -5205, 42523, -7484, 44811, -9846, 47186 } },
+	{ 60, 29, { 0, 0, 0, 1 }, { -10528, 48442, -13198, 51113, -17140, 55056, 0, 0 } },
+	{ 60, 30, { 0, 0, 0, 0 }, { -6518, 46311, -8710, 48490, -11521, 51278, -14887, 54594 } },
+	{ 60, 31, { 0, 0, 0, 0 }, { -2436, 41436, -4367, 43361, -6655, 45640, -9030, 48002 } },
+	{ 60, 32, { 0, 0, 0, 0 }, { 4655, 33730, 2350, 36036, -145, 38531, -2513, 40899 } },
+	{ 60, 33, { 0, 0, 0, 0 }, { -3303, 40610, -5229, 42542, -7509, 44831, -9873, 47208 } },
+	{ 60, 34, { 0, 0, 0, 1 }, { -10523, 48441, -13193, 51111, -17134, 55053, 0, 0 } },
+	{ 60, 35, { 0, 0, 0, 0 }, { 4184, 34726, 1959, 36951, -474, 39385, -2802, 41714 } },
+	{ 60, 36, { 0, 0, 0, 0 }, { -2428, 41417, -4359, 43342, -6646, 45621, -9020, 47982 } },
+	{ 60, 37, { 0, 0, 0, 0 }, { 4662, 33739, 2357, 36044, -138, 38539, -2506, 40907 } },
+	{ 60, 38, { 0, 0, 0, 0 }, { -3320, 40624, -5246, 42556, -7527, 44846, -9892, 47224 } },
+	{ 60, 39, { 0, 0, 0, 1 }, { -10527, 48437, -13196, 51107, -17137, 55048, 0, 0 } },
+	{ 60, 40, { 0, 0, 0, 1 }, { -10498, 48465, -13168, 51134, -17109, 55074, 0, 0 } },
+	{ 60, 41, { 0, 0, 0, 1 }, { -10096, 48573, -12737, 51208, -16596, 55048, 0, 0 } },
+	{ 61, 0, { 0, 0, 0, 2 }, { 50186, 108804, 47550, 111432, 43706, 115256, 0, 0 } },
+	{ 61, 1, { 0, 0, 0, 0 }, { 57758, 101619, 55826, 103545, 53538, 105824, 51164, 108185 } },
+	{ 61, 2, { 0, 0, 0, 0 }, { 64813, 93860, 62506, 96167, 60010, 98663, 57641, 101032 } },
+	{ 61, 3, { 0, 0, 0, 0 }, { 56872, 100777, 54946, 102709, 52666, 104998, 50303, 107374 } },
+	{ 61, 4, { 0, 0, 0, 1 }, { 49677, 108673, 47004, 111346, 43053, 115297, 0, 0 } },
+	{ 61, 5, { 0, 0, 0, 2 }, { 50186, 108804, 47550, 111432, 43706, 115256, 0, 0 } },
+	{ 61, 6, { 0, 0, 0, 0 }, { 57767, 101601, 55836, 103526, 53549, 105805, 51175, 108165 } },
+	{ 61, 7, { 0, 0, 0, 0 }, { 64817, 93872, 62510, 96179, 60014, 98675, 57646, 101043 } },
+	{ 61, 8, { 0, 0, 0, 0 }, { 56855, 100790, 54929, 102722, 52648, 105012, 50284, 107389 } },
+	{ 61, 9, { 0, 0, 0, 1 }, { 49677, 108664, 47005, 111336, 43057, 115285, 0, 0 } },
+	{ 61, 10, { 0, 0, 0, 0 }, { 64429, 93923, 62148, 96204, 59671, 98681, 57315, 101037 } },
+	{ 61, 11, { 0, 0, 0, 0 }, { 57756, 101615, 55825, 103541, 53537, 105820, 51163, 108181 } },
+	{ 61, 12, { 0, 0, 0, 0 }, { 64823, 93882, 62516, 96188, 60020, 98684, 57652, 101052 } },
+	{ 61, 13, { 0, 0, 0, 0 }, { 56871, 100785, 54945, 102717, 52665, 105006, 50301, 107383 } },
+	{ 61, 14, { 0, 0, 0, 1 }, { 49671, 108653, 47000, 111325, 43053, 115272, 0, 0 } },
+	{ 61, 15, { 0, 0, 0, 0 }, { 50742, 106006, 48411, 108352, 45310, 111481, 41205, 115673 } },
+	{ 61, 16, { 0, 0, 0, 0 }, { 57741, 101628, 55810, 103554, 53521, 105833, 51146, 108196 } },
+	{ 61, 17, { 0, 0, 0, 0 }, { 64826, 93887, 62519, 96194, 60024, 98689, 57655, 101058 } },
+	{ 61, 18, { 0, 0, 0, 0 }, { 56886, 100776, 54960, 102708, 52681, 104996, 50318, 107372 } },
+	{ 61, 19, { 0, 0, 0, 1 }, { 49661, 108640, 46990, 111312, 43044, 115258, 0, 0 } },
+	{ 61, 20, { 0, 0, 0, 0 }, { 60812, 97484, 58818, 99475, 56551, 101739, 54307, 103979 } },
+	{ 61, 21, { 0, 0, 0, 0 }, { 57822, 101511, 55892, 103435, 53608, 105710, 51240, 108065 } },
+	{ 61, 22, { 0, 0, 0, 0 }, { 64839, 93910, 62533, 96216, 60038, 98711, 57670, 101079 } },
+	{ 61, 23, { 0, 0, 0, 0 }, { 56769, 100858, 54841, 102791, 52557, 105084, 50186, 107469 } },
+	{ 61, 24, { 0, 0, 0, 1 }, { 49682, 108653, 47011, 111324, 43067, 115267, 0, 0 } },
+	{ 61, 25, { 0, 0, 0, 0 }, { 59637, 98899, 57695, 100845, 55455, 103090, 53206, 105345 } },
+	{ 61, 26, { 0, 0, 0, 0 }, { 57794, 101550, 55863, 103474, 53578, 105751, 51208, 108108 } },
+	{ 61, 27, { 0, 0, 0, 0 }, { 64841, 93911, 62535, 96217, 60040, 98712, 57672, 101080 } },
+	{ 61, 28, { 0, 0, 0, 0 }, { 56809, 100835, 54882, 102768, 52600, 105059, 50231, 107441 } },
+	{ 61, 29, { 0, 0, 0, 1 }, { 49671, 108643, 47001, 111313, 43057, 115256, 0, 0 } },
+	{ 61, 30, { 0, 0, 0, 0 }, { 53737, 106420, 51552, 108591, 48756, 111364, 45424, 114648 } },
+	{ 61, 31, { 0, 0, 0, 0 }, { 57811, 101525, 55881, 103449, 53596, 105725, 51228, 108081 } },
+	{ 61, 32, { 0, 0, 0, 0 }, { 64844, 93920, 62538, 96226, 60043, 98721, 57676, 101089 } },
+	{ 61, 33, { 0, 0, 0, 0 }, { 56785, 100853, 54858, 102786, 52574, 105079, 50204, 107462 } },
+	{ 61, 34, { 0, 0, 0, 1 }, { 49676, 108642, 47006, 111311, 43065, 115253, 0, 0 } },
+	{ 61, 35, { 0, 0, 0, 0 }, { 64327, 94952, 62107, 97172, 59677, 99603, 57351, 101930 } },
+	{ 61, 36, { 0, 0, 0, 0 }, { 57819, 101506, 55889, 103430, 53605, 105706, 51238, 108060 } },
+	{ 61, 37, { 0, 0, 0, 0 }, { 64850, 93929, 62545, 96235, 60050, 98730, 57682, 101097 } },
+	{ 61, 38, { 0, 0, 0, 0 }, { 56768, 100867, 54840, 102800, 52556, 105094, 50185, 107478 } },
+	{ 61, 39, { 0, 0, 0, 1 }, { 49673, 108637, 47003, 111306, 43062, 115247, 0, 0 } },
+	{ 61, 40, { 0, 0, 0, 1 }, { 49704, 108663, 47035, 111331, 43094, 115269, 0, 0 } },
+	{ 61, 41, { 0, 0, 0, 2 }, { 50125, 108751, 47488, 111380, 43642, 115207, 0, 0 } },
+	{ 62, 0, { 0, 0, 0, 0 }, { 16489, 70367, 14536, 72317, 12053, 74796, 9168, 77671 } },
+	{ 62, 1, { 0, 0, 0, 0 }, { 21737, 65552, 20119, 67166, 18219, 69062, 16283, 70991 } },
+	{ 62, 2, { 0, 0, 0, 0 }, { 26487, 60055, 24655, 61887, 22609, 63933, 20628, 65913 } },
+	{ 62, 3, { 0, 0, 0, 0 }, { 20908, 64621, 19294, 66239, 17400, 68138, 15474, 70070 } },
+	{ 62, 4, { 0, 0, 0, 0 }, { 16052, 70153, 14085, 72120, 11578, 74628, 8648, 77558 } },
+	{ 62, 5, { 0, 0, 0, 0 }, { 16489, 70367, 14536, 72317, 12053, 74796, 9168, 77671 } },
+	{ 62, 6, { 0, 0, 0, 0 }, { 21742, 65538, 20125, 67152, 18224, 69048, 16289, 70976 } },
+	{ 62, 7, { 0, 0, 0, 0 }, { 26492, 60066, 24661, 61897, 22615, 63943, 20634, 65923 } },
+	{ 62, 8, { 0, 0, 0, 0 }, { 20896, 64630, 19281, 66247, 17387, 68147, 15460, 70080 } },
+	{ 62, 9, { 0, 0, 0, 0 }, { 16050, 70146, 14084, 72113, 11577, 74620, 8648, 77549 } },
+	{ 62, 10, { 0, 0, 0, 0 }, { 26173, 60052, 24356, 61870, 22322, 63903, 20351, 65875 } },
+	{ 62, 11, { 0, 0, 0, 0 }, { 21735, 65549, 20118, 67163, 18217, 69059, 16281, 70988 } },
+	{ 62, 12, { 0, 0, 0, 0 }, { 26498, 60075, 24667, 61906, 22621, 63952, 20641, 65932 } },
+	{ 62, 13, { 0, 0, 0, 0 }, { 20909, 64628, 19295, 66245, 17400, 68145, 15474, 70077 } },
+	{ 62, 14, { 0, 0, 0, 0 }, { 16043, 70136, 14077, 72102, 11571, 74609, 8643, 77537 } },
+	{ 62, 15, { 0, 0, 0, 0 }, { 16500, 68098, 14681, 69924, 12430, 72186, 9949, 74683 } },
+	{ 62, 16, { 0, 0, 0, 0 }, { 21724, 65557, 20106, 67172, 18205, 69068, 16269, 70997 } },
+	{ 62, 17, { 0, 0, 0, 0 }, { 26502, 60080, 24671, 61911, 22625, 63957, 20645, 65937 } },
+	{ 62, 18, { 0, 0, 0, 0 }, { 20920, 64623, 19306, 66240, 17412, 68139, 15486, 70071 } },
+	{ 62, 19, { 0, 0, 0, 0 }, { 16033, 70123, 14067, 72089, 11561, 74596, 8634, 77524 } },
+	{ 62, 20, { 0, 0, 0, 0 }, { 23713, 62485, 22056, 64141, 20155, 66040, 18270, 67922 } },
+	{ 62, 21, { 0, 0, 0, 0 }, { 21775, 65469, 20158, 67082, 18259, 68977, 16327, 70902 } },
+	{ 62, 22, { 0, 0, 0, 0 }, { 26517, 60101, 24686, 61931, 22641, 63977, 20661, 65957 } },
+	{ 62, 23, { 0, 0, 0, 0 }, { 20832, 64675, 19217, 66293, 17321, 68194, 15391, 70130 } },
+	{ 62, 24, { 0, 0, 0, 0 }, { 16052, 70139, 14086, 72105, 11580, 74611, 8653, 77538 } },
+	{ 62, 25, { 0, 0, 0, 0 }, { 22983, 63436, 21355, 65066, 19474, 66950, 17594, 68833 } },
+	{ 62, 26, { 0, 0, 0, 0 }, { 21757, 65498, 20140, 67112, 18240, 69006, 16307, 70933 } },
+	{ 62, 27, { 0, 0, 0, 0 }, { 26519, 60102, 24688, 61933, 22642, 63978, 20662, 65958 } },
+	{ 62, 28, { 0, 0, 0, 0 }, { 20863, 64661, 19249, 66279, 17353, 68180, 15425, 70115 } },
+	{ 62, 29, { 0, 0, 0, 0 }, { 16041, 70128, 14076, 72094, 11570, 74600, 8643, 77527 } },
+	{ 62, 30, { 0, 0, 0, 0 }, { 19048, 69009, 17296, 70755, 15156, 72885, 12851, 75174 } },
+	{ 62, 31, { 0, 0, 0, 0 }, { 21768, 65479, 20151, 67093, 18252, 68987, 16319, 70914 } },
+	{ 62, 32, { 0, 0, 0, 0 }, { 26523, 60110, 24692, 61941, 22647, 63986, 20667, 65966 } },
+	{ 62, 33, { 0, 0, 0, 0 }, { 20845, 64673, 19231, 66291, 17335, 68192, 15405, 70128 } },
+	{ 62, 34, { 0, 0, 0, 0 }, { 16045, 70128, 14080, 72094, 11574, 74599, 8649, 77525 } },
+	{ 62, 35, { 0, 0, 0, 0 }, { 26288, 60860, 24501, 62648, 22493, 64656, 20541, 66608 } },
+	{ 62, 36, { 0, 0, 0, 0 }, { 21772, 65465, 20155, 67078, 18256, 68972, 16324, 70898 } },
+	{ 62, 37, { 0, 0, 0, 0 }, { 26530, 60118, 24699, 61949, 22654, 63994, 20674, 65974 } },
+	{ 62, 38, { 0, 0, 0, 0 }, { 20833, 64683, 19218, 66301, 17322, 68202, 15392, 70138 } },
+	{ 62, 39, { 0, 0, 0, 0 }, { 16042, 70124, 14077, 72089, 11571, 74595, 8645, 77521 } },
+	{ 62, 40, { 0, 0, 0, 0 }, { 16072, 70152, 14107, 72117, 11601, 74622, 8675, 77547 } },
+	{ 62, 41, { 0, 0, 0, 0 }, { 16430, 70311, 14477, 72262, 11992, 74741, 9107, 77618 } },
+	{ 63, 0, { 0, 0, 0, 0 }, { -7644, 46245, -9598, 48196, -12083, 50676, -14970, 53554 } },
+	{ 63, 1, { 0, 0, 0, 0 }, { -2400, 41460, -4018, 43074, -5919, 44970, -7856, 46901 } },
+	{ 63, 2, { 0, 0, 0, 0 }, { 2363, 35932, 531, 37763, -1515, 39809, -3496, 41790 } },
+	{ 63, 3, { 0, 0, 0, 0 }, { -3184, 40485, -4798, 42102, -6692, 44001, -8617, 45932 } },
+	{ 63, 4, { 0, 0, 0, 0 }, { -8076, 46025, -10042, 47991, -12550, 50499, -15479, 53429 } },
+	{ 63, 5, { 0, 0, 0, 0 }, { -7644, 46245, -9598, 48196, -12083, 50676, -14970, 53554 } },
+	{ 63, 6, { 0, 0, 0, 0 }, { -2395, 41445, -4013, 43059, -5914, 44956, -7850, 46885 } },
+	{ 63, 7, { 0, 0, 0, 0 }, { 2368, 35942, 537, 37774, -1509, 39819, -3490, 41800 } },
+	{ 63, 8, { 0, 0, 0, 0 }, { -3197, 40494, -4811, 42111, -6705, 44010, -8630, 45942 } },
+	{ 63, 9, { 0, 0, 0, 0 }, { -8078, 46018, -10044, 47984, -12551, 50491, -15479, 53420 } },
+	{ 63, 10, { 0, 0, 0, 0 }, { 2044, 35935, 227, 37752, -1806, 39785, -3778, 41756 } },
+	{ 63, 11, { 0, 0, 0, 0 }, { -2402, 41456, -4020, 43070, -5921, 44967, -7858, 46897 } },
+	{ 63, 12, { 0, 0, 0, 0 }, { 2374, 35951, 543, 37783, -1503, 39828, -3483, 41809 } },
+	{ 63, 13, { 0, 0, 0, 0 }, { -3184, 40492, -4797, 42109, -6691, 44008, -8617, 45939 } },
+	{ 63, 14, { 0, 0, 0, 0 }, { -8084, 46007, -10050, 47973, -12556, 50480, -15484, 53408 } },
+	{ 63, 15, { 0, 0, 0, 0 }, { -7605, 43959, -9423, 45782, -11671, 48041, -14147, 50534 } },
+	{ 63, 16, { 0, 0, 0, 0 }, { -2413, 41465, -4031, 43079, -5933, 44976, -7870, 46906 } },
+	{ 63, 17, { 0, 0, 0, 0 }, { 2378, 35957, 547, 37788, -1499, 39834, -3479, 41814 } },
+	{ 63, 18, { 0, 0, 0, 0 }, { -3172, 40487, -4786, 42104, -6680, 44002, -8604, 45933 } },
+	{ 63, 19, { 0, 0, 0, 0 }, { -8095, 45995, -10060, 47961, -12566, 50467, -15493, 53395 } },
+	{ 63, 20, { 0, 0, 0, 0 }, { -424, 38388, -2080, 40043, -3981, 41941, -5865, 43823 } },
+	{ 63, 21, { 0, 0, 0, 0 }, { -2362, 41376, -3979, 42990, -5879, 44885, -7812, 46811 } },
+	{ 63, 22, { 0, 0, 0, 0 }, { 2394, 35977, 563, 37808, -1483, 39853, -3463, 41833 } },
+	{ 63, 23, { 0, 0, 0, 0 }, { -3260, 40539, -4875, 42157, -6770, 44057, -8699, 45992 } },
+	{ 63, 24, { 0, 0, 0, 0 }, { -8076, 46011, -10042, 47976, -12548, 50482, -15474, 53409 } },
+	{ 63, 25, { 0, 0, 0, 0 }, { -1111, 39300, -2740, 40931, -4621, 42815, -6500, 44698 } },
+	{ 63, 26, { 0, 0, 0, 0 }, { -2380, 41405, -3997, 43019, -5898, 44914, -7832, 46843 } },
+	{ 63, 27, { 0, 0, 0, 0 }, { 2395, 35978, 564, 37809, -1481, 39854, -3462, 41835 } },
+	{ 63, 28, { 0, 0, 0, 0 }, { -3229, 40525, -4843, 42143, -6738, 44043, -8666, 45976 } },
+	{ 63, 29, { 0, 0, 0, 0 }, { -8086, 46000, -10052, 47965, -12558, 50471, -15484, 53398 } },
+	{ 63, 30, { 0, 0, 0, 0 }, { -5092, 44908, -6846, 46656, -8989, 48789, -11298, 51082 } },
+	{ 63, 31, { 0, 0, 0, 0 }, { -2369, 41387, -3986, 43000, -5886, 44895, -7820, 46823 } },
+	{ 63, 32, { 0, 0, 0, 0 }, { 2399, 35986, 569, 37817, -1477, 39862, -3457, 41842 } },
+	{ 63, 33, { 0, 0, 0, 0 }, { -3247, 40537, -4861, 42155, -6757, 44055, -8685, 45990 } },
+	{ 63, 34, { 0, 0, 0, 0 }, { -8083, 46000, -10048, 47965, -12553, 50471, -15479, 53397 } },
+	{ 63, 35, { 0, 0, 0, 0 }, { 2177, 36727, 389, 38516, -1620, 40525, -3573, 42478 } },
+	{ 63, 36, { 0, 0, 0, 0 }, { -2365, 41372, -3982, 42985, -5882, 44880, -7815, 46807 } },
+	{ 63, 37, { 0, 0, 0, 0 }, { 2406, 35994, 576, 37825, -1470, 39870, -3450, 41850 } },
+	{ 63, 38, { 0, 0, 0, 0 }, { -3259, 40547, -4874, 42164, -6770, 44065, -8698, 46000 } },
+	{ 63, 39, { 0, 0, 0, 0 }, { -8086, 45996, -10051, 47961, -12557, 50467, -15482, 53392 } },
+	{ 63, 40, { 0, 0, 0, 0 }, { -8057, 46025, -10022, 47990, -12528, 50495, -15453, 53420 } },
+	{ 63, 41, { 0, 0, 0, 0 }, { -7703, 46189, -9657, 48140, -12143, 50621, -15031, 53501 } },
+	{ 64, 0, { 0, 0, 0, 0 }, { 52570, 106429, 50618, 108378, 48136, 110855, 45255, 113726 } },
+	{ 64, 1, { 0, 0, 0, 0 }, { 57823, 101572, 56205, 103185, 54306, 105080, 52372, 107007 } },
+	{ 64, 2, { 0, 0, 0, 0 }, { 62552, 96120, 60721, 97952, 58675, 99998, 56694, 101979 } },
+	{ 64, 3, { 0, 0, 0, 0 }, { 56927, 100705, 55313, 102323, 53417, 104223, 51489, 106158 } },
+	{ 64, 4, { 0, 0, 0, 0 }, { 52124, 106226, 50157, 108193, 47649, 110701, 44719, 113631 } },
+	{ 64, 5, { 0, 0, 0, 0 }, { 52570, 106429, 50618, 108378, 48136, 110855, 45255, 113726 } },
+	{ 64, 6, { 0, 0, 0, 0 }, { 57828, 101557, 56211, 103171, 54311, 105066, 52378, 106992 } },
+	{ 64, 7, { 0, 0, 0, 0 }, { 62558, 96131, 60726, 97963, 58680, 100009, 56700, 101989 } },
+	{ 64, 8, { 0, 0, 0, 0 }, { 56914, 100714, 55300, 102332, 53404, 104232, 51476, 106167 } },
+	{ 64, 9, { 0, 0, 0, 0 }, { 52122, 106219, 50156, 108185, 47648, 110692, 44719, 113622 } },
+	{ 64, 10, { 0, 0, 0, 0 }, { 62248, 96108, 60429, 97926, 58395, 99960, 56423, 101932 } },
+	{ 64, 11, { 0, 0, 0, 0 }, { 57821, 101568, 56204, 103182, 54304, 105077, 52370, 107004 } },
+	{ 64, 12, { 0, 0, 0, 0 }, { 62564, 96140, 60733, 97972, 58687, 100017, 56707, 101998 } },
+	{ 64, 13, { 0, 0, 0, 0 }, { 56927, 100712, 55313, 102330, 53417, 104230, 51489, 106165 } },
+	{ 64, 14, { 0, 0, 0, 0 }, { 52115, 106209, 50149, 108175, 47642, 110682, 44714, 113610 } },
+	{ 64, 15, { 0, 0, 0, 0 }, { 52539, 104188, 50718, 106016, 48462, 108282, 45975, 110786 } },
+	{ 64, 16, { 0, 0, 0, 0 }, { 57810, 101577, 56193, 103191, 54293, 105086, 52358, 107013 } },
+	{ 64, 17, { 0, 0, 0, 0 }, { 62568, 96146, 60736, 97977, 58691, 100022, 56710, 102003 } },
+	{ 64, 18, { 0, 0, 0, 0 }, { 56939, 100707, 55324, 102324, 53429, 104224, 51501, 106159 } },
+	{ 64, 19, { 0, 0, 0, 0 }, { 52104, 106196, 50138, 108162, 47632, 110669, 44704, 113597 } },
+	{ 64, 20, { 0, 0, 0, 0 }, { 59797, 98510, 58139, 100167, 56237, 102067, 54353, 103950 } },
+	{ 64, 21, { 0, 0, 0, 0 }, { 57861, 101488, 56244, 103102, 54347, 104995, 52416, 106919 } },
+	{ 64, 22, { 0, 0, 0, 0 }, { 62582, 96167, 60751, 97997, 58706, 100043, 56726, 102023 } },
+	{ 64, 23, { 0, 0, 0, 0 }, { 56851, 100759, 55236, 102377, 53338, 104280, 51407, 106218 } },
+	{ 64, 24, { 0, 0, 0, 0 }, { 52124, 106211, 50158, 108177, 47652, 110683, 44725, 113609 } },
+	{ 64, 25, { 0, 0, 0, 0 }, { 59003, 99519, 57376, 101148, 55495, 103032, 53616, 104915 } },
+	{ 64, 26, { 0, 0, 0, 0 }, { 57843, 101517, 56226, 103131, 54328, 105025, 52396, 106950 } },
+	{ 64, 27, { 0, 0, 0, 0 }, { 62584, 96168, 60753, 97999, 58708, 100044, 56728, 102024 } },
+	{ 64, 28, { 0, 0, 0, 0 }, { 56882, 100745, 55267, 102363, 53370, 104265, 51440, 106202 } },
+	{ 64, 29, { 0, 0, 0, 0 }, { 52114, 106200, 50148, 108166, 47642, 110672, 44715, 113599 } },
+	{ 64, 30, { 0, 0, 0, 0 }, { 55139, 105040, 53389, 106783, 51252, 108910, 48954, 111193 } },
+	{ 64, 31, { 0, 0, 0, 0 }, { 57854, 101499, 56237, 103112, 54339, 105006, 52408, 106930 } },
+	{ 64, 32, { 0, 0, 0, 0 }, { 62588, 96176, 60758, 98007, 58712, 100052, 56732, 102032 } },
+	{ 64, 33, { 0, 0, 0, 0 }, { 56864, 100757, 55249, 102376, 53352, 104278, 51421, 106215 } },
+	{ 64, 34, { 0, 0, 0, 0 }, { 52117, 106201, 50152, 108166, 47646, 110671, 44720, 113597 } },
+	{ 64, 35, { 0, 0, 0, 0 }, { 62334, 96939, 60548, 98725, 58542, 100732, 56590, 102684 } },
+	{ 64, 36, { 0, 0, 0, 0 }, { 57858, 101484, 56241, 103097, 54343, 104990, 52413, 106914 } },
+	{ 64, 37, { 0, 0, 0, 0 }, { 62595, 96184, 60765, 98015, 58719, 100060, 56739, 102040 } },
+	{ 64, 38, { 0, 0, 0, 0 }, { 56851, 100766, 55236, 102385, 53339, 104287, 51407, 106226 } },
+	{ 64, 39, { 0, 0, 0, 0 }, { 52114, 106196, 50149, 108161, 47643, 110667, 44717, 113592 } },
+	{ 64, 40, { 0, 0, 0, 0 }, { 52145, 106224, 50180, 108188, 47674, 110693, 44749, 113617 } },
+	{ 64, 41, { 0, 0, 0, 0 }, { 52510, 106374, 50558, 108324, 48076, 110801, 45194, 113674 } },
+	{ 65, 0, { 0, 0, 0, 0 }, { 18145, 68716, 16510, 70349, 14518, 72340, 12387, 74467 } },
+	{ 65, 1, { 0, 0, 0, 0 }, { 21788, 65514, 20359, 66941, 18687, 68610, 17001, 70292 } },
+	{ 65, 2, { 0, 0, 0, 0 }, { 24889, 61653, 23309, 63233, 21515, 65027, 19759, 66783 } },
+	{ 65, 3, { 0, 0, 0, 0 }, { 20931, 64586, 19504, 66015, 17836, 67686, 16155, 69370 } },
+	{ 65, 4, { 0, 0, 0, 0 }, { 17743, 68462, 16100, 70105, 14096, 72109, 11949, 74256 } },
+	{ 65, 5, { 0, 0, 0, 0 }, { 18145, 68716, 16510, 70349, 14518, 72340, 12387, 74467 } },
+	{ 65, 6, { 0, 0, 0, 0 }, { 21790, 65502, 20362, 66929, 18690, 68598, 17004, 70280 } },
+	{ 65, 7, { 0, 0, 0, 0 }, { 24895, 61663, 23315, 63242, 21522, 65036, 19765, 66792 } },
+	{ 65, 8, { 0, 0, 0, 0 }, { 20922, 64591, 19495, 66020, 17827, 67691, 16145, 69376 } },
+	{ 65, 9, { 0, 0, 0, 0 }, { 17740, 68456, 16098, 70098, 14093, 72103, 11947, 74249 } },
+	{ 65, 10, { 0, 0, 0, 0 }, { 24629, 61599, 23059, 63169, 21274, 64954, 19525, 66704 } },
+	{ 65, 11, { 0, 0, 0, 0 }, { 21786, 65510, 20357, 66937, 18685, 68606, 16999, 70289 } },
+	{ 65, 12, { 0, 0, 0, 0 }, { 24902, 61672, 23322, 63251, 21529, 65045, 19772, 66801 } },
+	{ 65, 13, { 0, 0, 0, 0 }, { 20933, 64591, 19506, 66021, 17838, 67692, 16156, 69376 } },
+	{ 65, 14, { 0, 0, 0, 0 }, { 17733, 68446, 16090, 70088, 14086, 72092, 11940, 74239 } },
+	{ 65, 15, { 0, 0, 0, 0 }, { 17770, 66815, 16214, 68375, 14342, 70253, 12378, 72224 } },
+	{ 65, 16, { 0, 0, 0, 0 }, { 21778, 65516, 20349, 66943, 18677, 68612, 16991, 70295 } },
+	{ 65, 17, { 0, 0, 0, 0 }, { 24905, 61677, 23326, 63256, 21533, 65049, 19776, 66806 } },
+	{ 65, 18, { 0, 0, 0, 0 }, { 20942, 64589, 19515, 66018, 17847, 67689, 16166, 69373 } },
+	{ 65, 19, { 0, 0, 0, 0 }, { 17722, 68434, 16080, 70076, 14076, 72080, 11930, 74226 } },
+	{ 65, 20, { 0, 0, 0, 0 }, { 22970, 63236, 21511, 64696, 19827, 66378, 18156, 68048 } },
+	{ 65, 21, { 0, 0, 0, 0 }, { 21808, 65449, 20379, 66876, 18708, 68544, 17024, 70225 } },
+	{ 65, 22, { 0, 0, 0, 0 }, { 24922, 61696, 23342, 63275, 21549, 65069, 19793, 66825 } },
+	{ 65, 23, { 0, 0, 0, 0 }, { 20876, 64619, 19448, 66049, 17779, 67721, 16096, 69407 } },
+	{ 65, 24, { 0, 0, 0, 0 }, { 17741, 68450, 16098, 70092, 14095, 72096, 11949, 74242 } },
+	{ 65, 25, { 0, 0, 0, 0 }, { 22497, 63911, 21058, 65351, 19392, 67019, 17730, 68683 } },
+	{ 65, 26, { 0, 0, 0, 0 }, { 21797, 65471, 20368, 66898, 18697, 68566, 17012, 70248 } },
+	{ 65, 27, { 0, 0, 0, 0 }, { 24923, 61697, 23344, 63277, 21551, 65070, 19794, 66826 } },
+	{ 65, 28, { 0, 0, 0, 0 }, { 20900, 64612, 19472, 66042, 17804, 67713, 16121, 69399 } },
+	{ 65, 29, { 0, 0, 0, 0 }, { 17730, 68439, 16088, 70081, 14084, 72085, 11939, 74231 } },
+	{ 65, 30, { 0, 0, 0, 0 }, { 20067, 68004, 18553, 69515, 16742, 71320, 14862, 73193 } },
+	{ 65, 31, { 0, 0, 0, 0 }, { 21803, 65457, 20374, 66884, 18703, 68552, 17019, 70233 } },
+	{ 65, 32, { 0, 0, 0, 0 }, { 24928, 61705, 23349, 63284, 21556, 65077, 19800, 66833 } },
+	{ 65, 33, { 0, 0, 0, 0 }, { 20886, 64620, 19459, 66049, 17790, 67721, 16107, 69407 } },
+	{ 65, 34, { 0, 0, 0, 0 }, { 17733, 68440, 16091, 70082, 14088, 72086, 11942, 74231 } },
+	{ 65, 35, { 0, 0, 0, 0 }, { 24857, 62287, 23306, 63838, 21540, 65603, 19807, 67337 } },
+	{ 65, 36, { 0, 0, 0, 0 }, { 21804, 65445, 20376, 66872, 18705, 68540, 17020, 70221 } },
+	{ 65, 37, { 0, 0, 0, 0 }, { 24935, 61713, 23356, 63292, 21563, 65085, 19807, 66841 } },
+	{ 65, 38, { 0, 0, 0, 0 }, { 20877, 64626, 19450, 66055, 17781, 67727, 16098, 69414 } },
+	{ 65, 39, { 0, 0, 0, 0 }, { 17730, 68436, 16088, 70078, 14084, 72081, 11939, 74227 } },
+	{ 65, 40, { 0, 0, 0, 0 }, { 17760, 68465, 16118, 70107, 14114, 72110, 11969, 74255 } },
+	{ 65, 41, { 0, 0, 0, 0 }, { 18086, 68660, 16451, 70293, 14458, 72284, 12328, 74411 } },
+	{ 66, 0, { 0, 0, 0, 0 }, { -5986, 44592, -7622, 46226, -9615, 48217, -11746, 50345 } },
+	{ 66, 1, { 0, 0, 0, 0 }, { -2342, 41414, -3771, 42841, -5443, 44510, -7130, 46194 } },
+	{ 66, 2, { 0, 0, 0, 0 }, { 765, 37530, -815, 39109, -2609, 40903, -4365, 42660 } },
+	{ 66, 3, { 0, 0, 0, 0 }, { -3168, 40456, -4595, 41885, -6263, 43556, -7943, 45240 } },
+	{ 66, 4, { 0, 0, 0, 0 }, { -6385, 44333, -8028, 45976, -10032, 47981, -12179, 50128 } },
+	{ 66, 5, { 0, 0, 0, 0 }, { -5986, 44592, -7622, 46226, -9615, 48217, -11746, 50345 } },
+	{ 66, 6, { 0, 0, 0, 0 }, { -2340, 41403, -3769, 42830, -5441, 44499, -7128, 46182 } },
+	{ 66, 7, { 0, 0, 0, 0 }, { 771, 37539, -808, 39119, -2602, 40912, -4358, 42669 } },
+	{ 66, 8, { 0, 0, 0, 0 }, { -3177, 40462, -4604, 41891, -6272, 43561, -7953, 45246 } },
+	{ 66, 9, { 0, 0, 0, 0 }, { -6388, 44327, -8030, 45970, -10034, 47974, -12181, 50121 } },
+	{ 66, 10, { 0, 0, 0, 0 }, { 502, 37480, -1068, 39050, -2853, 40835, -4602, 42584 } },
+	{ 66, 11, { 0, 0, 0, 0 }, { -2344, 41411, -3773, 42838, -5446, 44507, -7132, 46190 } },
+	{ 66, 12, { 0, 0, 0, 0 }, { 778, 37548, -802, 39127, -2595, 40921, -4351, 42677 } },
+	{ 66, 13, { 0, 0, 0, 0 }, { -3166, 40462, -4593, 41891, -6261, 43562, -7942, 45246 } },
+	{ 66, 14, { 0, 0, 0, 0 }, { -6395, 44317, -8037, 45960, -10041, 47964, -12187, 50110 } },
+	{ 66, 15, { 0, 0, 0, 0 }, { -6341, 42681, -7896, 44240, -9767, 46116, -11729, 48085 } },
+	{ 66, 16, { 0, 0, 0, 0 }, { -2352, 41416, -3781, 42843, -5454, 44513, -7141, 46196 } },
+	{ 66, 17, { 0, 0, 0, 0 }, { 782, 37553, -798, 39132, -2591, 40926, -4347, 42682 } },
+	{ 66, 18, { 0, 0, 0, 0 }, { -3157, 40459, -4584, 41888, -6252, 43559, -7933, 45243 } },
+	{ 66, 19, { 0, 0, 0, 0 }, { -6406, 44305, -8048, 45947, -10052, 47951, -12198, 50098 } },
+	{ 66, 20, { 0, 0, 0, 0 }, { -1160, 39133, -2619, 40592, -4302, 42274, -5973, 43943 } },
+	{ 66, 21, { 0, 0, 0, 0 }, { -2323, 41350, -3752, 42776, -5423, 44445, -7108, 46126 } },
+	{ 66, 22, { 0, 0, 0, 0 }, { 798, 37572, -781, 39151, -2575, 40945, -4331, 42701 } },
+	{ 66, 23, { 0, 0, 0, 0 }, { -3223, 40490, -4651, 41919, -6320, 43591, -8002, 45277 } },
+	{ 66, 24, { 0, 0, 0, 0 }, { -6388, 44322, -8030, 45964, -10033, 47968, -12179, 50114 } },
+	{ 66, 25, { 0, 0, 0, 0 }, { -1603, 39782, -3043, 41223, -4710, 42891, -6371, 44554 } },
+	{ 66, 26, { 0, 0, 0, 0 }, { -2334, 41371, -3762, 42798, -5434, 44467, -7120, 46149 } },
+	{ 66, 27, { 0, 0, 0, 0 }, { 799, 37574, -780, 39153, -2573, 40946, -4329, 42702 } },
+	{ 66, 28, { 0, 0, 0, 0 }, { -3199, 40483, -4627, 41912, -6295, 43584, -7977, 45269 } },
+	{ 66, 29, { 0, 0, 0, 0 }, { -6398, 44311, -8040, 45953, -10044, 47957, -12189, 50103 } },
+	{ 66, 30, { 0, 0, 0, 0 }, { -4067, 43897, -5582, 45409, -7395, 47216, -9277, 49090 } },
+	{ 66, 31, { 0, 0, 0, 0 }, { -2327, 41357, -3756, 42784, -5427, 44452, -7113, 46134 } },
+	{ 66, 32, { 0, 0, 0, 0 }, { 804, 37581, -775, 39160, -2568, 40953, -4324, 42709 } },
+	{ 66, 33, { 0, 0, 0, 0 }, { -3213, 40491, -4640, 41920, -6309, 43591, -7991, 45277 } },
+	{ 66, 34, { 0, 0, 0, 0 }, { -6395, 44312, -8037, 45954, -10040, 47957, -12186, 50103 } },
+	{ 66, 35, { 0, 0, 0, 0 }, { 742, 38158, -809, 39709, -2575, 41476, -4309, 43210 } },
+	{ 66, 36, { 0, 0, 0, 0 }, { -2326, 41345, -3755, 42772, -5426, 44440, -7111, 46122 } },
+	{ 66, 37, { 0, 0, 0, 0 }, { 812, 37589, -767, 39168, -2561, 40961, -4317, 42717 } },
+	{ 66, 38, { 0, 0, 0, 0 }, { -3222, 40496, -4649, 41926, -6318, 43598, -8000, 45284 } },
+	{ 66, 39, { 0, 0, 0, 0 }, { -6398, 44308, -8040, 45950, -10044, 47953, -12189, 50099 } },
+	{ 66, 40, { 0, 0, 0, 0 }, { -6369, 44337, -8011, 45979, -10014, 47982, -12160, 50127 } },
+	{ 66, 41, { 0, 0, 0, 0 }, { -6045, 44535, -7681, 46169, -9674, 48161, -11806, 50289 } },
+	{ 67, 0, { 0, 0, 0, 0 }, { 54223, 104781, 52589, 106414, 50597, 108403, 48468, 110529 } },
+	{ 67, 1, { 0, 0, 0, 0 }, { 57864, 101543, 56435, 102970, 54763, 104638, 53078, 106320 } },
+	{ 67, 2, { 0, 0, 0, 0 }, { 60954, 97719, 59375, 99298, 57581, 101092, 55824, 102849 } },
+	{ 67, 3, { 0, 0, 0, 0 }, { 56960, 100660, 55533, 102089, 53864, 103760, 52182, 105446 } },
+	{ 67, 4, { 0, 0, 0, 0 }, { 53815, 104535, 52172, 106177, 50168, 108182, 48021, 110329 } },
+	{ 67, 5, { 0, 0, 0, 0 }, { 54223, 104781, 52589, 106414, 50597, 108403, 48468, 110529 } },
+	{ 67, 6, { 0, 0, 0, 0 }, { 57866, 101532, 56437, 102959, 54766, 104627, 53081, 106308 } },
+	{ 67, 7, { 0, 0, 0, 0 }, { 60960, 97728, 59381, 99308, 57587, 101102, 55831, 102858 } },
+	{ 67, 8, { 0, 0, 0, 0 }, { 56951, 100665, 55524, 102094, 53855, 103766, 52172, 105452 } },
+	{ 67, 9, { 0, 0, 0, 0 }, { 53812, 104528, 52170, 106171, 50165, 108175, 48019, 110322 } },
+	{ 67, 10, { 0, 0, 0, 0 }, { 60700, 97658, 59129, 99229, 57344, 101014, 55594, 102764 } },
+	{ 67, 11, { 0, 0, 0, 0 }, { 57861, 101540, 56433, 102967, 54761, 104635, 53076, 106317 } },
+	{ 67, 12, { 0, 0, 0, 0 }, { 60967, 97737, 59388, 99316, 57594, 101110, 55838, 102866 } },
+	{ 67, 13, { 0, 0, 0, 0 }, { 56962, 100665, 55534, 102095, 53866, 103766, 52184, 105452 } },
+	{ 67, 14, { 0, 0, 0, 0 }, { 53805, 104519, 52162, 106161, 50158, 108165, 48012, 110312 } },
+	{ 67, 15, { 0, 0, 0, 0 }, { 53817, 102897, 52260, 104458, 50385, 106338, 48418, 108312 } },
+	{ 67, 16, { 0, 0, 0, 0 }, { 57854, 101546, 56425, 102972, 54753, 104641, 53068, 106323 } },
+	{ 67, 17, { 0, 0, 0, 0 }, { 60971, 97742, 59392, 99321, 57598, 101115, 55842, 102871 } },
+	{ 67, 18, { 0, 0, 0, 0 }, { 56970, 100663, 55543, 102092, 53875, 103763, 52193, 105449 } },
+	{ 67, 19, { 0, 0, 0, 0 }, { 53794, 104506, 52151, 106149, 50147, 108153, 48001, 110299 } },
+	{ 67, 20, { 0, 0, 0, 0 }, { 59046, 99271, 57585, 100731, 55901, 102414, 54230, 104085 } },
+	{ 67, 21, { 0, 0, 0, 0 }, { 57883, 101479, 56455, 102905, 54784, 104573, 53101, 106253 } },
+	{ 67, 22, { 0, 0, 0, 0 }, { 60987, 97762, 59408, 99341, 57614, 101134, 55858, 102890 } },
+	{ 67, 23, { 0, 0, 0, 0 }, { 56904, 100693, 55477, 102123, 53807, 103795, 52123, 105483 } },
+	{ 67, 24, { 0, 0, 0, 0 }, { 53813, 104522, 52171, 106164, 50167, 108168, 48021, 110314 } },
+	{ 67, 25, { 0, 0, 0, 0 }, { 58528, 99985, 57089, 101424, 55423, 103092, 53761, 104755 } },
+	{ 67, 26, { 0, 0, 0, 0 }, { 57872, 101501, 56444, 102927, 54773, 104595, 53089, 106276 } },
+	{ 67, 27, { 0, 0, 0, 0 }, { 60988, 97763, 59409, 99342, 57616, 101136, 55860, 102892 } },
+	{ 67, 28, { 0, 0, 0, 0 }, { 56928, 100686, 55501, 102116, 53832, 103788, 52148, 105475 } },
+	{ 67, 29, { 0, 0, 0, 0 }, { 53802, 104512, 52160, 106154, 50156, 108158, 48011, 110303 } },
+	{ 67, 30, { 0, 0, 0, 0 }, { 56148, 104045, 54635, 105554, 52827, 107357, 50950, 109227 } },
+	{ 67, 31, { 0, 0, 0, 0 }, { 57879, 101487, 56450, 102913, 54780, 104581, 53096, 106261 } },
+	{ 67, 32, { 0, 0, 0, 0 }, { 60993, 97771, 59414, 99350, 57621, 101143, 55865, 102899 } },
+	{ 67, 33, { 0, 0, 0, 0 }, { 56915, 100694, 55488, 102123, 53818, 103796, 52134, 105483 } },
+	{ 67, 34, { 0, 0, 0, 0 }, { 53806, 104512, 52164, 106154, 50160, 108158, 48015, 110303 } },
+	{ 67, 35, { 0, 0, 0, 0 }, { 60908, 98361, 59359, 99910, 57594, 101675, 55861, 103408 } },
+	{ 67, 36, { 0, 0, 0, 0 }, { 57880, 101475, 56451, 102901, 54781, 104569, 53097, 106249 } },
+	{ 67, 37, { 0, 0, 0, 0 }, { 61000, 97779, 59421, 99358, 57628, 101151, 55872, 102907 } },
+	{ 67, 38, { 0, 0, 0, 0 }, { 56906, 100699, 55478, 102129, 53809, 103802, 52125, 105489 } },
+	{ 67, 39, { 0, 0, 0, 0 }, { 53802, 104508, 52160, 106150, 50157, 108154, 48011, 110299 } },
+	{ 67, 40, { 0, 0, 0, 0 }, { 53833, 104536, 52191, 106178, 50187, 108181, 48042, 110326 } },
+	{ 67, 41, { 0, 0, 0, 0 }, { 54164, 104726, 52529, 106359, 50537, 108348, 48408, 110474 } },
+	{ 68, 0, { 0, 0, 0, 0 }, { 19447, 67417, 17983, 68880, 16235, 70627, 14428, 72433 } },
+	{ 68, 1, { 0, 0, 0, 0 }, { 21824, 65489, 20508, 66803, 18972, 68338, 17430, 69877 } },
+	{ 68, 2, { 0, 0, 0, 0 }, { 23612, 62930, 22173, 64369, 20522, 66020, 18892, 67650 } },
+	{ 68, 3, { 0, 0, 0, 0 }, { 20944, 64563, 19629, 65879, 18095, 67415, 16556, 68955 } },
+	{ 68, 4, { 0, 0, 0, 0 }, { 19071, 67134, 17602, 68603, 15846, 70358, 14029, 72176 } },
+	{ 68, 5, { 0, 0, 0, 0 }, { 19447, 67417, 17983, 68880, 16235, 70627, 14428, 72433 } },
+	{ 68, 6, { 0, 0, 0, 0 }, { 21823, 65480, 20507, 66795, 18971, 68329, 17430, 69868 } },
+	{ 68, 7, { 0, 0, 0, 0 }, { 23619, 62939, 22180, 64378, 20529, 66029, 18899, 67659 } },
+	{ 68, 8, { 0, 0, 0, 0 }, { 20937, 64566, 19622, 65882, 18088, 67418, 16549, 68958 } },
+	{ 68, 9, { 0, 0, 0, 0 }, { 19068, 67128, 17598, 68597, 15843, 70353, 14026, 72170 } },
+	{ 68, 10, { 0, 0, 0, 0 }, { 23393, 62838, 21962, 64269, 20318, 65913, 18694, 67537 } },
+	{ 68, 11, { 0, 0, 0, 0 }, { 21821, 65486, 20505, 66800, 18969, 68335, 17428, 69874 } },
+	{ 68, 12, { 0, 0, 0, 0 }, { 23626, 62948, 22187, 64386, 20537, 66037, 18906, 67667 } },
+	{ 68, 13, { 0, 0, 0, 0 }, { 20946, 64568, 19631, 65884, 18097, 67420, 16559, 68960 } },
+	{ 68, 14, { 0, 0, 0, 0 }, { 19060, 67119, 17591, 68588, 15836, 70343, 14019, 72160 } },
+	{ 68, 15, { 0, 0, 0, 0 }, { 18780, 65796, 17372, 67207, 15702, 68880, 13991, 70595 } },
+	{ 68, 16, { 0, 0, 0, 0 }, { 21816, 65489, 20500, 66803, 18964, 68338, 17422, 69877 } },
+	{ 68, 17, { 0, 0, 0, 0 }, { 23630, 62952, 22191, 64391, 20541, 66041, 18910, 67672 } },
+	{ 68, 18, { 0, 0, 0, 0 }, { 20953, 64568, 19638, 65884, 18104, 67419, 16565, 68960 } },
+	{ 68, 19, { 0, 0, 0, 0 }, { 19049, 67107, 17580, 68576, 15825, 70331, 14008, 72148 } },
+	{ 68, 20, { 0, 0, 0, 0 }, { 22362, 63853, 21019, 65196, 19464, 66750, 17918, 68296 } },
+	{ 68, 21, { 0, 0, 0, 0 }, { 21827, 65440, 20512, 66754, 18976, 68288, 17436, 69827 } },
+	{ 68, 22, { 0, 0, 0, 0 }, { 23647, 62971, 22208, 64409, 20558, 66060, 18927, 67690 } },
+	{ 68, 23, { 0, 0, 0, 0 }, { 20904, 64580, 19589, 65897, 18055, 67433, 16515, 68974 } },
+	{ 68, 24, { 0, 0, 0, 0 }, { 19067, 67124, 17598, 68593, 15843, 70348, 14026, 72164 } },
+	{ 68, 25, { 0, 0, 0, 0 }, { 22095, 64304, 20769, 65631, 19230, 67170, 17696, 68705 } },
+	{ 68, 26, { 0, 0, 0, 0 }, { 21823, 65456, 20507, 66770, 18971, 68304, 17430, 69843 } },
+	{ 68, 27, { 0, 0, 0, 0 }, { 23648, 62972, 22210, 64411, 20559, 66061, 18929, 67692 } },
+	{ 68, 28, { 0, 0, 0, 0 }, { 20923, 64579, 19608, 65895, 18073, 67431, 16534, 68972 } },
+	{ 68, 29, { 0, 0, 0, 0 }, { 19056, 67113, 17587, 68582, 15833, 70337, 14016, 72153 } },
+	{ 68, 30, { 0, 0, 0, 0 }, { 20880, 67202, 19503, 68577, 17875, 70201, 16215, 71857 } },
+	{ 68, 31, { 0, 0, 0, 0 }, { 21825, 65445, 20509, 66760, 18974, 68294, 17433, 69832 } },
+	{ 68, 32, { 0, 0, 0, 0 }, { 23653, 62979, 22215, 64418, 20565, 66068, 18934, 67698 } },
+	{ 68, 33, { 0, 0, 0, 0 }, { 20913, 64583, 19598, 65899, 18064, 67435, 16525, 68976 } },
+	{ 68, 34, { 0, 0, 0, 0 }, { 19059, 67114, 17590, 68583, 15836, 70338, 14019, 72154 } },
+	{ 68, 35, { 0, 0, 0, 0 }, { 23706, 63434, 22290, 64850, 20662, 66477, 19053, 68086 } },
+	{ 68, 36, { 0, 0, 0, 0 }, { 21824, 65436, 20508, 66750, 18973, 68284, 17432, 69822 } },
+	{ 68, 37, { 0, 0, 0, 0 }, { 23661, 62987, 22223, 64425, 20572, 66076, 18942, 67706 } },
+	{ 68, 38, { 0, 0, 0, 0 }, { 20907, 64586, 19592, 65902, 18057, 67438, 16518, 68980 } },
+	{ 68, 39, { 0, 0, 0, 0 }, { 19056, 67110, 17587, 68579, 15832, 70334, 14016, 72150 } },
+	{ 68, 40, { 0, 0, 0, 0 }, { 19085, 67139, 17617, 68608, 15862, 70363, 14046, 72179 } },
+	{ 68, 41, { 0, 0, 0, 0 }, { 19389, 67361, 17925, 68824, 16177, 70570, 14369, 72377 } },
+	{ 69, 0, { 0, 0, 0, 0 }, { -4683, 43292, -6147, 44755, -7896, 46502, -9704, 48309 } },
+	{ 69, 1, { 0, 0, 0, 0 }, { -2301, 41383, -3617, 42698, -5153, 44233, -6695, 45772 } },
+	{ 69, 2, { 0, 0, 0, 0 }, { -512, 38807, -1951, 40245, -3602, 41896, -5232, 43527 } },
+	{ 69, 3, { 0, 0, 0, 0 }, { -3161, 40439, -4476, 41756, -6010, 43291, -7548, 44831 } },
+	{ 69, 4, { 0, 0, 0, 0 }, { -5057, 43005, -6526, 44474, -8282, 46230, -10099, 48047 } },
+	{ 69, 5, { 0, 0, 0, 0 }, { -4683, 43292, -6147, 44755, -7896, 46502, -9704, 48309 } },
+	{ 69, 6, { 0, 0, 0, 0 }, { -2301, 41375, -3617, 42689, -5153, 44224, -6695, 45763 } },
+	{ 69, 7, { 0, 0, 0, 0 }, { -505, 38816, -1944, 40254, -3594, 41905, -5225, 43536 } },
+	{ 69, 8, { 0, 0, 0, 0 }, { -3168, 40442, -4483, 41758, -6016, 43294, -7555, 44834 } },
+	{ 69, 9, { 0, 0, 0, 0 }, { -5061, 43000, -6530, 44469, -8285, 46224, -10102, 48041 } },
+	{ 69, 10, { 0, 0, 0, 0 }, { -733, 38717, -2164, 40148, -3807, 41791, -5430, 43415 } },
+	{ 69, 11, { 0, 0, 0, 0 }, { -2304, 41380, -3620, 42695, -5156, 44229, -6697, 45769 } },
+	{ 69, 12, { 0, 0, 0, 0 }, { -498, 38824, -1936, 40262, -3587, 41913, -5218, 43544 } },
+	{ 69, 13, { 0, 0, 0, 0 }, { -3159, 40445, -4474, 41761, -6007, 43296, -7546, 44836 } },
+	{ 69, 14, { 0, 0, 0, 0 }, { -5068, 42990, -6537, 44459, -8292, 46215, -10109, 48031 } },
+	{ 69, 15, { 0, 0, 0, 0 }, { -5336, 41666, -6743, 43076, -8412, 44748, -10121, 46462 } },
+	{ 69, 16, { 0, 0, 0, 0 }, { -2309, 41383, -3625, 42698, -5161, 44233, -6703, 45772 } },
+	{ 69, 17, { 0, 0, 0, 0 }, { -494, 38829, -1932, 40267, -3583, 41918, -5213, 43548 } },
+	{ 69, 18, { 0, 0, 0, 0 }, { -3152, 40444, -4467, 41760, -6001, 43295, -7539, 44835 } },
+	{ 69, 19, { 0, 0, 0, 0 }, { -5079, 42978, -6548, 44447, -8303, 46202, -10120, 48019 } },
+	{ 69, 20, { 0, 0, 0, 0 }, { -1763, 39745, -3106, 41087, -4660, 42641, -6206, 44187 } },
+	{ 69, 21, { 0, 0, 0, 0 }, { -2297, 41334, -3613, 42649, -5149, 44183, -6689, 45722 } },
+	{ 69, 22, { 0, 0, 0, 0 }, { -477, 38847, -1915, 40286, -3566, 41936, -5196, 43567 } },
+	{ 69, 23, { 0, 0, 0, 0 }, { -3200, 40456, -4515, 41773, -6050, 43309, -7589, 44850 } },
+	{ 69, 24, { 0, 0, 0, 0 }, { -5061, 42995, -6530, 44464, -8285, 46219, -10102, 48036 } },
+	{ 69, 25, { 0, 0, 0, 0 }, { -2011, 40181, -3338, 41508, -4876, 43047, -6411, 44582 } },
+	{ 69, 26, { 0, 0, 0, 0 }, { -2302, 41350, -3618, 42665, -5154, 44199, -6695, 45738 } },
+	{ 69, 27, { 0, 0, 0, 0 }, { -476, 38849, -1914, 40287, -3565, 41938, -5195, 43568 } },
+	{ 69, 28, { 0, 0, 0, 0 }, { -3182, 40455, -4497, 41772, -6031, 43307, -7570, 44848 } },
+	{ 69, 29, { 0, 0, 0, 0 }, { -5072, 42985, -6541, 44454, -8296, 46208, -10112, 48025 } },
+	{ 69, 30, { 0, 0, 0, 0 }, { -3249, 43090, -4627, 44465, -6256, 46091, -7917, 47748 } },
+	{ 69, 31, { 0, 0, 0, 0 }, { -2300, 41340, -3615, 42654, -5151, 44189, -6692, 45727 } },
+	{ 69, 32, { 0, 0, 0, 0 }, { -470, 38856, -1908, 40294, -3559, 41944, -5189, 43575 } },
+	{ 69, 33, { 0, 0, 0, 0 }, { -3191, 40459, -4506, 41775, -6041, 43311, -7580, 44852 } },
+	{ 69, 34, { 0, 0, 0, 0 }, { -5069, 42986, -6538, 44455, -8293, 46210, -10109, 48026 } },
+	{ 69, 35, { 0, 0, 0, 0 }, { -411, 39308, -1828, 40724, -3456, 42352, -5066, 43961 } },
+	{ 69, 36, { 0, 0, 0, 0 }, { -2301, 41330, -3617, 42645, -5152, 44179, -6693, 45718 } },
+	{ 69, 37, { 0, 0, 0, 0 }, { -463, 38863, -1901, 40302, -3552, 41952, -5182, 43582 } },
+	{ 69, 38, { 0, 0, 0, 0 }, { -3198, 40462, -4513, 41779, -6047, 43314, -7586, 44855 } },
+	{ 69, 39, { 0, 0, 0, 0 }, { -5073, 42982, -6541, 44451, -8296, 46206, -10112, 48022 } },
+	{ 69, 40, { 0, 0, 0, 0 }, { -5043, 43011, -6512, 44480, -8267, 46235, -10083, 48051 } },
+	{ 69, 41, { 0, 0, 0, 0 }, { -4742, 43235, -6206, 44698, -7954, 46445, -9763, 48252 } },
+	{ 70, 0, { 0, 0, 0, 0 }, { 55523, 103485, 54059, 104948, 52312, 106694, 50505, 108499 } },
+	{ 70, 1, { 0, 0, 0, 0 }, { 57890, 101527, 56575, 102841, 55039, 104375, 53498, 105914 } },
+	{ 70, 2, { 0, 0, 0, 0 }, { 59677, 98996, 58239, 100434, 56588, 102085, 54957, 103716 } },
+	{ 70, 3, { 0, 0, 0, 0 }, { 56981, 100629, 55666, 101945, 54132, 103481, 52593, 105022 } },
+	{ 70, 4, { 0, 0, 0, 0 }, { 55143, 103206, 53674, 104676, 51918, 106431, 50101, 108248 } },
+	{ 70, 5, { 0, 0, 0, 0 }, { 55523, 103485, 54059, 104948, 52312, 106694, 50505, 108499 } },
+	{ 70, 6, { 0, 0, 0, 0 }, { 57890, 101518, 56574, 102833, 55039, 104367, 53498, 105905 } },
+	{ 70, 7, { 0, 0, 0, 0 }, { 59684, 99005, 58246, 100443, 56595, 102094, 54964, 103725 } },
+	{ 70, 8, { 0, 0, 0, 0 }, { 56974, 100631, 55659, 101948, 54125, 103484, 52586, 105025 } },
+	{ 70, 9, { 0, 0, 0, 0 }, { 55140, 103201, 53671, 104670, 51915, 106425, 50098, 108242 } },
+	{ 70, 10, { 0, 0, 0, 0 }, { 59461, 98899, 58030, 100330, 56386, 101974, 54762, 103599 } },
+	{ 70, 11, { 0, 0, 0, 0 }, { 57888, 101524, 56572, 102838, 55037, 104372, 53496, 105911 } },
+	{ 70, 12, { 0, 0, 0, 0 }, { 59691, 99013, 58253, 100451, 56602, 102102, 54972, 103733 } },
+	{ 70, 13, { 0, 0, 0, 0 }, { 56983, 100634, 55668, 101950, 54134, 103486, 52595, 105027 } },
+	{ 70, 14, { 0, 0, 0, 0 }, { 55132, 103191, 53663, 104660, 51908, 106416, 50091, 108233 } },
+	{ 70, 15, { 0, 0, 0, 0 }, { 54833, 101871, 53425, 103283, 51753, 104957, 50040, 106674 } },
+	{ 70, 16, { 0, 0, 0, 0 }, { 57883, 101527, 56567, 102841, 55031, 104376, 53490, 105914 } },
+	{ 70, 17, { 0, 0, 0, 0 }, { 59695, 99018, 58257, 100456, 56606, 102107, 54976, 103737 } },
+	{ 70, 18, { 0, 0, 0, 0 }, { 56990, 100633, 55675, 101949, 54141, 103485, 52602, 105026 } },
+	{ 70, 19, { 0, 0, 0, 0 }, { 55121, 103179, 53652, 104649, 51897, 106404, 50080, 108220 } },
+	{ 70, 20, { 0, 0, 0, 0 }, { 58430, 99895, 57086, 101239, 55531, 102794, 53984, 104341 } },
+	{ 70, 21, { 0, 0, 0, 0 }, { 57894, 101478, 56579, 102792, 55043, 104326, 53504, 105864 } },
+	{ 70, 22, { 0, 0, 0, 0 }, { 59712, 99037, 58274, 100475, 56623, 102126, 54993, 103756 } },
+	{ 70, 23, { 0, 0, 0, 0 }, { 56941, 100646, 55626, 101962, 54091, 103498, 52551, 105040 } },
+	{ 70, 24, { 0, 0, 0, 0 }, { 55139, 103196, 53670, 104665, 51915, 106420, 50099, 108236 } },
+	{ 70, 25, { 0, 0, 0, 0 }, { 58133, 100370, 56808, 101696, 55269, 103235, 53735, 104770 } },
+	{ 70, 26, { 0, 0, 0, 0 }, { 57890, 101494, 56574, 102808, 55039, 104342, 53498, 105880 } },
+	{ 70, 27, { 0, 0, 0, 0 }, { 59713, 99038, 58275, 100476, 56625, 102127, 54994, 103757 } },
+	{ 70, 28, { 0, 0, 0, 0 }, { 56960, 100645, 55645, 101961, 54110, 103497, 52570, 105039 } },
+	{ 70, 29, { 0, 0, 0, 0 }, { 55129, 103185, 53660, 104654, 51905, 106409, 50088, 108226 } },
+	{ 70, 30, { 0, 0, 0, 0 }, { 56954, 103250, 55578, 104624, 53951, 106247, 52293, 107901 } },
+	{ 70, 31, { 0, 0, 0, 0 }, { 57892, 101483, 56576, 102798, 55041, 104332, 53501, 105870 } },
+	{ 70, 32, { 0, 0, 0, 0 }, { 59719, 99045, 58281, 100483, 56630, 102134, 55000, 103764 } },
+	{ 70, 33, { 0, 0, 0, 0 }, { 56950, 100648, 55635, 101965, 54100, 103501, 52561, 105043 } },
+	{ 70, 34, { 0, 0, 0, 0 }, { 55132, 103187, 53663, 104655, 51908, 106410, 50091, 108227 } },
+	{ 70, 35, { 0, 0, 0, 0 }, { 59762, 99503, 58346, 100918, 56720, 102545, 55111, 104153 } },
+	{ 70, 36, { 0, 0, 0, 0 }, { 57891, 101474, 56575, 102788, 55040, 104322, 53500, 105860 } },
+	{ 70, 37, { 0, 0, 0, 0 }, { 59726, 99053, 58288, 100491, 56637, 102142, 55007, 103772 } },
+	{ 70, 38, { 0, 0, 0, 0 }, { 56944, 100651, 55629, 101968, 54094, 103504, 52554, 105046 } },
+	{ 70, 39, { 0, 0, 0, 0 }, { 55128, 103183, 53659, 104651, 51904, 106406, 50088, 108222 } },
+	{ 70, 40, { 0, 0, 0, 0 }, { 55158, 103211, 53689, 104680, 51935, 106435, 50118, 108251 } },
+	{ 70, 41, { 0, 0, 0, 0 }, { 55464, 103429, 54000, 104891, 52253, 106637, 50446, 108443 } },
+	{ 71, 0, { 0, 0, 0, 0 }, { 20567, 66300, 19192, 67674, 17571, 69294, 15924, 70940 } },
+	{ 71, 1, { 0, 0, 0, 0 }, { 21848, 65473, 20593, 66727, 19130, 68190, 17666, 69653 } },
+	{ 71, 2, { 0, 0, 0, 0 }, { 22496, 64046, 21129, 65413, 19547, 66995, 17972, 68570 } },
+	{ 71, 3, { 0, 0, 0, 0 }, { 20948, 64550, 19693, 65805, 18231, 67268, 16768, 68732 } },
+	{ 71, 4, { 0, 0, 0, 0 }, { 20213, 65991, 18834, 67371, 17207, 68998, 15553, 70651 } },
+	{ 71, 5, { 0, 0, 0, 0 }, { 20567, 66300, 19192, 67674, 17571, 69294, 15924, 70940 } },
+	{ 71, 6, { 0, 0, 0, 0 }, { 21846, 65466, 20591, 66721, 19128, 68183, 17663, 69646 } },
+	{ 71, 7, { 0, 0, 0, 0 }, { 22504, 64054, 21137, 65421, 19555, 67004, 17979, 68579 } },
+	{ 71, 8, { 0, 0, 0, 0 }, { 20944, 64550, 19689, 65805, 18227, 67268, 16764, 68732 } },
+	{ 71, 9, { 0, 0, 0, 0 }, { 20209, 65986, 18830, 67366, 17203, 68992, 15550, 70646 } },
+	{ 71, 10, { 0, 0, 0, 0 }, { 22312, 63921, 20951, 65282, 19376, 66857, 17808, 68425 } },
+	{ 71, 11, { 0, 0, 0, 0 }, { 21846, 65470, 20591, 66725, 19128, 68187, 17663, 69650 } },
+	{ 71, 12, { 0, 0, 0, 0 }, { 22511, 64062, 21144, 65429, 19562, 67011, 17987, 68586 } },
+	{ 71, 13, { 0, 0, 0, 0 }, { 20951, 64554, 19696, 65809, 18234, 67272, 16771, 68736 } },
+	{ 71, 14, { 0, 0, 0, 0 }, { 20201, 65978, 18822, 67357, 17195, 68983, 15542, 70636 } },
+	{ 71, 15, { 0, 0, 0, 0 }, { 19653, 64916, 18323, 66247, 16761, 67812, 15181, 69394 } },
+	{ 71, 16, { 0, 0, 0, 0 }, { 21842, 65471, 20587, 66725, 19124, 68188, 17660, 69651 } },
+	{ 71, 17, { 0, 0, 0, 0 }, { 22515, 64067, 21148, 65434, 19566, 67016, 17991, 68591 } },
+	{ 71, 18, { 0, 0, 0, 0 }, { 20956, 64555, 19701, 65811, 18239, 67273, 16776, 68737 } },
+	{ 71, 19, { 0, 0, 0, 0 }, { 20189, 65966, 18810, 67345, 17184, 68971, 15531, 70625 } },
+	{ 71, 20, { 0, 0, 0, 0 }, { 21822, 64400, 20541, 65682, 19053, 67171, 17568, 68655 } },
+	{ 71, 21, { 0, 0, 0, 0 }, { 21838, 65438, 20583, 66692, 19121, 68154, 17657, 69617 } },
+	{ 71, 22, { 0, 0, 0, 0 }, { 22533, 64085, 21166, 65452, 19584, 67034, 18009, 68609 } },
+	{ 71, 23, { 0, 0, 0, 0 }, { 20923, 64552, 19669, 65808, 18206, 67271, 16743, 68735 } },
+	{ 71, 24, { 0, 0, 0, 0 }, { 20207, 65983, 18828, 67362, 17202, 68989, 15549, 70642 } },
+	{ 71, 25, { 0, 0, 0, 0 }, { 21735, 64656, 20469, 65922, 18997, 67394, 17527, 68863 } },
+	{ 71, 26, { 0, 0, 0, 0 }, { 21839, 65448, 20584, 66703, 19121, 68165, 17657, 69628 } },
+	{ 71, 27, { 0, 0, 0, 0 }, { 22534, 64086, 21167, 65453, 19585, 67035, 18010, 68610 } },
+	{ 71, 28, { 0, 0, 0, 0 }, { 20937, 64556, 19682, 65812, 18220, 67275, 16756, 68739 } },
+	{ 71, 29, { 0, 0, 0, 0 }, { 20197, 65972, 18818, 67351, 17191, 68978, 15539, 70631 } },
+	{ 71, 30, { 0, 0, 0, 0 }, { 21584, 66507, 20280, 67809, 18750, 69337, 17206, 70878 } },
+	{ 71, 31, { 0, 0, 0, 0 }, { 21838, 65441, 20583, 66696, 19120, 68158, 17656, 69621 } },
+	{ 71, 32, { 0, 0, 0, 0 }, { 22540, 64093, 21173, 65460, 19591, 67042, 18016, 68616 } },
+	{ 71, 33, { 0, 0, 0, 0 }, { 20931, 64556, 19676, 65812, 18214, 67275, 16750, 68739 } },
+	{ 71, 34, { 0, 0, 0, 0 }, { 20199, 65974, 18820, 67353, 17194, 68979, 15541, 70632 } },
+	{ 71, 35, { 0, 0, 0, 0 }, { 22698, 64439, 21350, 65786, 19790, 67345, 18236, 68898 } },
+	{ 71, 36, { 0, 0, 0, 0 }, { 21835, 65434, 20580, 66688, 19117, 68150, 17653, 69613 } },
+	{ 71, 37, { 0, 0, 0, 0 }, { 22547, 64101, 21180, 65468, 19599, 67049, 18024, 68624 } },
+	{ 71, 38, { 0, 0, 0, 0 }, { 20927, 64557, 19672, 65813, 18210, 67276, 16746, 68740 } },
+	{ 71, 39, { 0, 0, 0, 0 }, { 20196, 65970, 18817, 67349, 17190, 68975, 15538, 70628 } },
+	{ 71, 40, { 0, 0, 0, 0 }, { 20225, 66000, 18846, 67379, 17220, 69005, 15567, 70657 } },
+	{ 71, 41, { 0, 0, 0, 0 }, { 20509, 66243, 19134, 67617, 17513, 69237, 15866, 70883 } },
+	{ 72, 0, { 0, 0, 0, 0 }, { -3562, 42173, -4937, 43548, -6559, 45168, -8206, 46814 } },
+	{ 72, 1, { 0, 0, 0, 0 }, { -2271, 41363, -3526, 42617, -4990, 44080, -6454, 45543 } },
+	{ 72, 2, { 0, 0, 0, 0 }, { -1627, 39922, -2995, 41289, -4577, 42872, -6152, 44447 } },
+	{ 72, 3, { 0, 0, 0, 0 }, { -3161, 40431, -4416, 41686, -5878, 43149, -7341, 44613 } },
+	{ 72, 4, { 0, 0, 0, 0 }, { -3915, 41863, -5295, 43242, -6921, 44869, -8575, 46523 } },
+	{ 72, 5, { 0, 0, 0, 0 }, { -3562, 42173, -4937, 43548, -6559, 45168, -8206, 46814 } },
+	{ 72, 6, { 0, 0, 0, 0 }, { -2274, 41356, -3529, 42611, -4992, 44073, -6457, 45536 } },
+	{ 72, 7, { 0, 0, 0, 0 }, { -1620, 39931, -2987, 41298, -4569, 42880, -6144, 44455 } },
+	{ 72, 8, { 0, 0, 0, 0 }, { -3166, 40431, -4420, 41687, -5882, 43149, -7345, 44613 } },
+	{ 72, 9, { 0, 0, 0, 0 }, { -3919, 41858, -5298, 43237, -6925, 44864, -8578, 46517 } },
+	{ 72, 10, { 0, 0, 0, 0 }, { -1812, 39799, -3173, 41159, -4748, 42734, -6315, 44303 } },
+	{ 72, 11, { 0, 0, 0, 0 }, { -2274, 41360, -3529, 42614, -4992, 44077, -6457, 45540 } },
+	{ 72, 12, { 0, 0, 0, 0 }, { -1612, 39939, -2980, 41306, -4562, 42888, -6137, 44463 } },
+	{ 72, 13, { 0, 0, 0, 0 }, { -3158, 40435, -4413, 41691, -5875, 43153, -7338, 44617 } },
+	{ 72, 14, { 0, 0, 0, 0 }, { -3927, 41849, -5307, 43228, -6933, 44855, -8586, 46508 } },
+	{ 72, 15, { 0, 0, 0, 0 }, { -4466, 40790, -5795, 42120, -7357, 43684, -8936, 45266 } },
+	{ 72, 16, { 0, 0, 0, 0 }, { -2277, 41361, -3532, 42615, -4996, 44078, -6460, 45541 } },
+	{ 72, 17, { 0, 0, 0, 0 }, { -1608, 39943, -2975, 41310, -4557, 42892, -6132, 44467 } },
+	{ 72, 18, { 0, 0, 0, 0 }, { -3153, 40437, -4408, 41692, -5870, 43155, -7333, 44618 } },
+	{ 72, 19, { 0, 0, 0, 0 }, { -3939, 41837, -5318, 43216, -6944, 44843, -8597, 46496 } },
+	{ 72, 20, { 0, 0, 0, 0 }, { -2298, 40287, -3580, 41569, -5067, 43057, -6551, 44541 } },
+	{ 72, 21, { 0, 0, 0, 0 }, { -2281, 41327, -3536, 42582, -4999, 44044, -6463, 45507 } },
+	{ 72, 22, { 0, 0, 0, 0 }, { -1591, 39961, -2958, 41328, -4540, 42910, -6115, 44485 } },
+	{ 72, 23, { 0, 0, 0, 0 }, { -3186, 40433, -4441, 41689, -5903, 43152, -7367, 44616 } },
+	{ 72, 24, { 0, 0, 0, 0 }, { -3921, 41855, -5300, 43234, -6926, 44860, -8579, 46513 } },
+	{ 72, 25, { 0, 0, 0, 0 }, { -2375, 40537, -3642, 41804, -5114, 43276, -6584, 44745 } },
+	{ 72, 26, { 0, 0, 0, 0 }, { -2281, 41338, -3536, 42592, -4999, 44054, -6463, 45518 } },
+	{ 72, 27, { 0, 0, 0, 0 }, { -1590, 39963, -2957, 41330, -4538, 42912, -6113, 44486 } },
+	{ 72, 28, { 0, 0, 0, 0 }, { -3173, 40437, -4427, 41693, -5890, 43156, -7353, 44620 } },
+	{ 72, 29, { 0, 0, 0, 0 }, { -3931, 41844, -5310, 43223, -6937, 44849, -8590, 46502 } },
+	{ 72, 30, { 0, 0, 0, 0 }, { -2541, 42390, -3846, 43693, -5377, 45222, -6921, 46764 } },
+	{ 72, 31, { 0, 0, 0, 0 }, { -2282, 41331, -3537, 42585, -5000, 44047, -6464, 45511 } },
+	{ 72, 32, { 0, 0, 0, 0 }, { -1584, 39969, -2951, 41336, -4532, 42918, -6107, 44493 } },
+	{ 72, 33, { 0, 0, 0, 0 }, { -3179, 40438, -4434, 41693, -5896, 43156, -7359, 44620 } },
+	{ 72, 34, { 0, 0, 0, 0 }, { -3929, 41846, -5308, 43225, -6934, 44851, -8587, 46504 } },
+	{ 72, 35, { 0, 0, 0, 0 }, { -1422, 40315, -2770, 41662, -4331, 43222, -5885, 44776 } },
+	{ 72, 36, { 0, 0, 0, 0 }, { -2285, 41323, -3540, 42578, -5003, 44040, -6467, 45503 } },
+	{ 72, 37, { 0, 0, 0, 0 }, { -1576, 39977, -2943, 41344, -4525, 42926, -6100, 44500 } },
+	{ 72, 38, { 0, 0, 0, 0 }, { -3183, 40438, -4437, 41694, -5900, 43157, -7363, 44621 } },
+	{ 72, 39, { 0, 0, 0, 0 }, { -3933, 41842, -5312, 43221, -6938, 44847, -8591, 46500 } },
+	{ 72, 40, { 0, 0, 0, 0 }, { -3903, 41872, -5282, 43250, -6908, 44877, -8561, 46529 } },
+	{ 72, 41, { 0, 0, 0, 0 }, { -3620, 42116, -4995, 43491, -6617, 45111, -8264, 46758 } },
+	{ 73, 0, { 0, 0, 0, 0 }, { 56641, 102370, 55266, 103744, 53646, 105363, 51999, 107009 } },
+	{ 73, 1, { 0, 0, 0, 0 }, { 57908, 101518, 56653, 102773, 55190, 104235, 53726, 105698 } },
+	{ 73, 2, { 0, 0, 0, 0 }, { 58562, 100111, 57194, 101478, 55612, 103061, 54037, 104636 } },
+	{ 73, 3, { 0, 0, 0, 0 }, { 56993, 100608, 55738, 101863, 54276, 103326, 52812, 104791 } },
+	{ 73, 4, { 0, 0, 0, 0 }, { 56285, 102064, 54906, 103443, 53279, 105070, 51626, 106724 } },
+	{ 73, 5, { 0, 0, 0, 0 }, { 56641, 102370, 55266, 103744, 53646, 105363, 51999, 107009 } },
+	{ 73, 6, { 0, 0, 0, 0 }, { 57905, 101512, 56650, 102766, 55187, 104228, 53723, 105692 } },
+	{ 73, 7, { 0, 0, 0, 0 }, { 58569, 100120, 57202, 101487, 55620, 103069, 54045, 104644 } },
+	{ 73, 8, { 0, 0, 0, 0 }, { 56988, 100608, 55734, 101864, 54271, 103327, 52808, 104791 } },
+	{ 73, 9, { 0, 0, 0, 0 }, { 56281, 102059, 54902, 103438, 53275, 105065, 51622, 106718 } },
+	{ 73, 10, { 0, 0, 0, 0 }, { 58378, 99984, 57017, 101345, 55442, 102921, 53874, 104490 } },
+	{ 73, 11, { 0, 0, 0, 0 }, { 57905, 101516, 56650, 102770, 55187, 104232, 53723, 105695 } },
+	{ 73, 12, { 0, 0, 0, 0 }, { 58577, 100128, 57210, 101495, 55628, 103077, 54053, 104652 } },
+	{ 73, 13, { 0, 0, 0, 0 }, { 56996, 100612, 55741, 101868, 54279, 103331, 52815, 104795 } },
+	{ 73, 14, { 0, 0, 0, 0 }, { 56273, 102050, 54894, 103429, 53267, 105056, 51614, 106709 } },
+	{ 73, 15, { 0, 0, 0, 0 }, { 55712, 100986, 54381, 102318, 52818, 103883, 51237, 105467 } },
+	{ 73, 16, { 0, 0, 0, 0 }, { 57902, 101517, 56647, 102771, 55184, 104233, 53720, 105696 } },
+	{ 73, 17, { 0, 0, 0, 0 }, { 58581, 100132, 57214, 101499, 55632, 103081, 54057, 104656 } },
+	{ 73, 18, { 0, 0, 0, 0 }, { 57000, 100614, 55746, 101869, 54283, 103332, 52820, 104796 } },
+	{ 73, 19, { 0, 0, 0, 0 }, { 56262, 102038, 54883, 103417, 53256, 105044, 51603, 106697 } },
+	{ 73, 20, { 0, 0, 0, 0 }, { 57884, 100449, 56601, 101732, 55112, 103221, 53627, 104706 } },
+	{ 73, 21, { 0, 0, 0, 0 }, { 57898, 101483, 56643, 102738, 55180, 104200, 53717, 105662 } },
+	{ 73, 22, { 0, 0, 0, 0 }, { 58598, 100150, 57231, 101517, 55649, 103099, 54074, 104674 } },
+	{ 73, 23, { 0, 0, 0, 0 }, { 56968, 100610, 55713, 101866, 54250, 103329, 52787, 104794 } },
+	{ 73, 24, { 0, 0, 0, 0 }, { 56280, 102056, 54901, 103435, 53274, 105061, 51621, 106714 } },
+	{ 73, 25, { 0, 0, 0, 0 }, { 57781, 100714, 56515, 101980, 55043, 103452, 53574, 104921 } },
+	{ 73, 26, { 0, 0, 0, 0 }, { 57898, 101494, 56644, 102748, 55181, 104210, 53717, 105673 } },
+	{ 73, 27, { 0, 0, 0, 0 }, { 58600, 100152, 57233, 101519, 55651, 103101, 54076, 104676 } },
+	{ 73, 28, { 0, 0, 0, 0 }, { 56981, 100614, 55726, 101870, 54264, 103333, 52800, 104797 } },
+	{ 73, 29, { 0, 0, 0, 0 }, { 56269, 102045, 54890, 103424, 53264, 105050, 51611, 106703 } },
+	{ 73, 30, { 0, 0, 0, 0 }, { 57651, 102561, 56348, 103863, 54819, 105390, 53276, 106929 } },
+	{ 73, 31, { 0, 0, 0, 0 }, { 57898, 101487, 56643, 102741, 55180, 104203, 53716, 105666 } },
+	{ 73, 32, { 0, 0, 0, 0 }, { 58605, 100158, 57238, 101525, 55657, 103107, 54082, 104682 } },
+	{ 73, 33, { 0, 0, 0, 0 }, { 56975, 100615, 55720, 101870, 54258, 103333, 52794, 104798 } },
+	{ 73, 34, { 0, 0, 0, 0 }, { 56272, 102047, 54893, 103425, 53266, 105052, 51614, 106705 } },
+	{ 73, 35, { 0, 0, 0, 0 }, { 58757, 100504, 57410, 101851, 55851, 103409, 54298, 104962 } },
+	{ 73, 36, { 0, 0, 0, 0 }, { 57894, 101479, 56639, 102734, 55177, 104196, 53713, 105659 } },
+	{ 73, 37, { 0, 0, 0, 0 }, { 58613, 100166, 57246, 101533, 55664, 103115, 54089, 104689 } },
+	{ 73, 38, { 0, 0, 0, 0 }, { 56971, 100615, 55716, 101871, 54254, 103334, 52790, 104799 } },
+	{ 73, 39, { 0, 0, 0, 0 }, { 56268, 102043, 54889, 103421, 53263, 105048, 51610, 106701 } },
+	{ 73, 40, { 0, 0, 0, 0 }, { 56298, 102072, 54919, 103451, 53293, 105077, 51640, 106729 } },
+	{ 73, 41, { 0, 0, 0, 0 }, { 56582, 102313, 55208, 103687, 53587, 105307, 51941, 106952 } },
+	{ 74, 0, { 0, 0, 0, 0 }, { 21605, 65265, 20261, 66607, 18692, 68176, 17116, 69751 } },
+	{ 74, 1, { 0, 0, 0, 0 }, { 21865, 65464, 20630, 66700, 19190, 68140, 17750, 69579 } },
+	{ 74, 2, { 0, 0, 0, 0 }, { 21447, 65096, 20097, 66445, 18523, 68019, 16942, 69600 } },
+	{ 74, 3, { 0, 0, 0, 0 }, { 20946, 64543, 19710, 65779, 18271, 67219, 16831, 68659 } },
+	{ 74, 4, { 0, 0, 0, 0 }, { 21271, 64933, 19924, 66280, 18349, 67855, 16768, 69436 } },
+	{ 74, 5, { 0, 0, 0, 0 }, { 21605, 65265, 20261, 66607, 18692, 68176, 17116, 69751 } },
+	{ 74, 6, { 0, 0, 0, 0 }, { 21861, 65460, 20625, 66695, 19185, 68135, 17746, 69575 } },
+	{ 74, 7, { 0, 0, 0, 0 }, { 21455, 65104, 20105, 66453, 18531, 68027, 16951, 69607 } },
+	{ 74, 8, { 0, 0, 0, 0 }, { 20944, 64541, 19708, 65777, 18269, 67217, 16829, 68657 } },
+	{ 74, 9, { 0, 0, 0, 0 }, { 21267, 64929, 19919, 66276, 18345, 67850, 16764, 69431 } },
+	{ 74, 10, { 0, 0, 0, 0 }, { 21294, 64940, 19951, 66284, 18385, 67850, 16813, 69424 } },
+	{ 74, 11, { 0, 0, 0, 0 }, { 21862, 65462, 20627, 66697, 19187, 68137, 17747, 69577 } },
+	{ 74, 12, { 0, 0, 0, 0 }, { 21462, 65111, 20113, 66460, 18539, 68034, 16959, 69615 } },
+	{ 74, 13, { 0, 0, 0, 0 }, { 20950, 64547, 19714, 65783, 18274, 67223, 16835, 68662 } },
+	{ 74, 14, { 0, 0, 0, 0 }, { 21258, 64920, 19911, 66267, 18337, 67841, 16756, 69422 } },
+	{ 74, 15, { 0, 0, 0, 0 }, { 20463, 64100, 19161, 65403, 17641, 66924, 16117, 68449 } },
+	{ 74, 16, { 0, 0, 0, 0 }, { 21861, 65461, 20626, 66696, 19186, 68136, 17746, 69576 } },
+	{ 74, 17, { 0, 0, 0, 0 }, { 21467, 65116, 20118, 66465, 18544, 68039, 16963, 69619 } },
+	{ 74, 18, { 0, 0, 0, 0 }, { 20953, 64550, 19717, 65786, 18278, 67226, 16838, 68665 } },
+	{ 74, 19, { 0, 0, 0, 0 }, { 21246, 64908, 19899, 66256, 18325, 67830, 16744, 69411 } },
+	{ 74, 20, { 0, 0, 0, 0 }, { 21310, 64920, 20046, 66185, 18573, 67659, 17099, 69135 } },
+	{ 74, 21, { 0, 0, 0, 0 }, { 21842, 65442, 20607, 66677, 19167, 68117, 17728, 69557 } },
+	{ 74, 22, { 0, 0, 0, 0 }, { 21484, 65133, 20135, 66482, 18562, 68056, 16981, 69636 } },
+	{ 74, 23, { 0, 0, 0, 0 }, { 20935, 64532, 19699, 65768, 18260, 67208, 16820, 68647 } },
+	{ 74, 24, { 0, 0, 0, 0 }, { 21264, 64926, 19917, 66273, 18343, 67847, 16762, 69428 } },
+	{ 74, 25, { 0, 0, 0, 0 }, { 21391, 64992, 20142, 66241, 18687, 67695, 17232, 69149 } },
+	{ 74, 26, { 0, 0, 0, 0 }, { 21848, 65448, 20612, 66683, 19173, 68123, 17733, 69562 } },
+	{ 74, 27, { 0, 0, 0, 0 }, { 21486, 65135, 20137, 66484, 18563, 68057, 16982, 69638 } },
+	{ 74, 28, { 0, 0, 0, 0 }, { 20944, 64541, 19708, 65777, 18268, 67216, 16829, 68656 } },
+	{ 74, 29, { 0, 0, 0, 0 }, { 21254, 64916, 19907, 66263, 18333, 67837, 16752, 69417 } },
+	{ 74, 30, { 0, 0, 0, 0 }, { 22236, 65862, 20958, 67139, 19465, 68630, 17971, 70123 } },
+	{ 74, 31, { 0, 0, 0, 0 }, { 21844, 65444, 20609, 66679, 19169, 68119, 17729, 69559 } },
+	{ 74, 32, { 0, 0, 0, 0 }, { 21492, 65141, 20143, 66490, 18569, 68063, 16989, 69644 } },
+	{ 74, 33, { 0, 0, 0, 0 }, { 20941, 64538, 19705, 65774, 18265, 67214, 16826, 68653 } },
+	{ 74, 34, { 0, 0, 0, 0 }, { 21256, 64918, 19909, 66265, 18335, 67838, 16754, 69419 } },
+	{ 74, 35, { 0, 0, 0, 0 }, { 21747, 65386, 20417, 66715, 18866, 68265, 17310, 69820 } },
+	{ 74, 36, { 0, 0, 0, 0 }, { 21839, 65438, 20603, 66674, 19163, 68113, 17724, 69553 } },
+	{ 74, 37, { 0, 0, 0, 0 }, { 21499, 65148, 20151, 66497, 18577, 68071, 16997, 69651 } },
+	{ 74, 38, { 0, 0, 0, 0 }, { 20939, 64536, 19703, 65772, 18264, 67212, 16824, 68652 } },
+	{ 74, 39, { 0, 0, 0, 0 }, { 21252, 64914, 19905, 66261, 18331, 67835, 16750, 69415 } },
+	{ 74, 40, { 0, 0, 0, 0 }, { 21282, 64944, 19935, 66291, 18361, 67864, 16780, 69445 } },
+	{ 74, 41, { 0, 0, 0, 0 }, { 21547, 65207, 20204, 66550, 18634, 68118, 17058, 69694 } },
+	{ 75, 0, { 0, 0, 0, 0 }, { -2523, 41137, -3867, 42480, -5436, 44049, -7013, 45624 } },
+	{ 75, 1, { 0, 0, 0, 0 }, { -2250, 41350, -3485, 42585, -4925, 44025, -6365, 45464 } },
+	{ 75, 2, { 0, 0, 0, 0 }, { -2677, 40972, -4026, 42321, -5600, 43895, -7181, 45476 } },
+	{ 75, 3, { 0, 0, 0, 0 }, { -3168, 40429, -4404, 41665, -5844, 43105, -7283, 44544 } },
+	{ 75, 4, { 0, 0, 0, 0 }, { -2857, 40805, -4205, 42152, -5779, 43726, -7360, 45308 } },
+	{ 75, 5, { 0, 0, 0, 0 }, { -2523, 41137, -3867, 42480, -5436, 44049, -7013, 45624 } },
+	{ 75, 6, { 0, 0, 0, 0 }, { -2254, 41345, -3490, 42580, -4930, 44020, -6369, 45460 } },
+	{ 75, 7, { 0, 0, 0, 0 }, { -2669, 40980, -4018, 42329, -5592, 43903, -7173, 45484 } },
+	{ 75, 8, { 0, 0, 0, 0 }, { -3170, 40427, -4406, 41663, -5845, 43103, -7285, 44542 } },
+	{ 75, 9, { 0, 0, 0, 0 }, { -2862, 40800, -4209, 42148, -5783, 43722, -7364, 45303 } },
+	{ 75, 10, { 0, 0, 0, 0 }, { -2829, 40817, -4171, 42160, -5737, 43727, -7309, 45300 } },
+	{ 75, 11, { 0, 0, 0, 0 }, { -2253, 41347, -3488, 42582, -4928, 44022, -6368, 45462 } },
+	{ 75, 12, { 0, 0, 0, 0 }, { -2661, 40988, -4011, 42337, -5584, 43911, -7165, 45491 } },
+	{ 75, 13, { 0, 0, 0, 0 }, { -3164, 40433, -4400, 41669, -5840, 43108, -7279, 44548 } },
+	{ 75, 14, { 0, 0, 0, 0 }, { -2870, 40792, -4217, 42139, -5791, 43713, -7372, 45294 } },
+	{ 75, 15, { 0, 0, 0, 0 }, { -3660, 39977, -4961, 41279, -6480, 42800, -8003, 44324 } },
+	{ 75, 16, { 0, 0, 0, 0 }, { -2254, 41346, -3489, 42581, -4929, 44021, -6369, 45461 } },
+	{ 75, 17, { 0, 0, 0, 0 }, { -2657, 40992, -4006, 42341, -5580, 43915, -7160, 45496 } },
+	{ 75, 18, { 0, 0, 0, 0 }, { -3161, 40436, -4397, 41672, -5837, 43111, -7276, 44551 } },
+	{ 75, 19, { 0, 0, 0, 0 }, { -2882, 40780, -4229, 42127, -5803, 43701, -7384, 45282 } },
+	{ 75, 20, { 0, 0, 0, 0 }, { -2807, 40803, -4070, 42068, -5543, 43541, -7016, 45016 } },
+	{ 75, 21, { 0, 0, 0, 0 }, { -2273, 41327, -3508, 42562, -4948, 44002, -6387, 45442 } },
+	{ 75, 22, { 0, 0, 0, 0 }, { -2639, 41010, -3988, 42359, -5562, 43932, -7143, 45513 } },
+	{ 75, 23, { 0, 0, 0, 0 }, { -3179, 40418, -4415, 41654, -5855, 43094, -7294, 44533 } },
+	{ 75, 24, { 0, 0, 0, 0 }, { -2864, 40798, -4211, 42145, -5785, 43719, -7366, 45300 } },
+	{ 75, 25, { 0, 0, 0, 0 }, { -2724, 40878, -3973, 42126, -5428, 43581, -6884, 45036 } },
+	{ 75, 26, { 0, 0, 0, 0 }, { -2267, 41332, -3503, 42568, -4942, 44008, -6382, 45447 } },
+	{ 75, 27, { 0, 0, 0, 0 }, { -2638, 41011, -3987, 42360, -5561, 43934, -7141, 45514 } },
+	{ 75, 28, { 0, 0, 0, 0 }, { -3170, 40427, -4406, 41663, -5846, 43102, -7285, 44542 } },
+	{ 75, 29, { 0, 0, 0, 0 }, { -2875, 40787, -4222, 42134, -5796, 43708, -7376, 45289 } },
+	{ 75, 30, { 0, 0, 0, 0 }, { -1884, 41741, -3164, 43019, -4657, 44511, -6152, 46005 } },
+	{ 75, 31, { 0, 0, 0, 0 }, { -2271, 41329, -3507, 42564, -4946, 44004, -6386, 45443 } },
+	{ 75, 32, { 0, 0, 0, 0 }, { -2632, 41017, -3981, 42366, -5554, 43940, -7135, 45520 } },
+	{ 75, 33, { 0, 0, 0, 0 }, { -3173, 40424, -4409, 41660, -5849, 43099, -7288, 44539 } },
+	{ 75, 34, { 0, 0, 0, 0 }, { -2873, 40789, -4220, 42136, -5793, 43710, -7374, 45291 } },
+	{ 75, 35, { 0, 0, 0, 0 }, { -2375, 41264, -3705, 42594, -5257, 44144, -6814, 45700 } },
+	{ 75, 36, { 0, 0, 0, 0 }, { -2277, 41323, -3512, 42559, -4952, 43998, -6391, 45438 } },
+	{ 75, 37, { 0, 0, 0, 0 }, { -2624, 41025, -3973, 42374, -5547, 43947, -7127, 45528 } },
+	{ 75, 38, { 0, 0, 0, 0 }, { -3175, 40422, -4411, 41658, -5850, 43098, -7290, 44537 } },
+	{ 75, 39, { 0, 0, 0, 0 }, { -2876, 40786, -4223, 42132, -5797, 43706, -7378, 45287 } },
+	{ 75, 40, { 0, 0, 0, 0 }, { -2847, 40815, -4194, 42162, -5767, 43736, -7348, 45317 } },
+	{ 75, 41, { 0, 0, 0, 0 }, { -2581, 41079, -3925, 42422, -5494, 43991, -7071, 45567 } },
+	{ 76, 0, { 0, 0, 0, 0 }, { 57676, 101336, 56334, 102679, 54765, 104247, 53189, 105822 } },
+	{ 76, 1, { 0, 0, 0, 0 }, { 57918, 101517, 56682, 102752, 55242, 104192, 53803, 105632 } },
+	{ 76, 2, { 0, 0, 0, 0 }, { 57512, 101161, 56163, 102510, 54589, 104084, 53008, 105665 } },
+	{ 76, 3, { 0, 0, 0, 0 }, { 56998, 100595, 55762, 101831, 54322, 103270, 52882, 104710 } },
+	{ 76, 4, { 0, 0, 0, 0 }, { 57343, 101006, 55996, 102353, 54422, 103927, 52841, 105509 } },
+	{ 76, 5, { 0, 0, 0, 0 }, { 57676, 101336, 56334, 102679, 54765, 104247, 53189, 105822 } },
+	{ 76, 6, { 0, 0, 0, 0 }, { 57913, 101512, 56678, 102748, 55238, 104188, 53798, 105627 } },
+	{ 76, 7, { 0, 0, 0, 0 }, { 57520, 101169, 56171, 102518, 54597, 104092, 53016, 105673 } },
+	{ 76, 8, { 0, 0, 0, 0 }, { 56996, 100593, 55760, 101829, 54320, 103268, 52880, 104708 } },
+	{ 76, 9, { 0, 0, 0, 0 }, { 57339, 101001, 55992, 102348, 54418, 103923, 52837, 105504 } },
+	{ 76, 10, { 0, 0, 0, 0 }, { 57359, 101005, 56016, 102349, 54449, 103916, 52876, 105490 } },
+	{ 76, 11, { 0, 0, 0, 0 }, { 57915, 101514, 56679, 102750, 55240, 104189, 53800, 105629 } },
+	{ 76, 12, { 0, 0, 0, 0 }, { 57528, 101177, 56178, 102526, 54605, 104100, 53024, 105680 } },
+	{ 76, 13, { 0, 0, 0, 0 }, { 57001, 100598, 55765, 101834, 54326, 103274, 52886, 104714 } },
+	{ 76, 14, { 0, 0, 0, 0 }, { 57330, 100993, 55983, 102340, 54409, 103914, 52828, 105495 } },
+	{ 76, 15, { 0, 0, 0, 0 }, { 56527, 100164, 55224, 101468, 53703, 102990, 52179, 104517 } },
+	{ 76, 16, { 0, 0, 0, 0 }, { 57914, 101513, 56678, 102749, 55238, 104188, 53799, 105628 } },
+	{ 76, 17, { 0, 0, 0, 0 }, { 57532, 101181, 56183, 102530, 54609, 104104, 53028, 105685 } },
+	{ 76, 18, { 0, 0, 0, 0 }, { 57004, 100601, 55768, 101837, 54329, 103277, 52889, 104717 } },
+	{ 76, 19, { 0, 0, 0, 0 }, { 57319, 100981, 55972, 102328, 54398, 103902, 52817, 105483 } },
+	{ 76, 20, { 0, 0, 0, 0 }, { 57364, 100975, 56100, 102241, 54626, 103716, 53151, 105192 } },
+	{ 76, 21, { 0, 0, 0, 0 }, { 57895, 101495, 56660, 102730, 55220, 104170, 53780, 105610 } },
+	{ 76, 22, { 0, 0, 0, 0 }, { 57550, 101199, 56201, 102548, 54627, 104121, 53046, 105702 } },
+	{ 76, 23, { 0, 0, 0, 0 }, { 56986, 100583, 55750, 101819, 54311, 103259, 52871, 104699 } },
+	{ 76, 24, { 0, 0, 0, 0 }, { 57337, 100999, 55990, 102346, 54416, 103920, 52835, 105501 } },
+	{ 76, 25, { 0, 0, 0, 0 }, { 57443, 101044, 56195, 102292, 54740, 103746, 53285, 105200 } },
+	{ 76, 26, { 0, 0, 0, 0 }, { 57901, 101500, 56665, 102736, 55225, 104175, 53786, 105615 } },
+	{ 76, 27, { 0, 0, 0, 0 }, { 57551, 101200, 56202, 102549, 54629, 104123, 53048, 105703 } },
+	{ 76, 28, { 0, 0, 0, 0 }, { 56995, 100592, 55759, 101828, 54319, 103268, 52880, 104707 } },
+	{ 76, 29, { 0, 0, 0, 0 }, { 57326, 100988, 55979, 102335, 54405, 103909, 52824, 105490 } },
+	{ 76, 30, { 0, 0, 0, 0 }, { 58298, 101922, 57020, 103199, 55528, 104689, 54035, 106181 } },
+	{ 76, 31, { 0, 0, 0, 0 }, { 57897, 101496, 56661, 102732, 55221, 104171, 53782, 105611 } },
+	{ 76, 32, { 0, 0, 0, 0 }, { 57557, 101206, 56208, 102555, 54635, 104129, 53054, 105709 } },
+	{ 76, 33, { 0, 0, 0, 0 }, { 56992, 100589, 55756, 101825, 54317, 103265, 52877, 104705 } },
+	{ 76, 34, { 0, 0, 0, 0 }, { 57328, 100990, 55981, 102337, 54407, 103911, 52827, 105492 } },
+	{ 76, 35, { 0, 0, 0, 0 }, { 57809, 101448, 56480, 102776, 54930, 104325, 53374, 105880 } },
+	{ 76, 36, { 0, 0, 0, 0 }, { 57891, 101491, 56656, 102726, 55216, 104166, 53776, 105606 } },
+	{ 76, 37, { 0, 0, 0, 0 }, { 57565, 101214, 56216, 102563, 54643, 104136, 53062, 105717 } },
+	{ 76, 38, { 0, 0, 0, 0 }, { 56991, 100587, 55755, 101823, 54315, 103263, 52875, 104703 } },
+	{ 76, 39, { 0, 0, 0, 0 }, { 57324, 100986, 55977, 102333, 54404, 103907, 52823, 105488 } },
+	{ 76, 40, { 0, 0, 0, 0 }, { 57354, 101016, 56007, 102363, 54433, 103937, 52853, 105517 } },
+	{ 76, 41, { 0, 0, 0, 0 }, { 57619, 101279, 56276, 102621, 54707, 104190, 53131, 105765 } },
+	{ 77, 0, { 0, 0, 0, 0 }, { 22634, 64237, 21273, 65598, 19695, 67175, 18124, 68746 } },
+	{ 77, 1, { 0, 0, 0, 0 }, { 21876, 65462, 20621, 66717, 19160, 68180, 17697, 69644 } },
+	{ 77, 2, { 0, 0, 0, 0 }, { 20389, 66154, 19007, 67535, 17381, 69162, 15728, 70815 } },
+	{ 77, 3, { 0, 0, 0, 0 }, { 20938, 64543, 19683, 65798, 18220, 67260, 16756, 68723 } },
+	{ 77, 4, { 0, 0, 0, 0 }, { 22321, 63883, 20956, 65248, 19373, 66831, 17798, 68406 } },
+	{ 77, 5, { 0, 0, 0, 0 }, { 22634, 64237, 21273, 65598, 19695, 67175, 18124, 68746 } },
+	{ 77, 6, { 0, 0, 0, 0 }, { 21869, 65460, 20615, 66715, 19153, 68177, 17690, 69641 } },
+	{ 77, 7, { 0, 0, 0, 0 }, { 20397, 66161, 19016, 67542, 17389, 69169, 15736, 70822 } },
+	{ 77, 8, { 0, 0, 0, 0 }, { 20938, 64539, 19683, 65794, 18220, 67256, 16756, 68719 } },
+	{ 77, 9, { 0, 0, 0, 0 }, { 22316, 63879, 20951, 65244, 19368, 66827, 17793, 68402 } },
+	{ 77, 10, { 0, 0, 0, 0 }, { 20269, 65969, 18894, 67343, 17277, 68961, 15635, 70605 } },
+	{ 77, 11, { 0, 0, 0, 0 }, { 21873, 65460, 20618, 66715, 19156, 68177, 17694, 69641 } },
+	{ 77, 12, { 0, 0, 0, 0 }, { 20405, 66168, 19024, 67550, 17398, 69176, 15745, 70829 } },
+	{ 77, 13, { 0, 0, 0, 0 }, { 20942, 64546, 19687, 65801, 18224, 67263, 16760, 68726 } },
+	{ 77, 14, { 0, 0, 0, 0 }, { 22307, 63871, 20942, 65236, 19360, 66818, 17784, 68394 } },
+	{ 77, 15, { 0, 0, 0, 0 }, { 21266, 63291, 19946, 64611, 18415, 66144, 16889, 67670 } },
+	{ 77, 16, { 0, 0, 0, 0 }, { 21874, 65457, 20619, 66711, 19157, 68174, 17695, 69638 } },
+	{ 77, 17, { 0, 0, 0, 0 }, { 20410, 66173, 19028, 67554, 17402, 69180, 15749, 70833 } },
+	{ 77, 18, { 0, 0, 0, 0 }, { 20944, 64551, 19688, 65806, 18226, 67268, 16762, 68731 } },
+	{ 77, 19, { 0, 0, 0, 0 }, { 22295, 63859, 20930, 65225, 19348, 66807, 17773, 68382 } },
+	{ 77, 20, { 0, 0, 0, 0 }, { 20790, 65447, 19503, 66736, 17997, 68244, 16480, 69763 } },
+	{ 77, 21, { 0, 0, 0, 0 }, { 21840, 65453, 20586, 66707, 19124, 68170, 17661, 69635 } },
+	{ 77, 22, { 0, 0, 0, 0 }, { 20428, 66190, 19047, 67571, 17421, 69197, 15768, 70849 } },
+	{ 77, 23, { 0, 0, 0, 0 }, { 20941, 64518, 19685, 65773, 18223, 67235, 16759, 68698 } },
+	{ 77, 24, { 0, 0, 0, 0 }, { 22313, 63878, 20948, 65243, 19366, 66825, 17791, 68400 } },
+	{ 77, 25, { 0, 0, 0, 0 }, { 21040, 65335, 19769, 66605, 18284, 68088, 16793, 69578 } },
+	{ 77, 26, { 0, 0, 0, 0 }, { 21851, 65453, 20596, 66708, 19134, 68171, 17671, 69635 } },
+	{ 77, 27, { 0, 0, 0, 0 }, { 20429, 66191, 19048, 67572, 17422, 69198, 15769, 70851 } },
+	{ 77, 28, { 0, 0, 0, 0 }, { 20945, 64532, 19689, 65787, 18227, 67249, 16763, 68711 } },
+	{ 77, 29, { 0, 0, 0, 0 }, { 22302, 63867, 20937, 65232, 19355, 66814, 17780, 68389 } },
+	{ 77, 30, { 0, 0, 0, 0 }, { 22882, 65223, 21586, 66519, 20080, 68023, 18580, 69523 } },
+	{ 77, 31, { 0, 0, 0, 0 }, { 21844, 65452, 20589, 66707, 19127, 68170, 17664, 69634 } },
+	{ 77, 32, { 0, 0, 0, 0 }, { 20436, 66197, 19055, 67578, 17429, 69204, 15776, 70856 } },
+	{ 77, 33, { 0, 0, 0, 0 }, { 20945, 64526, 19690, 65780, 18227, 67242, 16763, 68705 } },
+	{ 77, 34, { 0, 0, 0, 0 }, { 22304, 63869, 20939, 65234, 19357, 66816, 17782, 68392 } },
+	{ 77, 35, { 0, 0, 0, 0 }, { 20788, 66340, 19428, 67699, 17829, 69297, 16206, 70917 } },
+	{ 77, 36, { 0, 0, 0, 0 }, { 21836, 65449, 20582, 66704, 19120, 68167, 17656, 69631 } },
+	{ 77, 37, { 0, 0, 0, 0 }, { 20443, 66204, 19062, 67585, 17436, 69211, 15784, 70864 } },
+	{ 77, 38, { 0, 0, 0, 0 }, { 20946, 64522, 19690, 65777, 18228, 67238, 16764, 68701 } },
+	{ 77, 39, { 0, 0, 0, 0 }, { 22300, 63866, 20935, 65231, 19353, 66813, 17778, 68388 } },
+	{ 77, 40, { 0, 0, 0, 0 }, { 22330, 63896, 20965, 65261, 19383, 66843, 17808, 68418 } },
+	{ 77, 41, { 0, 0, 0, 0 }, { 22577, 64179, 21215, 65540, 19638, 67117, 18067, 68688 } },
+	{ 78, 0, { 0, 0, 0, 0 }, { -1493, 40108, -2854, 41469, -4432, 43047, -6003, 44617 } },
+	{ 78, 1, { 0, 0, 0, 0 }, { -2234, 41343, -3489, 42598, -4951, 44060, -6413, 45524 } },
+	{ 78, 2, { 0, 0, 0, 0 }, { -3735, 42030, -5116, 43411, -6743, 45038, -8396, 46691 } },
+	{ 78, 3, { 0, 0, 0, 0 }, { -3181, 40434, -4436, 41689, -5899, 43151, -7363, 44614 } },
+	{ 78, 4, { 0, 0, 0, 0 }, { -1808, 39755, -3173, 41120, -4755, 42703, -6331, 44278 } },
+	{ 78, 5, { 0, 0, 0, 0 }, { -1493, 40108, -2854, 41469, -4432, 43047, -6003, 44617 } },
+	{ 78, 6, { 0, 0, 0, 0 }, { -2241, 41340, -3495, 42595, -4957, 44058, -6420, 45521 } },
+	{ 78, 7, { 0, 0, 0, 0 }, { -3726, 42037, -5108, 43419, -6734, 45045, -8387, 46698 } },
+	{ 78, 8, { 0, 0, 0, 0 }, { -3181, 40429, -4436, 41684, -5899, 43146, -7363, 44610 } },
+	{ 78, 9, { 0, 0, 0, 0 }, { -1813, 39751, -3178, 41116, -4760, 42698, -6335, 44274 } },
+	{ 78, 10, { 0, 0, 0, 0 }, { -3853, 41844, -5227, 43219, -6844, 44836, -8486, 46480 } },
+	{ 78, 11, { 0, 0, 0, 0 }, { -2238, 41340, -3492, 42595, -4954, 44058, -6417, 45521 } },
+	{ 78, 12, { 0, 0, 0, 0 }, { -3718, 42045, -5100, 43426, -6726, 45052, -8379, 46705 } },
+	{ 78, 13, { 0, 0, 0, 0 }, { -3176, 40437, -4432, 41691, -5895, 43154, -7359, 44617 } },
+	{ 78, 14, { 0, 0, 0, 0 }, { -1821, 39743, -3187, 41108, -4769, 42690, -6344, 44265 } },
+	{ 78, 15, { 0, 0, 0, 0 }, { -2860, 39171, -4179, 40491, -5710, 42023, -7235, 43549 } },
+	{ 78, 16, { 0, 0, 0, 0 }, { -2237, 41337, -3491, 42592, -4953, 44054, -6416, 45518 } },
+	{ 78, 17, { 0, 0, 0, 0 }, { -3714, 42049, -5095, 43430, -6721, 45056, -8374, 46709 } },
+	{ 78, 18, { 0, 0, 0, 0 }, { -3175, 40441, -4430, 41696, -5893, 43159, -7357, 44622 } },
+	{ 78, 19, { 0, 0, 0, 0 }, { -1833, 39731, -3198, 41096, -4780, 42679, -6356, 44254 } },
+	{ 78, 20, { 0, 0, 0, 0 }, { -3322, 41326, -4609, 42614, -6115, 44122, -7630, 45640 } },
+	{ 78, 21, { 0, 0, 0, 0 }, { -2270, 41333, -3524, 42588, -4987, 44051, -6450, 45515 } },
+	{ 78, 22, { 0, 0, 0, 0 }, { -3696, 42066, -5077, 43447, -6703, 45073, -8356, 46726 } },
+	{ 78, 23, { 0, 0, 0, 0 }, { -3178, 40409, -4433, 41664, -5896, 43126, -7360, 44588 } },
+	{ 78, 24, { 0, 0, 0, 0 }, { -1816, 39749, -3180, 41114, -4763, 42697, -6338, 44272 } },
+	{ 78, 25, { 0, 0, 0, 0 }, { -3079, 41225, -4350, 42495, -5836, 43979, -7328, 45469 } },
+	{ 78, 26, { 0, 0, 0, 0 }, { -2260, 41333, -3514, 42588, -4976, 44051, -6439, 45515 } },
+	{ 78, 27, { 0, 0, 0, 0 }, { -3695, 42068, -5076, 43449, -6702, 45075, -8354, 46727 } },
+	{ 78, 28, { 0, 0, 0, 0 }, { -3174, 40422, -4429, 41677, -5892, 43139, -7356, 44602 } },
+	{ 78, 29, { 0, 0, 0, 0 }, { -1826, 39739, -3191, 41104, -4773, 42686, -6349, 44261 } },
+	{ 78, 30, { 0, 0, 0, 0 }, { -1235, 41099, -2532, 42395, -4037, 43900, -5539, 45400 } },
+	{ 78, 31, { 0, 0, 0, 0 }, { -2267, 41333, -3521, 42588, -4983, 44050, -6446, 45514 } },
+	{ 78, 32, { 0, 0, 0, 0 }, { -3688, 42073, -5069, 43454, -6695, 45080, -8348, 46733 } },
+	{ 78, 33, { 0, 0, 0, 0 }, { -3174, 40416, -4429, 41671, -5892, 43133, -7356, 44596 } },
+	{ 78, 34, { 0, 0, 0, 0 }, { -1824, 39741, -3189, 41106, -4771, 42688, -6347, 44263 } },
+	{ 78, 35, { 0, 0, 0, 0 }, { -3336, 42221, -4696, 43580, -6296, 45179, -7919, 46800 } },
+	{ 78, 36, { 0, 0, 0, 0 }, { -2274, 41329, -3528, 42584, -4991, 44047, -6454, 45511 } },
+	{ 78, 37, { 0, 0, 0, 0 }, { -3680, 42081, -5061, 43462, -6687, 45088, -8340, 46740 } },
+	{ 78, 38, { 0, 0, 0, 0 }, { -3173, 40412, -4428, 41667, -5891, 43129, -7355, 44592 } },
+	{ 78, 39, { 0, 0, 0, 0 }, { -1828, 39737, -3193, 41102, -4775, 42684, -6350, 44259 } },
+	{ 78, 40, { 0, 0, 0, 0 }, { -1799, 39767, -3163, 41132, -4745, 42714, -6321, 44289 } },
+	{ 78, 41, { 0, 0, 0, 0 }, { -1550, 40050, -2912, 41411, -4490, 42989, -6061, 44559 } },
+	{ 79, 0, { 0, 0, 0, 0 }, { 58704, 100311, 57344, 101671, 55766, 103248, 54196, 104818 } },
+	{ 79, 1, { 0, 0, 0, 0 }, { 57921, 101522, 56667, 102776, 55205, 104239, 53742, 105703 } },
+	{ 79, 2, { 0, 0, 0, 0 }, { 56454, 102219, 55072, 103600, 53446, 105227, 51793, 106880 } },
+	{ 79, 3, { 0, 0, 0, 0 }, { 56996, 100588, 55741, 101843, 54278, 103305, 52815, 104768 } },
+	{ 79, 4, { 0, 0, 0, 0 }, { 58393, 99956, 57028, 101321, 55446, 102903, 53870, 104479 } },
+	{ 79, 5, { 0, 0, 0, 0 }, { 58704, 100311, 57344, 101671, 55766, 103248, 54196, 104818 } },
+	{ 79, 6, { 0, 0, 0, 0 }, { 57915, 101519, 56660, 102774, 55198, 104237, 53735, 105701 } },
+	{ 79, 7, { 0, 0, 0, 0 }, { 56462, 102226, 55081, 103608, 53455, 105234, 51802, 106887 } },
+	{ 79, 8, { 0, 0, 0, 0 }, { 56997, 100584, 55741, 101838, 54279, 103300, 52815, 104763 } },
+	{ 79, 9, { 0, 0, 0, 0 }, { 58389, 99952, 57023, 101317, 55441, 102899, 53866, 104475 } },
+	{ 79, 10, { 0, 0, 0, 0 }, { 56331, 102035, 54957, 103410, 53339, 105029, 51696, 106673 } },
+	{ 79, 11, { 0, 0, 0, 0 }, { 57918, 101519, 56664, 102774, 55202, 104237, 53739, 105701 } },
+	{ 79, 12, { 0, 0, 0, 0 }, { 56470, 102234, 55089, 103615, 53463, 105241, 51810, 106894 } },
+	{ 79, 13, { 0, 0, 0, 0 }, { 57001, 100591, 55745, 101845, 54283, 103307, 52819, 104770 } },
+	{ 79, 14, { 0, 0, 0, 0 }, { 58380, 99943, 57015, 101308, 55432, 102891, 53857, 104466 } },
+	{ 79, 15, { 0, 0, 0, 0 }, { 57335, 99350, 56014, 100672, 54482, 102205, 52956, 103732 } },
+	{ 79, 16, { 0, 0, 0, 0 }, { 57919, 101516, 56665, 102771, 55203, 104234, 53740, 105698 } },
+	{ 79, 17, { 0, 0, 0, 0 }, { 56475, 102238, 55094, 103619, 53468, 105246, 51815, 106898 } },
+	{ 79, 18, { 0, 0, 0, 0 }, { 57002, 100595, 55747, 101850, 54284, 103312, 52820, 104775 } },
+	{ 79, 19, { 0, 0, 0, 0 }, { 58368, 99932, 57003, 101297, 55420, 102879, 53845, 104455 } },
+	{ 79, 20, { 0, 0, 0, 0 }, { 56839, 101509, 55551, 102798, 54043, 104307, 52526, 105827 } },
+	{ 79, 21, { 0, 0, 0, 0 }, { 57886, 101512, 56632, 102767, 55169, 104230, 53706, 105694 } },
+	{ 79, 22, { 0, 0, 0, 0 }, { 56493, 102255, 55112, 103636, 53486, 105262, 51833, 106915 } },
+	{ 79, 23, { 0, 0, 0, 0 }, { 56999, 100563, 55743, 101818, 54281, 103279, 52818, 104742 } },
+	{ 79, 24, { 0, 0, 0, 0 }, { 58385, 99950, 57020, 101315, 55438, 102897, 53863, 104473 } },
+	{ 79, 25, { 0, 0, 0, 0 }, { 57099, 101380, 55828, 102650, 54344, 104132, 52854, 105621 } },
+	{ 79, 26, { 0, 0, 0, 0 }, { 57896, 101513, 56642, 102768, 55180, 104231, 53716, 105695 } },
+	{ 79, 27, { 0, 0, 0, 0 }, { 56495, 102257, 55114, 103638, 53487, 105264, 51835, 106916 } },
+	{ 79, 28, { 0, 0, 0, 0 }, { 57003, 100576, 55747, 101831, 54285, 103293, 52821, 104755 } },
+	{ 79, 29, { 0, 0, 0, 0 }, { 58375, 99940, 57010, 101304, 55427, 102887, 53852, 104462 } },
+	{ 79, 30, { 0, 0, 0, 0 }, { 58937, 101290, 57642, 102585, 56137, 104088, 54638, 105587 } },
+	{ 79, 31, { 0, 0, 0, 0 }, { 57889, 101512, 56635, 102767, 55173, 104230, 53709, 105694 } },
+	{ 79, 32, { 0, 0, 0, 0 }, { 56501, 102262, 55120, 103643, 53494, 105269, 51842, 106922 } },
+	{ 79, 33, { 0, 0, 0, 0 }, { 57003, 100570, 55748, 101825, 54285, 103287, 52822, 104749 } },
+	{ 79, 34, { 0, 0, 0, 0 }, { 58376, 99942, 57011, 101307, 55429, 102889, 53854, 104464 } },
+	{ 79, 35, { 0, 0, 0, 0 }, { 56854, 102399, 55494, 103758, 53896, 105354, 52275, 106974 } },
+	{ 79, 36, { 0, 0, 0, 0 }, { 57882, 101509, 56628, 102764, 55165, 104227, 53702, 105691 } },
+	{ 79, 37, { 0, 0, 0, 0 }, { 56509, 102270, 55128, 103651, 53502, 105277, 51849, 106929 } },
+	{ 79, 38, { 0, 0, 0, 0 }, { 57004, 100566, 55748, 101821, 54286, 103283, 52823, 104745 } },
+	{ 79, 39, { 0, 0, 0, 0 }, { 58372, 99938, 57008, 101303, 55425, 102885, 53850, 104460 } },
+	{ 79, 40, { 0, 0, 0, 0 }, { 58402, 99968, 57037, 101333, 55455, 102915, 53880, 104490 } },
+	{ 79, 41, { 0, 0, 0, 0 }, { 58647, 100252, 57286, 101613, 55709, 103190, 54138, 104760 } },
+	{ 80, 0, { 0, 0, 0, 0 }, { 23727, 63146, 22296, 64577, 20649, 66223, 19023, 67849 } },
+	{ 80, 1, { 0, 0, 0, 0 }, { 21881, 65466, 20566, 66782, 19033, 68317, 17495, 69857 } },
+	{ 80, 2, { 0, 0, 0, 0 }, { 19247, 67295, 17775, 68767, 16020, 70522, 14203, 72339 } },
+	{ 80, 3, { 0, 0, 0, 0 }, { 20923, 64550, 19606, 65865, 18071, 67399, 16530, 68937 } },
+	{ 80, 4, { 0, 0, 0, 0 }, { 23436, 62768, 22000, 64204, 20349, 65855, 18718, 67486 } },
+	{ 80, 5, { 0, 0, 0, 0 }, { 23727, 63146, 22296, 64577, 20649, 66223, 19023, 67849 } },
+	{ 80, 6, { 0, 0, 0, 0 }, { 21872, 65466, 20557, 66782, 19024, 68317, 17485, 69857 } },
+	{ 80, 7, { 0, 0, 0, 0 }, { 19256, 67302, 17784, 68774, 16030, 70529, 14213, 72345 } },
+	{ 80, 8, { 0, 0, 0, 0 }, { 20925, 64543, 19609, 65858, 18074, 67392, 16533, 68931 } },
+	{ 80, 9, { 0, 0, 0, 0 }, { 23431, 62764, 21994, 64201, 20343, 65852, 18713, 67483 } },
+	{ 80, 10, { 0, 0, 0, 0 }, { 19162, 67078, 17700, 68541, 15957, 70285, 14156, 72088 } },
+	{ 80, 11, { 0, 0, 0, 0 }, { 21877, 65464, 20563, 66780, 19029, 68315, 17491, 69855 } },
+	{ 80, 12, { 0, 0, 0, 0 }, { 19264, 67309, 17793, 68781, 16038, 70536, 14222, 72352 } },
+	{ 80, 13, { 0, 0, 0, 0 }, { 20928, 64552, 19612, 65867, 18076, 67401, 16536, 68940 } },
+	{ 80, 14, { 0, 0, 0, 0 }, { 23421, 62756, 21985, 64193, 20334, 65844, 18703, 67474 } },
+	{ 80, 15, { 0, 0, 0, 0 }, { 22116, 62435, 20730, 63821, 19132, 65419, 17549, 67003 } },
+	{ 80, 16, { 0, 0, 0, 0 }, { 21880, 65459, 20566, 66774, 19032, 68309, 17495, 69849 } },
+	{ 80, 17, { 0, 0, 0, 0 }, { 19269, 67313, 17798, 68785, 16043, 70540, 14227, 72356 } },
+	{ 80, 18, { 0, 0, 0, 0 }, { 20927, 64559, 19611, 65874, 18076, 67408, 16535, 68946 } },
+	{ 80, 19, { 0, 0, 0, 0 }, { 23410, 62745, 21973, 64181, 20322, 65832, 18692, 67463 } },
+	{ 80, 20, { 0, 0, 0, 0 }, { 20230, 66016, 18874, 67375, 17277, 68974, 15657, 70598 } },
+	{ 80, 21, { 0, 0, 0, 0 }, { 21831, 65470, 20517, 66786, 18983, 68322, 17444, 69863 } },
+	{ 80, 22, { 0, 0, 0, 0 }, { 19287, 67330, 17816, 68801, 16062, 70555, 14245, 72372 } },
+	{ 80, 23, { 0, 0, 0, 0 }, { 20940, 64510, 19624, 65825, 18089, 67359, 16549, 68896 } },
+	{ 80, 24, { 0, 0, 0, 0 }, { 23427, 62764, 21991, 64200, 20340, 65851, 18709, 67481 } },
+	{ 80, 25, { 0, 0, 0, 0 }, { 20660, 65707, 19323, 67041, 17755, 68607, 16170, 70189 } },
+	{ 80, 26, { 0, 0, 0, 0 }, { 21847, 65466, 20533, 66781, 18999, 68317, 17460, 69857 } },
+	{ 80, 27, { 0, 0, 0, 0 }, { 19289, 67331, 17818, 68803, 16063, 70557, 14247, 72373 } },
+	{ 80, 28, { 0, 0, 0, 0 }, { 20939, 64529, 19623, 65844, 18088, 67377, 16548, 68915 } },
+	{ 80, 29, { 0, 0, 0, 0 }, { 23416, 62753, 21980, 64189, 20329, 65840, 18698, 67471 } },
+	{ 80, 30, { 0, 0, 0, 0 }, { 23562, 64550, 22204, 65908, 20633, 67479, 19073, 69039 } },
+	{ 80, 31, { 0, 0, 0, 0 }, { 21837, 65468, 20522, 66784, 18988, 68320, 17450, 69860 } },
+	{ 80, 32, { 0, 0, 0, 0 }, { 19296, 67337, 17825, 68808, 16070, 70562, 14254, 72378 } },
+	{ 80, 33, { 0, 0, 0, 0 }, { 20942, 64519, 19626, 65834, 18091, 67368, 16552, 68906 } },
+	{ 80, 34, { 0, 0, 0, 0 }, { 23417, 62756, 21981, 64192, 20331, 65843, 18700, 67473 } },
+	{ 80, 35, { 0, 0, 0, 0 }, { 19754, 67369, 18308, 68813, 16589, 70530, 14817, 72299 } },
+	{ 80, 36, { 0, 0, 0, 0 }, { 21827, 65467, 20513, 66783, 18979, 68318, 17440, 69859 } },
+	{ 80, 37, { 0, 0, 0, 0 }, { 19304, 67344, 17833, 68815, 16078, 70569, 14262, 72385 } },
+	{ 80, 38, { 0, 0, 0, 0 }, { 20946, 64513, 19630, 65828, 18095, 67361, 16555, 68899 } },
+	{ 80, 39, { 0, 0, 0, 0 }, { 23414, 62752, 21977, 64188, 20327, 65839, 18696, 67470 } },
+	{ 80, 40, { 0, 0, 0, 0 }, { 23443, 62783, 22007, 64219, 20356, 65869, 18726, 67500 } },
+	{ 80, 41, { 0, 0, 0, 0 }, { 23670, 63087, 22239, 64519, 20592, 66165, 18966, 67791 } },
+	{ 81, 0, { 0, 0, 0, 0 }, { -399, 39016, -1830, 40447, -3477, 42093, -5103, 43720 } },
+	{ 81, 1, { 0, 0, 0, 0 }, { -2225, 41342, -3539, 42657, -5073, 44192, -6610, 45732 } },
+	{ 81, 2, { 0, 0, 0, 0 }, { -4877, 43172, -6348, 44643, -8103, 46398, -9920, 48215 } },
+	{ 81, 3, { 0, 0, 0, 0 }, { -3201, 40445, -4517, 41760, -6053, 43294, -7594, 44833 } },
+	{ 81, 4, { 0, 0, 0, 0 }, { -692, 38639, -2129, 40076, -3780, 41727, -5411, 43358 } },
+	{ 81, 5, { 0, 0, 0, 0 }, { -399, 39016, -1830, 40447, -3477, 42093, -5103, 43720 } },
+	{ 81, 6, { 0, 0, 0, 0 }, { -2234, 41342, -3548, 42657, -5082, 44192, -6619, 45732 } },
+	{ 81, 7, { 0, 0, 0, 0 }, { -4868, 43179, -6339, 44650, -8094, 46405, -9910, 48222 } },
+	{ 81, 8, { 0, 0, 0, 0 }, { -3198, 40438, -4515, 41754, -6050, 43288, -7591, 44826 } },
+	{ 81, 9, { 0, 0, 0, 0 }, { -698, 38636, -2134, 40072, -3785, 41723, -5416, 43354 } },
+	{ 81, 10, { 0, 0, 0, 0 }, { -4958, 42952, -6420, 44415, -8162, 46159, -9963, 47961 } },
+	{ 81, 11, { 0, 0, 0, 0 }, { -2228, 41340, -3542, 42655, -5076, 44190, -6614, 45730 } },
+	{ 81, 12, { 0, 0, 0, 0 }, { -4859, 43186, -6331, 44657, -8085, 46412, -9902, 48228 } },
+	{ 81, 13, { 0, 0, 0, 0 }, { -3196, 40447, -4512, 41762, -6048, 43297, -7589, 44835 } },
+	{ 81, 14, { 0, 0, 0, 0 }, { -707, 38628, -2143, 40064, -3794, 41715, -5425, 43346 } },
+	{ 81, 15, { 0, 0, 0, 0 }, { -2014, 38319, -3399, 39704, -4996, 41302, -6579, 42885 } },
+	{ 81, 16, { 0, 0, 0, 0 }, { -2225, 41334, -3539, 42650, -5073, 44185, -6610, 45724 } },
+	{ 81, 17, { 0, 0, 0, 0 }, { -4854, 43190, -6326, 44661, -8080, 46416, -9897, 48232 } },
+	{ 81, 18, { 0, 0, 0, 0 }, { -3196, 40454, -4513, 41769, -6048, 43303, -7589, 44842 } },
+	{ 81, 19, { 0, 0, 0, 0 }, { -719, 38617, -2155, 40053, -3806, 41704, -5437, 43335 } },
+	{ 81, 20, { 0, 0, 0, 0 }, { -3878, 41891, -5233, 43249, -6829, 44847, -8449, 46471 } },
+	{ 81, 21, { 0, 0, 0, 0 }, { -2274, 41346, -3588, 42661, -5122, 44197, -6661, 45737 } },
+	{ 81, 22, { 0, 0, 0, 0 }, { -4836, 43206, -6307, 44677, -8062, 46432, -9878, 48248 } },
+	{ 81, 23, { 0, 0, 0, 0 }, { -3184, 40406, -4500, 41721, -6035, 43254, -7575, 44792 } },
+	{ 81, 24, { 0, 0, 0, 0 }, { -702, 38635, -2138, 40072, -3789, 41722, -5419, 43353 } },
+	{ 81, 25, { 0, 0, 0, 0 }, { -3464, 41601, -4801, 42936, -6370, 44502, -7956, 46085 } },
+	{ 81, 26, { 0, 0, 0, 0 }, { -2258, 41341, -3573, 42657, -5107, 44192, -6645, 45732 } },
+	{ 81, 27, { 0, 0, 0, 0 }, { -4835, 43208, -6306, 44679, -8060, 46434, -9877, 48250 } },
+	{ 81, 28, { 0, 0, 0, 0 }, { -3185, 40424, -4501, 41739, -6036, 43273, -7577, 44811 } },
+	{ 81, 29, { 0, 0, 0, 0 }, { -712, 38625, -2149, 40061, -3799, 41712, -5430, 43342 } },
+	{ 81, 30, { 0, 0, 0, 0 }, { -550, 40421, -1909, 41780, -3481, 43351, -5041, 44911 } },
+	{ 81, 31, { 0, 0, 0, 0 }, { -2269, 41344, -3583, 42659, -5117, 44195, -6655, 45735 } },
+	{ 81, 32, { 0, 0, 0, 0 }, { -4828, 43213, -6299, 44684, -8053, 46439, -9869, 48255 } },
+	{ 81, 33, { 0, 0, 0, 0 }, { -3181, 40415, -4497, 41730, -6032, 43263, -7572, 44801 } },
+	{ 81, 34, { 0, 0, 0, 0 }, { -711, 38628, -2147, 40064, -3798, 41714, -5428, 43345 } },
+	{ 81, 35, { 0, 0, 0, 0 }, { -4372, 43253, -5818, 44697, -7538, 46414, -9311, 48184 } },
+	{ 81, 36, { 0, 0, 0, 0 }, { -2278, 41342, -3593, 42658, -5127, 44193, -6665, 45734 } },
+	{ 81, 37, { 0, 0, 0, 0 }, { -4820, 43220, -6291, 44692, -8045, 46446, -9861, 48262 } },
+	{ 81, 38, { 0, 0, 0, 0 }, { -3178, 40408, -4494, 41723, -6029, 43257, -7569, 44795 } },
+	{ 81, 39, { 0, 0, 0, 0 }, { -715, 38624, -2151, 40060, -3802, 41711, -5432, 43341 } },
+	{ 81, 40, { 0, 0, 0, 0 }, { -685, 38654, -2121, 40090, -3772, 41741, -5402, 43371 } },
+	{ 81, 41, { 0, 0, 0, 0 }, { -456, 38957, -1888, 40389, -3534, 42035, -5161, 43661 } },
+	{ 82, 0, { 0, 0, 0, 0 }, { 59795, 99221, 58364, 100652, 56719, 102298, 55093, 103924 } },
+	{ 82, 1, { 0, 0, 0, 0 }, { 57919, 101533, 56604, 102849, 55070, 104384, 53532, 105925 } },
+	{ 82, 2, { 0, 0, 0, 0 }, { 55312, 103361, 53841, 104832, 52085, 106588, 50268, 108404 } },
+	{ 82, 3, { 0, 0, 0, 0 }, { 56988, 100587, 55672, 101902, 54137, 103436, 52597, 104974 } },
+	{ 82, 4, { 0, 0, 0, 0 }, { 59509, 98840, 58073, 100277, 56421, 101928, 54790, 103559 } },
+	{ 82, 5, { 0, 0, 0, 0 }, { 59795, 99221, 58364, 100652, 56719, 102298, 55093, 103924 } },
+	{ 82, 6, { 0, 0, 0, 0 }, { 57910, 101533, 56595, 102849, 55061, 104384, 53523, 105925 } },
+	{ 82, 7, { 0, 0, 0, 0 }, { 55321, 103368, 53850, 104839, 52095, 106594, 50278, 108411 } },
+	{ 82, 8, { 0, 0, 0, 0 }, { 56991, 100580, 55675, 101895, 54140, 103429, 52600, 104967 } },
+	{ 82, 9, { 0, 0, 0, 0 }, { 59504, 98837, 58067, 100273, 56416, 101924, 54785, 103555 } },
+	{ 82, 10, { 0, 0, 0, 0 }, { 55223, 103146, 53760, 104610, 52017, 106355, 50214, 108159 } },
+	{ 82, 11, { 0, 0, 0, 0 }, { 57915, 101531, 56601, 102847, 55067, 104382, 53529, 105923 } },
+	{ 82, 12, { 0, 0, 0, 0 }, { 55330, 103375, 53858, 104846, 52103, 106601, 50287, 108418 } },
+	{ 82, 13, { 0, 0, 0, 0 }, { 56993, 100589, 55677, 101904, 54142, 103438, 52602, 104976 } },
+	{ 82, 14, { 0, 0, 0, 0 }, { 59494, 98829, 58058, 100265, 56407, 101916, 54776, 103547 } },
+	{ 82, 15, { 0, 0, 0, 0 }, { 58190, 98489, 56804, 99876, 55205, 101475, 53621, 103060 } },
+	{ 82, 16, { 0, 0, 0, 0 }, { 57919, 101526, 56604, 102841, 55070, 104377, 53532, 105917 } },
+	{ 82, 17, { 0, 0, 0, 0 }, { 55334, 103379, 53863, 104850, 52108, 106605, 50292, 108421 } },
+	{ 82, 18, { 0, 0, 0, 0 }, { 56993, 100596, 55677, 101911, 54141, 103444, 52601, 104983 } },
+	{ 82, 19, { 0, 0, 0, 0 }, { 59482, 98817, 58046, 100254, 56395, 101905, 54764, 103535 } },
+	{ 82, 20, { 0, 0, 0, 0 }, { 56272, 102084, 54915, 103443, 53317, 105044, 51695, 106670 } },
+	{ 82, 21, { 0, 0, 0, 0 }, { 57870, 101537, 56555, 102853, 55021, 104389, 53481, 105931 } },
+	{ 82, 22, { 0, 0, 0, 0 }, { 55353, 103395, 53882, 104866, 52127, 106621, 50311, 108437 } },
+	{ 82, 23, { 0, 0, 0, 0 }, { 57005, 100547, 55689, 101862, 54155, 103396, 52615, 104933 } },
+	{ 82, 24, { 0, 0, 0, 0 }, { 59499, 98836, 58063, 100272, 56412, 101923, 54782, 103554 } },
+	{ 82, 25, { 0, 0, 0, 0 }, { 56725, 101745, 55390, 103079, 53823, 104643, 52239, 106224 } },
+	{ 82, 26, { 0, 0, 0, 0 }, { 57885, 101533, 56571, 102849, 55037, 104384, 53498, 105925 } },
+	{ 82, 27, { 0, 0, 0, 0 }, { 55354, 103397, 53883, 104868, 52129, 106622, 50312, 108438 } },
+	{ 82, 28, { 0, 0, 0, 0 }, { 57004, 100566, 55688, 101881, 54153, 103414, 52614, 104952 } },
+	{ 82, 29, { 0, 0, 0, 0 }, { 59489, 98825, 58052, 100262, 56402, 101913, 54771, 103543 } },
+	{ 82, 30, { 0, 0, 0, 0 }, { 59611, 100623, 58253, 101980, 56683, 103550, 55124, 105109 } },
+	{ 82, 31, { 0, 0, 0, 0 }, { 57875, 101535, 56560, 102851, 55026, 104387, 53487, 105928 } },
+	{ 82, 32, { 0, 0, 0, 0 }, { 55361, 103402, 53890, 104873, 52136, 106627, 50320, 108443 } },
+	{ 82, 33, { 0, 0, 0, 0 }, { 57008, 100556, 55692, 101871, 54157, 103405, 52618, 104942 } },
+	{ 82, 34, { 0, 0, 0, 0 }, { 59490, 98828, 58054, 100264, 56403, 101915, 54773, 103546 } },
+	{ 82, 35, { 0, 0, 0, 0 }, { 55823, 103425, 54379, 104868, 52661, 106583, 50890, 108351 } },
+	{ 82, 36, { 0, 0, 0, 0 }, { 57866, 101534, 56551, 102850, 55016, 104386, 53477, 105927 } },
+	{ 82, 37, { 0, 0, 0, 0 }, { 55369, 103409, 53898, 104880, 52144, 106634, 50328, 108450 } },
+	{ 82, 38, { 0, 0, 0, 0 }, { 57011, 100550, 55695, 101865, 54160, 103398, 52621, 104935 } },
+	{ 82, 39, { 0, 0, 0, 0 }, { 59486, 98825, 58050, 100261, 56399, 101912, 54769, 103542 } },
+	{ 82, 40, { 0, 0, 0, 0 }, { 59515, 98855, 58079, 100291, 56429, 101942, 54798, 103573 } },
+	{ 82, 41, { 0, 0, 0, 0 }, { 59739, 99162, 58307, 100594, 56662, 102239, 55036, 103865 } },
+	{ 83, 0, { 0, 0, 0, 0 }, { 24977, 61898, 23407, 63468, 21619, 65256, 19867, 67008 } },
+	{ 83, 1, { 0, 0, 0, 0 }, { 21879, 65478, 20452, 66907, 18785, 68577, 17105, 70261 } },
+	{ 83, 2, { 0, 0, 0, 0 }, { 17919, 68623, 16274, 70268, 14270, 72273, 12123, 74419 } },
+	{ 83, 3, { 0, 0, 0, 0 }, { 20898, 64564, 19469, 65991, 17798, 67660, 16113, 69341 } },
+	{ 83, 4, { 0, 0, 0, 0 }, { 24713, 61491, 23136, 63068, 21342, 64862, 19585, 66619 } },
+	{ 83, 5, { 0, 0, 0, 0 }, { 24977, 61898, 23407, 63468, 21619, 65256, 19867, 67008 } },
+	{ 83, 6, { 0, 0, 0, 0 }, { 21868, 65481, 20441, 66909, 18773, 68580, 17093, 70263 } },
+	{ 83, 7, { 0, 0, 0, 0 }, { 17929, 68629, 16284, 70274, 14280, 72278, 12134, 74425 } },
+	{ 83, 8, { 0, 0, 0, 0 }, { 20903, 64555, 19474, 65982, 17803, 67650, 16119, 69331 } },
+	{ 83, 9, { 0, 0, 0, 0 }, { 24707, 61488, 23130, 63065, 21336, 64859, 19579, 66616 } },
+	{ 83, 10, { 0, 0, 0, 0 }, { 17877, 68367, 16245, 70001, 14260, 71988, 12142, 74110 } },
+	{ 83, 11, { 0, 0, 0, 0 }, { 21875, 65476, 20449, 66905, 18781, 68575, 17101, 70259 } },
+	{ 83, 12, { 0, 0, 0, 0 }, { 17938, 68636, 16293, 70281, 14289, 72285, 12143, 74431 } },
+	{ 83, 13, { 0, 0, 0, 0 }, { 20904, 64566, 19475, 65993, 17804, 67661, 16119, 69342 } },
+	{ 83, 14, { 0, 0, 0, 0 }, { 24697, 61481, 23120, 63057, 21326, 64851, 19570, 66608 } },
+	{ 83, 15, { 0, 0, 0, 0 }, { 23082, 61463, 21570, 62975, 19838, 64707, 18131, 66413 } },
+	{ 83, 16, { 0, 0, 0, 0 }, { 21881, 65468, 20455, 66897, 18787, 68567, 17107, 70250 } },
+	{ 83, 17, { 0, 0, 0, 0 }, { 17943, 68640, 16298, 70285, 14294, 72289, 12149, 74434 } },
+	{ 83, 18, { 0, 0, 0, 0 }, { 20901, 64574, 19472, 66002, 17801, 67670, 16116, 69352 } },
+	{ 83, 19, { 0, 0, 0, 0 }, { 24685, 61469, 23108, 63046, 21314, 64840, 19558, 66597 } },
+	{ 83, 20, { 0, 0, 0, 0 }, { 19583, 66674, 18099, 68162, 16335, 69930, 14519, 71753 } },
+	{ 83, 21, { 0, 0, 0, 0 }, { 21814, 65498, 20388, 66927, 18719, 68598, 17037, 70283 } },
+	{ 83, 22, { 0, 0, 0, 0 }, { 17962, 68656, 16317, 70300, 14314, 72303, 12168, 74449 } },
+	{ 83, 23, { 0, 0, 0, 0 }, { 20932, 64508, 19503, 65935, 17833, 67603, 16150, 69282 } },
+	{ 83, 24, { 0, 0, 0, 0 }, { 24702, 61489, 23125, 63065, 21331, 64859, 19575, 66616 } },
+	{ 83, 25, { 0, 0, 0, 0 }, { 20219, 66137, 18761, 67592, 17039, 69310, 15279, 71064 } },
+	{ 83, 26, { 0, 0, 0, 0 }, { 21836, 65487, 20409, 66916, 18741, 68587, 17060, 70271 } },
+	{ 83, 27, { 0, 0, 0, 0 }, { 17963, 68657, 16319, 70302, 14315, 72305, 12170, 74451 } },
+	{ 83, 28, { 0, 0, 0, 0 }, { 20925, 64532, 19496, 65959, 17826, 67627, 16142, 69307 } },
+	{ 83, 29, { 0, 0, 0, 0 }, { 24691, 61478, 23114, 63055, 21321, 64848, 19564, 66605 } },
+	{ 83, 30, { 0, 0, 0, 0 }, { 24332, 63788, 22854, 65266, 21153, 66967, 19471, 68650 } },
+	{ 83, 31, { 0, 0, 0, 0 }, { 21822, 65493, 20395, 66922, 18727, 68593, 17045, 70278 } },
+	{ 83, 32, { 0, 0, 0, 0 }, { 17970, 68662, 16326, 70306, 14323, 72310, 12178, 74455 } },
+	{ 83, 33, { 0, 0, 0, 0 }, { 20933, 64519, 19504, 65946, 17833, 67614, 16150, 69293 } },
+	{ 83, 34, { 0, 0, 0, 0 }, { 24692, 61481, 23115, 63058, 21322, 64852, 19565, 66608 } },
+	{ 83, 35, { 0, 0, 0, 0 }, { 18554, 68563, 16946, 70169, 14997, 72113, 12929, 74175 } },
+	{ 83, 36, { 0, 0, 0, 0 }, { 21810, 65495, 20383, 66923, 18715, 68595, 17033, 70280 } },
+	{ 83, 37, { 0, 0, 0, 0 }, { 17978, 68669, 16334, 70313, 14331, 72316, 12186, 74461 } },
+	{ 83, 38, { 0, 0, 0, 0 }, { 20938, 64510, 19510, 65937, 17840, 67604, 16157, 69284 } },
+	{ 83, 39, { 0, 0, 0, 0 }, { 24688, 61478, 23111, 63054, 21318, 64848, 19561, 66604 } },
+	{ 83, 40, { 0, 0, 0, 0 }, { 24717, 61508, 23141, 63085, 21347, 64878, 19591, 66635 } },
+	{ 83, 41, { 0, 0, 0, 0 }, { 24921, 61838, 23350, 63409, 21562, 65197, 19810, 66949 } },
+	{ 84, 0, { 0, 0, 0, 0 }, { 853, 37766, -718, 39337, -2506, 41125, -4258, 42877 } },
+	{ 84, 1, { 0, 0, 0, 0 }, { -2221, 41348, -3647, 42777, -5315, 44447, -6994, 46130 } },
+	{ 84, 2, { 0, 0, 0, 0 }, { -6204, 44499, -7849, 46145, -9853, 48149, -12000, 50296 } },
+	{ 84, 3, { 0, 0, 0, 0 }, { -3231, 40465, -4661, 41892, -6332, 43561, -8018, 45243 } },
+	{ 84, 4, { 0, 0, 0, 0 }, { 584, 37363, -993, 38940, -2787, 40734, -4544, 42491 } },
+	{ 84, 5, { 0, 0, 0, 0 }, { 853, 37766, -718, 39337, -2506, 41125, -4258, 42877 } },
+	{ 84, 6, { 0, 0, 0, 0 }, { -2232, 41350, -3659, 42779, -5326, 44449, -7006, 46132 } },
+	{ 84, 7, { 0, 0, 0, 0 }, { -6194, 44506, -7839, 46151, -9843, 48155, -11989, 50301 } },
+	{ 84, 8, { 0, 0, 0, 0 }, { -3226, 40456, -4655, 41883, -6326, 43552, -8012, 45233 } },
+	{ 84, 9, { 0, 0, 0, 0 }, { 578, 37360, -999, 38937, -2793, 40731, -4549, 42487 } },
+	{ 84, 10, { 0, 0, 0, 0 }, { -6242, 44240, -7873, 45873, -9857, 47859, -11975, 49980 } },
+	{ 84, 11, { 0, 0, 0, 0 }, { -2224, 41346, -3651, 42774, -5318, 44445, -6998, 46128 } },
+	{ 84, 12, { 0, 0, 0, 0 }, { -6186, 44512, -7830, 46157, -9834, 48161, -11980, 50307 } },
+	{ 84, 13, { 0, 0, 0, 0 }, { -3225, 40467, -4655, 41894, -6326, 43562, -8011, 45244 } },
+	{ 84, 14, { 0, 0, 0, 0 }, { 568, 37352, -1009, 38929, -2802, 40723, -4559, 42480 } },
+	{ 84, 15, { 0, 0, 0, 0 }, { -1052, 37351, -2563, 38863, -4295, 40594, -6001, 42299 } },
+	{ 84, 16, { 0, 0, 0, 0 }, { -2219, 41338, -3645, 42766, -5312, 44436, -6992, 46119 } },
+	{ 84, 17, { 0, 0, 0, 0 }, { -6181, 44516, -7825, 46161, -9829, 48165, -11975, 50311 } },
+	{ 84, 18, { 0, 0, 0, 0 }, { -3228, 40475, -4657, 41903, -6329, 43571, -8014, 45254 } },
+	{ 84, 19, { 0, 0, 0, 0 }, { 556, 37341, -1021, 38918, -2815, 40712, -4571, 42469 } },
+	{ 84, 20, { 0, 0, 0, 0 }, { -4520, 42543, -6003, 44030, -7766, 45798, -9580, 47619 } },
+	{ 84, 21, { 0, 0, 0, 0 }, { -2286, 41368, -3712, 42796, -5380, 44467, -7061, 46152 } },
+	{ 84, 22, { 0, 0, 0, 0 }, { -6162, 44532, -7807, 46177, -9810, 48180, -11955, 50325 } },
+	{ 84, 23, { 0, 0, 0, 0 }, { -3197, 40409, -4626, 41836, -6297, 43504, -7981, 45184 } },
+	{ 84, 24, { 0, 0, 0, 0 }, { 573, 37360, -1003, 38937, -2797, 40731, -4554, 42487 } },
+	{ 84, 25, { 0, 0, 0, 0 }, { -3910, 42037, -5369, 43492, -7092, 45211, -8853, 46967 } },
+	{ 84, 26, { 0, 0, 0, 0 }, { -2264, 41357, -3690, 42785, -5358, 44456, -7039, 46140 } },
+	{ 84, 27, { 0, 0, 0, 0 }, { -6161, 44534, -7805, 46178, -9808, 48182, -11954, 50327 } },
+	{ 84, 28, { 0, 0, 0, 0 }, { -3204, 40433, -4633, 41860, -6304, 43528, -7988, 45209 } },
+	{ 84, 29, { 0, 0, 0, 0 }, { 562, 37350, -1014, 38927, -2808, 40720, -4565, 42477 } },
+	{ 84, 30, { 0, 0, 0, 0 }, { 224, 39654, -1255, 41133, -2956, 42835, -4639, 44518 } },
+	{ 84, 31, { 0, 0, 0, 0 }, { -2278, 41363, -3704, 42792, -5373, 44463, -7053, 46147 } },
+	{ 84, 32, { 0, 0, 0, 0 }, { -6153, 44539, -7798, 46183, -9801, 48186, -11946, 50331 } },
+	{ 84, 33, { 0, 0, 0, 0 }, { -3197, 40420, -4626, 41847, -6296, 43515, -7980, 45195 } },
+	{ 84, 34, { 0, 0, 0, 0 }, { 563, 37353, -1013, 38930, -2807, 40723, -4563, 42480 } },
+	{ 84, 35, { 0, 0, 0, 0 }, { -5575, 44449, -7184, 46055, -9134, 48001, -11203, 50065 } },
+	{ 84, 36, { 0, 0, 0, 0 }, { -2290, 41364, -3717, 42793, -5385, 44464, -7066, 46149 } },
+	{ 84, 37, { 0, 0, 0, 0 }, { -6145, 44546, -7790, 46190, -9793, 48193, -11938, 50338 } },
+	{ 84, 38, { 0, 0, 0, 0 }, { -3191, 40411, -4620, 41838, -6290, 43506, -7974, 45186 } },
+	{ 84, 39, { 0, 0, 0, 0 }, { 559, 37350, -1017, 38926, -2811, 40720, -4567, 42476 } },
+	{ 84, 40, { 0, 0, 0, 0 }, { 589, 37380, -987, 38956, -2781, 40750, -4537, 42506 } },
+	{ 84, 41, { 0, 0, 0, 0 }, { 796, 37707, -775, 39278, -2563, 41066, -4315, 42818 } },
+	{ 85, 0, { 0, 0, 0, 0 }, { 61044, 97975, 59473, 99546, 57686, 101333, 55935, 103084 } },
+	{ 85, 1, { 0, 0, 0, 0 }, { 57908, 101554, 56482, 102982, 54814, 104653, 53133, 106338 } },
+	{ 85, 2, { 0, 0, 0, 0 }, { 53984, 104689, 52339, 106334, 50335, 108338, 48188, 110485 } },
+	{ 85, 3, { 0, 0, 0, 0 }, { 56972, 100593, 55543, 102020, 53872, 103688, 52188, 105368 } },
+	{ 85, 4, { 0, 0, 0, 0 }, { 60786, 97563, 59209, 99140, 57415, 100934, 55658, 102691 } },
+	{ 85, 5, { 0, 0, 0, 0 }, { 61044, 97975, 59473, 99546, 57686, 101333, 55935, 103084 } },
+	{ 85, 6, { 0, 0, 0, 0 }, { 57897, 101556, 56471, 102985, 54802, 104656, 53121, 106340 } },
+	{ 85, 7, { 0, 0, 0, 0 }, { 53994, 104695, 52349, 106340, 50345, 108344, 48199, 110490 } },
+	{ 85, 8, { 0, 0, 0, 0 }, { 56977, 100584, 55548, 102011, 53878, 103678, 52194, 105359 } },
+	{ 85, 9, { 0, 0, 0, 0 }, { 60780, 97560, 59203, 99137, 57409, 100931, 55652, 102688 } },
+	{ 85, 10, { 0, 0, 0, 0 }, { 53935, 104438, 52302, 106072, 50317, 108060, 48196, 110184 } },
+	{ 85, 11, { 0, 0, 0, 0 }, { 57905, 101552, 56478, 102980, 54810, 104651, 53129, 106336 } },
+	{ 85, 12, { 0, 0, 0, 0 }, { 54003, 104702, 52358, 106346, 50354, 108350, 48208, 110496 } },
+	{ 85, 13, { 0, 0, 0, 0 }, { 56978, 100595, 55549, 102021, 53878, 103689, 52194, 105370 } },
+	{ 85, 14, { 0, 0, 0, 0 }, { 60770, 97553, 59193, 99130, 57399, 100924, 55643, 102680 } },
+	{ 85, 15, { 0, 0, 0, 0 }, { 59163, 97511, 57649, 99024, 55916, 100757, 54209, 102464 } },
+	{ 85, 16, { 0, 0, 0, 0 }, { 57911, 101544, 56484, 102972, 54816, 104643, 53135, 106327 } },
+	{ 85, 17, { 0, 0, 0, 0 }, { 54008, 104705, 52363, 106350, 50359, 108354, 48213, 110500 } },
+	{ 85, 18, { 0, 0, 0, 0 }, { 56975, 100603, 55546, 102030, 53875, 103698, 52191, 105379 } },
+	{ 85, 19, { 0, 0, 0, 0 }, { 60758, 97542, 59181, 99119, 57387, 100912, 55631, 102669 } },
+	{ 85, 20, { 0, 0, 0, 0 }, { 55617, 102750, 54132, 104239, 52366, 106009, 50547, 107834 } },
+	{ 85, 21, { 0, 0, 0, 0 }, { 57844, 101573, 56417, 103002, 54748, 104674, 53065, 106360 } },
+	{ 85, 22, { 0, 0, 0, 0 }, { 54027, 104721, 52383, 106365, 50379, 108368, 48234, 110513 } },
+	{ 85, 23, { 0, 0, 0, 0 }, { 57006, 100537, 55577, 101964, 53907, 103631, 52225, 105310 } },
+	{ 85, 24, { 0, 0, 0, 0 }, { 60774, 97561, 59198, 99138, 57404, 100932, 55647, 102688 } },
+	{ 85, 25, { 0, 0, 0, 0 }, { 56292, 102167, 54836, 103621, 53115, 105338, 51357, 107090 } },
+	{ 85, 26, { 0, 0, 0, 0 }, { 57866, 101563, 56439, 102991, 54770, 104663, 53088, 106349 } },
+	{ 85, 27, { 0, 0, 0, 0 }, { 54029, 104722, 52384, 106367, 50381, 108370, 48235, 110515 } },
+	{ 85, 28, { 0, 0, 0, 0 }, { 56999, 100561, 55570, 101988, 53900, 103655, 52217, 105335 } },
+	{ 85, 29, { 0, 0, 0, 0 }, { 60764, 97551, 59187, 99127, 57393, 100921, 55637, 102677 } },
+	{ 85, 30, { 0, 0, 0, 0 }, { 60373, 99868, 58896, 101346, 57197, 103046, 55515, 104728 } },
+	{ 85, 31, { 0, 0, 0, 0 }, { 57852, 101569, 56425, 102998, 54756, 104670, 53074, 106356 } },
+	{ 85, 32, { 0, 0, 0, 0 }, { 54036, 104727, 52392, 106371, 50388, 108374, 48243, 110519 } },
+	{ 85, 33, { 0, 0, 0, 0 }, { 57006, 100548, 55578, 101975, 53908, 103642, 52225, 105321 } },
+	{ 85, 34, { 0, 0, 0, 0 }, { 60765, 97554, 59188, 99131, 57394, 100924, 55638, 102681 } },
+	{ 85, 35, { 0, 0, 0, 0 }, { 54628, 104614, 53021, 106218, 51074, 108161, 49008, 110221 } },
+	{ 85, 36, { 0, 0, 0, 0 }, { 57840, 101570, 56413, 102999, 54744, 104671, 53061, 106357 } },
+	{ 85, 37, { 0, 0, 0, 0 }, { 54044, 104734, 52400, 106378, 50397, 108381, 48252, 110526 } },
+	{ 85, 38, { 0, 0, 0, 0 }, { 57012, 100539, 55583, 101966, 53914, 103632, 52232, 105311 } },
+	{ 85, 39, { 0, 0, 0, 0 }, { 60760, 97550, 59184, 99127, 57390, 100921, 55634, 102677 } },
+	{ 85, 40, { 0, 0, 0, 0 }, { 60789, 97582, 59213, 99158, 57419, 100952, 55663, 102708 } },
+	{ 85, 41, { 0, 0, 0, 0 }, { 60987, 97916, 59417, 99486, 57630, 101274, 55878, 103025 } },
+	{ 86, 0, { 0, 0, 0, 0 }, { 26540, 60337, 24721, 62156, 22683, 64194, 20709, 66169 } },
+	{ 86, 1, { 0, 0, 0, 0 }, { 21869, 65501, 20255, 67118, 18362, 69016, 16438, 70946 } },
+	{ 86, 2, { 0, 0, 0, 0 }, { 16229, 70314, 14259, 72283, 11752, 74791, 8823, 77721 } },
+	{ 86, 3, { 0, 0, 0, 0 }, { 20860, 64590, 19242, 66204, 17343, 68099, 15410, 70026 } },
+	{ 86, 4, { 0, 0, 0, 0 }, { 26311, 59893, 24482, 61722, 22435, 63768, 20454, 65749 } },
+	{ 86, 5, { 0, 0, 0, 0 }, { 26540, 60337, 24721, 62156, 22683, 64194, 20709, 66169 } },
+	{ 86, 6, { 0, 0, 0, 0 }, { 21854, 65506, 20241, 67123, 18347, 69021, 16423, 70952 } },
+	{ 86, 7, { 0, 0, 0, 0 }, { 16239, 70319, 14270, 72288, 11764, 74795, 8835, 77724 } },
+	{ 86, 8, { 0, 0, 0, 0 }, { 20868, 64578, 19251, 66192, 17352, 68086, 15419, 70012 } },
+	{ 86, 9, { 0, 0, 0, 0 }, { 26304, 59891, 24475, 61719, 22429, 63766, 20448, 65747 } },
+	{ 86, 10, { 0, 0, 0, 0 }, { 16243, 70006, 14297, 71955, 11830, 74428, 8976, 77291 } },
+	{ 86, 11, { 0, 0, 0, 0 }, { 21865, 65499, 20252, 67116, 18358, 69014, 16434, 70945 } },
+	{ 86, 12, { 0, 0, 0, 0 }, { 16249, 70325, 14280, 72294, 11773, 74801, 8846, 77729 } },
+	{ 86, 13, { 0, 0, 0, 0 }, { 20867, 64591, 19249, 66205, 17350, 68099, 15417, 70026 } },
+	{ 86, 14, { 0, 0, 0, 0 }, { 26293, 59884, 24465, 61712, 22419, 63759, 20438, 65739 } },
+	{ 86, 15, { 0, 0, 0, 0 }, { 24276, 60262, 22544, 61994, 20581, 63956, 18660, 65876 } },
+	{ 86, 16, { 0, 0, 0, 0 }, { 21873, 65488, 20260, 67105, 18367, 69003, 16444, 70933 } },
+	{ 86, 17, { 0, 0, 0, 0 }, { 16254, 70329, 14285, 72298, 11779, 74804, 8852, 77732 } },
+	{ 86, 18, { 0, 0, 0, 0 }, { 20862, 64602, 19244, 66216, 17344, 68111, 15411, 70038 } },
+	{ 86, 19, { 0, 0, 0, 0 }, { 26281, 59873, 24453, 61702, 22406, 63748, 20426, 65728 } },
+	{ 86, 20, { 0, 0, 0, 0 }, { 18775, 67496, 17071, 69205, 15013, 71272, 12834, 73464 } },
+	{ 86, 21, { 0, 0, 0, 0 }, { 21785, 65540, 20171, 67157, 18276, 69057, 16349, 70991 } },
+	{ 86, 22, { 0, 0, 0, 0 }, { 16274, 70343, 14305, 72312, 11800, 74817, 8873, 77743 } },
+	{ 86, 23, { 0, 0, 0, 0 }, { 20914, 64514, 19297, 66128, 17399, 68020, 15470, 69944 } },
+	{ 86, 24, { 0, 0, 0, 0 }, { 26297, 59893, 24469, 61721, 22423, 63767, 20443, 65748 } },
+	{ 86, 25, { 0, 0, 0, 0 }, { 19667, 66675, 18004, 68333, 16017, 70313, 13945, 72375 } },
+	{ 86, 26, { 0, 0, 0, 0 }, { 21814, 65522, 20201, 67139, 18306, 69038, 16380, 70970 } },
+	{ 86, 27, { 0, 0, 0, 0 }, { 16275, 70345, 14307, 72314, 11801, 74819, 8875, 77745 } },
+	{ 86, 28, { 0, 0, 0, 0 }, { 20900, 64545, 19283, 66159, 17385, 68052, 15454, 69977 } },
+	{ 86, 29, { 0, 0, 0, 0 }, { 26286, 59883, 24458, 61711, 22412, 63757, 20432, 65737 } },
+	{ 86, 30, { 0, 0, 0, 0 }, { 25276, 62853, 23593, 64537, 21671, 66459, 19778, 68355 } },
+	{ 86, 31, { 0, 0, 0, 0 }, { 21795, 65533, 20182, 67150, 18287, 69049, 16360, 70983 } },
+	{ 86, 32, { 0, 0, 0, 0 }, { 16283, 70349, 14315, 72317, 11810, 74822, 8884, 77748 } },
+	{ 86, 33, { 0, 0, 0, 0 }, { 20912, 64527, 19295, 66141, 17398, 68034, 15468, 69958 } },
+	{ 86, 34, { 0, 0, 0, 0 }, { 26287, 59886, 24459, 61714, 22413, 63760, 20433, 65741 } },
+	{ 86, 35, { 0, 0, 0, 0 }, { 17034, 70074, 15128, 71975, 12733, 74362, 10008, 77072 } },
+	{ 86, 36, { 0, 0, 0, 0 }, { 21780, 65537, 20167, 67154, 18272, 69054, 16344, 70988 } },
+	{ 86, 37, { 0, 0, 0, 0 }, { 16291, 70356, 14323, 72324, 11818, 74829, 8893, 77754 } },
+	{ 86, 38, { 0, 0, 0, 0 }, { 20922, 64515, 19305, 66128, 17407, 68021, 15478, 69944 } },
+	{ 86, 39, { 0, 0, 0, 0 }, { 26283, 59883, 24455, 61711, 22409, 63757, 20429, 65737 } },
+	{ 86, 40, { 0, 0, 0, 0 }, { 26312, 59914, 24484, 61742, 22438, 63788, 20458, 65768 } },
+	{ 86, 41, { 0, 0, 0, 0 }, { 26484, 60277, 24665, 62096, 22627, 64134, 20652, 66109 } },
+	{ 87, 0, { 0, 0, 0, 0 }, { 2417, 36204, 598, 38023, -1440, 40061, -3415, 42036 } },
+	{ 87, 1, { 0, 0, 0, 0 }, { -2224, 41364, -3837, 42980, -5730, 44878, -7653, 46807 } },
+	{ 87, 2, { 0, 0, 0, 0 }, { -7894, 46190, -9864, 48160, -12371, 50667, -15300, 53597 } },
+	{ 87, 3, { 0, 0, 0, 0 }, { -3276, 40498, -4894, 42112, -6794, 44008, -8729, 45935 } },
+	{ 87, 4, { 0, 0, 0, 0 }, { 2182, 35765, 353, 37594, -1693, 39640, -3674, 41621 } },
+	{ 87, 5, { 0, 0, 0, 0 }, { 2417, 36204, 598, 38023, -1440, 40061, -3415, 42036 } },
+	{ 87, 6, { 0, 0, 0, 0 }, { -2239, 41369, -3852, 42986, -5745, 44883, -7668, 46813 } },
+	{ 87, 7, { 0, 0, 0, 0 }, { -7884, 46195, -9853, 48165, -12359, 50671, -15288, 53600 } },
+	{ 87, 8, { 0, 0, 0, 0 }, { -3268, 40485, -4885, 42100, -6785, 43994, -8719, 45922 } },
+	{ 87, 9, { 0, 0, 0, 0 }, { 2175, 35763, 346, 37591, -1700, 39638, -3681, 41618 } },
+	{ 87, 10, { 0, 0, 0, 0 }, { -7873, 45876, -9819, 47825, -12284, 50296, -15135, 53157 } },
+	{ 87, 11, { 0, 0, 0, 0 }, { -2228, 41362, -3841, 42979, -5734, 44876, -7657, 46805 } },
+	{ 87, 12, { 0, 0, 0, 0 }, { -7875, 46202, -9843, 48171, -12350, 50677, -15277, 53605 } },
+	{ 87, 13, { 0, 0, 0, 0 }, { -3269, 40498, -4887, 42113, -6787, 44008, -8721, 45936 } },
+	{ 87, 14, { 0, 0, 0, 0 }, { 2164, 35756, 336, 37584, -1710, 39631, -3691, 41611 } },
+	{ 87, 15, { 0, 0, 0, 0 }, { 137, 36155, -1594, 37886, -3556, 39847, -5477, 41767 } },
+	{ 87, 16, { 0, 0, 0, 0 }, { -2219, 41351, -3832, 42968, -5725, 44865, -7647, 46794 } },
+	{ 87, 17, { 0, 0, 0, 0 }, { -7869, 46205, -9838, 48174, -12344, 50680, -15271, 53608 } },
+	{ 87, 18, { 0, 0, 0, 0 }, { -3275, 40510, -4892, 42124, -6793, 44019, -8727, 45948 } },
+	{ 87, 19, { 0, 0, 0, 0 }, { 2152, 35745, 324, 37574, -1722, 39620, -3703, 41600 } },
+	{ 87, 20, { 0, 0, 0, 0 }, { -5321, 43359, -7024, 45067, -9080, 47132, -11256, 49320 } },
+	{ 87, 21, { 0, 0, 0, 0 }, { -2308, 41402, -3921, 43019, -5816, 44919, -7742, 46851 } },
+	{ 87, 22, { 0, 0, 0, 0 }, { -7850, 46220, -9819, 48189, -12324, 50694, -15250, 53620 } },
+	{ 87, 23, { 0, 0, 0, 0 }, { -3222, 40422, -4839, 42036, -6738, 43929, -8668, 45853 } },
+	{ 87, 24, { 0, 0, 0, 0 }, { 2169, 35765, 341, 37593, -1705, 39639, -3686, 41619 } },
+	{ 87, 25, { 0, 0, 0, 0 }, { -4469, 42582, -6132, 44240, -8121, 46222, -10196, 48287 } },
+	{ 87, 26, { 0, 0, 0, 0 }, { -2279, 41384, -3892, 43001, -5786, 44900, -7711, 46831 } },
+	{ 87, 27, { 0, 0, 0, 0 }, { -7849, 46222, -9817, 48190, -12322, 50696, -15249, 53622 } },
+	{ 87, 28, { 0, 0, 0, 0 }, { -3236, 40453, -4853, 42067, -6752, 43961, -8684, 45886 } },
+	{ 87, 29, { 0, 0, 0, 0 }, { 2158, 35754, 330, 37582, -1716, 39628, -3697, 41609 } },
+	{ 87, 30, { 0, 0, 0, 0 }, { 1174, 38713, -510, 40398, -2432, 42321, -4326, 44217 } },
+	{ 87, 31, { 0, 0, 0, 0 }, { -2297, 41395, -3911, 43012, -5805, 44911, -7731, 46843 } },
+	{ 87, 32, { 0, 0, 0, 0 }, { -7841, 46226, -9809, 48194, -12314, 50699, -15239, 53625 } },
+	{ 87, 33, { 0, 0, 0, 0 }, { -3224, 40435, -4841, 42049, -6739, 43942, -8670, 45867 } },
+	{ 87, 34, { 0, 0, 0, 0 }, { 2158, 35758, 330, 37586, -1716, 39632, -3696, 41612 } },
+	{ 87, 35, { 0, 0, 0, 0 }, { -7099, 45964, -9006, 47866, -11404, 50255, -14132, 52969 } },
+	{ 87, 36, { 0, 0, 0, 0 }, { -2312, 41399, -3926, 43016, -5820, 44915, -7746, 46848 } },
+	{ 87, 37, { 0, 0, 0, 0 }, { -7833, 46233, -9801, 48201, -12306, 50706, -15231, 53631 } },
+	{ 87, 38, { 0, 0, 0, 0 }, { -3214, 40422, -4832, 42036, -6730, 43929, -8660, 45854 } },
+	{ 87, 39, { 0, 0, 0, 0 }, { 2154, 35755, 326, 37583, -1720, 39628, -3700, 41609 } },
+	{ 87, 40, { 0, 0, 0, 0 }, { 2184, 35785, 356, 37613, -1690, 39659, -3670, 41639 } },
+	{ 87, 41, { 0, 0, 0, 0 }, { 2361, 36144, 542, 37963, -1497, 40002, -3472, 41977 } },
+	{ 88, 0, { 0, 0, 0, 0 }, { 62603, 96418, 60785, 98236, 58748, 100273, 56774, 102248 } },
+	{ 88, 1, { 0, 0, 0, 0 }, { 57888, 101587, 56274, 103204, 54380, 105103, 52454, 107035 } },
+	{ 88, 2, { 0, 0, 0, 0 }, { 52294, 106379, 50324, 108349, 47817, 110856, 44887, 113786 } },
+	{ 88, 3, { 0, 0, 0, 0 }, { 56944, 100609, 55327, 102223, 53428, 104116, 51497, 106041 } },
+	{ 88, 4, { 0, 0, 0, 0 }, { 62384, 95965, 60555, 97794, 58508, 99840, 56528, 101821 } },
+	{ 88, 5, { 0, 0, 0, 0 }, { 62603, 96418, 60785, 98236, 58748, 100273, 56774, 102248 } },
+	{ 88, 6, { 0, 0, 0, 0 }, { 57874, 101592, 56260, 103209, 54366, 105108, 52439, 107041 } },
+	{ 88, 7, { 0, 0, 0, 0 }, { 52304, 106384, 50335, 108353, 47829, 110860, 44900, 113789 } },
+	{ 88, 8, { 0, 0, 0, 0 }, { 56953, 100596, 55335, 102210, 53437, 104103, 51507, 106028 } },
+	{ 88, 9, { 0, 0, 0, 0 }, { 62377, 95963, 60548, 97792, 58502, 99838, 56521, 101819 } },
+	{ 88, 10, { 0, 0, 0, 0 }, { 52298, 106080, 50350, 108031, 47881, 110505, 45023, 113373 } },
+	{ 88, 11, { 0, 0, 0, 0 }, { 57884, 101585, 56271, 103202, 54376, 105101, 52451, 107033 } },
+	{ 88, 12, { 0, 0, 0, 0 }, { 52314, 106391, 50345, 108360, 47838, 110866, 44910, 113794 } },
+	{ 88, 13, { 0, 0, 0, 0 }, { 56951, 100609, 55334, 102223, 53435, 104117, 51504, 106041 } },
+	{ 88, 14, { 0, 0, 0, 0 }, { 62366, 95956, 60538, 97785, 58492, 99831, 56511, 101812 } },
+	{ 88, 15, { 0, 0, 0, 0 }, { 60365, 96302, 58631, 98035, 56667, 99999, 54745, 101920 } },
+	{ 88, 16, { 0, 0, 0, 0 }, { 57893, 101574, 56279, 103191, 54386, 105090, 52460, 107022 } },
+	{ 88, 17, { 0, 0, 0, 0 }, { 52319, 106394, 50350, 108363, 47844, 110869, 44916, 113797 } },
+	{ 88, 18, { 0, 0, 0, 0 }, { 56946, 100620, 55328, 102234, 53430, 104128, 51498, 106054 } },
+	{ 88, 19, { 0, 0, 0, 0 }, { 62354, 95945, 60526, 97774, 58480, 99820, 56499, 101800 } },
+	{ 88, 20, { 0, 0, 0, 0 }, { 54799, 103581, 53094, 105293, 51032, 107363, 48848, 109560 } },
+	{ 88, 21, { 0, 0, 0, 0 }, { 57804, 101625, 56190, 103243, 54294, 105144, 52365, 107080 } },
+	{ 88, 22, { 0, 0, 0, 0 }, { 52339, 106408, 50371, 108376, 47865, 110882, 44939, 113807 } },
+	{ 88, 23, { 0, 0, 0, 0 }, { 56998, 100533, 55381, 102146, 53484, 104038, 51557, 105960 } },
+	{ 88, 24, { 0, 0, 0, 0 }, { 62370, 95966, 60542, 97794, 58496, 99840, 56515, 101820 } },
+	{ 88, 25, { 0, 0, 0, 0 }, { 55751, 102695, 54089, 104352, 52105, 106330, 50036, 108388 } },
+	{ 88, 26, { 0, 0, 0, 0 }, { 57833, 101608, 56220, 103225, 54324, 105125, 52396, 107059 } },
+	{ 88, 27, { 0, 0, 0, 0 }, { 52340, 106410, 50372, 108378, 47866, 110884, 44940, 113810 } },
+	{ 88, 28, { 0, 0, 0, 0 }, { 56984, 100564, 55367, 102177, 53470, 104070, 51541, 105993 } },
+	{ 88, 29, { 0, 0, 0, 0 }, { 62359, 95955, 60531, 97783, 58485, 99829, 56504, 101810 } },
+	{ 88, 30, { 0, 0, 0, 0 }, { 61307, 98943, 59626, 100625, 57706, 102547, 55813, 104442 } },
+	{ 88, 31, { 0, 0, 0, 0 }, { 57815, 101618, 56201, 103236, 54305, 105136, 52377, 107072 } },
+	{ 88, 32, { 0, 0, 0, 0 }, { 52349, 106414, 50380, 108382, 47875, 110887, 44950, 113812 } },
+	{ 88, 33, { 0, 0, 0, 0 }, { 56996, 100546, 55379, 102159, 53483, 104051, 51554, 105973 } },
+	{ 88, 34, { 0, 0, 0, 0 }, { 62359, 95959, 60531, 97787, 58486, 99833, 56505, 101813 } },
+	{ 88, 35, { 0, 0, 0, 0 }, { 53113, 106119, 51209, 108018, 48817, 110402, 46099, 113105 } },
+	{ 88, 36, { 0, 0, 0, 0 }, { 57800, 101623, 56186, 103240, 54290, 105141, 52361, 107077 } },
+	{ 88, 37, { 0, 0, 0, 0 }, { 52357, 106421, 50389, 108389, 47884, 110893, 44959, 113818 } },
+	{ 88, 38, { 0, 0, 0, 0 }, { 57005, 100533, 55389, 102147, 53492, 104038, 51565, 105960 } },
+	{ 88, 39, { 0, 0, 0, 0 }, { 62355, 95956, 60527, 97784, 58481, 99829, 56501, 101810 } },
+	{ 88, 40, { 0, 0, 0, 0 }, { 62384, 95988, 60556, 97815, 58510, 99861, 56530, 101841 } },
+	{ 88, 41, { 0, 0, 0, 0 }, { 62548, 96357, 60730, 98176, 58692, 100213, 56718, 102188 } },
+	{ 89, 0, { 0, 0, 0, 0 }, { 28744, 58136, 26460, 60420, 23978, 62903, 21618, 65263 } },
+	{ 89, 1, { 0, 0, 0, 0 }, { 21845, 65542, 19921, 67472, 17645, 69756, 15291, 72123 } },
+	{ 89, 2, { 0, 0, 0, 1 }, { 13784, 72759, 11107, 75436, 7157, 79387, 0, 0 } },
+	{ 89, 3, { 0, 0, 0, 0 }, { 20798, 64635, 18867, 66560, 16579, 68839, 14206, 71199 } },
+	{ 89, 4, { 0, 0, 0, 0 }, { 28571, 57633, 26267, 59936, 23770, 62433, 21401, 64802 } },
+	{ 89, 5, { 0, 0, 0, 0 }, { 28744, 58136, 26460, 60420, 23978, 62903, 21618, 65263 } },
+	{ 89, 6, { 0, 0, 0, 0 }, { 21827, 65551, 19902, 67481, 17626, 69766, 15270, 72135 } },
+	{ 89, 7, { 0, 0, 0, 1 }, { 13796, 72763, 11120, 75439, 7173, 79387, 0, 0 } },
+	{ 89, 8, { 0, 0, 0, 0 }, { 20812, 64618, 18880, 66543, 16594, 68821, 14222, 71180 } },
+	{ 89, 9, { 0, 0, 0, 0 }, { 28562, 57632, 26259, 59935, 23763, 62432, 21394, 64801 } },
+	{ 89, 10, { 0, 0, 0, 2 }, { 13892, 72367, 11273, 74994, 7487, 78801, 0, 0 } },
+	{ 89, 11, { 0, 0, 0, 0 }, { 21841, 65540, 19917, 67470, 17641, 69755, 15286, 72122 } },
+	{ 89, 12, { 0, 0, 0, 1 }, { 13806, 72768, 11131, 75444, 7185, 79390, 0, 0 } },
+	{ 89, 13, { 0, 0, 0, 0 }, { 20807, 64634, 18875, 66559, 16588, 68838, 14215, 71198 } },
+	{ 89, 14, { 0, 0, 0, 0 }, { 28551, 57626, 26248, 59929, 23752, 62425, 21383, 64794 } },
+	{ 89, 15, { 0, 0, 0, 0 }, { 25922, 58608, 23799, 60729, 21440, 63087, 19155, 65369 } },
+	{ 89, 16, { 0, 0, 0, 0 }, { 21854, 65525, 19930, 67455, 17655, 69739, 15301, 72105 } },
+	{ 89, 17, { 0, 0, 0, 1 }, { 13812, 72771, 11137, 75447, 7192, 79392, 0, 0 } },
+	{ 89, 18, { 0, 0, 0, 0 }, { 20798, 64649, 18866, 66574, 16579, 68853, 14205, 71214 } },
+	{ 89, 19, { 0, 0, 0, 0 }, { 28538, 57616, 26235, 59919, 23739, 62415, 21371, 64783 } },
+	{ 89, 20, { 0, 0, 0, 0 }, { 17661, 68631, 15568, 70735, 12951, 73371, 9980, 76376 } },
+	{ 89, 21, { 0, 0, 0, 0 }, { 21736, 65606, 19811, 67537, 17532, 69825, 15170, 72200 } },
+	{ 89, 22, { 0, 0, 0, 1 }, { 13833, 72784, 11158, 75458, 7215, 79400, 0, 0 } },
+	{ 89, 23, { 0, 0, 0, 0 }, { 20880, 64531, 18949, 66456, 16666, 68731, 14301, 71084 } },
+	{ 89, 24, { 0, 0, 0, 0 }, { 28554, 57637, 26251, 59939, 23756, 62435, 21387, 64803 } },
+	{ 89, 25, { 0, 0, 0, 0 }, { 18909, 67414, 16893, 69421, 14427, 71873, 11735, 74541 } },
+	{ 89, 26, { 0, 0, 0, 0 }, { 21775, 65578, 19850, 67509, 17572, 69795, 15213, 72167 } },
+	{ 89, 27, { 0, 0, 0, 1 }, { 13834, 72786, 11160, 75460, 7217, 79403, 0, 0 } },
+	{ 89, 28, { 0, 0, 0, 0 }, { 20857, 64572, 18926, 66497, 16641, 68773, 14273, 71128 } },
+	{ 89, 29, { 0, 0, 0, 0 }, { 28542, 57626, 26240, 59929, 23744, 62424, 21376, 64793 } },
+	{ 89, 30, { 0, 0, 0, 0 }, { 26558, 61581, 24523, 63619, 22228, 65916, 19978, 68170 } },
+	{ 89, 31, { 0, 0, 0, 0 }, { 21750, 65595, 19825, 67526, 17546, 69814, 15186, 72187 } },
+	{ 89, 32, { 0, 0, 0, 1 }, { 13843, 72789, 11169, 75462, 7228, 79403, 0, 0 } },
+	{ 89, 33, { 0, 0, 0, 0 }, { 20875, 64547, 18945, 66472, 16661, 68747, 14295, 71101 } },
+	{ 89, 34, { 0, 0, 0, 0 }, { 28542, 57631, 26240, 59933, 23745, 62429, 21376, 64797 } },
+	{ 89, 35, { 0, 0, 0, 2 }, { 14863, 72229, 12343, 74737, 8815, 78236, 0, 0 } },
+	{ 89, 36, { 0, 0, 0, 0 }, { 21731, 65603, 19806, 67534, 17527, 69822, 15165, 72197 } },
+	{ 89, 37, { 0, 0, 0, 1 }, { 13852, 72795, 11178, 75468, 7238, 79408, 0, 0 } },
+	{ 89, 38, { 0, 0, 0, 0 }, { 20889, 64530, 18959, 66455, 16676, 68729, 14311, 71082 } },
+	{ 89, 39, { 0, 0, 0, 0 }, { 28538, 57628, 26236, 59930, 23740, 62425, 21372, 64794 } },
+	{ 89, 40, { 0, 0, 0, 0 }, { 28567, 57660, 26265, 59961, 23770, 62457, 21401, 64825 } },
+	{ 89, 41, { 0, 0, 0, 0 }, { 28689, 58075, 26404, 60360, 23922, 62842, 21562, 65202 } },
+	{ 90, 0, { 0, 0, 0, 0 }, { 4624, 33999, 2339, 36285, -144, 38768, -2504, 41128 } },
+	{ 90, 1, { 0, 0, 0, 0 }, { -2238, 41395, -4162, 43325, -6436, 45608, -8789, 47973 } },
+	{ 90, 2, { 0, 0, 0, 1 }, { -10339, 48635, -13015, 51312, -16965, 55263, 0, 0 } },
+	{ 90, 3, { 0, 0, 0, 0 }, { -3347, 40552, -5279, 42478, -7568, 44758, -9944, 47121 } },
+	{ 90, 4, { 0, 0, 0, 0 }, { 4441, 33505, 2138, 35808, -359, 38305, -2728, 40674 } },
+	{ 90, 5, { 0, 0, 0, 0 }, { 4624, 33999, 2339, 36285, -144, 38768, -2504, 41128 } },
+	{ 90, 6, { 0, 0, 0, 0 }, { -2257, 41404, -4181, 43334, -6456, 45618, -8809, 47984 } },
+	{ 90, 7, { 0, 0, 0, 1 }, { -10327, 48639, -13003, 51315, -16949, 55263, 0, 0 } },
+	{ 90, 8, { 0, 0, 0, 0 }, { -3334, 40534, -5266, 42460, -7554, 44740, -9928, 47101 } },
+	{ 90, 9, { 0, 0, 0, 0 }, { 4433, 33504, 2130, 35807, -366, 38304, -2735, 40673 } },
+	{ 90, 10, { 0, 0, 0, 2 }, { -10220, 48234, -12837, 50858, -16617, 54660, 0, 0 } },
+	{ 90, 11, { 0, 0, 0, 0 }, { -2243, 41394, -4166, 43323, -6441, 45606, -8793, 47971 } },
+	{ 90, 12, { 0, 0, 0, 1 }, { -10317, 48644, -12992, 51320, -16937, 55266, 0, 0 } },
+	{ 90, 13, { 0, 0, 0, 0 }, { -3339, 40551, -5271, 42477, -7559, 44756, -9935, 47119 } },
+	{ 90, 14, { 0, 0, 0, 0 }, { 4422, 33499, 2119, 35801, -377, 38297, -2746, 40666 } },
+	{ 90, 15, { 0, 0, 0, 0 }, { 1775, 34509, -346, 36628, -2704, 38985, -4988, 41266 } },
+	{ 90, 16, { 0, 0, 0, 0 }, { -2230, 41379, -4154, 43308, -6427, 45591, -8779, 47954 } },
+	{ 90, 17, { 0, 0, 0, 1 }, { -10311, 48647, -12986, 51323, -16930, 55268, 0, 0 } },
+	{ 90, 18, { 0, 0, 0, 0 }, { -3347, 40565, -5279, 42492, -7568, 44772, -9945, 47136 } },
+	{ 90, 19, { 0, 0, 0, 0 }, { 4409, 33488, 2106, 35791, -390, 38287, -2759, 40655 } },
+	{ 90, 20, { 0, 0, 0, 0 }, { -6426, 44485, -8517, 46586, -11129, 49218, -14091, 52213 } },
+	{ 90, 21, { 0, 0, 0, 0 }, { -2348, 41459, -4272, 43390, -6550, 45677, -8909, 48049 } },
+	{ 90, 22, { 0, 0, 0, 1 }, { -10291, 48661, -12965, 51335, -16908, 55278, 0, 0 } },
+	{ 90, 23, { 0, 0, 0, 0 }, { -3265, 40448, -5196, 42373, -7481, 44649, -9849, 47005 } },
+	{ 90, 24, { 0, 0, 0, 0 }, { 4425, 33508, 2123, 35811, -373, 38307, -2741, 40675 } },
+	{ 90, 25, { 0, 0, 0, 0 }, { -5236, 43330, -7254, 45338, -9724, 47793, -12422, 50468 } },
+	{ 90, 26, { 0, 0, 0, 0 }, { -2309, 41431, -4233, 43362, -6510, 45647, -8866, 48016 } },
+	{ 90, 27, { 0, 0, 0, 1 }, { -10289, 48663, -12963, 51337, -16906, 55280, 0, 0 } },
+	{ 90, 28, { 0, 0, 0, 0 }, { -3288, 40488, -5220, 42414, -7506, 44691, -9876, 47049 } },
+	{ 90, 29, { 0, 0, 0, 0 }, { 4414, 33498, 2111, 35801, -384, 38296, -2753, 40665 } },
+	{ 90, 30, { 0, 0, 0, 0 }, { 2466, 37432, 428, 39471, -1868, 41770, -4118, 44025 } },
+	{ 90, 31, { 0, 0, 0, 0 }, { -2333, 41448, -4258, 43379, -6535, 45665, -8894, 48036 } },
+	{ 90, 32, { 0, 0, 0, 1 }, { -10280, 48666, -12954, 51339, -16895, 55280, 0, 0 } },
+	{ 90, 33, { 0, 0, 0, 0 }, { -3270, 40464, -5201, 42389, -7486, 44666, -9855, 47022 } },
+	{ 90, 34, { 0, 0, 0, 0 }, { 4413, 33503, 2111, 35805, -384, 38300, -2752, 40669 } },
+	{ 90, 35, { 0, 0, 0, 2 }, { -9276, 48124, -11799, 50636, -15334, 54143, 0, 0 } },
+	{ 90, 36, { 0, 0, 0, 0 }, { -2352, 41456, -4277, 43387, -6555, 45674, -8914, 48046 } },
+	{ 90, 37, { 0, 0, 0, 1 }, { -10272, 48672, -12946, 51345, -16886, 55285, 0, 0 } },
+	{ 90, 38, { 0, 0, 0, 0 }, { -3256, 40447, -5187, 42372, -7471, 44648, -9839, 47003 } },
+	{ 90, 39, { 0, 0, 0, 0 }, { 4409, 33500, 2107, 35802, -388, 38297, -2757, 40665 } },
+	{ 90, 40, { 0, 0, 0, 0 }, { 4439, 33530, 2137, 35832, -358, 38328, -2727, 40696 } },
+	{ 90, 41, { 0, 0, 0, 0 }, { 4569, 33939, 2284, 36224, -199, 38708, -2560, 41068 } },
+	{ 91, 0, { 0, 0, 0, 0 }, { 64803, 94221, 62520, 96504, 60039, 98986, 57680, 101345 } },
+	{ 91, 1, { 0, 0, 0, 0 }, { 57851, 101641, 55926, 103572, 53648, 105858, 51290, 108230 } },
+	{ 91, 2, { 0, 0, 0, 1 }, { 49849, 108824, 47172, 111501, 43221, 115452, 0, 0 } },
+	{ 91, 3, { 0, 0, 0, 0 }, { 56896, 100640, 54965, 102565, 52680, 104841, 50311, 107198 } },
+	{ 91, 4, { 0, 0, 0, 0 }, { 64644, 93705, 62340, 96008, 59844, 98505, 57474, 100874 } },
+	{ 91, 5, { 0, 0, 0, 0 }, { 64803, 94221, 62520, 96504, 60039, 98986, 57680, 101345 } },
+	{ 91, 6, { 0, 0, 0, 0 }, { 57832, 101650, 55907, 103581, 53629, 105868, 51269, 108241 } },
+	{ 91, 7, { 0, 0, 0, 1 }, { 49861, 108828, 47185, 111504, 43237, 115451, 0, 0 } },
+	{ 91, 8, { 0, 0, 0, 0 }, { 56910, 100622, 54979, 102547, 52694, 104823, 50326, 107179 } },
+	{ 91, 9, { 0, 0, 0, 0 }, { 64636, 93704, 62332, 96008, 59836, 98504, 57467, 100873 } },
+	{ 91, 10, { 0, 0, 0, 2 }, { 49942, 108446, 47320, 111076, 43524, 114892, 0, 0 } },
+	{ 91, 11, { 0, 0, 0, 0 }, { 57846, 101640, 55922, 103571, 53644, 105857, 51285, 108229 } },
+	{ 91, 12, { 0, 0, 0, 1 }, { 49871, 108833, 47195, 111509, 43249, 115455, 0, 0 } },
+	{ 91, 13, { 0, 0, 0, 0 }, { 56905, 100639, 54974, 102564, 52689, 104840, 50320, 107196 } },
+	{ 91, 14, { 0, 0, 0, 0 }, { 64624, 93698, 62322, 96001, 59825, 98497, 57457, 100866 } },
+	{ 91, 15, { 0, 0, 0, 0 }, { 62022, 94636, 59897, 96760, 57535, 99120, 55249, 101404 } },
+	{ 91, 16, { 0, 0, 0, 0 }, { 57859, 101625, 55935, 103555, 53658, 105841, 51300, 108212 } },
+	{ 91, 17, { 0, 0, 0, 1 }, { 49877, 108837, 47201, 111512, 43256, 115457, 0, 0 } },
+	{ 91, 18, { 0, 0, 0, 0 }, { 56896, 100653, 54965, 102579, 52679, 104855, 50309, 107213 } },
+	{ 91, 19, { 0, 0, 0, 0 }, { 64612, 93688, 62309, 95990, 59813, 98487, 57444, 100855 } },
+	{ 91, 20, { 0, 0, 0, 0 }, { 53672, 104730, 51575, 106838, 48951, 109481, 45967, 112500 } },
+	{ 91, 21, { 0, 0, 0, 0 }, { 57741, 101706, 55816, 103637, 53534, 105928, 51169, 108307 } },
+	{ 91, 22, { 0, 0, 0, 1 }, { 49898, 108848, 47224, 111522, 43281, 115463, 0, 0 } },
+	{ 91, 23, { 0, 0, 0, 0 }, { 56978, 100536, 55048, 102460, 52766, 104733, 50405, 107083 } },
+	{ 91, 24, { 0, 0, 0, 0 }, { 64626, 93710, 62324, 96012, 59828, 98508, 57460, 100876 } },
+	{ 91, 25, { 0, 0, 0, 0 }, { 55006, 103421, 52993, 105425, 50532, 107872, 47849, 110531 } },
+	{ 91, 26, { 0, 0, 0, 0 }, { 57780, 101678, 55855, 103609, 53575, 105898, 51212, 108274 } },
+	{ 91, 27, { 0, 0, 0, 1 }, { 49900, 108851, 47225, 111525, 43282, 115466, 0, 0 } },
+	{ 91, 28, { 0, 0, 0, 0 }, { 56955, 100576, 55024, 102501, 52742, 104775, 50377, 107127 } },
+	{ 91, 29, { 0, 0, 0, 0 }, { 64615, 93699, 62313, 96001, 59817, 98497, 57449, 100865 } },
+	{ 91, 30, { 0, 0, 0, 0 }, { 62577, 97684, 60544, 99719, 58251, 102015, 56002, 104268 } },
+	{ 91, 31, { 0, 0, 0, 0 }, { 57756, 101695, 55830, 103626, 53549, 105916, 51184, 108294 } },
+	{ 91, 32, { 0, 0, 0, 1 }, { 49909, 108853, 47235, 111526, 43294, 115466, 0, 0 } },
+	{ 91, 33, { 0, 0, 0, 0 }, { 56973, 100552, 55043, 102477, 52761, 104750, 50399, 107100 } },
+	{ 91, 34, { 0, 0, 0, 0 }, { 64615, 93704, 62313, 96006, 59817, 98501, 57449, 100870 } },
+	{ 91, 35, { 0, 0, 0, 2 }, { 50951, 108265, 48436, 110769, 44920, 114256, 0, 0 } },
+	{ 91, 36, { 0, 0, 0, 0 }, { 57737, 101703, 55811, 103635, 53530, 105925, 51164, 108304 } },
+	{ 91, 37, { 0, 0, 0, 1 }, { 49918, 108859, 47244, 111532, 43304, 115471, 0, 0 } },
+	{ 91, 38, { 0, 0, 0, 0 }, { 56987, 100535, 55057, 102459, 52776, 104732, 50415, 107081 } },
+	{ 91, 39, { 0, 0, 0, 0 }, { 64610, 93701, 62308, 96003, 59813, 98498, 57445, 100866 } },
+	{ 91, 40, { 0, 0, 0, 0 }, { 64638, 93734, 62336, 96035, 59841, 98530, 57473, 100899 } },
+	{ 91, 41, { 0, 0, 0, 0 }, { 64749, 94159, 62465, 96443, 59984, 98924, 57625, 101284 } },
+	{ 92, 0, { 0, 0, 0, 0 }, { 32580, 54304, 29186, 57698, 25806, 61079, 22729, 64157 } },
+	{ 92, 1, { 0, 0, 0, 0 }, { 21797, 65616, 19317, 68107, 16334, 71110, 13102, 74374 } },
+	{ 92, 2, { 0, 2, 1, 1 }, { 9274, 77270, 0, 0, 0, 0, 0, 0 } },
+	{ 92, 3, { 0, 0, 0, 0 }, { 20692, 64715, 18198, 67197, 15187, 70189, 11905, 73437 } },
+	{ 92, 4, { 0, 0, 0, 0 }, { 32538, 53665, 29080, 57123, 25664, 60539, 22570, 63633 } },
+	{ 92, 5, { 0, 0, 0, 0 }, { 32580, 54304, 29186, 57698, 25806, 61079, 22729, 64157 } },
+	{ 92, 6, { 0, 0, 0, 0 }, { 21772, 65632, 19292, 68123, 16307, 71127, 13073, 74395 } },
+	{ 92, 7, { 0, 2, 1, 1 }, { 9290, 77269, 0, 0, 0, 0, 0, 0 } },
+	{ 92, 8, { 0, 0, 0, 0 }, { 20712, 64691, 18219, 67173, 15210, 70163, 11932, 73408 } },
+	{ 92, 9, { 0, 0, 0, 0 }, { 32527, 53667, 29070, 57124, 25655, 60539, 22561, 63633 } },
+	{ 92, 10, { 0, 0, 1, 1 }, { 9630, 76658, 4049, 82330, 0, 0, 0, 0 } },
+	{ 92, 11, { 0, 0, 0, 0 }, { 21792, 65615, 19313, 68106, 16329, 71109, 13097, 74374 } },
+	{ 92, 12, { 0, 2, 1, 1 }, { 9303, 77273, 0, 0, 0, 0, 0, 0 } },
+	{ 92, 13, { 0, 0, 0, 0 }, { 20702, 64712, 18209, 67194, 15199, 70185, 11918, 73433 } },
+	{ 92, 14, { 0, 0, 0, 0 }, { 32513, 53664, 29058, 57119, 25644, 60533, 22549, 63627 } },
+	{ 92, 15, { 0, 0, 0, 0 }, { 28608, 55910, 25683, 58833, 22578, 61934, 19637, 64870 } },
+	{ 92, 16, { 0, 0, 0, 0 }, { 21811, 65594, 19332, 68084, 16350, 71086, 13121, 74347 } },
+	{ 92, 17, { 0, 2, 1, 1 }, { 9310, 77275, 0, 0, 0, 0, 0, 0 } },
+	{ 92, 18, { 0, 0, 0, 0 }, { 20688, 64732, 18194, 67215, 15183, 70207, 11899, 73457 } },
+	{ 92, 19, { 0, 0, 0, 0 }, { 32499, 53655, 29044, 57109, 25630, 60523, 22536, 63617 } },
+	{ 92, 20, { 0, 0, 0, 2 }, { 15887, 70444, 12989, 73370, 8947, 77485, 0, 0 } },
+	{ 92, 21, { 0, 0, 0, 0 }, { 21649, 65720, 19167, 68213, 16174, 71226, 12921, 74512 } },
+	{ 92, 22, { 0, 2, 1, 1 }, { 9333, 77282, 0, 0, 0, 0, 0, 0 } },
+	{ 92, 23, { 0, 0, 0, 0 }, { 20815, 64570, 18325, 67050, 15324, 70031, 12065, 73258 } },
+	{ 92, 24, { 0, 0, 0, 0 }, { 32513, 53678, 29059, 57131, 25646, 60545, 22552, 63639 } },
+	{ 92, 25, { 0, 0, 0, 0 }, { 17715, 68574, 15021, 71248, 11509, 74718, 6962, 79148 } },
+	{ 92, 26, { 0, 0, 0, 0 }, { 21703, 65677, 19222, 68169, 16232, 71178, 12988, 74456 } },
+	{ 92, 27, { 0, 2, 1, 1 }, { 9335, 77285, 0, 0, 0, 0, 0, 0 } },
+	{ 92, 28, { 0, 0, 0, 0 }, { 20778, 64625, 18286, 67105, 15282, 70090, 12016, 73324 } },
+	{ 92, 29, { 0, 0, 0, 0 }, { 32501, 53667, 29048, 57121, 25634, 60534, 22541, 63628 } },
+	{ 92, 30, { 0, 0, 0, 0 }, { 28587, 59568, 25873, 62285, 22899, 65264, 20012, 68159 } },
+	{ 92, 31, { 0, 0, 0, 0 }, { 21668, 65703, 19187, 68196, 16195, 71208, 12946, 74491 } },
+	{ 92, 32, { 0, 2, 1, 1 }, { 9347, 77284, 0, 0, 0, 0, 0, 0 } },
+	{ 92, 33, { 0, 0, 0, 0 }, { 20806, 64591, 18315, 67071, 15314, 70053, 12052, 73282 } },
+	{ 92, 34, { 0, 0, 0, 0 }, { 32499, 53674, 29046, 57127, 25633, 60540, 22540, 63633 } },
+	{ 92, 35, { 0, 0, 1, 1 }, { 11035, 76015, 6341, 80629, 0, 0, 0, 0 } },
+	{ 92, 36, { 0, 0, 0, 0 }, { 21643, 65717, 19161, 68211, 16168, 71224, 12916, 74510 } },
+	{ 92, 37, { 0, 2, 1, 1 }, { 9356, 77290, 0, 0, 0, 0, 0, 0 } },
+	{ 92, 38, { 0, 0, 0, 0 }, { 20827, 64567, 18336, 67046, 15337, 70027, 12079, 73253 } },
+	{ 92, 39, { 0, 0, 0, 0 }, { 32494, 53672, 29041, 57124, 25629, 60537, 22535, 63630 } },
+	{ 92, 40, { 0, 0, 0, 0 }, { 32522, 53705, 29070, 57156, 25658, 60569, 22565, 63662 } },
+	{ 92, 41, { 0, 0, 0, 0 }, { 32527, 54240, 29132, 57635, 25751, 61017, 22675, 64095 } },
+	{ 93, 0, { 0, 0, 0, 0 }, { 8467, 30160, 5070, 33558, 1688, 36941, -1389, 40019 } },
+	{ 93, 1, { 0, 0, 0, 0 }, { -2272, 41455, -4751, 43945, -7731, 46945, -10955, 50201 } },
+	{ 93, 2, { 0, 2, 1, 1 }, { -14848, 53146, 0, 0, 0, 0, 0, 0 } },
+	{ 93, 3, { 0, 0, 0, 0 }, { -3468, 40646, -5963, 43129, -8977, 46124, -12267, 49380 } },
+	{ 93, 4, { 0, 0, 0, 0 }, { 8408, 29538, 4951, 32995, 1535, 36411, -1560, 39506 } },
+	{ 93, 5, { 0, 0, 0, 0 }, { 8467, 30160, 5070, 33558, 1688, 36941, -1389, 40019 } },
+	{ 93, 6, { 0, 0, 0, 0 }, { -2297, 41471, -4776, 43961, -7758, 46962, -10985, 50222 } },
+	{ 93, 7, { 0, 2, 1, 1 }, { -14832, 53145, 0, 0, 0, 0, 0, 0 } },
+	{ 93, 8, { 0, 0, 0, 0 }, { -3448, 40622, -5942, 43105, -8955, 46098, -12241, 49351 } },
+	{ 93, 9, { 0, 0, 0, 0 }, { 8397, 29540, 4941, 32996, 1526, 36411, -1568, 39505 } },
+	{ 93, 10, { 0, 0, 1, 1 }, { -14473, 52516, -20028, 58163, 0, 0, 0, 0 } },
+	{ 93, 11, { 0, 0, 0, 0 }, { -2277, 41454, -4756, 43944, -7736, 46944, -10961, 50201 } },
+	{ 93, 12, { 0, 2, 1, 1 }, { -14820, 53149, 0, 0, 0, 0, 0, 0 } },
+	{ 93, 13, { 0, 0, 0, 0 }, { -3457, 40643, -5952, 43126, -8966, 46120, -12255, 49376 } },
+	{ 93, 14, { 0, 0, 0, 0 }, { 8383, 29537, 4928, 32992, 1514, 36406, -1580, 39500 } },
+	{ 93, 15, { 0, 0, 0, 0 }, { 4445, 31827, 1526, 34744, -1575, 37842, -4515, 40777 } },
+	{ 93, 16, { 0, 0, 0, 0 }, { -2258, 41433, -4736, 43922, -7715, 46920, -10936, 50174 } },
+	{ 93, 17, { 0, 2, 1, 1 }, { -14812, 53151, 0, 0, 0, 0, 0, 0 } },
+	{ 93, 18, { 0, 0, 0, 0 }, { -3471, 40663, -5966, 43147, -8981, 46142, -12273, 49400 } },
+	{ 93, 19, { 0, 0, 0, 0 }, { 8369, 29528, 4914, 32982, 1500, 36396, -1593, 39490 } },
+	{ 93, 20, { 0, 0, 0, 2 }, { -8185, 46283, -11076, 49201, -15099, 53296, 0, 0 } },
+	{ 93, 21, { 0, 0, 0, 0 }, { -2421, 41559, -4902, 44051, -7891, 47060, -11136, 50339 } },
+	{ 93, 22, { 0, 2, 1, 1 }, { -14790, 53160, 0, 0, 0, 0, 0, 0 } },
+	{ 93, 23, { 0, 0, 0, 0 }, { -3344, 40501, -5836, 42981, -8840, 45966, -12106, 49200 } },
+	{ 93, 24, { 0, 0, 0, 0 }, { 8384, 29549, 4930, 33003, 1517, 36417, -1577, 39510 } },
+	{ 93, 25, { 0, 0, 0, 0 }, { -6445, 44504, -9143, 47182, -12665, 50662, -17247, 55123 } },
+	{ 93, 26, { 0, 0, 0, 0 }, { -2367, 41516, -4847, 44007, -7833, 47012, -11069, 50282 } },
+	{ 93, 27, { 0, 2, 1, 1 }, { -14788, 53162, 0, 0, 0, 0, 0, 0 } },
+	{ 93, 28, { 0, 0, 0, 0 }, { -3381, 40556, -5874, 43037, -8882, 46025, -12156, 49267 } },
+	{ 93, 29, { 0, 0, 0, 0 }, { 8372, 29540, 4919, 32993, 1505, 36406, -1589, 39500 } },
+	{ 93, 30, { 0, 0, 0, 0 }, { 4509, 35403, 1792, 38125, -1185, 41106, -4072, 44001 } },
+	{ 93, 31, { 0, 0, 0, 0 }, { -2401, 41542, -4882, 44034, -7870, 47042, -11111, 50317 } },
+	{ 93, 32, { 0, 2, 1, 1 }, { -14777, 53162, 0, 0, 0, 0, 0, 0 } },
+	{ 93, 33, { 0, 0, 0, 0 }, { -3353, 40522, -5845, 43003, -8850, 45988, -12119, 49225 } },
+	{ 93, 34, { 0, 0, 0, 0 }, { 8370, 29546, 4917, 32999, 1504, 36412, -1589, 39505 } },
+	{ 93, 35, { 0, 0, 1, 1 }, { -13118, 51924, -17833, 56560, 0, 0, 0, 0 } },
+	{ 93, 36, { 0, 0, 0, 0 }, { -2426, 41556, -4907, 44049, -7897, 47058, -11141, 50337 } },
+	{ 93, 37, { 0, 2, 1, 1 }, { -14768, 53167, 0, 0, 0, 0, 0, 0 } },
+	{ 93, 38, { 0, 0, 0, 0 }, { -3332, 40498, -5824, 42978, -8827, 45962, -12092, 49195 } },
+	{ 93, 39, { 0, 0, 0, 0 }, { 8365, 29544, 4913, 32996, 1500, 36409, -1593, 39502 } },
+	{ 93, 40, { 0, 0, 0, 0 }, { 8395, 29575, 4943, 33027, 1530, 36440, -1563, 39533 } },
+	{ 93, 41, { 0, 0, 0, 0 }, { 8414, 30097, 5016, 33496, 1633, 36879, -1445, 39958 } },
+	{ 94, 0, { 0, 0, 0, 0 }, { 68628, 90400, 65239, 93789, 61862, 97167, 58787, 100243 } },
+	{ 94, 1, { 0, 0, 0, 0 }, { 57781, 101737, 55300, 104229, 52311, 107238, 49069, 110514 } },
+	{ 94, 2, { 0, 2, 1, 1 }, { 45338, 113335, 0, 0, 0, 0, 0, 0 } },
+	{ 94, 3, { 0, 0, 0, 0 }, { 56811, 100699, 54319, 103180, 51313, 106166, 48043, 109403 } },
+	{ 94, 4, { 0, 0, 0, 0 }, { 68612, 89736, 65154, 93195, 61738, 96611, 58643, 99705 } },
+	{ 94, 5, { 0, 0, 0, 0 }, { 68628, 90400, 65239, 93789, 61862, 97167, 58787, 100243 } },
+	{ 94, 6, { 0, 0, 0, 0 }, { 57756, 101753, 55275, 104245, 52285, 107255, 49039, 110535 } },
+	{ 94, 7, { 0, 2, 1, 1 }, { 45355, 113334, 0, 0, 0, 0, 0, 0 } },
+	{ 94, 8, { 0, 0, 0, 0 }, { 56831, 100675, 54339, 103155, 51336, 106140, 48069, 109374 } },
+	{ 94, 9, { 0, 0, 0, 0 }, { 68601, 89739, 65144, 93196, 61729, 96611, 58634, 99705 } },
+	{ 94, 10, { 0, 0, 1, 1 }, { 45666, 112751, 40047, 118460, 0, 0, 0, 0 } },
+	{ 94, 11, { 0, 0, 0, 0 }, { 57776, 101736, 55295, 104229, 52307, 107237, 49064, 110514 } },
+	{ 94, 12, { 0, 2, 1, 1 }, { 45367, 113338, 0, 0, 0, 0, 0, 0 } },
+	{ 94, 13, { 0, 0, 0, 0 }, { 56821, 100696, 54329, 103177, 51324, 106162, 48055, 109399 } },
+	{ 94, 14, { 0, 0, 0, 0 }, { 68587, 89735, 65132, 93191, 61717, 96605, 58623, 99699 } },
+	{ 94, 15, { 0, 0, 0, 0 }, { 64731, 91916, 61798, 94847, 58689, 97952, 55745, 100891 } },
+	{ 94, 16, { 0, 0, 0, 0 }, { 57795, 101715, 55315, 104207, 52328, 107214, 49088, 110487 } },
+	{ 94, 17, { 0, 2, 1, 1 }, { 45374, 113340, 0, 0, 0, 0, 0, 0 } },
+	{ 94, 18, { 0, 0, 0, 0 }, { 56807, 100716, 54315, 103197, 51309, 106184, 48037, 109423 } },
+	{ 94, 19, { 0, 0, 0, 0 }, { 68573, 89726, 65118, 93181, 61704, 96595, 58610, 99689 } },
+	{ 94, 20, { 0, 0, 0, 2 }, { 51875, 106567, 48967, 109503, 44896, 113648, 0, 0 } },
+	{ 94, 21, { 0, 0, 0, 0 }, { 57633, 101841, 55149, 104336, 52151, 107354, 48887, 110653 } },
+	{ 94, 22, { 0, 2, 1, 1 }, { 45399, 113345, 0, 0, 0, 0, 0, 0 } },
+	{ 94, 23, { 0, 0, 0, 0 }, { 56934, 100554, 54445, 103032, 51449, 106009, 48202, 109225 } },
+	{ 94, 24, { 0, 0, 0, 0 }, { 68585, 89751, 65132, 93204, 61718, 96618, 58625, 99712 } },
+	{ 94, 25, { 0, 0, 0, 0 }, { 53834, 104559, 51147, 107227, 47651, 110681, 43152, 115066 } },
+	{ 94, 26, { 0, 0, 0, 0 }, { 57687, 101798, 55204, 104292, 52210, 107306, 48954, 110596 } },
+	{ 94, 27, { 0, 2, 1, 1 }, { 45400, 113348, 0, 0, 0, 0, 0, 0 } },
+	{ 94, 28, { 0, 0, 0, 0 }, { 56897, 100608, 54406, 103088, 51408, 106068, 48152, 109291 } },
+	{ 94, 29, { 0, 0, 0, 0 }, { 68574, 89740, 65121, 93193, 61707, 96607, 58614, 99701 } },
+	{ 94, 30, { 0, 0, 0, 0 }, { 64583, 95694, 61875, 98405, 58905, 101381, 56019, 104274 } },
+	{ 94, 31, { 0, 0, 0, 0 }, { 57653, 101824, 55169, 104319, 52173, 107336, 48912, 110631 } },
+	{ 94, 32, { 0, 2, 1, 1 }, { 45413, 113348, 0, 0, 0, 0, 0, 0 } },
+	{ 94, 33, { 0, 0, 0, 0 }, { 56925, 100575, 54435, 103053, 51439, 106031, 48189, 109249 } },
+	{ 94, 34, { 0, 0, 0, 0 }, { 68571, 89747, 65119, 93200, 61706, 96613, 58613, 99706 } },
+	{ 94, 35, { 0, 0, 1, 1 }, { 47143, 112031, 42482, 116613, 0, 0, 0, 0 } },
+	{ 94, 36, { 0, 0, 0, 0 }, { 57628, 101839, 55144, 104334, 52146, 107352, 48881, 110651 } },
+	{ 94, 37, { 0, 2, 1, 1 }, { 45422, 113353, 0, 0, 0, 0, 0, 0 } },
+	{ 94, 38, { 0, 0, 0, 0 }, { 56946, 100551, 54456, 103029, 51462, 106005, 48215, 109220 } },
+	{ 94, 39, { 0, 0, 0, 0 }, { 68566, 89745, 65114, 93197, 61701, 96610, 58608, 99703 } },
+	{ 94, 40, { 0, 0, 0, 0 }, { 68592, 89780, 65141, 93231, 61729, 96643, 58636, 99736 } },
+	{ 94, 41, { 0, 0, 0, 0 }, { 68577, 90334, 65187, 93725, 61808, 97104, 58733, 100181 } },
+	{ 95, 0, { -1, 0, 0, 0 }, { 0, 0, 35460, 51430, 29164, 57728, 24420, 62474 } },
+	{ 95, 1, { 0, 0, 0, 0 }, { 21688, 65774, 18037, 69455, 13387, 74171, 7143, 80678 } },
+	{ 95, 2, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 3, { 0, 0, 0, 0 }, { 20473, 64884, 16784, 68544, 12033, 73227, 5344, 79626 } },
+	{ 95, 4, { -1, 0, 0, 0 }, { 0, 0, 35721, 50482, 29177, 57025, 24372, 61831 } },
+	{ 95, 5, { -1, 0, 0, 0 }, { 0, 0, 35460, 51430, 29164, 57728, 24420, 62474 } },
+	{ 95, 6, { 0, 0, 0, 0 }, { 21652, 65802, 17999, 69484, 13343, 74206, 7070, 80748 } },
+	{ 95, 7, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 8, { 0, 0, 0, 0 }, { 20506, 64847, 16819, 68506, 12076, 73181, 5427, 79547 } },
+	{ 95, 9, { -1, 0, 0, 0 }, { 0, 0, 35702, 50492, 29164, 57029, 24360, 61833 } },
+	{ 95, 10, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 11, { 0, 0, 0, 0 }, { 21682, 65775, 18031, 69455, 13380, 74172, 7134, 80683 } },
+	{ 95, 12, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 13, { 0, 0, 0, 0 }, { 20488, 64877, 16799, 68537, 12051, 73217, 5374, 79607 } },
+	{ 95, 14, { -1, 0, 0, 0 }, { 0, 0, 35683, 50493, 29150, 57027, 24347, 61829 } },
+	{ 95, 15, { 0, 0, 0, 0 }, { 35181, 49319, 29400, 55095, 24484, 60003, 20143, 64333 } },
+	{ 95, 16, { 0, 0, 0, 0 }, { 21713, 65741, 18063, 69420, 13419, 74130, 7201, 80607 } },
+	{ 95, 17, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 18, { 0, 0, 0, 0 }, { 20464, 64907, 16773, 68568, 12019, 73254, 5310, 79671 } },
+	{ 95, 19, { -1, 0, 0, 0 }, { 0, 0, 35666, 50487, 29135, 57018, 24333, 61820 } },
+	{ 95, 20, { 0, 0, 1, 1 }, { 12197, 74249, 6304, 80398, 0, 0, 0, 0 } },
+	{ 95, 21, { 0, 0, 0, 0 }, { 21466, 65952, 17806, 69643, 13117, 74401, 6683, 81136 } },
+	{ 95, 22, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 23, { 0, 0, 0, 0 }, { 20676, 64661, 16997, 68311, 12292, 72952, 5837, 79155 } },
+	{ 95, 24, { -1, 0, 0, 0 }, { 0, 0, 35676, 50515, 29148, 57042, 24347, 61844 } },
+	{ 95, 25, { 0, 0, 2, 1 }, { 15353, 70856, 10845, 75279, 0, 0, 0, 0 } },
+	{ 95, 26, { 0, 0, 0, 0 }, { 21549, 65880, 17892, 69567, 13218, 74309, 6861, 80952 } },
+	{ 95, 27, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 28, { 0, 0, 0, 0 }, { 20611, 64742, 16929, 68396, 12208, 73051, 5677, 79319 } },
+	{ 95, 29, { -1, 0, 0, 0 }, { 0, 0, 35663, 50506, 29136, 57032, 24335, 61833 } },
+	{ 95, 30, { 0, 0, 0, 0 }, { 32878, 55300, 28370, 59816, 23900, 64298, 19680, 68536 } },
+	{ 95, 31, { 0, 0, 0, 0 }, { 21497, 65925, 17838, 69614, 13154, 74366, 6749, 81066 } },
+	{ 95, 32, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 33, { 0, 0, 0, 0 }, { 20658, 64690, 16978, 68342, 12268, 72987, 5789, 79211 } },
+	{ 95, 34, { -1, 0, 0, 0 }, { 0, 0, 35655, 50518, 29133, 57040, 24333, 61840 } },
+	{ 95, 35, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 36, { 0, 0, 0, 0 }, { 21460, 65951, 17800, 69641, 13110, 74400, 6674, 81138 } },
+	{ 95, 37, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 95, 38, { 0, 0, 0, 0 }, { 20692, 64653, 17013, 68303, 12311, 72942, 5868, 79135 } },
+	{ 95, 39, { -1, 0, 0, 0 }, { 0, 0, 35649, 50517, 29128, 57038, 24328, 61838 } },
+	{ 95, 40, { -1, 0, 0, 0 }, { 0, 0, 35675, 50552, 29156, 57071, 24357, 61871 } },
+	{ 95, 41, { -1, 0, 0, 0 }, { 0, 0, 35413, 51360, 29113, 57662, 24368, 62410 } },
+	{ 96, 0, { -1, 0, 0, 0 }, { 0, 0, 11362, 27271, 5054, 33581, 307, 38330 } },
+	{ 96, 1, { 0, 0, 0, 0 }, { -2354, 41586, -6002, 45264, -10639, 49965, -16819, 56397 } },
+	{ 96, 2, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 3, { 0, 0, 0, 0 }, { -3713, 40842, -7407, 44505, -12173, 49202, -18951, 55675 } },
+	{ 96, 4, { -1, 0, 0, 0 }, { 0, 0, 11589, 26356, 5047, 32898, 242, 37703 } },
+	{ 96, 5, { -1, 0, 0, 0 }, { 0, 0, 11362, 27271, 5054, 33581, 307, 38330 } },
+	{ 96, 6, { 0, 0, 0, 0 }, { -2391, 41614, -6040, 45292, -10682, 50000, -16890, 56465 } },
+	{ 96, 7, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 8, { 0, 0, 0, 0 }, { -3680, 40805, -7371, 44467, -12130, 49157, -18864, 55594 } },
+	{ 96, 9, { -1, 0, 0, 0 }, { 0, 0, 11571, 26366, 5034, 32902, 230, 37706 } },
+	{ 96, 10, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 11, { 0, 0, 0, 0 }, { -2360, 41587, -6009, 45264, -10645, 49966, -16828, 56401 } },
+	{ 96, 12, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 13, { 0, 0, 0, 0 }, { -3698, 40834, -7391, 44498, -12155, 49193, -18919, 55655 } },
+	{ 96, 14, { -1, 0, 0, 0 }, { 0, 0, 11552, 26368, 5019, 32900, 217, 37702 } },
+	{ 96, 15, { 0, 0, 0, 0 }, { 10952, 25302, 5214, 31035, 310, 35931, -4027, 40257 } },
+	{ 96, 16, { 0, 0, 0, 0 }, { -2329, 41553, -5976, 45229, -10607, 49924, -16763, 56328 } },
+	{ 96, 17, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 18, { 0, 0, 0, 0 }, { -3722, 40865, -7417, 44529, -12187, 49230, -18985, 55720 } },
+	{ 96, 19, { -1, 0, 0, 0 }, { 0, 0, 11534, 26362, 5004, 32891, 202, 37693 } },
+	{ 96, 20, { 0, 0, 1, 1 }, { -11836, 50048, -17666, 56123, 0, 0, 0, 0 } },
+	{ 96, 21, { 0, 0, 0, 0 }, { -2576, 41764, -6233, 45451, -10908, 50194, -17270, 56842 } },
+	{ 96, 22, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 23, { 0, 0, 0, 0 }, { -3510, 40618, -7193, 44272, -11913, 48926, -18442, 55192 } },
+	{ 96, 24, { -1, 0, 0, 0 }, { 0, 0, 11546, 26387, 5019, 32914, 218, 37715 } },
+	{ 96, 25, { 0, 0, 2, 1 }, { -8838, 46817, -13368, 51261, 0, 0, 0, 0 } },
+	{ 96, 26, { 0, 0, 0, 0 }, { -2494, 41692, -6147, 45375, -10807, 50102, -17096, 56663 } },
+	{ 96, 27, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 28, { 0, 0, 0, 0 }, { -3575, 40700, -7261, 44357, -11996, 49026, -18607, 55360 } },
+	{ 96, 29, { -1, 0, 0, 0 }, { 0, 0, 11533, 26379, 5007, 32904, 206, 37705 } },
+	{ 96, 30, { 0, 0, 0, 0 }, { 8843, 31093, 4316, 35628, -162, 40118, -4382, 44357 } },
+	{ 96, 31, { 0, 0, 0, 0 }, { -2546, 41737, -6201, 45422, -10870, 50159, -17205, 56774 } },
+	{ 96, 32, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 33, { 0, 0, 0, 0 }, { -3528, 40647, -7212, 44302, -11937, 48962, -18492, 55250 } },
+	{ 96, 34, { -1, 0, 0, 0 }, { 0, 0, 11526, 26390, 5004, 32912, 204, 37712 } },
+	{ 96, 35, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 36, { 0, 0, 0, 0 }, { -2582, 41763, -6239, 45449, -10914, 50193, -17278, 56843 } },
+	{ 96, 37, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 96, 38, { 0, 0, 0, 0 }, { -3494, 40610, -7176, 44264, -11893, 48916, -18410, 55172 } },
+	{ 96, 39, { -1, 0, 0, 0 }, { 0, 0, 11520, 26389, 4999, 32910, 199, 37709 } },
+	{ 96, 40, { -1, 0, 0, 0 }, { 0, 0, 11549, 26421, 5029, 32941, 229, 37741 } },
+	{ 96, 41, { -1, 0, 0, 0 }, { 0, 0, 11314, 27203, 5002, 33517, 254, 38267 } },
+	{ 97, 0, { -1, 0, 0, 0 }, { 0, 0, 71485, 87550, 65207, 93829, 60468, 98570 } },
+	{ 97, 1, { 0, 0, 0, 0 }, { 57632, 101936, 53976, 105622, 49305, 110361, 42960, 116987 } },
+	{ 97, 2, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 3, { 0, 0, 0, 0 }, { 56632, 100828, 52948, 104483, 48221, 109144, 41654, 115441 } },
+	{ 97, 4, { -1, 0, 0, 0 }, { 0, 0, 71796, 86552, 65252, 93097, 60446, 97903 } },
+	{ 97, 5, { -1, 0, 0, 0 }, { 0, 0, 71485, 87550, 65207, 93829, 60468, 98570 } },
+	{ 97, 6, { 0, 0, 0, 0 }, { 57596, 101963, 53938, 105651, 49261, 110396, 42885, 117060 } },
+	{ 97, 7, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 8, { 0, 0, 0, 0 }, { 56665, 100792, 52983, 104445, 48263, 109099, 41734, 115365 } },
+	{ 97, 9, { -1, 0, 0, 0 }, { 0, 0, 71777, 86563, 65239, 93101, 60434, 97905 } },
+	{ 97, 10, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 11, { 0, 0, 0, 0 }, { 57626, 101936, 53970, 105622, 49298, 110362, 42951, 116992 } },
+	{ 97, 12, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 13, { 0, 0, 0, 0 }, { 56647, 100821, 52963, 104476, 48238, 109135, 41683, 115423 } },
+	{ 97, 14, { -1, 0, 0, 0 }, { 0, 0, 71759, 86563, 65224, 93098, 60421, 97901 } },
+	{ 97, 15, { 0, 0, 0, 0 }, { 71405, 85224, 65559, 91066, 60624, 95993, 56278, 100328 } },
+	{ 97, 16, { 0, 0, 0, 0 }, { 57657, 101903, 54003, 105587, 49337, 110320, 43020, 116914 } },
+	{ 97, 17, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 18, { 0, 0, 0, 0 }, { 56622, 100852, 52937, 104508, 48207, 109172, 41622, 115485 } },
+	{ 97, 19, { -1, 0, 0, 0 }, { 0, 0, 71742, 86556, 65210, 93089, 60407, 97891 } },
+	{ 97, 20, { 0, 0, 1, 1 }, { 48127, 110431, 42134, 116696, 0, 0, 0, 0 } },
+	{ 97, 21, { 0, 0, 0, 0 }, { 57411, 102114, 53745, 105810, 49033, 110593, 42484, 117468 } },
+	{ 97, 22, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 23, { 0, 0, 0, 0 }, { 56835, 100605, 53160, 104251, 48477, 108872, 42128, 114985 } },
+	{ 97, 24, { -1, 0, 0, 0 }, { 0, 0, 71748, 86589, 65221, 93115, 60420, 97917 } },
+	{ 97, 25, { 0, 0, 2, 1 }, { 51519, 106795, 47043, 111189, 0, 0, 0, 0 } },
+	{ 97, 26, { 0, 0, 0, 0 }, { 57493, 102042, 53831, 105734, 49135, 110500, 42668, 117274 } },
+	{ 97, 27, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 28, { 0, 0, 0, 0 }, { 56770, 100687, 53092, 104336, 48394, 108970, 41974, 115144 } },
+	{ 97, 29, { -1, 0, 0, 0 }, { 0, 0, 71736, 86578, 65210, 93104, 60408, 97906 } },
+	{ 97, 30, { 0, 0, 0, 0 }, { 68812, 91489, 64331, 95977, 59872, 100448, 55654, 104686 } },
+	{ 97, 31, { 0, 0, 0, 0 }, { 57441, 102087, 53777, 105782, 49071, 110558, 42553, 117394 } },
+	{ 97, 32, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 33, { 0, 0, 0, 0 }, { 56817, 100635, 53141, 104282, 48453, 108907, 42081, 115040 } },
+	{ 97, 34, { -1, 0, 0, 0 }, { 0, 0, 71728, 86591, 65206, 93113, 60406, 97913 } },
+	{ 97, 35, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 36, { 0, 0, 0, 0 }, { 57405, 102113, 53739, 105809, 49026, 110593, 42475, 117470 } },
+	{ 97, 37, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 97, 38, { 0, 0, 0, 0 }, { 56851, 100598, 53177, 104243, 48495, 108862, 42158, 114966 } },
+	{ 97, 39, { -1, 0, 0, 0 }, { 0, 0, 71721, 86590, 65200, 93111, 60400, 97911 } },
+	{ 97, 40, { -1, 0, 0, 0 }, { 0, 0, 71743, 86630, 65226, 93147, 60427, 97946 } },
+	{ 97, 41, { -1, 0, 0, 0 }, { 0, 0, 71440, 87477, 65158, 93762, 60417, 98505 } },
+	{ 98, 0, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28702, 58212 } },
+	{ 98, 1, { 0, 0, 1, 1 }, { 21341, 66269, 13798, 73991, 0, 0, 0, 0 } },
+	{ 98, 2, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 3, { 0, 0, 1, 1 }, { 19804, 65405, 11993, 73025, 0, 0, 0, 0 } },
+	{ 98, 4, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29045, 57156 } },
+	{ 98, 5, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28702, 58212 } },
+	{ 98, 6, { 0, 0, 1, 1 }, { 21271, 66330, 13714, 74069, 0, 0, 0, 0 } },
+	{ 98, 7, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 8, { 0, 0, 1, 1 }, { 19875, 65331, 12084, 72935, 0, 0, 0, 0 } },
+	{ 98, 9, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29025, 57168 } },
+	{ 98, 10, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 11, { 0, 0, 1, 1 }, { 21332, 66272, 13788, 73996, 0, 0, 0, 0 } },
+	{ 98, 12, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 13, { 0, 0, 1, 1 }, { 19830, 65386, 12026, 73002, 0, 0, 0, 0 } },
+	{ 98, 14, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 29004, 57170 } },
+	{ 98, 15, { -1, -1, 0, 0 }, { 0, 0, 0, 0, 29984, 54446, 20814, 63576 } },
+	{ 98, 16, { 0, 0, 1, 1 }, { 21397, 66204, 13867, 73912, 0, 0, 0, 0 } },
+	{ 98, 17, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 18, { 0, 0, 1, 1 }, { 19776, 65445, 11957, 73074, 0, 0, 0, 0 } },
+	{ 98, 19, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28986, 57165 } },
+	{ 98, 20, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 21, { 0, 0, 1, 1 }, { 20908, 66662, 13274, 74492, 0, 0, 0, 0 } },
+	{ 98, 22, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 23, { 0, 0, 1, 1 }, { 20237, 64956, 12538, 72482, 0, 0, 0, 0 } },
+	{ 98, 24, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28995, 57195 } },
+	{ 98, 25, { 0, 1, 1, 1 }, { 6030, 79410, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 26, { 0, 0, 1, 1 }, { 21072, 66507, 13475, 74293, 0, 0, 0, 0 } },
+	{ 98, 27, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 28, { 0, 0, 1, 1 }, { 20093, 65115, 12358, 72672, 0, 0, 0, 0 } },
+	{ 98, 29, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28982, 57185 } },
+	{ 98, 30, { -1, 0, 0, 0 }, { 0, 0, 37480, 50768, 26294, 61992, 17917, 70457 } },
+	{ 98, 31, { 0, 0, 1, 1 }, { 20969, 66604, 13349, 74417, 0, 0, 0, 0 } },
+	{ 98, 32, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 33, { 0, 0, 1, 1 }, { 20193, 65011, 12482, 72547, 0, 0, 0, 0 } },
+	{ 98, 34, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28973, 57199 } },
+	{ 98, 35, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 36, { 0, 0, 1, 1 }, { 20900, 66663, 13264, 74494, 0, 0, 0, 0 } },
+	{ 98, 37, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 98, 38, { 0, 0, 1, 1 }, { 20265, 64936, 12572, 72457, 0, 0, 0, 0 } },
+	{ 98, 39, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28967, 57198 } },
+	{ 98, 40, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28994, 57236 } },
+	{ 98, 41, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 28657, 58140 } },
+	{ 99, 0, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4610, 34048 } },
+	{ 99, 1, { 0, 0, 1, 1 }, { -2625, 42002, -10137, 49689, 0, 0, 0, 0 } },
+	{ 99, 2, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 3, { 0, 0, 1, 1 }, { -4461, 41438, -12312, 49094, 0, 0, 0, 0 } },
+	{ 99, 4, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4913, 33030 } },
+	{ 99, 5, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4610, 34048 } },
+	{ 99, 6, { 0, 0, 1, 1 }, { -2695, 42064, -10220, 49766, 0, 0, 0, 0 } },
+	{ 99, 7, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 8, { 0, 0, 1, 1 }, { -4389, 41364, -12220, 49003, 0, 0, 0, 0 } },
+	{ 99, 9, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4893, 33042 } },
+	{ 99, 10, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 11, { 0, 0, 1, 1 }, { -2634, 42006, -10147, 49694, 0, 0, 0, 0 } },
+	{ 99, 12, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 13, { 0, 0, 1, 1 }, { -4434, 41420, -12279, 49071, 0, 0, 0, 0 } },
+	{ 99, 14, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4872, 33045 } },
+	{ 99, 15, { -1, -1, 0, 0 }, { 0, 0, 0, 0, 5731, 30453, -3408, 39550 } },
+	{ 99, 16, { 0, 0, 1, 1 }, { -2569, 41938, -10069, 49611, 0, 0, 0, 0 } },
+	{ 99, 17, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 18, { 0, 0, 1, 1 }, { -4487, 41479, -12349, 49144, 0, 0, 0, 0 } },
+	{ 99, 19, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4854, 33039 } },
+	{ 99, 20, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 21, { 0, 0, 1, 1 }, { -3057, 42396, -10657, 50184, 0, 0, 0, 0 } },
+	{ 99, 22, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 23, { 0, 0, 1, 1 }, { -4027, 40989, -11761, 48545, 0, 0, 0, 0 } },
+	{ 99, 24, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4866, 33067 } },
+	{ 99, 25, { 0, 1, 1, 1 }, { -18431, 55589, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 26, { 0, 0, 1, 1 }, { -2893, 42241, -10458, 49988, 0, 0, 0, 0 } },
+	{ 99, 27, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 28, { 0, 0, 1, 1 }, { -4170, 41148, -11943, 48737, 0, 0, 0, 0 } },
+	{ 99, 29, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4851, 33058 } },
+	{ 99, 30, { -1, 0, 0, 0 }, { 0, 0, 13635, 26371, 2300, 37744, -6080, 46209 } },
+	{ 99, 31, { 0, 0, 1, 1 }, { -2997, 42337, -10583, 50110, 0, 0, 0, 0 } },
+	{ 99, 32, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 33, { 0, 0, 1, 1 }, { -4070, 41044, -11817, 48611, 0, 0, 0, 0 } },
+	{ 99, 34, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4843, 33071 } },
+	{ 99, 35, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 36, { 0, 0, 1, 1 }, { -3066, 42396, -10666, 50186, 0, 0, 0, 0 } },
+	{ 99, 37, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 99, 38, { 0, 0, 1, 1 }, { -3998, 40969, -11726, 48521, 0, 0, 0, 0 } },
+	{ 99, 39, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4837, 33070 } },
+	{ 99, 40, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4867, 33104 } },
+	{ 99, 41, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 4562, 33977 } },
+	{ 100, 0, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 64719, 94341 } },
+	{ 100, 1, { 0, 0, 1, 1 }, { 57170, 102547, 49579, 110326, 0, 0, 0, 0 } },
+	{ 100, 2, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 3, { 0, 0, 1, 1 }, { 56079, 101235, 48327, 108806, 0, 0, 0, 0 } },
+	{ 100, 4, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65122, 93226 } },
+	{ 100, 5, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 64719, 94341 } },
+	{ 100, 6, { 0, 0, 1, 1 }, { 57100, 102609, 49494, 110405, 0, 0, 0, 0 } },
+	{ 100, 7, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 8, { 0, 0, 1, 1 }, { 56150, 101162, 48415, 108717, 0, 0, 0, 0 } },
+	{ 100, 9, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65101, 93239 } },
+	{ 100, 10, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 11, { 0, 0, 1, 1 }, { 57161, 102551, 49568, 110332, 0, 0, 0, 0 } },
+	{ 100, 12, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 13, { 0, 0, 1, 1 }, { 56105, 101217, 48358, 108783, 0, 0, 0, 0 } },
+	{ 100, 14, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65081, 93241 } },
+	{ 100, 15, { -1, -1, 0, 0 }, { 0, 0, 0, 0, 66244, 90316, 57024, 99496 } },
+	{ 100, 16, { 0, 0, 1, 1 }, { 57226, 102483, 49648, 110246, 0, 0, 0, 0 } },
+	{ 100, 17, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 18, { 0, 0, 1, 1 }, { 56051, 101276, 48290, 108855, 0, 0, 0, 0 } },
+	{ 100, 19, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65064, 93234 } },
+	{ 100, 20, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 21, { 0, 0, 1, 1 }, { 56737, 102942, 49047, 110836, 0, 0, 0, 0 } },
+	{ 100, 22, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 23, { 0, 0, 1, 1 }, { 56511, 100787, 48862, 108270, 0, 0, 0, 0 } },
+	{ 100, 24, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65068, 93269 } },
+	{ 100, 25, { 0, 1, 1, 1 }, { 42567, 115043, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 26, { 0, 0, 1, 1 }, { 56901, 102787, 49251, 110634, 0, 0, 0, 0 } },
+	{ 100, 27, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 28, { 0, 0, 1, 1 }, { 56367, 100946, 48684, 108458, 0, 0, 0, 0 } },
+	{ 100, 29, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65056, 93258 } },
+	{ 100, 30, { -1, 0, 0, 0 }, { 0, 0, 73146, 87224, 62166, 98244, 53790, 106709 } },
+	{ 100, 31, { 0, 0, 1, 1 }, { 56798, 102884, 49123, 110760, 0, 0, 0, 0 } },
+	{ 100, 32, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 33, { 0, 0, 1, 1 }, { 56467, 100842, 48807, 108335, 0, 0, 0, 0 } },
+	{ 100, 34, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65047, 93273 } },
+	{ 100, 35, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 36, { 0, 0, 1, 1 }, { 56728, 102943, 49037, 110838, 0, 0, 0, 0 } },
+	{ 100, 37, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 100, 38, { 0, 0, 1, 1 }, { 56539, 100768, 48895, 108246, 0, 0, 0, 0 } },
+	{ 100, 39, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65040, 93272 } },
+	{ 100, 40, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 65061, 93315 } },
+	{ 100, 41, { -1, -1, -1, 0 }, { 0, 0, 0, 0, 0, 0, 64677, 94265 } },
+	{ 101, 0, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 1, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 2, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 3, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 4, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 5, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 6, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 7, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 8, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 9, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 10, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 11, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 12, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 13, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 14, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 15, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 16, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 17, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 18, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 19, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 20, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 21, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 22, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 23, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 24, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 25, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 26, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 27, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 28, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 29, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 30, { -1, -1, -1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 31, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 32, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 33, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 34, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 35, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 36, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 37, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 38, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 39, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 40, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 101, 41, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 0, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 1, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 2, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 3, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 4, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 5, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 6, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 7, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 8, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 9, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 10, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 11, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 12, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 13, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 14, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 15, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 16, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 17, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 18, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 19, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 20, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 21, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 22, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 23, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 24, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 25, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 26, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 27, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 28, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 29, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 30, { -1, -1, -1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 31, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 32, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 33, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 34, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 35, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 36, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 37, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 38, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 39, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 40, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 102, 41, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 0, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 1, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 2, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 3, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 4, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 5, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 6, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 7, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 8, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 9, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 10, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 11, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 12, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 13, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 14, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 15, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 16, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 17, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 18, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 19, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 20, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 21, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 22, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 23, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 24, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 25, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 26, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 27, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 28, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 29, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 30, { -1, -1, -1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 31, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 32, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 33, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 34, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 35, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 36, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 37, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 38, { 1, 1, 1, 1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 39, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 40, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+	{ 103, 41, { -1, -1, -1, -1 }, { 0, 0, 0, 0, 0, 0, 0, 0 } },
+};
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+#
+# Generates ofxSolarReference.inl, the reference rise/set and twilight
+# times ofxSolarVerify::reference() checks ofxSolar against:
+#
+#     python3 ofxSolarReference.py ofxSolarReference.inl
+#
+# Independent of the addon's ephemeris: Meeus' low precision solar
+# coordinates (Astronomical Algorithms ch. 25, apparent longitude, about
+# 0.01 degrees) and his mean sidereal time, with every event iterated to
+# the instant the hour angle meets the one of the Sun's declination at
+# that instant, until it moves less than 0.4 ms. Altitudes as sunriset():
+# -35' for the upper limb at rise/set, -6, -12 and -18 degrees for the
+# centre at the twilights.
+#
+# Sites are every LOCATION_* of ofxSolar.h and a grid of latitudes from
+# pole to pole at three longitudes; dates are 1801 Jan 1, 2099 Dec 31 and
+# the solstices, equinoxes and one more date of eight years in between.
+# Pairs where the Sun only just reaches the altitude (|cos H0| > 0.97),
+# where a hundredth of a degree moves the events by many minutes, are
+# marked S and skipped by the check.
+#
+
+import datetime, math, os, re, sys
+
+DEG = math.pi / 180.0
+
+# Altitudes in degrees and upper limb flags of rise/set and the twilights
+ALTITUDES = [ ( -35.0 / 60.0, True ), ( -6.0, False ), ( -12.0, False ), ( -18.0, False ) ]
+
+# Codes of a pair of events, as the return codes of sunriset() and 2
+EVENT, ABOVE, BELOW, SKIPPED = 0, 1, -1, 2
+
+
+def days_since_2000_Jan_0( y, m, d ):
+    """Gregorian, from the proleptic ordinal of the date, not from
+    ofxSolar.h's formula"""
+    return ( datetime.date( y, m, d ) - datetime.date( 1999, 12, 31 ) ).days
+
+
+def rev180( x ):
+    return x - 360.0 * math.floor( x / 360.0 + 0.5 )
+
+
+def sun( jd ):
+    """Apparent right ascension and declination in degrees, distance in AU
+    and mean sidereal time at Greenwich in degrees at Julian day jd"""
+    T = ( jd - 2451545.0 ) / 36525.0
+    L0 = 280.46646 + 36000.76983 * T + 0.0003032 * T * T
+    M = 357.52911 + 35999.05029 * T - 0.0001537 * T * T
+    e = 0.016708634 - 0.000042037 * T - 0.0000001267 * T * T
+    C = ( ( 1.914602 - 0.004817 * T - 0.000014 * T * T ) * math.sin( M * DEG )
+        + ( 0.019993 - 0.000101 * T ) * math.sin( 2 * M * DEG )
+        + 0.000289 * math.sin( 3 * M * DEG ) )
+    nu = M + C
+    R = 1.000001018 * ( 1 - e * e ) / ( 1 + e * math.cos( nu * DEG ) )
+    omega = 125.04 - 1934.136 * T
+    lam = L0 + C - 0.00569 - 0.00478 * math.sin( omega * DEG )
+    eps0 = 23 + 26 / 60.0 + ( 21.448 - 46.8150 * T - 0.00059 * T * T + 0.001813 * T ** 3 ) / 3600.0
+    eps = eps0 + 0.00256 * math.cos( omega * DEG )
+    ra = math.atan2( math.cos( eps * DEG ) * math.sin( lam * DEG ), math.cos( lam * DEG ) ) / DEG
+    dec = math.asin( math.sin( eps * DEG ) * math.sin( lam * DEG ) ) / DEG
+    gmst = ( 280.46061837 + 360.98564736629 * ( jd - 2451545.0 )
+        + 0.000387933 * T * T - T ** 3 / 38710000.0 )
+    return ra, dec, R, gmst
+
+
+def cos_hour_angle( jd, lat, altitude, upper_limb ):
+    ra, dec, R, gmst = sun( jd )
+    h = altitude - ( 0.2666 / R if upper_limb else 0.0 )
+    c = ( math.sin( h * DEG ) - math.sin( lat * DEG ) * math.sin( dec * DEG ) ) / ( math.cos( lat * DEG ) * math.cos( dec * DEG ) )
+    return c, ra, gmst
+
+
+def event( year, month, day, lat, lon, altitude, upper_limb, rising ):
+    """( code, hours UT from 0h of the date ). Starts from local noon like
+    sunriset(), so events of longitudes far from Greenwich can be before
+    0h or after 24h"""
+    jd0 = 2451543.5 + days_since_2000_Jan_0( year, month, day )
+    t = 12.0 - lon / 15.0
+    c, ra, gmst = cos_hour_angle( jd0 + t / 24.0, lat, altitude, upper_limb )
+    if c >= 1.03:
+        return BELOW, 0.0
+    if c <= -1.03:
+        return ABOVE, 0.0
+    if abs( c ) > 0.97:
+        return SKIPPED, 0.0
+
+    t += ( -1.0 if rising else 1.0 ) * math.acos( c ) / DEG / 15.0
+    for i in range( 50 ):
+        c, ra, gmst = cos_hour_angle( jd0 + t / 24.0, lat, altitude, upper_limb )
+        if abs( c ) >= 1.0:
+            return SKIPPED, 0.0
+        wanted = ( -1.0 if rising else 1.0 ) * math.acos( c ) / DEG
+        dt = rev180( wanted - rev180( gmst + lon - ra ) ) / 360.98564736629 * 24.0
+        t += dt
+        if abs( dt ) < 1e-7:
+            return EVENT, t
+    return SKIPPED, 0.0
+
+
+def main( path ):
+    header = open( os.path.join( os.path.dirname( os.path.abspath( __file__ ) ), 'ofxSolar.h' ) ).read()
+    sites = [ ( name, float( lat ), float( lon ) ) for name, lat, lon in
+        re.findall( r'#define\s+(LOCATION_\w+)\s+([+-][\d.]+)\s*,\s*([+-][\d.]+)', header ) ]
+    for lat in range( -90, 91, 10 ):
+        for lon in ( 0.0, 100.5, -150.25 ):
+            sites.append( ( None, float( lat ), lon ) )
+
+    dates = [ ( 1801, 1, 1 ) ]
+    for i, year in enumerate( [ 1801, 1850, 1900, 1950, 2000, 2026, 2050, 2099 ] ):
+        dates += [ ( year, 3, 20 ), ( year, 6, 21 ), ( year, 9, 23 ), ( year, 12, 21 ) ]
+        dates.append( ( year, ( i * 5 ) % 12 + 1, ( i * 7 ) % 28 + 1 ) )
+    dates.append( ( 2099, 12, 31 ) )
+
+    out = [ '/* Generated by ofxSolarReference.py, do not edit */', '' ]
+    out.append( 'static const ofxSolarReferenceSite referenceSites[] = {' )
+    for name, lat, lon in sites:
+        if name:
+            out.append( '\t{ "%s", %s },' % ( name[len( 'LOCATION_' ):].lower(), name ) )
+        else:
+            out.append( '\t{ "%+d,%g", %.3f, %.3f },' % ( lat, lon, lat, lon ) )
+    out += [ '};', '' ]
+
+    out.append( 'static const ofxSolarReferenceDate referenceDates[] = {' )
+    for i in range( 0, len( dates ), 6 ):
+        out.append( '\t' + ' '.join( '{ %d, %d, %d },' % date for date in dates[i:i + 6] ) )
+    out += [ '};', '' ]
+
+    out.append( '/* Site, date, codes of rise/set and the three twilights, their times */' )
+    out.append( '/* in seconds UT from 0h of the date                                  */' )
+    out.append( 'static const ofxSolarReferenceRow referenceRows[] = {' )
+    counts = {}
+    for s, ( name, lat, lon ) in enumerate( sites ):
+        for d, ( year, month, day ) in enumerate( dates ):
+            codes, times = [], []
+            for altitude, upper_limb in ALTITUDES:
+                rise = event( year, month, day, lat, lon, altitude, upper_limb, True )
+                set = event( year, month, day, lat, lon, altitude, upper_limb, False )
+                if rise[0] == EVENT and set[0] == EVENT:
+                    code = EVENT
+                elif rise[0] == set[0] and rise[0] in ( ABOVE, BELOW ):
+                    code = rise[0]
+                else:
+                    code = SKIPPED
+                codes.append( code )
+                times += [ int( round( rise[1] * 3600 ) ), int( round( set[1] * 3600 ) ) ] if code == EVENT else [ 0, 0 ]
+                counts[code] = counts.get( code, 0 ) + 1
+            out.append( '\t{ %d, %d, { %s }, { %s } },' % ( s, d, ', '.join( map( str, codes ) ), ', '.join( map( str, times ) ) ) )
+    out.append( '};' )
+
+    open( path, 'w' ).write( '\n'.join( out ) + '\n' )
+    sys.stderr.write( '%d sites, %d dates, pairs: %d events, %d above, %d below, %d skipped\n' % ( len( sites ), len( dates ),
+        counts.get( EVENT, 0 ), counts.get( ABOVE, 0 ), counts.get( BELOW, 0 ), counts.get( SKIPPED, 0 ) ) )
+
+
+if __name__ == '__main__':
+    main( sys.argv[1] if len( sys.argv ) > 1 else 'ofxSolarReference.inl' )
@@ -0,0 +1,253 @@
+#include "ofxSolarScheduler.h"
+
+/* Days from 1970 Jan 1.0 to 2000 Jan 0.0 */
+#define UNIX_EPOCH_DAYS 10956.0
+
+ofxSolarScheduler::ofxSolarScheduler(){
+	running = false;
+	active = 0;
+}
+ofxSolarScheduler::~ofxSolarScheduler(){
+	stop();
+}
+
+double ofxSolarScheduler::now(){
+	chrono::duration<double> t = chrono::system_clock::now().time_since_epoch();
+	return t.count() / 86400.0 - UNIX_EPOCH_DAYS;
+}
+
+double ofxSolarScheduler::nextEvent( double lat, double lon, double altitude, bool upper_limb, bool rising, double after ){
+	/* Start a day early, the events of a local date are spread over two UT dates */
+	long daynum = (long)floor( after + lon/360.0 ) - 1;
+
+	for ( int i = 0; i < 368; i++, daynum++ ){
+		ofxSolarDayState state = ofxSolar::dayState( daynum, lon );
+		double t;
+		if ( ofxSolar::diurnalArc( state, lat, altitude, upper_limb, &t ) != 0 )
+			continue;   /* Sun above or below altitude all day */
+		double time = daynum + ( rising ? state.tsouth - t : state.tsouth + t ) / 24.0;
+		if ( time > after )
+			return time;
+	}
+	return HUGE_VAL;
+}
+
+size_t ofxSolarScheduler::add( double lat, double lon, ofxSolarEventType type, Callback callback ){
+	/* Same altitudes as ofxSolar::dayEvents() */
+	switch ( type ){
+	case OFXSOLAR_SUNRISE:            return add( lat, lon, -35.0/60.0, true, true, type, callback );
+	case OFXSOLAR_SUNSET:             return add( lat, lon, -35.0/60.0, true, false, type, callback );
+	case OFXSOLAR_CIVIL_START:        return add( lat, lon, -6.0, false, true, type, callback );
+	case OFXSOLAR_CIVIL_END:          return add( lat, lon, -6.0, false, false, type, callback );
+	case OFXSOLAR_NAUTICAL_START:     return add( lat, lon, -12.0, false, true, type, callback );
+	case OFXSOLAR_NAUTICAL_END:       return add( lat, lon, -12.0, false, false, type, callback );
+	case OFXSOLAR_ASTRONOMICAL_START: return add( lat, lon, -18.0, false, true, type, callback );
+	case OFXSOLAR_ASTRONOMICAL_END:   return add( lat, lon, -18.0, false, false, type, callback );
+	default:
+		ofLogError("ofxSolarScheduler") << "add(): altitude triggers need an altitude";
+		return (size_t)-1;
+	}
+}
+
+size_t ofxSolarScheduler::add( double lat, double lon, double altitude, bool upper_limb, bool rising, Callback callback ){
+	return add( lat, lon, altitude, upper_limb, rising,
+		rising ? OFXSOLAR_ALTITUDE_RISING : OFXSOLAR_ALTITUDE_SETTING, callback );
+}
+
+size_t ofxSolarScheduler::add( double lat, double lon, double altitude, bool upper_limb, bool rising,
+	ofxSolarEventType type, Callback callback ){
+	/* The first occurrence is computed before taking the lock */
+	double first = nextEvent( lat, lon, altitude, upper_limb, rising, now() );
+
+	lock_guard<mutex> lock( guard );
+	uint32_t index;
+	if ( freeSlots.empty() ){
+		index = triggers.size();
+		triggers.push_back( Trigger() );
+		triggers[index].generation = 0;
+	}else{
+		index = freeSlots.back();
+		freeSlots.pop_back();
+	}
+
+	Trigger &trigger = triggers[index];
+	trigger.lat = lat;
+	trigger.lon = lon;
+	trigger.altitude = altitude;
+	trigger.upper_limb = upper_limb;
+	trigger.rising = rising;
+	trigger.active = true;
+	trigger.type = type;
+	trigger.callback = make_shared<const Callback>( callback );
+	active++;
+
+	if ( first != HUGE_VAL ){
+		Entry entry = { first, index, trigger.generation };
+		heap.push( entry );
+		/* The timer thread may be sleeping until a later time */
+		if ( heap.top().index == index )
+			wake.notify_one();
+	}
+	return index;
+}
+
+bool ofxSolarScheduler::remove( size_t id ){
+	lock_guard<mutex> lock( guard );
+	if ( id >= triggers.size() || !triggers[id].active )
+		return false;
+
+	/* The heap entry stays and is dropped when it comes up */
+	Trigger &trigger = triggers[id];
+	trigger.active = false;
+	trigger.generation++;
+	trigger.callback.reset();
+	freeSlots.push_back( id );
+	active--;
+	return true;
+}
+
+void ofxSolarScheduler::clear(){
+	lock_guard<mutex> lock( guard );
+	/* The slots are kept with their generations bumped, so ids handed */
+	/* to a dispatch in progress don't match the triggers added later   */
+	freeSlots.clear();
+	for ( size_t i = triggers.size(); i-- > 0; ){
+		triggers[i].active = false;
+		triggers[i].generation++;
+		triggers[i].callback.reset();
+		freeSlots.push_back( (uint32_t)i );
+	}
+	heap = priority_queue<Entry, vector<Entry>, greater<Entry> >();
+	active = 0;
+}
+
+size_t ofxSolarScheduler::size(){
+	lock_guard<mutex> lock( guard );
+	return active;
+}
+
+double ofxSolarScheduler::getNextTime(){
+	lock_guard<mutex> lock( guard );
+	while ( !heap.empty() && heap.top().generation != triggers[heap.top().index].generation )
+		heap.pop();
+	return heap.empty() ? HUGE_VAL : heap.top().time;
+}
+
+void ofxSolarScheduler::schedule( uint32_t index, double after ){
+	const Trigger &trigger = triggers[index];
+	double next = nextEvent( trigger.lat, trigger.lon, trigger.altitude, trigger.upper_limb, trigger.rising, after );
+	if ( next != HUGE_VAL ){
+		Entry entry = { next, index, trigger.generation };
+		heap.push( entry );
+	}
+}
+
+int ofxSolarScheduler::dispatch( unique_lock<mutex> &lock, double time ){
+	struct Due{
+		ofxSolarSchedulerEvent event;
+		uint32_t generation;
+		shared_ptr<const Callback> callback;
+	};
+	vector<Due> due;
+
+	while ( !heap.empty() && heap.top().time <= time ){
+		Entry entry = heap.top();
+		heap.pop();
+		Trigger &trigger = triggers[entry.index];
+		if ( entry.generation != trigger.generation )
+			continue;   /* Removed */
+
+		ofxSolarSchedulerEvent event = { entry.index, trigger.type, entry.time,
+			trigger.lat, trigger.lon, trigger.altitude };
+		Due d = { event, entry.generation, trigger.callback };
+		due.push_back( d );
+
+		/* Missed occurrences aren't replayed, roll on past time */
+		schedule( entry.index, max( entry.time, time ) );
+	}
+
+	/* Callbacks run unlocked so they can add and remove triggers. One  */
+	/* removed by an earlier callback of the batch doesn't fire anymore */
+	int fired = 0;
+	for ( size_t i = 0; i < due.size(); i++ ){
+		uint32_t index = (uint32_t)due[i].event.id;
+		if ( index >= triggers.size() || triggers[index].generation != due[i].generation )
+			continue;
+		lock.unlock();
+		( *due[i].callback )( due[i].event );
+		lock.lock();
+		fired++;
+	}
+
+	return fired;
+}
+
+int ofxSolarScheduler::process( double time ){
+	unique_lock<mutex> lock( guard );
+	return dispatch( lock, time );
+}
+
+void ofxSolarScheduler::start(){
+	unique_lock<mutex> lock( guard );
+	if ( running )
+		return;
+
+	/* A callback that stopped the timer thread and starts it again: */
+	/* the thread is still in its loop and just carries on           */
+	if ( this_thread::get_id() == timer.get_id() ){
+		running = true;
+		return;
+	}
+
+	/* Stopped from a callback, the thread ended without a join */
+	if ( timer.joinable() ){
+		thread stopped = move( timer );
+		lock.unlock();
+		stopped.join();
+		lock.lock();
+		if ( running )
+			return;
+	}
+	running = true;
+	timer = thread( &ofxSolarScheduler::run, this );
+}
+
+void ofxSolarScheduler::stop(){
+	{
+		lock_guard<mutex> lock( guard );
+		running = false;
+	}
+	wake.notify_one();
+
+	/* From a callback on the timer thread, which can't join itself: */
+	/* it ends after the callback, start() or the destructor joins it */
+	if ( this_thread::get_id() == timer.get_id() )
+		return;
+	if ( timer.joinable() )
+		timer.join();
+}
+
+bool ofxSolarScheduler::isRunning(){
+	lock_guard<mutex> lock( guard );
+	return running;
+}
+
+void ofxSolarScheduler::run(){
+	unique_lock<mutex> lock( guard );
+
+	while ( running ){
+		double time = now();
+		if ( !heap.empty() && heap.top().time <= time ){
+			dispatch( lock, time );
+			continue;
+		}
+		if ( heap.empty() ){
+			wake.wait( lock );
+		}else{
+			/* Woken early by add() or stop(), or late by the OS, the loop sorts it out */
+			chrono::duration<double> t( ( heap.top().time + UNIX_EPOCH_DAYS ) * 86400.0 );
+			wake.wait_until( lock, chrono::system_clock::time_point(
+				chrono::duration_cast<chrono::system_clock::duration>( t ) ) );
+		}
+	}
+}
@@ -0,0 +1,126 @@
+/*
+
+ofxSolarScheduler - calls back at sunrise, sunset, twilight or any other
+altitude of the Sun, without polling
+
+Every trigger is a site, an altitude and a direction (rising in the
+morning, setting in the evening). The scheduler keeps the next instant of
+every trigger in a min-heap and one timer thread sleeps until the
+earliest of them, fires the callbacks that are due and rolls each of
+those triggers forward to its next occurrence. Adding, removing and
+rescheduling a trigger is O(log n), a firing costs one dayState() and
+diurnalArc() evaluation for the next day.
+
+Days on which the Sun doesn't cross the altitude (return codes +1 and -1
+of sunriset(), polar day and night) are skipped, a sunset trigger at 89
+degrees north only fires on the few days around the equinoxes. A trigger
+that doesn't occur within a year, e.g. astronomical twilight at the pole
+in the wrong season forever, stays registered but never fires.
+
+Times are days since 2000 Jan 0.0 UT, the same scale as the d of the
+ephemeris functions, now() converts the system clock. Callbacks run on
+the timer thread, or on the caller's thread with process(), and may add
+or remove triggers; a trigger removed by a callback doesn't fire
+afterwards, even if it was due in the same batch. If the machine was
+suspended over several occurrences, a trigger fires once and continues
+with the next future one.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+enum ofxSolarEventType{
+	OFXSOLAR_SUNRISE,
+	OFXSOLAR_SUNSET,
+	OFXSOLAR_CIVIL_START,
+	OFXSOLAR_CIVIL_END,
+	OFXSOLAR_NAUTICAL_START,
+	OFXSOLAR_NAUTICAL_END,
+	OFXSOLAR_ASTRONOMICAL_START,
+	OFXSOLAR_ASTRONOMICAL_END,
+	OFXSOLAR_ALTITUDE_RISING,     /* User specified altitude, morning */
+	OFXSOLAR_ALTITUDE_SETTING     /* User specified altitude, evening */
+};
+
+struct ofxSolarSchedulerEvent{
+	size_t id;                    /* As returned by ofxSolarScheduler::add() */
+	ofxSolarEventType type;
+	double time;                  /* When the Sun crossed the altitude, days since 2000 Jan 0.0 UT */
+	double lat, lon, altitude;
+};
+
+class ofxSolarScheduler{
+
+public:
+
+	typedef function<void( const ofxSolarSchedulerEvent & )> Callback;
+
+	ofxSolarScheduler();
+	~ofxSolarScheduler();
+	ofxSolarScheduler( const ofxSolarScheduler & ) = delete;
+	ofxSolarScheduler & operator=( const ofxSolarScheduler & ) = delete;
+
+	/* Returns the trigger's id, first occurrence after now() */
+	size_t add( double lat, double lon, ofxSolarEventType type, Callback callback );
+	size_t add( double lat, double lon, double altitude, bool upper_limb, bool rising, Callback callback );
+
+	bool remove( size_t id );
+	void clear();
+	size_t size();
+
+	/* Runs the timer thread. A callback may call stop(), the thread then */
+	/* ends when the callback returns and is joined by the next start()   */
+	/* or the destructor                                                  */
+	void start();
+	void stop();
+	bool isRunning();
+
+	/* Without the thread: fires everything due up to time, returns the */
+	/* number of callbacks                                              */
+	int process( double time );
+
+	/* Earliest scheduled instant, HUGE_VAL if there is none */
+	double getNextTime();
+
+	/* The system clock in days since 2000 Jan 0.0 UT */
+	static double now();
+
+	/* First instant after the time after when the Sun crosses altitude */
+	/* at the site, HUGE_VAL if that doesn't happen within a year       */
+	static double nextEvent( double lat, double lon, double altitude, bool upper_limb, bool rising, double after );
+
+private:
+
+	struct Trigger{
+		double lat, lon, altitude;
+		bool upper_limb, rising, active;
+		ofxSolarEventType type;
+		uint32_t generation;          /* Bumped on remove, invalidates heap entries */
+		shared_ptr<const Callback> callback;
+	};
+
+	struct Entry{
+		double time;
+		uint32_t index, generation;
+		bool operator>( const Entry &other ) const { return time > other.time; }
+	};
+
+	size_t add( double lat, double lon, double altitude, bool upper_limb, bool rising,
+		ofxSolarEventType type, Callback callback );
+	void schedule( uint32_t index, double after );
+	int dispatch( unique_lock<mutex> &lock, double time );
+	void run();
+
+	mutex guard;
+	condition_variable wake;
+	thread timer;
+	bool running;
+
+	vector<Trigger> triggers;
+	vector<uint32_t> freeSlots;
+	size_t active;
+	priority_queue<Entry, vector<Entry>, greater<Entry> > heap;
+
+};
@@ -0,0 +1,565 @@
+#include "ofxSolarServer.h"
+#include "ofxSolarArena.h"
+#include "ofxSolarBatch.h"
+#include "ofxSolarTimeZone.h"
+
+#include <cerrno>
+
+#ifdef TARGET_LINUX
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+#ifndef TARGET_WIN32
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+static_assert( sizeof(ofxSolarQuery) == 40, "ofxSolarQuery must be 40 bytes" );
+static_assert( sizeof(ofxSolarAnswer) == 16, "ofxSolarAnswer must be 16 bytes" );
+
+/* Values per date of an events mask */
+static int valueCount( unsigned events ){
+	int n = 0;
+	for ( events &= OFXSOLAR_EVENT_ALL; events; events &= events - 1 )
+		n++;
+	return n;
+}
+
+/* The date of a days_since_2000_Jan_0() day number */
+static void civilFromDaynum( long dn, int *year, int *month, int *day ){
+	ofxSolarTimeZone::civilFromDays( dn + ofxSolarTimeZone::daysFromCivil( 2000, 1, 1 ) - 1, year, month, day );
+}
+
+static bool validQuery( const ofxSolarQuery &q ){
+	if ( !( q.days >= 1 && q.days <= 366 && q.year >= 1801 && q.year <= 2099
+		&& q.month >= 1 && q.month <= 12 && q.day >= 1 && q.day <= 31
+		&& fabs( q.lat ) <= 90.0 && fabs( q.lon ) <= 180.0 && fabs( q.tz ) <= 24.0
+		&& ( q.events & OFXSOLAR_EVENT_ALL ) != 0 ) )
+		return false;
+
+	/* Days past the end of the month, e.g. February 30, come back as another date */
+	int year, month, day;
+	civilFromDaynum( days_since_2000_Jan_0(q.year,q.month,q.day), &year, &month, &day );
+	return year == q.year && month == q.month && day == q.day;
+}
+
+#ifndef TARGET_WIN32
+static bool socketAddress( const string &path, sockaddr_un *address ){
+	memset( address, 0, sizeof(*address) );
+	address->sun_family = AF_UNIX;
+	if ( path.empty() || path.size() >= sizeof(address->sun_path) )
+		return false;
+	memcpy( address->sun_path, path.c_str(), path.size() + 1 );
+	return true;
+}
+#endif
+
+
+/* Server */
+
+struct ofxSolarServer::Connection{
+	int fd;
+	vector<char> in, out;
+	size_t sent;          /* Of out */
+	size_t queued;        /* Answer bytes of its requests in pending */
+	bool writing;         /* Waiting for EPOLLOUT */
+	bool paused;          /* Requests wait for out to drain, no EPOLLIN */
+	bool closed;
+};
+
+ofxSolarServer::ofxSolarServer(){
+	listener = epoll = wake = -1;
+	running = false;
+	accepted = requests = turns = dates = pauses = maxBuffered = 0;
+}
+
+ofxSolarServer::~ofxSolarServer(){
+	stop();
+}
+
+bool ofxSolarServer::isRunning() const{
+	return running;
+}
+
+ofxSolarServerStats ofxSolarServer::getStats() const{
+	ofxSolarServerStats stats;
+	stats.connections = accepted;
+	stats.requests = requests;
+	stats.turns = turns;
+	stats.dates = dates;
+	stats.pauses = pauses;
+	stats.maxBuffered = maxBuffered;
+	return stats;
+}
+
+#ifdef TARGET_LINUX
+
+bool ofxSolarServer::setup( const string &path ){
+	stop();
+	this->path = ofToDataPath( path );
+
+	sockaddr_un address;
+	if ( !socketAddress( this->path, &address ) ){
+		ofLogError("ofxSolarServer") << "socket path too long: " << path;
+		return false;
+	}
+
+	/* A socket file left behind by a server that didn't stop */
+	struct stat info;
+	if ( lstat( this->path.c_str(), &info ) == 0 && S_ISSOCK( info.st_mode ) )
+		unlink( this->path.c_str() );
+
+	listener = ::socket( AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0 );
+	epoll = epoll_create1( EPOLL_CLOEXEC );
+	wake = eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+	if ( listener < 0 || epoll < 0 || wake < 0
+		|| bind( listener, (sockaddr *)&address, sizeof(address) ) != 0
+		|| listen( listener, SOMAXCONN ) != 0 ){
+		ofLogError("ofxSolarServer") << "couldn't listen on " << path << ": " << strerror( errno );
+		if ( listener >= 0 ) ::close( listener );
+		if ( epoll >= 0 ) ::close( epoll );
+		if ( wake >= 0 ) ::close( wake );
+		listener = epoll = wake = -1;
+		return false;
+	}
+
+	epoll_event event;
+	event.events = EPOLLIN;
+	event.data.fd = listener;
+	epoll_ctl( epoll, EPOLL_CTL_ADD, listener, &event );
+	event.data.fd = wake;
+	epoll_ctl( epoll, EPOLL_CTL_ADD, wake, &event );
+
+	running = true;
+	worker = thread( &ofxSolarServer::loop, this );
+	return true;
+}
+
+void ofxSolarServer::stop(){
+	if ( !worker.joinable() )
+		return;
+	running = false;
+	uint64_t one = 1;
+	if ( ::write( wake, &one, sizeof(one) ) < 0 )
+		ofLogError("ofxSolarServer") << "couldn't wake the loop";
+	worker.join();
+
+	for ( auto &c : connections )
+		::close( c.first );
+	connections.clear();
+	pending.clear();
+	resumed.clear();
+	::close( listener );
+	::close( epoll );
+	::close( wake );
+	listener = epoll = wake = -1;
+	unlink( path.c_str() );
+}
+
+void ofxSolarServer::loop(){
+	epoll_event events[64];
+	while ( running ){
+		/* Requests of resumed connections are waiting, don't block */
+		int n = epoll_wait( epoll, events, 64, pending.empty() ? -1 : 0 );
+		if ( n < 0 ){
+			if ( errno == EINTR )
+				continue;
+			ofLogError("ofxSolarServer") << "epoll_wait: " << strerror( errno );
+			break;
+		}
+
+		/* Read everything that is there... */
+		for ( int i = 0; i < n; i++ ){
+			int fd = events[i].data.fd;
+			if ( fd == wake )
+				continue;
+			if ( fd == listener ){
+				accept();
+				continue;
+			}
+			auto found = connections.find( fd );
+			if ( found == connections.end() )
+				continue;
+			Connection &c = *found->second;
+			if ( events[i].events & ( EPOLLIN | EPOLLHUP | EPOLLERR ) )
+				c.closed = c.closed || !receive( c );
+			if ( ( events[i].events & EPOLLOUT ) && !c.closed )
+				c.closed = !send( c );
+		}
+
+		/* ...then answer it all at once */
+		answer();
+
+		/* Connections whose answers drained take their requests again, */
+		/* answered in the next turn                                    */
+		for ( size_t i = 0; i < resumed.size(); i++ )
+			if ( !resumed[i]->closed )
+				parse( *resumed[i] );
+		resumed.clear();
+
+		for ( auto c = connections.begin(); c != connections.end(); ){
+			if ( c->second->closed ){
+				::close( c->first );
+				c = connections.erase( c );
+			}else{
+				++c;
+			}
+		}
+	}
+}
+
+void ofxSolarServer::accept(){
+	for ( ;; ){
+		int fd = accept4( listener, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC );
+		if ( fd < 0 ){
+			if ( errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR )
+				ofLogError("ofxSolarServer") << "accept: " << strerror( errno );
+			if ( errno == EINTR )
+				continue;
+			return;
+		}
+		unique_ptr<Connection> c( new Connection );
+		c->fd = fd;
+		c->sent = c->queued = 0;
+		c->writing = c->paused = c->closed = false;
+
+		epoll_event event;
+		event.events = EPOLLIN;
+		event.data.fd = fd;
+		epoll_ctl( epoll, EPOLL_CTL_ADD, fd, &event );
+		connections[fd] = move( c );
+		accepted++;
+	}
+}
+
+bool ofxSolarServer::receive( Connection &c ){
+	char buffer[65536];
+	bool open = true;
+	for ( ;; ){
+		ssize_t n = ::read( c.fd, buffer, sizeof(buffer) );
+		if ( n > 0 ){
+			c.in.insert( c.in.end(), buffer, buffer + n );
+			continue;
+		}
+		if ( n < 0 && errno == EINTR )
+			continue;
+		/* 0 is the client closing, anything but EAGAIN an error */
+		open = n < 0 && ( errno == EAGAIN || errno == EWOULDBLOCK );
+		break;
+	}
+
+	parse( c );
+	return open;
+}
+
+/* Epoll events of a connection: input unless paused, output while waiting for room */
+static uint32_t interest( bool paused, bool writing ){
+	return ( paused ? 0u : (uint32_t)EPOLLIN ) | ( writing ? (uint32_t)EPOLLOUT : 0u );
+}
+
+void ofxSolarServer::parse( Connection &c ){
+	/* Whole requests, a partial one waits for the rest, as long as the */
+	/* answers held for the connection stay within the limit            */
+	size_t used = 0;
+	for ( ; c.in.size() - used >= sizeof(ofxSolarQuery); used += sizeof(ofxSolarQuery) ){
+		if ( c.out.size() - c.sent + c.queued > OFXSOLAR_SERVER_OUTPUT_LIMIT )
+			break;
+		ofxSolarQuery query;
+		memcpy( &query, c.in.data() + used, sizeof(query) );
+		pending.push_back( make_pair( &c, query ) );
+		c.queued += sizeof(ofxSolarAnswer) + ( validQuery( query ) ? (size_t)query.days * valueCount( query.events ) * sizeof(double) : 0 );
+		requests++;
+	}
+	c.in.erase( c.in.begin(), c.in.begin() + used );
+
+	/* Stop reading the client until send() drained its answers */
+	if ( c.in.size() >= sizeof(ofxSolarQuery) && !c.paused ){
+		c.paused = true;
+		pauses++;
+		epoll_event event;
+		event.events = interest( c.paused, c.writing );
+		event.data.fd = c.fd;
+		epoll_ctl( epoll, EPOLL_CTL_MOD, c.fd, &event );
+	}
+}
+
+bool ofxSolarServer::send( Connection &c ){
+	while ( c.sent < c.out.size() ){
+		ssize_t n = ::send( c.fd, c.out.data() + c.sent, c.out.size() - c.sent, MSG_NOSIGNAL );
+		if ( n >= 0 ){
+			c.sent += n;
+			continue;
+		}
+		if ( errno == EINTR )
+			continue;
+		if ( errno != EAGAIN && errno != EWOULDBLOCK )
+			return false;
+
+		/* The client is slow to read, go on when it has room. The sent */
+		/* part goes once it is as large as the limit, so the buffer    */
+		/* stays within about twice the limit                           */
+		if ( c.sent >= OFXSOLAR_SERVER_OUTPUT_LIMIT ){
+			c.out.erase( c.out.begin(), c.out.begin() + c.sent );
+			c.sent = 0;
+		}
+		if ( !c.writing ){
+			c.writing = true;
+			epoll_event event;
+			event.events = interest( c.paused, c.writing );
+			event.data.fd = c.fd;
+			epoll_ctl( epoll, EPOLL_CTL_MOD, c.fd, &event );
+		}
+		return true;
+	}
+
+	c.out.clear();
+	c.sent = 0;
+	if ( c.writing || c.paused ){
+		/* Drained: read the client again and take its waiting requests */
+		if ( c.paused )
+			resumed.push_back( &c );
+		c.writing = c.paused = false;
+		epoll_event event;
+		event.events = interest( c.paused, c.writing );
+		event.data.fd = c.fd;
+		epoll_ctl( epoll, EPOLL_CTL_MOD, c.fd, &event );
+	}
+	return true;
+}
+
+void ofxSolarServer::answer()
+	/**********************************************************************/
+	/* Computes every pending request. The dates are swept in order with  */
+	/* the requests covering each date, which share one calculate()       */
+	/**********************************************************************/
+{
+	if ( pending.empty() )
+		return;
+	turns++;
+
+	static thread_local ofxSolarArena arena;
+	size_t count = pending.size();
+	ofxSolarSpan<long> first = arena.allocate<long>( count );
+	ofxSolarSpan<double *> values = arena.allocate<double *>( count );
+	ofxSolarSpan<size_t> order = arena.allocate<size_t>( count );
+	ofxSolarSpan<size_t> active = arena.allocate<size_t>( count );
+	ofxSolarSpan<double> lat = arena.allocate<double>( count ), lon = arena.allocate<double>( count ),
+		tz = arena.allocate<double>( count );
+	ofxSolarBatchOutput out = ofxSolarBatch::allocate( arena, count );
+
+	size_t valid = 0;
+	for ( size_t i = 0; i < count; i++ ){
+		const ofxSolarQuery &q = pending[i].second;
+		values[i] = NULL;
+		if ( pending[i].first->closed || !validQuery( q ) )
+			continue;
+		first[i] = days_since_2000_Jan_0(q.year,q.month,q.day);
+		values[i] = arena.allocate<double>( (size_t)q.days * valueCount( q.events ) ).data();
+		order[valid++] = i;
+	}
+	sort( order.begin(), order.begin() + valid, [&]( size_t a, size_t b ){ return first[a] < first[b]; } );
+
+	/* Sweep the dates, the requests enter at their first date and leave */
+	/* after their last                                                  */
+	size_t next = 0, live = 0;
+	long dn = 0;
+	while ( next < valid || live > 0 ){
+		/* Jump over dates nobody asked for */
+		if ( live == 0 )
+			dn = first[order[next]];
+		while ( next < valid && first[order[next]] == dn )
+			active[live++] = order[next++];
+
+		for ( size_t j = 0; j < live; j++ ){
+			const ofxSolarQuery &q = pending[active[j]].second;
+			lat[j] = q.lat;
+			lon[j] = q.lon;
+			tz[j] = q.tz;
+		}
+		int year, month, day;
+		civilFromDaynum( dn, &year, &month, &day );
+		ofxSolarBatch::calculate( year, month, day, live, lat.data(), lon.data(), tz.data(), out );
+		dates++;
+
+		/* Each request's events in the order of the bits */
+		size_t kept = 0;
+		for ( size_t j = 0; j < live; j++ ){
+			size_t i = active[j];
+			const ofxSolarQuery &q = pending[i].second;
+			const double all[9] = {
+				out.rs[j] ? NAN : out.rise[j], out.rs[j] ? NAN : out.set[j],
+				out.civ[j] ? NAN : out.civ_start[j], out.civ[j] ? NAN : out.civ_end[j],
+				out.naut[j] ? NAN : out.naut_start[j], out.naut[j] ? NAN : out.naut_end[j],
+				out.astr[j] ? NAN : out.astr_start[j], out.astr[j] ? NAN : out.astr_end[j],
+				out.dayleng[j] };
+			double *v = values[i] + ( dn - first[i] ) * valueCount( q.events );
+			for ( int e = 0; e < 9; e++ )
+				if ( q.events & ( 1 << e ) )
+					*v++ = all[e];
+			if ( dn - first[i] + 1 < q.days )
+				active[kept++] = i;
+		}
+		live = kept;
+		dn++;
+	}
+
+	/* Answers in the order the requests came */
+	for ( size_t i = 0; i < count; i++ ){
+		Connection &c = *pending[i].first;
+		if ( c.closed )
+			continue;
+		const ofxSolarQuery &q = pending[i].second;
+		ofxSolarAnswer a;
+		memset( &a, 0, sizeof(a) );
+		a.id = q.id;
+		a.status = values[i] ? OFXSOLAR_ANSWER_OK : OFXSOLAR_ANSWER_INVALID;
+		a.values = values[i] ? valueCount( q.events ) : 0;
+		a.days = values[i] ? q.days : 0;
+		c.out.insert( c.out.end(), (const char *)&a, (const char *)&a + sizeof(a) );
+		c.out.insert( c.out.end(), (const char *)values[i], (const char *)( values[i] + a.days * a.values ) );
+	}
+	for ( size_t i = 0; i < count; i++ ){
+		Connection &c = *pending[i].first;
+		c.queued = 0;
+		if ( c.out.size() > maxBuffered )
+			maxBuffered = c.out.size();
+		if ( !c.closed && !c.out.empty() && !c.writing )
+			c.closed = !send( c );
+	}
+
+	pending.clear();
+	arena.reset();
+}
+
+#else
+
+bool ofxSolarServer::setup( const string &path ){
+	ofLogError("ofxSolarServer") << "needs epoll, only available on Linux, not serving " << path;
+	return false;
+}
+
+void ofxSolarServer::stop(){
+}
+
+void ofxSolarServer::loop(){
+}
+
+void ofxSolarServer::accept(){
+}
+
+bool ofxSolarServer::receive( Connection & ){
+	return false;
+}
+
+void ofxSolarServer::parse( Connection & ){
+}
+
+bool ofxSolarServer::send( Connection & ){
+	return false;
+}
+
+void ofxSolarServer::answer(){
+}
+
+#endif
+
+
+/* Client */
+
+ofxSolarClient::ofxSolarClient(){
+	socket = -1;
+}
+
+ofxSolarClient::~ofxSolarClient(){
+	close();
+}
+
+#ifndef TARGET_WIN32
+
+bool ofxSolarClient::connect( const string &path ){
+	close();
+	sockaddr_un address;
+	if ( !socketAddress( ofToDataPath( path ), &address ) ){
+		ofLogError("ofxSolarClient") << "socket path too long: " << path;
+		return false;
+	}
+	socket = ::socket( AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+	if ( socket < 0 || ::connect( socket, (sockaddr *)&address, sizeof(address) ) != 0 ){
+		ofLogError("ofxSolarClient") << "couldn't connect to " << path << ": " << strerror( errno );
+		close();
+		return false;
+	}
+	return true;
+}
+
+void ofxSolarClient::close(){
+	if ( socket >= 0 )
+		::close( socket );
+	socket = -1;
+}
+
+bool ofxSolarClient::send( const ofxSolarQuery &query ){
+	const char *p = (const char *)&query;
+	size_t left = sizeof(query);
+	while ( left > 0 && socket >= 0 ){
+		ssize_t n = ::send( socket, p, left, MSG_NOSIGNAL );
+		if ( n < 0 && errno == EINTR )
+			continue;
+		if ( n <= 0 )
+			return false;
+		p += n;
+		left -= n;
+	}
+	return left == 0;
+}
+
+bool ofxSolarClient::readFully( void *data, size_t size ){
+	char *p = (char *)data;
+	while ( size > 0 && socket >= 0 ){
+		ssize_t n = ::read( socket, p, size );
+		if ( n < 0 && errno == EINTR )
+			continue;
+		if ( n <= 0 )
+			return false;
+		p += n;
+		size -= n;
+	}
+	return size == 0;
+}
+
+bool ofxSolarClient::receive( ofxSolarAnswer *answer, vector<double> &values ){
+	if ( !readFully( answer, sizeof(*answer) ) )
+		return false;
+	values.resize( (size_t)answer->days * answer->values );
+	return values.empty() || readFully( values.data(), values.size() * sizeof(double) );
+}
+
+#else
+
+bool ofxSolarClient::connect( const string &path ){
+	ofLogError("ofxSolarClient") << "Unix domain sockets aren't supported here, not connecting to " << path;
+	return false;
+}
+
+void ofxSolarClient::close(){
+}
+
+bool ofxSolarClient::send( const ofxSolarQuery & ){
+	return false;
+}
+
+bool ofxSolarClient::readFully( void *, size_t ){
+	return false;
+}
+
+bool ofxSolarClient::receive( ofxSolarAnswer *, vector<double> & ){
+	return false;
+}
+
+#endif
+
+bool ofxSolarClient::query( const ofxSolarQuery &query, ofxSolarAnswer *answer, vector<double> &values ){
+	return send( query ) && receive( answer, values );
+}
@@ -0,0 +1,276 @@
+#include "ofxSolarTableFile.h"
+
+#include <cstddef>
+
+#ifdef TARGET_WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert( sizeof(ofxSolarTableHeader) == 128, "ofxSolarTableHeader must be 128 bytes" );
+static_assert( sizeof(ofxSolarTableRecord) == 64, "ofxSolarTableRecord must be 64 bytes" );
+static_assert( sizeof(ofxSolarTableSite) == 32, "ofxSolarTableSite must be 32 bytes" );
+
+static const char tableMagic[8] = { 'o', 'f', 'x', 'S', 'o', 'l', 'a', 'r' };
+
+/* FNV-1a over 64 bit words, all checksummed blocks are multiples of 8 bytes */
+
+static uint64_t tableChecksum( uint64_t h, const void *data, size_t size ){
+	const unsigned char *p = (const unsigned char *)data;
+	for ( size_t i = 0; i + 8 <= size; i += 8 ){
+		uint64_t w;
+		memcpy( &w, p + i, 8 );
+		h = ( h ^ w ) * 0x100000001b3ULL;
+	}
+	return h;
+}
+
+static const uint64_t tableChecksumSeed = 0xcbf29ce484222325ULL;
+
+static uint64_t headerChecksum( const ofxSolarTableHeader &header ){
+	return tableChecksum( tableChecksumSeed, &header, offsetof(ofxSolarTableHeader, headerChecksum) );
+}
+
+
+ofxSolarTableWriter::ofxSolarTableWriter(){
+	file = NULL;
+	checksum = tableChecksumSeed;
+	memset( &header, 0, sizeof(header) );
+}
+ofxSolarTableWriter::~ofxSolarTableWriter(){
+	if ( file )
+		close();
+}
+
+bool ofxSolarTableWriter::open( const string &path, int year, int month, int day, int days ){
+	if ( file )
+		close();
+	if ( days < 1 ){
+		ofLogError("ofxSolarTableWriter") << "a table needs at least one day, not " << days;
+		return false;
+	}
+
+	file = fopen( ofToDataPath(path).c_str(), "wb" );
+	if ( !file ){
+		ofLogError("ofxSolarTableWriter") << "couldn't create " << path;
+		return false;
+	}
+
+	memset( &header, 0, sizeof(header) );
+	memcpy( header.magic, tableMagic, sizeof(tableMagic) );
+	header.version = OFXSOLAR_TABLE_VERSION;
+	header.byteOrder = 0x01020304;
+	header.headerSize = sizeof(ofxSolarTableHeader);
+	header.recordSize = sizeof(ofxSolarTableRecord);
+	header.days = days;
+	header.firstDay = days_since_2000_Jan_0(year,month,day);
+	header.recordsOffset = sizeof(ofxSolarTableHeader);
+
+	sites.clear();
+	records.assign( days, ofxSolarTableRecord() );
+	checksum = tableChecksumSeed;
+
+	/* Placeholder, the real header is written by close() */
+	return write( &header, sizeof(header) );
+}
+
+bool ofxSolarTableWriter::addSite( double lat, double lon, double tz ){
+	if ( !file )
+		return false;
+
+	for ( uint32_t i = 0; i < header.days; i++ ){
+		ofxSolarDay events;
+		ofxSolarTableRecord &record = records[i];
+
+		ofxSolar::dayEvents( ofxSolar::dayState( header.firstDay + (long)i, lon ), lat, tz, &events );
+		memset( &record, 0, sizeof(record) );
+		record.rise = events.rise;
+		record.set = events.set;
+		record.civ_start = events.civ_start;
+		record.civ_end = events.civ_end;
+		record.naut_start = events.naut_start;
+		record.naut_end = events.naut_end;
+		record.astr_start = events.astr_start;
+		record.astr_end = events.astr_end;
+		record.dayleng = events.dayleng;
+		record.civlen = events.civlen;
+		record.nautlen = events.nautlen;
+		record.astrlen = events.astrlen;
+		record.rs = events.rs;
+		record.civ = events.civ;
+		record.naut = events.naut;
+		record.astr = events.astr;
+	}
+
+	ofxSolarTableSite site = { lat, lon, tz, 0.0 };
+	sites.push_back( site );
+
+	size_t bytes = records.size() * sizeof(ofxSolarTableRecord);
+	checksum = tableChecksum( checksum, records.data(), bytes );
+	return write( records.data(), bytes );
+}
+
+bool ofxSolarTableWriter::close(){
+	if ( !file )
+		return false;
+
+	size_t bytes = sites.size() * sizeof(ofxSolarTableSite);
+	bool ok = write( sites.data(), bytes );
+
+	header.sites = sites.size();
+	header.sitesOffset = header.recordsOffset + (uint64_t)header.sites * header.days * sizeof(ofxSolarTableRecord);
+	header.checksum = tableChecksum( checksum, sites.data(), bytes );
+	header.headerChecksum = headerChecksum( header );
+
+	ok = ok && fseek( file, 0, SEEK_SET ) == 0 && write( &header, sizeof(header) );
+	ok = fclose( file ) == 0 && ok;
+	file = NULL;
+	if ( !ok )
+		ofLogError("ofxSolarTableWriter") << "couldn't write the table";
+	return ok;
+}
+
+bool ofxSolarTableWriter::write( const void *data, size_t size ){
+	return size == 0 || fwrite( data, 1, size, file ) == size;
+}
+
+
+ofxSolarTableFile::ofxSolarTableFile(){
+	data = NULL;
+	size = 0;
+	header = NULL;
+#ifdef TARGET_WIN32
+	fileHandle = mappingHandle = NULL;
+#endif
+}
+ofxSolarTableFile::~ofxSolarTableFile(){
+	close();
+}
+
+bool ofxSolarTableFile::open( const string &path ){
+	close();
+
+#ifdef TARGET_WIN32
+	HANDLE f = CreateFileA( ofToDataPath(path).c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+	if ( f == INVALID_HANDLE_VALUE ){
+		ofLogError("ofxSolarTableFile") << "couldn't open " << path;
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx( f, &fileSize );
+	HANDLE m = CreateFileMappingA( f, NULL, PAGE_READONLY, 0, 0, NULL );
+	const void *p = m ? MapViewOfFile( m, FILE_MAP_READ, 0, 0, 0 ) : NULL;
+	if ( !p ){
+		if ( m )
+			CloseHandle( m );
+		CloseHandle( f );
+		ofLogError("ofxSolarTableFile") << "couldn't map " << path;
+		return false;
+	}
+	fileHandle = f;
+	mappingHandle = m;
+	size = (size_t)fileSize.QuadPart;
+#else
+	int fd = ::open( ofToDataPath(path).c_str(), O_RDONLY );
+	if ( fd < 0 ){
+		ofLogError("ofxSolarTableFile") << "couldn't open " << path;
+		return false;
+	}
+	struct stat st;
+	void *p = MAP_FAILED;
+	if ( fstat( fd, &st ) == 0 && st.st_size > 0 )
+		p = mmap( NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0 );
+	::close( fd );
+	if ( p == MAP_FAILED ){
+		ofLogError("ofxSolarTableFile") << "couldn't map " << path;
+		return false;
+	}
+	size = st.st_size;
+#endif
+	data = (const unsigned char *)p;
+
+	/* Everything but the data checksum is checked up front */
+	const ofxSolarTableHeader *h = (const ofxSolarTableHeader *)data;
+	const char *error = NULL;
+	if ( size < sizeof(ofxSolarTableHeader) || memcmp( h->magic, tableMagic, sizeof(tableMagic) ) != 0 )
+		error = "not a solar table";
+	else if ( h->byteOrder != 0x01020304 )
+		error = "wrong byte order";
+	else if ( h->version != OFXSOLAR_TABLE_VERSION )
+		error = "unsupported version";
+	else if ( h->headerChecksum != headerChecksum( *h ) )
+		error = "corrupt header";
+	else if ( h->headerSize != sizeof(ofxSolarTableHeader) || h->recordSize != sizeof(ofxSolarTableRecord) ||
+		h->recordsOffset != sizeof(ofxSolarTableHeader) ||
+		h->sitesOffset != h->recordsOffset + (uint64_t)h->sites * h->days * sizeof(ofxSolarTableRecord) ||
+		h->sitesOffset + (uint64_t)h->sites * sizeof(ofxSolarTableSite) != size )
+		error = "inconsistent sizes";
+
+	if ( error ){
+		ofLogError("ofxSolarTableFile") << path << ": " << error;
+		close();
+		return false;
+	}
+
+	header = h;
+	return true;
+}
+
+void ofxSolarTableFile::close(){
+	if ( data ){
+#ifdef TARGET_WIN32
+		UnmapViewOfFile( data );
+		CloseHandle( mappingHandle );
+		CloseHandle( fileHandle );
+		fileHandle = mappingHandle = NULL;
+#else
+		munmap( (void *)data, size );
+#endif
+	}
+	data = NULL;
+	size = 0;
+	header = NULL;
+}
+
+bool ofxSolarTableFile::isOpen() const{
+	return header != NULL;
+}
+
+bool ofxSolarTableFile::verify() const{
+	if ( !header )
+		return false;
+	return tableChecksum( tableChecksumSeed, data + header->recordsOffset,
+		size - header->recordsOffset ) == header->checksum;
+}
+
+size_t ofxSolarTableFile::getNumSites() const{
+	return header ? header->sites : 0;
+}
+
+int ofxSolarTableFile::getNumDays() const{
+	return header ? header->days : 0;
+}
+
+const ofxSolarTableSite * ofxSolarTableFile::getSite( size_t site ) const{
+	if ( !header || site >= header->sites )
+		return NULL;
+	return (const ofxSolarTableSite *)( data + header->sitesOffset ) + site;
+}
+
+const ofxSolarTableRecord * ofxSolarTableFile::get( size_t site, int year, int month, int day ) const{
+	return get( site, days_since_2000_Jan_0(year,month,day) );
+}
+
+const ofxSolarTableRecord * ofxSolarTableFile::get( size_t site, long daynum ) const{
+	if ( !header || site >= header->sites )
+		return NULL;
+	long i = daynum - header->firstDay;
+	if ( i < 0 || i >= (long)header->days )
+		return NULL;
+	return (const ofxSolarTableRecord *)( data + header->recordsOffset ) + site * header->days + i;
+}
@@ -0,0 +1,119 @@
+/*
+
+ofxSolarTableFile - binary file of precomputed rise/set and twilight times
+
+Layout, offsets in bytes, all values in the byte order of the host that
+wrote the file; byteOrder tells them apart and open() refuses files of
+the other order:
+
+	0       ofxSolarTableHeader, 128 bytes
+	128     ofxSolarTableRecord[sites][days], 64 bytes each
+	...     ofxSolarTableSite[sites], 32 bytes each
+
+Every record has the same size and records of a site are consecutive, so
+the record of (site, day) is at recordsOffset + (site*days + day)*64.
+ofxSolarTableWriter streams the records out one site at a time and writes
+the site table and the final header on close(). ofxSolarTableFile maps the
+file into memory and returns pointers into it, queries don't parse or
+allocate anything.
+
+The header carries a version, the record and header sizes, a checksum of
+itself and one of the records and site table. open() checks everything
+but the data checksum, which verify() checks on request.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+/* Version 2 numbers the days before 1900 March 1 one lower than 1 did */
+#define OFXSOLAR_TABLE_VERSION 2
+
+struct ofxSolarTableHeader{
+	char     magic[8];         /* "ofxSolar" */
+	uint32_t version;          /* OFXSOLAR_TABLE_VERSION */
+	uint32_t byteOrder;        /* 0x01020304 as written by the producer */
+	uint32_t headerSize;       /* sizeof(ofxSolarTableHeader) */
+	uint32_t recordSize;       /* sizeof(ofxSolarTableRecord) */
+	uint32_t sites, days;
+	int32_t  firstDay;         /* days_since_2000_Jan_0 of the first day */
+	uint32_t reserved0;
+	uint64_t recordsOffset, sitesOffset;
+	uint64_t checksum;         /* Of the records and the site table */
+	uint64_t headerChecksum;   /* Of the header up to this field */
+	uint8_t  reserved[56];
+};
+
+struct ofxSolarTableRecord{
+	float  rise, set, civ_start, civ_end, naut_start, naut_end,
+		astr_start, astr_end;                     /* Hours, local time */
+	float  dayleng, civlen, nautlen, astrlen;     /* Hours */
+	int8_t rs, civ, naut, astr;                   /* Return codes of sunriset() */
+	uint8_t reserved[12];
+};
+
+struct ofxSolarTableSite{
+	double lat, lon, tz;
+	double reserved;
+};
+
+class ofxSolarTableWriter{
+
+public:
+
+	ofxSolarTableWriter();
+	~ofxSolarTableWriter();
+	ofxSolarTableWriter( const ofxSolarTableWriter & ) = delete;
+	ofxSolarTableWriter & operator=( const ofxSolarTableWriter & ) = delete;
+
+	bool open( const string &path, int year, int month, int day, int days );
+	bool addSite( double lat, double lon, double tz );
+	bool close();
+
+private:
+
+	bool write( const void *data, size_t size );
+
+	FILE *file;
+	ofxSolarTableHeader header;
+	vector<ofxSolarTableSite> sites;
+	vector<ofxSolarTableRecord> records;   /* One site, reused */
+	uint64_t checksum;
+
+};
+
+class ofxSolarTableFile{
+
+public:
+
+	ofxSolarTableFile();
+	~ofxSolarTableFile();
+	ofxSolarTableFile( const ofxSolarTableFile & ) = delete;
+	ofxSolarTableFile & operator=( const ofxSolarTableFile & ) = delete;
+
+	bool open( const string &path );
+	void close();
+	bool isOpen() const;
+
+	/* Checks the data checksum, reads the whole file */
+	bool verify() const;
+
+	size_t getNumSites() const;
+	int getNumDays() const;
+	const ofxSolarTableSite * getSite( size_t site ) const;
+
+	/* NULL when the site or date is not in the file */
+	const ofxSolarTableRecord * get( size_t site, int year, int month, int day ) const;
+	const ofxSolarTableRecord * get( size_t site, long daynum ) const;
+
+private:
+
+	const unsigned char *data;
+	size_t size;
+	const ofxSolarTableHeader *header;
+#ifdef TARGET_WIN32
+	void *fileHandle, *mappingHandle;
+#endif
+
+};
@@ -0,0 +1,469 @@
+#include "ofxSolarTimeZone.h"
+
+/* Zones parsed so far, by name */
+
+static mutex zonesGuard;
+static map<string, shared_ptr<const ofxSolarTimeZone> > zones;
+static string zoneDirectory;
+
+/* The table holds the footer rule's transitions up to the end of this year */
+
+static const int ruleTableEnd = 2100;
+
+static inline uint32_t readBe32( const unsigned char *p ){
+	return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | (uint32_t)p[3];
+}
+
+static inline int64_t readBe64( const unsigned char *p ){
+	return (int64_t)( (uint64_t)readBe32( p ) << 32 | readBe32( p + 4 ) );
+}
+
+static inline int64_t floorDiv( int64_t a, int64_t b ){
+	return a / b - ( a % b != 0 && ( a < 0 ) != ( b < 0 ) );
+}
+
+static inline bool isLeapYear( int year ){
+	return ( year % 4 == 0 && year % 100 != 0 ) || year % 400 == 0;
+}
+
+static inline int daysInMonth( int year, int month ){
+	static const int days[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	return month == 2 && isLeapYear( year ) ? 29 : days[month - 1];
+}
+
+
+ofxSolarTimeZone::ofxSolarTimeZone(){
+	initial = 0;
+	hasRule = false;
+	hint = 0;
+	memset( &rule, 0, sizeof(rule) );
+}
+
+shared_ptr<const ofxSolarTimeZone> ofxSolarTimeZone::get( const string &name ){
+	lock_guard<mutex> lock( zonesGuard );
+	auto found = zones.find( name );
+	if ( found != zones.end() )
+		return found->second;
+
+	string directory = zoneDirectory;
+	if ( directory.empty() ){
+		const char *env = getenv( "TZDIR" );
+		directory = env && *env ? env : "/usr/share/zoneinfo";
+	}
+	string path = name.empty() || name == "localtime" ? "/etc/localtime" : directory + "/" + name;
+
+	shared_ptr<const ofxSolarTimeZone> zone;
+	FILE *file = fopen( path.c_str(), "rb" );
+	if ( file ){
+		vector<unsigned char> data;
+		unsigned char chunk[16384];
+		size_t n;
+		while ( ( n = fread( chunk, 1, sizeof(chunk), file ) ) > 0 )
+			data.insert( data.end(), chunk, chunk + n );
+		fclose( file );
+		zone = parse( name, data.data(), data.size() );
+	}
+
+	if ( !zone ){
+		/* Not a file, maybe a POSIX TZ rule */
+		shared_ptr<ofxSolarTimeZone> ruleZone( new ofxSolarTimeZone );
+		ruleZone->name = name;
+		if ( !name.empty() && ruleZone->parseRule( name ) ){
+			ruleZone->initial = ruleZone->rule.standard;
+			ruleZone->expandRule( 1970, ruleTableEnd );
+			zone = ruleZone;
+		}
+	}
+
+	if ( !zone ){
+		ofLogError("ofxSolarTimeZone") << "no time zone " << ( name.empty() ? "localtime" : name );
+		return zone;
+	}
+	zones[name] = zone;
+	return zone;
+}
+
+shared_ptr<const ofxSolarTimeZone> ofxSolarTimeZone::fixed( double hours ){
+	shared_ptr<ofxSolarTimeZone> zone( new ofxSolarTimeZone );
+	int32_t offset = (int32_t)floor( hours * 3600.0 + 0.5 );
+	int32_t a = abs( offset );
+	char name[32];
+	snprintf( name, sizeof(name), "UTC%c%02d:%02d", offset < 0 ? '-' : '+', a / 3600, a / 60 % 60 );
+	zone->name = name;
+	zone->addType( offset, false, name );
+	return zone;
+}
+
+shared_ptr<const ofxSolarTimeZone> ofxSolarTimeZone::parse( const string &name, const void *data, size_t size ){
+	shared_ptr<ofxSolarTimeZone> zone( new ofxSolarTimeZone );
+	zone->name = name;
+	if ( !zone->parseData( (const unsigned char *)data, size ) ){
+		ofLogError("ofxSolarTimeZone") << name << " is not a valid TZif file";
+		return shared_ptr<const ofxSolarTimeZone>();
+	}
+	return zone;
+}
+
+void ofxSolarTimeZone::setDirectory( const string &directory ){
+	lock_guard<mutex> lock( zonesGuard );
+	zoneDirectory = directory;
+}
+
+const string & ofxSolarTimeZone::getName() const{
+	return name;
+}
+
+
+/* TZif */
+
+bool ofxSolarTimeZone::parseData( const unsigned char *data, size_t size ){
+	const size_t headerSize = 44;
+	if ( size < headerSize || memcmp( data, "TZif", 4 ) != 0 )
+		return false;
+
+	int version = data[4] == 0 ? 1 : data[4] - '0';
+	const unsigned char *p = data, *end = data + size;
+	int timeSize = 4;
+
+	for ( int pass = 0; ; pass++ ){
+		if ( end - p < (ptrdiff_t)headerSize || memcmp( p, "TZif", 4 ) != 0 )
+			return false;
+		uint32_t isutcnt = readBe32( p + 20 ), isstdcnt = readBe32( p + 24 ), leapcnt = readBe32( p + 28 ),
+			timecnt = readBe32( p + 32 ), typecnt = readBe32( p + 36 ), charcnt = readBe32( p + 40 );
+		uint64_t body = (uint64_t)timecnt * ( timeSize + 1 ) + (uint64_t)typecnt * 6 + charcnt +
+			(uint64_t)leapcnt * ( timeSize + 4 ) + isstdcnt + isutcnt;
+		p += headerSize;
+		if ( (uint64_t)( end - p ) < body )
+			return false;
+
+		/* Version 1 files only have the 32 bit block, later ones skip it */
+		if ( pass == 0 && version >= 2 ){
+			p += body;
+			timeSize = 8;
+			continue;
+		}
+
+		if ( typecnt == 0 || typecnt > 255 )
+			return false;
+		const unsigned char *indices = p + (size_t)timecnt * timeSize;
+		const unsigned char *info = indices + timecnt;
+		const unsigned char *chars = info + (size_t)typecnt * 6;
+
+		for ( uint32_t i = 0; i < typecnt; i++ ){
+			const unsigned char *t = info + i * 6;
+			if ( t[5] >= charcnt )
+				return false;
+			Type type;
+			type.offset = (int32_t)readBe32( t );
+			type.dst = t[4] != 0;
+			type.abbreviation = string( (const char *)chars + t[5], strnlen( (const char *)chars + t[5], charcnt - t[5] ) );
+			types.push_back( type );
+		}
+		for ( uint32_t i = 0; i < timecnt; i++ ){
+			int64_t time = timeSize == 8 ? readBe64( p + i * 8 ) : (int64_t)(int32_t)readBe32( p + i * 4 );
+			if ( indices[i] >= typecnt || ( !times.empty() && time <= times.back() ) )
+				return false;
+			times.push_back( time );
+			typeIndex.push_back( indices[i] );
+		}
+		p += body;
+		break;
+	}
+
+	/* Footer: newline, TZ rule, newline */
+	if ( version >= 2 && p < end && *p == '\n' ){
+		const unsigned char *close = (const unsigned char *)memchr( p + 1, '\n', end - p - 1 );
+		if ( close && close > p + 1 && parseRule( string( (const char *)p + 1, close - p - 1 ) ) ){
+			int64_t last = times.empty() ? 0 : times.back();
+			int year, month, day;
+			civilFromDays( floorDiv( last, 86400 ), &year, &month, &day );
+			expandRule( max( year, 1970 ), ruleTableEnd );
+		}
+	}
+	return true;
+}
+
+uint8_t ofxSolarTimeZone::addType( int32_t offset, bool dst, const string &abbreviation ){
+	for ( size_t i = 0; i < types.size(); i++ )
+		if ( types[i].offset == offset && types[i].dst == dst && types[i].abbreviation == abbreviation )
+			return (uint8_t)i;
+	if ( types.size() >= 256 )
+		return 0;
+	Type type = { offset, dst, abbreviation };
+	types.push_back( type );
+	return (uint8_t)( types.size() - 1 );
+}
+
+
+/* POSIX TZ rules, e.g. "CET-1CEST,M3.5.0,M10.5.0/3" or "<+0545>-5:45" */
+
+static bool parseRuleName( const char *&p, string *name ){
+	const char *begin = p;
+	if ( *p == '<' ){
+		while ( *p && *p != '>' )
+			p++;
+		if ( *p != '>' )
+			return false;
+		*name = string( begin + 1, p++ );
+		return true;
+	}
+	while ( isalpha( (unsigned char)*p ) )
+		p++;
+	*name = string( begin, p );
+	return p - begin >= 3;
+}
+
+/* [+-]hh[:mm[:ss]] in seconds */
+
+static bool parseRuleTime( const char *&p, int32_t *seconds ){
+	int sign = 1;
+	if ( *p == '+' || *p == '-' )
+		sign = *p++ == '-' ? -1 : 1;
+	if ( !isdigit( (unsigned char)*p ) )
+		return false;
+	int32_t value = 0, part = 0;
+	for ( int field = 0; field < 3; field++ ){
+		part = 0;
+		while ( isdigit( (unsigned char)*p ) )
+			part = part * 10 + ( *p++ - '0' );
+		value += part * ( field == 0 ? 3600 : field == 1 ? 60 : 1 );
+		if ( *p != ':' || field == 2 )
+			break;
+		p++;
+	}
+	*seconds = sign * value;
+	return value <= 167 * 3600;
+}
+
+bool ofxSolarTimeZone::parseRule( const string &text ){
+	const char *p = text.c_str();
+	string stdName, dstName;
+	int32_t stdOffset, dstOffset;
+
+	/* POSIX offsets are west of Greenwich */
+	if ( !parseRuleName( p, &stdName ) || !parseRuleTime( p, &stdOffset ) )
+		return false;
+	stdOffset = -stdOffset;
+	rule.standard = addType( stdOffset, false, stdName );
+	rule.hasDst = false;
+
+	if ( *p && *p != ',' ){
+		if ( !parseRuleName( p, &dstName ) )
+			return false;
+		dstOffset = stdOffset + 3600;
+		if ( *p && *p != ',' ){
+			if ( !parseRuleTime( p, &dstOffset ) )
+				return false;
+			dstOffset = -dstOffset;
+		}
+		rule.daylight = addType( dstOffset, true, dstName );
+		rule.hasDst = true;
+
+		/* The US rules when the dates are left out */
+		if ( !*p )
+			p = ",M3.2.0,M11.1.0";
+
+		Rule::Date *dates[2] = { &rule.start, &rule.end };
+		for ( int i = 0; i < 2; i++ ){
+			Rule::Date &date = *dates[i];
+			if ( *p++ != ',' )
+				return false;
+			if ( *p == 'M' ){
+				date.kind = Rule::MONTH_WEEK_DAY;
+				char *next;
+				date.month = (int)strtol( p + 1, &next, 10 );
+				if ( *next != '.' )
+					return false;
+				date.week = (int)strtol( next + 1, &next, 10 );
+				if ( *next != '.' )
+					return false;
+				date.day = (int)strtol( next + 1, &next, 10 );
+				p = next;
+				if ( date.month < 1 || date.month > 12 || date.week < 1 || date.week > 5 || date.day < 0 || date.day > 6 )
+					return false;
+			}else{
+				date.kind = *p == 'J' ? Rule::JULIAN_NO_LEAP : Rule::JULIAN;
+				if ( *p == 'J' )
+					p++;
+				char *next;
+				date.day = (int)strtol( p, &next, 10 );
+				if ( next == p || date.day < 0 || date.day > 365 )
+					return false;
+				p = next;
+			}
+			date.time = 2 * 3600;
+			if ( *p == '/' && !parseRuleTime( ++p, &date.time ) )
+				return false;
+		}
+	}
+	hasRule = true;
+	return *p == 0;
+}
+
+/* UT instant of a rule date in a year, time is local at offset */
+
+int64_t ofxSolarTimeZone::ruleTransition( const Rule::Date &date, int year, int32_t offset ) const{
+	int64_t days = daysFromCivil( year, 1, 1 );
+	switch ( date.kind ){
+	case Rule::JULIAN_NO_LEAP:
+		days += date.day - 1 + ( isLeapYear( year ) && date.day >= 60 );
+		break;
+	case Rule::JULIAN:
+		days += date.day;
+		break;
+	case Rule::MONTH_WEEK_DAY:{
+		/* 1970-01-01 was a Thursday */
+		int64_t first = daysFromCivil( year, date.month, 1 );
+		int weekday = (int)( ( first % 7 + 11 ) % 7 );
+		int day = 1 + ( date.day - weekday + 7 ) % 7 + 7 * ( date.week - 1 );
+		while ( day > daysInMonth( year, date.month ) )
+			day -= 7;
+		days = first + day - 1;
+		break;
+	}
+	}
+	return days * 86400 + date.time - offset;
+}
+
+void ofxSolarTimeZone::expandRule( int fromYear, int toYear ){
+	if ( !hasRule || !rule.hasDst )
+		return;
+	int32_t stdOffset = types[rule.standard].offset, dstOffset = types[rule.daylight].offset;
+	for ( int year = fromYear; year <= toYear; year++ ){
+		int64_t start = ruleTransition( rule.start, year, stdOffset );
+		int64_t end = ruleTransition( rule.end, year, dstOffset );
+		int64_t first = min( start, end ), second = max( start, end );
+		uint8_t firstType = start < end ? rule.daylight : rule.standard;
+		uint8_t secondType = start < end ? rule.standard : rule.daylight;
+		if ( times.empty() || first > times.back() ){
+			times.push_back( first );
+			typeIndex.push_back( firstType );
+		}
+		if ( times.empty() || second > times.back() ){
+			times.push_back( second );
+			typeIndex.push_back( secondType );
+		}
+	}
+}
+
+
+/* Lookups */
+
+const ofxSolarTimeZone::Type & ofxSolarTimeZone::typeAt( int64_t utc ) const{
+	size_t n = times.size();
+	if ( n == 0 || utc < times[0] )
+		return types[initial];
+
+	/* Past the table the rule is evaluated for the year */
+	if ( utc >= times[n-1] && hasRule && rule.hasDst ){
+		int year, month, day;
+		civilFromDays( floorDiv( utc, 86400 ), &year, &month, &day );
+		int64_t start = ruleTransition( rule.start, year, types[rule.standard].offset );
+		int64_t end = ruleTransition( rule.end, year, types[rule.daylight].offset );
+		bool dst = start < end ? utc >= start && utc < end : !( utc >= end && utc < start );
+		if ( year > ruleTableEnd )
+			return types[ dst ? rule.daylight : rule.standard ];
+	}
+
+	size_t i = hint.load( memory_order_relaxed );
+	if ( !( i < n && times[i] <= utc && ( i + 1 == n || utc < times[i+1] ) ) ){
+		i = upper_bound( times.begin(), times.end(), utc ) - times.begin() - 1;
+		hint.store( i, memory_order_relaxed );
+	}
+	return types[ typeIndex[i] ];
+}
+
+double ofxSolarTimeZone::getOffset( int64_t utc ) const{
+	return typeAt( utc ).offset / 3600.0;
+}
+
+int32_t ofxSolarTimeZone::getOffsetSeconds( int64_t utc ) const{
+	return typeAt( utc ).offset;
+}
+
+bool ofxSolarTimeZone::isDaylightSaving( int64_t utc ) const{
+	return typeAt( utc ).dst;
+}
+
+string ofxSolarTimeZone::getAbbreviation( int64_t utc ) const{
+	return typeAt( utc ).abbreviation;
+}
+
+void ofxSolarTimeZone::getDate( int64_t utc, int *year, int *month, int *day ) const{
+	civilFromDays( floorDiv( utc + getOffsetSeconds( utc ), 86400 ), year, month, day );
+}
+
+int64_t ofxSolarTimeZone::getMidnight( int year, int month, int day ) const{
+	int64_t local = daysFromCivil( year, month, day ) * 86400;
+
+	/* The offsets of the day before and after, midnight exists in one of them */
+	int32_t before = getOffsetSeconds( local - 86400 ), after = getOffsetSeconds( local + 86400 );
+	int64_t best = INT64_MAX;
+	if ( getOffsetSeconds( local - before ) == before )
+		best = local - before;
+	if ( getOffsetSeconds( local - after ) == after )
+		best = min( best, local - after );
+	if ( best != INT64_MAX )
+		return best;
+
+	/* Skipped by a jump forward, the day starts with the jump */
+	auto jump = upper_bound( times.begin(), times.end(), local - max( before, after ) );
+	return jump != times.end() ? *jump : local - after;
+}
+
+void ofxSolarTimeZone::localize( ofxSolarDay *events ) const{
+	double *hours[8] = { &events->rise, &events->set, &events->civ_start, &events->civ_end,
+		&events->naut_start, &events->naut_end, &events->astr_start, &events->astr_end };
+	int64_t base = daysFromCivil( events->year, events->month, events->day ) * 86400;
+	for ( int i = 0; i < 8; i++ )
+		if ( *hours[i] == *hours[i] )
+			*hours[i] += getOffsetSeconds( base + (int64_t)floor( *hours[i] * 3600.0 ) ) / 3600.0;
+}
+
+void ofxSolarTimeZone::localize( int year, int month, int day, double *hours, size_t count ) const{
+	int64_t base = daysFromCivil( year, month, day ) * 86400;
+	for ( size_t i = 0; i < count; i++ )
+		if ( hours[i] == hours[i] )
+			hours[i] += getOffsetSeconds( base + (int64_t)floor( hours[i] * 3600.0 ) ) / 3600.0;
+}
+
+ofxSolarDay ofxSolarTimeZone::dayEvents( int year, int month, int day, double lat, double lon,
+	ofxSolarPrecision precision ) const{
+	ofxSolarDay events = ofxSolar::dayEvents( year, month, day, lat, lon, 0.0, precision );
+	localize( &events );
+	return events;
+}
+
+vector<ofxSolarDay> ofxSolarTimeZone::calendar( int startYear, int startMonth, int startDay,
+	int endYear, int endMonth, int endDay, double lat, double lon, int threads,
+	ofxSolarPrecision precision ) const{
+	vector<ofxSolarDay> days = ofxSolar::calendar( startYear, startMonth, startDay,
+		endYear, endMonth, endDay, lat, lon, 0.0, threads, precision );
+	for ( size_t i = 0; i < days.size(); i++ )
+		localize( &days[i] );
+	return days;
+}
+
+
+/* Howard Hinnant's days_from_civil() and civil_from_days() */
+
+int64_t ofxSolarTimeZone::daysFromCivil( int year, int month, int day ){
+	int64_t y = year - ( month <= 2 );
+	int64_t era = floorDiv( y, 400 );
+	int64_t yoe = y - era * 400;
+	int64_t doy = ( 153 * ( month + ( month > 2 ? -3 : 9 ) ) + 2 ) / 5 + day - 1;
+	int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return era * 146097 + doe - 719468;
+}
+
+void ofxSolarTimeZone::civilFromDays( int64_t days, int *year, int *month, int *day ){
+	days += 719468;
+	int64_t era = floorDiv( days, 146097 );
+	int64_t doe = days - era * 146097;
+	int64_t yoe = ( doe - doe / 1460 + doe / 36524 - doe / 146096 ) / 365;
+	int64_t doy = doe - ( 365 * yoe + yoe / 4 - yoe / 100 );
+	int64_t mp = ( 5 * doy + 2 ) / 153;
+	*day = (int)( doy - ( 153 * mp + 2 ) / 5 + 1 );
+	*month = (int)( mp < 10 ? mp + 3 : mp - 9 );
+	*year = (int)( yoe + era * 400 + ( *month <= 2 ) );
+}
@@ -0,0 +1,125 @@
+/*
+
+ofxSolarTimeZone - UTC offsets and daylight saving of a time zone from the
+system's tz database
+
+get() reads a TZif file (RFC 8536, versions 1 to 4) from the zoneinfo
+directory once, keeps its transitions as a sorted table of instants with
+the index of the offset that starts there, and hands out the same shared
+instance to every later caller. The POSIX TZ rule at the end of version 2+
+files, which newer "slim" files rely on for everything after the last
+listed transition, is expanded into the table up to 2100 and evaluated
+directly after that. A bare rule such as "CET-1CEST,M3.5.0,M10.5.0/3"
+works as a name too.
+
+A lookup is a binary search over the table, or nothing when the instant
+falls into the same interval as the previous lookup on that zone. There
+is no localtime() or TZ environment variable involved, zones are
+independent of the machine's zone and of each other, and offsets are in
+seconds, so 5:30, 5:45 and 12:45 zones are exact.
+
+Event times: localize() takes a day computed with tz 0 and adds to every
+event the offset in force at that event's own instant, so a sunrise after
+a 2am switch already has the new offset. dayEvents() and calendar() do
+the same for one day or a range, ofxSolar::setTimeZone() for an instance
+and ofxSolarBatch::setTimeZones() for the sites of a batch.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+class ofxSolarTimeZone{
+
+public:
+
+	/* "Europe/Berlin", "Asia/Kathmandu"..., "localtime" or "" for the      */
+	/* machine's zone, or a POSIX TZ rule. Parsed on the first call, shared */
+	/* afterwards, NULL if there is no such zone                            */
+	static shared_ptr<const ofxSolarTimeZone> get( const string &name );
+
+	/* A zone that is hours from UT all year, e.g. TZ_IST */
+	static shared_ptr<const ofxSolarTimeZone> fixed( double hours );
+
+	/* From the contents of a TZif file */
+	static shared_ptr<const ofxSolarTimeZone> parse( const string &name, const void *data, size_t size );
+
+	/* Default $TZDIR, else /usr/share/zoneinfo */
+	static void setDirectory( const string &directory );
+
+	const string & getName() const;
+
+	/* Instants are seconds since 1970 UT (time_t), offsets hours or */
+	/* seconds to add to UT                                          */
+	double getOffset( int64_t utc ) const;
+	int32_t getOffsetSeconds( int64_t utc ) const;
+	bool isDaylightSaving( int64_t utc ) const;
+	string getAbbreviation( int64_t utc ) const;
+
+	/* Local date of an instant */
+	void getDate( int64_t utc, int *year, int *month, int *day ) const;
+
+	/* First instant of a local date, later than midnight if the clocks */
+	/* jump over midnight that day                                      */
+	int64_t getMidnight( int year, int month, int day ) const;
+
+	/* events computed for the date with tz 0, turned into local times */
+	void localize( ofxSolarDay *events ) const;
+
+	/* Hours UT after 0h UT of the date, turned into local hours in place, */
+	/* NaN stays NaN                                                       */
+	void localize( int year, int month, int day, double *hours, size_t count ) const;
+
+	ofxSolarDay dayEvents( int year, int month, int day, double lat, double lon,
+		ofxSolarPrecision precision = OFXSOLAR_PRECISION_DEFAULT ) const;
+
+	vector<ofxSolarDay> calendar( int startYear, int startMonth, int startDay,
+		int endYear, int endMonth, int endDay, double lat, double lon, int threads = 0,
+		ofxSolarPrecision precision = OFXSOLAR_PRECISION_DEFAULT ) const;
+
+	/* Days since 1970-01-01 of a date of the proleptic Gregorian calendar */
+	static int64_t daysFromCivil( int year, int month, int day );
+	static void civilFromDays( int64_t days, int *year, int *month, int *day );
+
+private:
+
+	ofxSolarTimeZone();
+
+	struct Type{
+		int32_t offset;      /* Seconds */
+		bool dst;
+		string abbreviation;
+	};
+
+	/* The POSIX TZ rule of the footer */
+	struct Rule{
+		enum Kind{ JULIAN_NO_LEAP, JULIAN, MONTH_WEEK_DAY };
+		struct Date{
+			Kind kind;
+			int day, week, month;    /* day: Jn/n day number or weekday */
+			int32_t time;            /* Seconds after local midnight, may be negative or past 24h */
+		};
+		uint8_t standard, daylight;  /* Types */
+		bool hasDst;
+		Date start, end;
+	};
+
+	bool parseData( const unsigned char *data, size_t size );
+	bool parseRule( const string &text );
+	uint8_t addType( int32_t offset, bool dst, const string &abbreviation );
+	void expandRule( int fromYear, int toYear );
+	int64_t ruleTransition( const Rule::Date &date, int year, int32_t offset ) const;
+	const Type & typeAt( int64_t utc ) const;
+
+	string name;
+	vector<int64_t> times;       /* Transitions, UT, ascending */
+	vector<uint8_t> typeIndex;   /* Type from times[i] on */
+	vector<Type> types;
+	uint8_t initial;             /* Type before the first transition */
+	Rule rule;
+	bool hasRule;
+
+	mutable atomic<size_t> hint; /* Interval of the last lookup */
+
+};
@@ -0,0 +1,96 @@
+#include "ofxSolarTracker.h"
+
+/* Cosine and sine of a small angle in radians, series below 0.1 */
+
+static void turn( double angle, double *c, double *s ){
+	if ( fabs(angle) < 0.1 ){
+		double z = angle * angle;
+		*c = 1.0 - z * ( 0.5 - z * ( 1.0/24.0 - z * ( 1.0/720.0 ) ) );
+		*s = angle * ( 1.0 - z * ( 1.0/6.0 - z * ( 1.0/120.0 - z * ( 1.0/5040.0 ) ) ) );
+	}else{
+		*c = cos(angle);
+		*s = sin(angle);
+	}
+}
+
+ofxSolarTracker::ofxSolarTracker(){
+	setup( 0.0, 0.0 );
+}
+
+void ofxSolarTracker::setup( double lat, double lon ){
+	this->lat = lat;
+	this->lon = lon;
+	sin_lat = sind(lat);
+	cos_lat = cosd(lat);
+	setTime( 0.0 );
+}
+
+void ofxSolarTracker::setTime( int year, int month, int day, double hoursUT ){
+	setTime( days_since_2000_Jan_0(year,month,day) + hoursUT/24.0 );
+}
+
+void ofxSolarTracker::setTime( double d ){
+	double sr, sRA, sRA1, sdec, sdec1, sidtime, ha;
+
+	this->d = d;
+	anchor = d;
+
+	/* Same as ofxSolar::sunPosition(), GMST = GMST0 + UT */
+	sidtime = ofxSolar::GMST0(d) + ( d - floor(d) ) * 360.0 + lon;
+	ofxSolar::sun_RA_dec( d, &sRA, &sdec, &sr );
+	ha = ofxSolar::rev180( sidtime - sRA );
+	sin_sdec = sind(sdec);
+	cos_sdec = cosd(sdec);
+	sin_ha = sind(ha);
+	cos_ha = cosd(ha);
+
+	/* Sidereal rate minus the Sun's own motion in RA over the next hour, */
+	/* and the declination's motion over the same hour                    */
+	ofxSolar::sun_RA_dec( d + 1.0/24.0, &sRA1, &sdec1, &sr );
+	rate = 15.0 * ( 1.0 + ( 0.9856002585 + 4.70935E-5 ) / 360.0 ) - ofxSolar::rev180( sRA1 - sRA );
+	decRate = sdec1 - sdec;
+}
+
+void ofxSolarTracker::advance( double hours ){
+	double t = d + hours/24.0;
+
+	if ( fabs( t - anchor ) > 1.0/24.0 ){
+		setTime( t );
+		return;
+	}
+	d = t;
+
+	/* Turn the hour angle and the declination the same way */
+	double c, s;
+	turn( hours * rate * DEGRAD, &c, &s );
+	double sh = sin_ha * c + cos_ha * s;
+	cos_ha = cos_ha * c - sin_ha * s;
+	sin_ha = sh;
+
+	turn( hours * decRate * DEGRAD, &c, &s );
+	double sd = sin_sdec * c + cos_sdec * s;
+	cos_sdec = cos_sdec * c - sin_sdec * s;
+	sin_sdec = sd;
+}
+
+double ofxSolarTracker::getTime() const{
+	return d;
+}
+
+void ofxSolarTracker::getDirection( double *east, double *north, double *up ) const{
+	*east  = -cos_sdec * sin_ha;
+	*north = cos_lat * sin_sdec - sin_lat * cos_sdec * cos_ha;
+	*up    = sin_lat * sin_sdec + cos_lat * cos_sdec * cos_ha;
+}
+
+ofxSolarPosition ofxSolarTracker::getPosition() const{
+	ofxSolarPosition pos;
+	double east, north, up;
+
+	getDirection( &east, &north, &up );
+	/* The rotated hour angle drifts, up can leave [-1, 1] at the zenith and the nadir */
+	pos.elevation = asind( up < -1.0 ? -1.0 : ( up > 1.0 ? 1.0 : up ) );
+	pos.azimuth = ofxSolar::revolution( atan2d( east, north ) );
+	pos.hourAngle = atan2d( sin_ha, cos_ha );
+	return pos;
+}
@@ -0,0 +1,1330 @@
+#include "ofxSolarVerify.h"
+#include "ofxSolarArena.h"
+#include "ofxSolarBatch.h"
+#include "ofxSolarCache.h"
+#include "ofxSolarConstexpr.h"
+#include "ofxSolarGrid.h"
+#include "ofxSolarRaster.h"
+#include "ofxSolarScheduler.h"
+#include "ofxSolarServer.h"
+#include "ofxSolarTableFile.h"
+#include "ofxSolarTimeZone.h"
+#include "ofxSolarTracker.h"
+
+/* Layout of ofxSolarReference.inl */
+
+struct ofxSolarReferenceSite{
+	const char *name;
+	double lat, lon;
+};
+
+struct ofxSolarReferenceDate{
+	int year, month, day;
+};
+
+struct ofxSolarReferenceRow{
+	int site, date;
+	int code[4];        /* Rise/set, civil, nautical, astronomical: 0, +1, -1 as sunriset(), 2 skipped */
+	int t[8];           /* Rise, set, civ_start... seconds UT from 0h of the date */
+};
+
+#include "ofxSolarReference.inl"
+
+static const int REFERENCE_SKIPPED = 2;
+
+static const size_t referenceSiteCount = sizeof(referenceSites) / sizeof(referenceSites[0]);
+static const size_t referenceDateCount = sizeof(referenceDates) / sizeof(referenceDates[0]);
+static const size_t referenceRowCount = sizeof(referenceRows) / sizeof(referenceRows[0]);
+
+static const char * const eventNames[8] = { "rise", "set", "civ_start", "civ_end",
+	"naut_start", "naut_end", "astr_start", "astr_end" };
+
+/* Where a value was compared, for the report */
+
+struct Sample{
+	uint64_t index;         /* Draw order, ties of the maximum go to the first */
+	int year, month, day;
+	double lat, lon, tz;
+	const char *what;
+};
+
+/* The running maximum and failures of one result */
+
+struct Check{
+	string name, unit;
+	double budget;
+	uint64_t samples, failures;
+	double maxError;
+	bool hasWorst, hasMismatch;
+	Sample worst, mismatch;
+
+	Check( const string &name, const string &unit, double budget ) : name( name ), unit( unit ), budget( budget ){
+		samples = failures = 0;
+		maxError = 0.0;
+		hasWorst = hasMismatch = false;
+	}
+
+	void add( double error, const Sample &sample ){
+		samples++;
+		error = error == error ? fabs( error ) : INFINITY;     /* NaN is the worst */
+		if ( error > budget )
+			failures++;
+		if ( !hasWorst || error > maxError || ( error == maxError && sample.index < worst.index ) ){
+			maxError = error;
+			worst = sample;
+			hasWorst = true;
+		}
+	}
+
+	/* Return codes, or anything else that has to be equal */
+	void match( bool equal, const Sample &sample ){
+		samples++;
+		if ( equal )
+			return;
+		failures++;
+		if ( !hasMismatch || sample.index < mismatch.index ){
+			mismatch = sample;
+			hasMismatch = true;
+		}
+	}
+
+	void merge( const Check &other ){
+		samples += other.samples;
+		failures += other.failures;
+		if ( other.hasWorst && ( !hasWorst || other.maxError > maxError ||
+			( other.maxError == maxError && other.worst.index < worst.index ) ) ){
+			maxError = other.maxError;
+			worst = other.worst;
+			hasWorst = true;
+		}
+		if ( other.hasMismatch && ( !hasMismatch || other.mismatch.index < mismatch.index ) ){
+			mismatch = other.mismatch;
+			hasMismatch = true;
+		}
+	}
+
+	ofxSolarVerifyResult result() const{
+		ofxSolarVerifyResult r;
+		r.name = name;
+		r.unit = unit;
+		r.samples = samples;
+		r.failures = failures;
+		r.maxError = maxError;
+		r.budget = budget;
+
+		/* A differing code explains a failure better than the largest error within budget */
+		const Sample *s = hasMismatch && !( maxError > budget ) ? &mismatch : hasWorst ? &worst : NULL;
+		if ( s ){
+			char text[160];
+			snprintf( text, sizeof(text), "%04d-%02d-%02d lat %+.4f lon %+.4f tz %+.2f %s%s",
+				s->year, s->month, s->day, s->lat, s->lon, s->tz, s->what,
+				s == &mismatch ? ", codes differ" : "" );
+			r.worst = text;
+		}
+		return r;
+	}
+};
+
+static Sample sample( uint64_t index, int year, int month, int day, double lat, double lon, double tz, const char *what ){
+	Sample s;
+	s.index = index;
+	s.year = year;
+	s.month = month;
+	s.day = day;
+	s.lat = lat;
+	s.lon = lon;
+	s.tz = tz;
+	s.what = what;
+	return s;
+}
+
+/* Seconds from b to a. Paths may place the same event a day apart, on */
+/* either side of the branch of rev180() for longitudes near 180       */
+static double secondsApart( double a, double b ){
+	return remainder( a - b, 24.0 ) * 3600.0;
+}
+
+static void times( const ofxSolarDay &day, double *t, int *rc ){
+	t[0] = day.rise;       t[1] = day.set;
+	t[2] = day.civ_start;  t[3] = day.civ_end;
+	t[4] = day.naut_start; t[5] = day.naut_end;
+	t[6] = day.astr_start; t[7] = day.astr_end;
+	rc[0] = day.rs;
+	rc[1] = day.civ;
+	rc[2] = day.naut;
+	rc[3] = day.astr;
+}
+
+static void times( const ofxSolarBatchOutput &out, size_t i, double *t, int *rc ){
+	t[0] = out.rise[i];       t[1] = out.set[i];
+	t[2] = out.civ_start[i];  t[3] = out.civ_end[i];
+	t[4] = out.naut_start[i]; t[5] = out.naut_end[i];
+	t[6] = out.astr_start[i]; t[7] = out.astr_end[i];
+	rc[0] = out.rs[i];
+	rc[1] = out.civ[i];
+	rc[2] = out.naut[i];
+	rc[3] = out.astr[i];
+}
+
+
+/* Reference */
+
+/* Seconds, a margin over the largest errors measured. The reference */
+/* times are rounded to the second                                    */
+
+struct ReferencePath{
+	const char *name;
+	double budgetTemperate, budget;      /* |lat| <= 60, all */
+};
+
+static const ReferencePath referencePaths[] = {
+	{ "DEFAULT",  180.0, 700.0 },
+	{ "FAST",     180.0, 700.0 },
+	{ "ACCURATE",  10.0,  30.0 },
+	{ "Batch",    180.0, 700.0 },
+};
+
+vector<ofxSolarVerifyResult> ofxSolarVerify::reference(){
+	const int paths = sizeof(referencePaths) / sizeof(referencePaths[0]);
+	vector<Check> checks;
+	for ( int p = 0; p < paths; p++ ){
+		string name = string( "reference " ) + referencePaths[p].name;
+		checks.push_back( Check( name, "s", referencePaths[p].budget ) );
+		checks.push_back( Check( name + " |lat|<=60", "s", referencePaths[p].budgetTemperate ) );
+	}
+
+	/* Batch computes all sites of a date at once */
+	vector<double> lat( referenceSiteCount ), lon( referenceSiteCount ), tz( referenceSiteCount, 0.0 );
+	for ( size_t i = 0; i < referenceSiteCount; i++ ){
+		lat[i] = referenceSites[i].lat;
+		lon[i] = referenceSites[i].lon;
+	}
+	ofxSolarArena arena;
+	vector<ofxSolarBatchOutput> batch( referenceDateCount );
+	for ( size_t d = 0; d < referenceDateCount; d++ ){
+		const ofxSolarReferenceDate &date = referenceDates[d];
+		batch[d] = ofxSolarBatch::allocate( arena, referenceSiteCount );
+		ofxSolarBatch::calculate( date.year, date.month, date.day, referenceSiteCount,
+			lat.data(), lon.data(), tz.data(), batch[d] );
+	}
+
+	for ( size_t r = 0; r < referenceRowCount; r++ ){
+		const ofxSolarReferenceRow &row = referenceRows[r];
+		const ofxSolarReferenceSite &site = referenceSites[row.site];
+		const ofxSolarReferenceDate &date = referenceDates[row.date];
+
+		for ( int p = 0; p < paths; p++ ){
+			double t[8];
+			int rc[4];
+			if ( p < 3 ){
+				static const ofxSolarPrecision precision[3] = { OFXSOLAR_PRECISION_DEFAULT,
+					OFXSOLAR_PRECISION_FAST, OFXSOLAR_PRECISION_ACCURATE };
+				times( ofxSolar::dayEvents( date.year, date.month, date.day, site.lat, site.lon, 0.0, precision[p] ), t, rc );
+			}else{
+				times( batch[row.date], row.site, t, rc );
+			}
+
+			for ( int e = 0; e < 4; e++ ){
+				if ( row.code[e] == REFERENCE_SKIPPED )
+					continue;
+				for ( int k = 0; k < 2; k++ ){
+					Sample s = sample( r * 8 + 2 * e + k, date.year, date.month, date.day, site.lat, site.lon, 0.0,
+						eventNames[2 * e + k] );
+					for ( int band = 0; band < 2; band++ ){
+						if ( band == 1 && fabs( site.lat ) > 60.0 )
+							continue;
+						Check &check = checks[2 * p + band];
+						if ( row.code[e] != 0 || rc[e] != 0 )
+							check.match( rc[e] == row.code[e], s );
+						else
+							check.add( secondsApart( t[2 * e + k], row.t[2 * e + k] / 3600.0 ), s );
+					}
+				}
+			}
+		}
+	}
+
+	vector<ofxSolarVerifyResult> results;
+	for ( size_t i = 0; i < checks.size(); i++ )
+		results.push_back( checks[i].result() );
+	return results;
+}
+
+
+/* Differential */
+
+/* Samples per block, drawn from one seed and sharing one date */
+static const uint64_t blockSize = 256;
+
+/* splitmix64, one stream per block */
+
+class Random{
+
+public:
+
+	explicit Random( uint64_t seed ) : state( seed ){}
+
+	uint64_t next(){
+		uint64_t z = ( state += 0x9E3779B97F4A7C15ULL );
+		z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+		z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+		return z ^ ( z >> 31 );
+	}
+
+	/* [a, b) */
+	double uniform( double a, double b ){
+		return a + ( b - a ) * ( next() >> 11 ) * ( 1.0 / 9007199254740992.0 );
+	}
+
+	int integer( int a, int b ){
+		return a + (int)( next() % (uint64_t)( b - a + 1 ) );
+	}
+
+private:
+
+	uint64_t state;
+
+};
+
+/* A date of 1801-2099, or of one year */
+
+static void randomDate( Random &random, int firstYear, int lastYear, int *year, int *month, int *day ){
+	long first = days_since_2000_Jan_0(firstYear,1,1);
+	long last = days_since_2000_Jan_0(lastYear + 1,1,1) - 1;
+	int64_t days = first + random.integer( 0, (int)( last - first ) ) - 1
+		+ ofxSolarTimeZone::daysFromCivil( 2000, 1, 1 );
+	ofxSolarTimeZone::civilFromDays( days, year, month, day );
+}
+
+/* Events close to where the Sun only just reaches their altitude, and  */
+/* all events near the poles, are ill-conditioned: the time moves with  */
+/* 1 / sqrt( 1 - cost^2 ) and 1 / cos(lat) for the same rounding. The   */
+/* time checks have a tight budget for the well conditioned events and  */
+/* a loose one for all, return codes are only compared away from +-1    */
+static const double tangent = 1e-5;
+
+static bool wellConditioned( double lat, double cost ){
+	return fabs( lat ) <= 66.0 && fabs( cost ) <= 0.97;
+}
+
+static const double eventAltitudes[4] = { -35.0/60.0, -6.0, -12.0, -18.0 };
+static const int eventUpperLimb[4] = { 1, 0, 0, 0 };
+
+static double cosHourAngle( const ofxSolarDayState &state, double lat, double altit, int upper_limb ){
+	if ( upper_limb )
+		altit -= 0.2666 / state.sr;
+	return ( sind(altit) - sind(lat) * state.sin_sdec ) / ( cosd(lat) * state.cos_sdec );
+}
+
+enum{
+	CHECK_FAST, CHECK_FAST_ALL, CHECK_FAST_CODES,
+	CHECK_BATCH, CHECK_BATCH_ALL, CHECK_BATCH_CODES,
+	CHECK_SUNPOS_LON, CHECK_SUNPOS_R, CHECK_RA, CHECK_DEC,
+	CHECK_CROSSINGS, CHECK_BATCH_CROSSINGS, CHECK_BATCH_CROSSINGS_ALL, CHECK_ELEVATION,
+	CHECK_GRID_RISE, CHECK_GRID_TWILIGHT, CHECK_GRID_TWILIGHT_ALL,
+	CHECK_CACHE,
+	CHECK_TRACKER,
+	CHECK_RASTER_ELEVATION, CHECK_RASTER_DAYLENGTH,
+	CHECK_CALENDAR
+};
+
+static vector<Check> differentialChecks(){
+	vector<Check> checks;
+	checks.push_back( Check( "FAST vs DEFAULT, conditioned", "s", 0.25 ) );
+	checks.push_back( Check( "FAST vs DEFAULT", "s", 1200.0 ) );
+	checks.push_back( Check( "FAST vs DEFAULT return codes", "", 0.0 ) );
+	checks.push_back( Check( "Batch::calculate vs dayEvents, conditioned", "s", 0.01 ) );
+	checks.push_back( Check( "Batch::calculate vs dayEvents", "s", 30.0 ) );
+	checks.push_back( Check( "Batch::calculate vs dayEvents return codes", "", 0.0 ) );
+	checks.push_back( Check( "Batch::sunpos lon vs sunpos", "deg", 1e-9 ) );
+	checks.push_back( Check( "Batch::sunpos r vs sunpos", "AU", 1e-12 ) );
+	checks.push_back( Check( "Batch::sun_RA_dec RA vs sun_RA_dec", "deg", 1e-9 ) );
+	checks.push_back( Check( "Batch::sun_RA_dec dec vs sun_RA_dec", "deg", 1e-9 ) );
+	checks.push_back( Check( "crossings vs diurnalArc", "h", 0.0 ) );
+	checks.push_back( Check( "Batch::crossings vs crossings, conditioned", "s", 0.01 ) );
+	checks.push_back( Check( "Batch::crossings vs crossings", "s", 10.0 ) );
+	checks.push_back( Check( "elevation at crossings", "deg", 1e-9 ) );
+	checks.push_back( Check( "ofxSolarGrid rise/set, |lat|<=65", "s", 6.0 ) );
+	checks.push_back( Check( "ofxSolarGrid twilight, |lat|<=65 conditioned", "s", 10.0 ) );
+	checks.push_back( Check( "ofxSolarGrid twilight, |lat|<=65", "s", 300.0 ) );
+	checks.push_back( Check( "ofxSolarCache vs dayEvents", "h", 0.0 ) );
+	checks.push_back( Check( "ofxSolarTracker vs sunPosition", "deg", 1e-5 ) );
+	checks.push_back( Check( "ofxSolarRaster::elevation vs sunPosition", "deg", 1e-5 ) );
+	checks.push_back( Check( "ofxSolarRaster::dayLength vs dayEvents", "h", 1e-5 ) );
+	checks.push_back( Check( "calendar vs dayEvents", "h", 0.0 ) );
+	return checks;
+}
+
+/* Shared by all blocks, read only once set up */
+
+struct Fixtures{
+	ofxSolarGrid grid;
+	ofxSolarCache cache;
+};
+
+static void differentialBlock( uint64_t block, uint64_t count, uint64_t seed, Fixtures &fixtures, vector<Check> &checks )
+	/**********************************************************************/
+	/* count samples of one block: sites are drawn for one date, shared    */
+	/* by the Batch calls, plus one date of 2026 for the grid             */
+	/**********************************************************************/
+{
+	Random random( seed ^ ( block * 0xD1B54A32D192ED03ULL ) );
+	uint64_t first = block * blockSize;
+
+	int year, month, day;
+	randomDate( random, 1801, 2099, &year, &month, &day );
+	long daynum = days_since_2000_Jan_0(year,month,day);
+
+	vector<double> lat( count ), lon( count ), tz( count );
+	for ( uint64_t i = 0; i < count; i++ ){
+		lat[i] = random.uniform( -90.0, 90.0 );
+		lon[i] = random.uniform( -180.0, 180.0 );
+		tz[i] = random.integer( -48, 56 ) / 4.0;
+	}
+
+	/* Tiers and Batch */
+	ofxSolarArena arena;
+	ofxSolarBatchOutput out = ofxSolarBatch::allocate( arena, count );
+	ofxSolarBatch::calculate( year, month, day, count, lat.data(), lon.data(), tz.data(), out );
+
+	for ( uint64_t i = 0; i < count; i++ ){
+		double t[8], tf[8], tb[8];
+		int rc[4], rcf[4], rcb[4];
+		times( ofxSolar::dayEvents( year, month, day, lat[i], lon[i], tz[i] ), t, rc );
+		times( ofxSolar::dayEvents( year, month, day, lat[i], lon[i], tz[i], OFXSOLAR_PRECISION_FAST ), tf, rcf );
+		times( out, i, tb, rcb );
+		ofxSolarDayState state = ofxSolar::dayState( daynum, lon[i] );
+		for ( int e = 0; e < 8; e++ ){
+			Sample s = sample( ( first + i ) * 8 + e, year, month, day, lat[i], lon[i], tz[i], eventNames[e] );
+			double cost = cosHourAngle( state, lat[i], eventAltitudes[e / 2], eventUpperLimb[e / 2] );
+			if ( e % 2 == 0 && fabs( fabs( cost ) - 1.0 ) > tangent ){
+				checks[CHECK_FAST_CODES].match( rcf[e / 2] == rc[e / 2], s );
+				checks[CHECK_BATCH_CODES].match( rcb[e / 2] == rc[e / 2], s );
+			}
+			if ( rcf[e / 2] == 0 && rc[e / 2] == 0 ){
+				checks[CHECK_FAST_ALL].add( secondsApart( tf[e], t[e] ), s );
+				if ( wellConditioned( lat[i], cost ) )
+					checks[CHECK_FAST].add( secondsApart( tf[e], t[e] ), s );
+			}
+			if ( rcb[e / 2] == 0 && rc[e / 2] == 0 ){
+				checks[CHECK_BATCH_ALL].add( secondsApart( tb[e], t[e] ), s );
+				if ( wellConditioned( lat[i], cost ) )
+					checks[CHECK_BATCH].add( secondsApart( tb[e], t[e] ), s );
+			}
+		}
+	}
+
+	/* Array ephemeris at random instants of the date */
+	vector<double> d( count ), alon( count ), ar( count ), ara( count ), adec( count ), ar2( count );
+	for ( uint64_t i = 0; i < count; i++ )
+		d[i] = daynum + random.uniform( -0.5, 1.5 );
+	ofxSolarBatch::sunpos( d.data(), count, alon.data(), ar.data() );
+	ofxSolarBatch::sun_RA_dec( d.data(), count, ara.data(), adec.data(), ar2.data() );
+	for ( uint64_t i = 0; i < count; i++ ){
+		double slon, sr, sra, sdec, sr2;
+		ofxSolar::sunpos( d[i], &slon, &sr );
+		ofxSolar::sun_RA_dec( d[i], &sra, &sdec, &sr2 );
+		Sample s = sample( first + i, year, month, day, 0.0, 0.0, 0.0, "d + fraction" );
+		checks[CHECK_SUNPOS_LON].add( ofxSolar::rev180( alon[i] - slon ), s );
+		checks[CHECK_SUNPOS_R].add( ar[i] - sr, s );
+		checks[CHECK_RA].add( ofxSolar::rev180( ara[i] - sra ), s );
+		checks[CHECK_DEC].add( adec[i] - sdec, s );
+	}
+
+	/* Crossings of four random altitudes, upper limb on odd blocks */
+	const size_t altitudeCount = 4;
+	double altitudes[altitudeCount];
+	for ( size_t k = 0; k < altitudeCount; k++ )
+		altitudes[k] = random.uniform( -20.0, 20.0 );
+	int upper_limb = (int)( block & 1 );
+	vector<ofxSolarCrossing> batchCrossings( count * altitudeCount );
+	ofxSolarBatch::crossings( year, month, day, count, lat.data(), lon.data(), tz.data(),
+		altitudes, altitudeCount, batchCrossings.data(), upper_limb );
+	for ( uint64_t i = 0; i < count; i++ ){
+		ofxSolarDayState state = ofxSolar::dayState( year, month, day, lon[i] );
+		ofxSolarCrossing crossing[altitudeCount];
+		ofxSolar::crossings( state, lat[i], tz[i], altitudes, altitudeCount, crossing, upper_limb );
+		for ( size_t k = 0; k < altitudeCount; k++ ){
+			Sample s = sample( ( first + i ) * altitudeCount + k, year, month, day, lat[i], lon[i], tz[i], "crossing" );
+			double arc;
+			int rc = ofxSolar::diurnalArc( state, lat[i], altitudes[k], upper_limb, &arc );
+			checks[CHECK_CROSSINGS].match( rc == crossing[k].rc, s );
+			checks[CHECK_CROSSINGS].add( crossing[k].rise - ( state.tsouth - arc + tz[i] ), s );
+			checks[CHECK_CROSSINGS].add( crossing[k].set - ( state.tsouth + arc + tz[i] ), s );
+
+			const ofxSolarCrossing &bc = batchCrossings[i * altitudeCount + k];
+			double cost = cosHourAngle( state, lat[i], altitudes[k], upper_limb );
+			if ( fabs( fabs( cost ) - 1.0 ) > tangent )
+				checks[CHECK_BATCH_CROSSINGS_ALL].match( bc.rc == crossing[k].rc, s );
+			if ( bc.rc == 0 && crossing[k].rc == 0 ){
+				for ( int c = wellConditioned( lat[i], cost ) ? 0 : 1; c < 2; c++ ){
+					Check &check = checks[c == 0 ? CHECK_BATCH_CROSSINGS : CHECK_BATCH_CROSSINGS_ALL];
+					check.add( secondsApart( bc.rise, crossing[k].rise ), s );
+					check.add( secondsApart( bc.set, crossing[k].set ), s );
+				}
+			}
+
+			/* elevation() gives the centre's altitude */
+			if ( crossing[k].rc == 0 ){
+				double centre = altitudes[k] - ( upper_limb ? 0.2666 / state.sr : 0.0 );
+				checks[CHECK_ELEVATION].add( ofxSolar::elevation( state, lat[i], tz[i], crossing[k].rise ) - centre, s );
+				checks[CHECK_ELEVATION].add( ofxSolar::elevation( state, lat[i], tz[i], crossing[k].set ) - centre, s );
+			}
+		}
+	}
+
+	/* Grid of 2026 */
+	int gy, gm, gd;
+	randomDate( random, 2026, 2026, &gy, &gm, &gd );
+	for ( uint64_t i = 0; i < count; i++ ){
+		double glat = lat[i] * ( 65.0 / 90.0 );
+		double t[8], tg[8];
+		int rc[4], rcg[4];
+		times( ofxSolar::dayEvents( gy, gm, gd, glat, lon[i], tz[i] ), t, rc );
+		times( fixtures.grid.get( gm, gd, glat, lon[i], tz[i] ), tg, rcg );
+		ofxSolarDayState state = ofxSolar::dayState( gy, gm, gd, lon[i] );
+		for ( int e = 0; e < 8; e++ ){
+			if ( rc[e / 2] != 0 || rcg[e / 2] != 0 )
+				continue;
+			Sample s = sample( ( first + i ) * 8 + e, gy, gm, gd, glat, lon[i], tz[i], eventNames[e] );
+			double error = secondsApart( tg[e], t[e] );
+			if ( e < 2 ){
+				checks[CHECK_GRID_RISE].add( error, s );
+				continue;
+			}
+			checks[CHECK_GRID_TWILIGHT_ALL].add( error, s );
+			if ( wellConditioned( glat, cosHourAngle( state, glat, eventAltitudes[e / 2], 0 ) ) )
+				checks[CHECK_GRID_TWILIGHT].add( error, s );
+		}
+	}
+
+	/* Cache at the centers of its cells, every eighth site, against */
+	/* diurnalArc() at the altitudes rounded to 1e-4 degrees as keyed */
+	for ( uint64_t i = 0; i < count; i += 8 ){
+		double clat = floor( lat[i] / 0.01 + 0.5 ) * 0.01, clon = floor( lon[i] / 0.01 + 0.5 ) * 0.01;
+		double tc[8];
+		int rcc[4];
+		times( fixtures.cache.dayEvents( year, month, day, clat, clon, tz[i] ), tc, rcc );
+		ofxSolarDayState state = ofxSolar::dayState( year, month, day, clon );
+		for ( int e = 0; e < 8; e++ ){
+			Sample s = sample( ( first + i ) * 8 + e, year, month, day, clat, clon, tz[i], eventNames[e] );
+			double arc;
+			int rc = ofxSolar::diurnalArc( state, clat, floor( eventAltitudes[e / 2] * 10000.0 + 0.5 ) / 10000.0,
+				eventUpperLimb[e / 2], &arc );
+			if ( e % 2 == 0 )
+				checks[CHECK_CACHE].match( rc == rcc[e / 2], s );
+			checks[CHECK_CACHE].add( tc[e] - ( state.tsouth + ( e % 2 ? arc : -arc ) + tz[i] ), s );
+		}
+	}
+
+	/* Tracker, 100 frames of up to a minute, past the hour after which */
+	/* it re-evaluates the ephemeris, every eighth site                   */
+	for ( uint64_t i = 0; i < count; i += 8 ){
+		ofxSolarTracker tracker;
+		tracker.setup( lat[i], lon[i] );
+		tracker.setTime( d[i] );
+		for ( int frame = 0; frame < 100; frame++ )
+			tracker.advance( random.uniform( 0.0, 1.0 / 60.0 ) );
+		ofxSolarPosition a = tracker.getPosition(), e = ofxSolar::sunPosition( tracker.getTime(), lat[i], lon[i] );
+
+		/* Angle between the two directions from the chord between them, */
+		/* 1 - cos would lose the small angles. Azimuth is meaningless   */
+		/* at the zenith, the chord is not                               */
+		double dx = cosd(a.elevation) * sind(a.azimuth) - cosd(e.elevation) * sind(e.azimuth);
+		double dy = cosd(a.elevation) * cosd(a.azimuth) - cosd(e.elevation) * cosd(e.azimuth);
+		double dz = sind(a.elevation) - sind(e.elevation);
+		double angle = 2.0 * asind( min( 1.0, sqrt( dx*dx + dy*dy + dz*dz ) / 2.0 ) );
+		checks[CHECK_TRACKER].add( angle, sample( first + i, year, month, day, lat[i], lon[i], 0.0, "position" ) );
+	}
+
+	/* Raster of 36 x 18 cells once per block */
+	{
+		ofxSolarRaster raster;
+		raster.setup( 36, 18 );
+		raster.setThreads( 1 );
+		vector<float> values( 36 * 18 );
+		raster.elevation( d[0], values.data() );
+		for ( int y = 0; y < 18; y++ ){
+			for ( int x = 0; x < 36; x++ ){
+				double rlat = raster.getLatitude( y ), rlon = raster.getLongitude( x );
+				Sample s = sample( first + y * 36 + x, year, month, day, rlat, rlon, 0.0, "elevation" );
+				checks[CHECK_RASTER_ELEVATION].add( values[y * 36 + x] - ofxSolar::sunPosition( d[0], rlat, rlon ).elevation, s );
+			}
+		}
+		raster.dayLength( year, month, day, values.data() );
+		for ( int y = 0; y < 18; y++ ){
+			for ( int x = 0; x < 36; x++ ){
+				double rlat = raster.getLatitude( y ), rlon = raster.getLongitude( x );
+				Sample s = sample( first + y * 36 + x, year, month, day, rlat, rlon, 0.0, "day length" );
+				checks[CHECK_RASTER_DAYLENGTH].add( values[y * 36 + x] - ofxSolar::dayEvents( year, month, day, rlat, rlon, 0.0 ).dayleng, s );
+			}
+		}
+	}
+
+	/* A month of calendar() at the first site */
+	{
+		int cy = year, cm = month, cd = day;
+		for ( int k = 0; k < 30; k++ )
+			ofxSolar::nextDay( &cy, &cm, &cd );
+		if ( cy > 2099 )
+			cy = 2099, cm = 12, cd = 31;
+		vector<ofxSolarDay> days = ofxSolar::calendar( year, month, day, cy, cm, cd, lat[0], lon[0], tz[0], 1 );
+		int y = year, m = month, dd = day;
+		for ( size_t k = 0; k < days.size(); k++, ofxSolar::nextDay( &y, &m, &dd ) ){
+			double t[8], tc[8];
+			int rc[4], rcc[4];
+			times( ofxSolar::dayEvents( y, m, dd, lat[0], lon[0], tz[0] ), t, rc );
+			times( days[k], tc, rcc );
+			Sample s = sample( first + k, y, m, dd, lat[0], lon[0], tz[0], "day" );
+			checks[CHECK_CALENDAR].match( days[k].year == y && days[k].month == m && days[k].day == dd &&
+				rc[0] == rcc[0] && rc[1] == rcc[1] && rc[2] == rcc[2] && rc[3] == rcc[3], s );
+			for ( int e = 0; e < 8; e++ )
+				checks[CHECK_CALENDAR].add( tc[e] - t[e], s );
+		}
+	}
+}
+
+static Check dates()
+	/**********************************************************************/
+	/* Every date of 1801-2099: nextDay() steps days_since_2000_Jan_0()   */
+	/* by one, and it agrees with the proleptic Gregorian calendar of     */
+	/* ofxSolarTimeZone                                                   */
+	/**********************************************************************/
+{
+	Check check( "nextDay and days_since_2000_Jan_0, 1801-2099", "days", 0.0 );
+	int64_t offset = ofxSolarTimeZone::daysFromCivil( 2000, 1, 1 ) - days_since_2000_Jan_0(2000,1,1);
+	int year = 1801, month = 1, day = 1;
+	long previous = days_since_2000_Jan_0(year,month,day) - 1;
+	for ( uint64_t i = 0; year < 2100; i++, ofxSolar::nextDay( &year, &month, &day ) ){
+		long daynum = days_since_2000_Jan_0(year,month,day);
+		Sample s = sample( i, year, month, day, 0.0, 0.0, 0.0, "date" );
+		check.add( (double)( daynum - previous - 1 ), s );
+		check.add( (double)( ofxSolarTimeZone::daysFromCivil( year, month, day ) - offset - daynum ), s );
+		previous = daynum;
+	}
+	return check;
+}
+
+vector<ofxSolarVerifyResult> ofxSolarVerify::differential( uint64_t samples, uint64_t seed, int threads ){
+	Fixtures fixtures;
+	fixtures.grid.setup( 2026 );
+	fixtures.cache.setup( 1 << 16, 0.01 );
+
+	uint64_t blocks = ( samples + blockSize - 1 ) / blockSize;
+	int n = threads > 0 ? threads : (int)max( 1u, thread::hardware_concurrency() );
+	n = (int)min( (uint64_t)n, max( blocks, (uint64_t)1 ) );
+
+	/* Each thread folds into checks of its own, merged at the end */
+	vector<vector<Check> > partial( n, differentialChecks() );
+	atomic<uint64_t> next( 0 );
+	auto work = [&]( int worker ){
+		for ( uint64_t block = next++; block < blocks; block = next++ )
+			differentialBlock( block, min( blockSize, samples - block * blockSize ), seed, fixtures, partial[worker] );
+	};
+
+	if ( n == 1 ){
+		work( 0 );
+	}else{
+		vector<thread> workers;
+		for ( int i = 0; i < n; i++ )
+			workers.push_back( thread( work, i ) );
+		for ( size_t i = 0; i < workers.size(); i++ )
+			workers[i].join();
+	}
+
+	vector<Check> checks = differentialChecks();
+	for ( int i = 0; i < n; i++ )
+		for ( size_t k = 0; k < checks.size(); k++ )
+			checks[k].merge( partial[i][k] );
+
+	vector<ofxSolarVerifyResult> results;
+	for ( size_t k = 0; k < checks.size(); k++ )
+		results.push_back( checks[k].result() );
+	results.push_back( dates().result() );
+	return results;
+}
+
+
+/* Units */
+
+#ifdef TARGET_LINUX
+static Check server()
+	/**********************************************************************/
+	/* Queries pipelined on one connection, so they're answered in one    */
+	/* turn: valid dates across the end of February between dates that   */
+	/* don't exist. The invalid ones must come back without values and    */
+	/* the valid ones must match dayEvents() date by date                 */
+	/**********************************************************************/
+{
+	Check check( "ofxSolarServer, valid and invalid dates in one turn", "s", 1.0 );
+	const char *path = "/tmp/ofxsolar-verify.sock";
+	const double lat = 52.52, lon = 13.40, tz = 1.0;
+	const struct{ int year, month, day, days; bool valid; } dates[] = {
+		{ 2026, 2, 27, 4, true },
+		{ 2026, 2, 30, 1, false },
+		{ 2025, 2, 29, 1, false },
+		{ 2024, 2, 28, 3, true },
+		{ 2026, 4, 31, 1, false },
+		{ 1900, 2, 28, 2, true },
+	};
+	const size_t count = sizeof(dates) / sizeof(dates[0]);
+
+	ofxSolarServer server;
+	ofxSolarClient client;
+	if ( !server.setup( path ) || !client.connect( path ) ){
+		check.match( false, sample( 0, 0, 0, 0, lat, lon, tz, "connect" ) );
+		return check;
+	}
+	for ( size_t i = 0; i < count; i++ ){
+		ofxSolarQuery q;
+		memset( &q, 0, sizeof(q) );
+		q.id = (uint32_t)i;
+		q.events = OFXSOLAR_EVENT_ALL;
+		q.days = dates[i].days;
+		q.year = dates[i].year;
+		q.month = dates[i].month;
+		q.day = dates[i].day;
+		q.lat = lat;
+		q.lon = lon;
+		q.tz = tz;
+		client.send( q );
+	}
+
+	for ( size_t i = 0; i < count; i++ ){
+		ofxSolarAnswer a;
+		vector<double> values;
+		int year = dates[i].year, month = dates[i].month, day = dates[i].day;
+		bool received = client.receive( &a, values );
+		check.match( received && a.id == i && a.status == ( dates[i].valid ? OFXSOLAR_ANSWER_OK : OFXSOLAR_ANSWER_INVALID )
+			&& a.days == ( dates[i].valid ? (uint32_t)dates[i].days : 0 ),
+			sample( i, year, month, day, lat, lon, tz, "answer" ) );
+		if ( !received || a.status != OFXSOLAR_ANSWER_OK || a.values != 9 )
+			continue;
+		for ( uint32_t k = 0; k < a.days; k++, ofxSolar::nextDay( &year, &month, &day ) ){
+			ofxSolarDay expected = ofxSolar::dayEvents( year, month, day, lat, lon, tz );
+			double t[8];
+			int rc[4];
+			times( expected, t, rc );
+			Sample s = sample( i, year, month, day, lat, lon, tz, "event" );
+			for ( int e = 0; e < 8; e++ )
+				check.add( secondsApart( values[k*9 + e], t[e] ), s );
+			check.add( ( values[k*9 + 8] - expected.dayleng ) * 3600.0, s );
+		}
+	}
+	client.close();
+	server.stop();
+	return check;
+}
+
+static Check serverBackpressure()
+	/**********************************************************************/
+	/* A client pipelining a thousand year long queries, 26 MB of       */
+	/* answers, before it reads any. The server has to pause it and      */
+	/* hold no more than twice OFXSOLAR_SERVER_OUTPUT_LIMIT and one       */
+	/* answer, then answer every query in order once the client reads     */
+	/**********************************************************************/
+{
+	const size_t answerBytes = sizeof(ofxSolarAnswer) + 366 * 9 * sizeof(double);
+	Check check( "ofxSolarServer, answers held for a client not reading", "MB",
+		( 2.0 * OFXSOLAR_SERVER_OUTPUT_LIMIT + answerBytes ) / 1048576.0 );
+	const char *path = "/tmp/ofxsolar-verify-backpressure.sock";
+	const double lat = 52.52, lon = 13.40, tz = 1.0;
+	const uint32_t count = 1000;
+
+	ofxSolarServer server;
+	ofxSolarClient client;
+	if ( !server.setup( path ) || !client.connect( path ) ){
+		check.match( false, sample( 0, 0, 0, 0, lat, lon, tz, "connect" ) );
+		return check;
+	}
+	/* From a thread of its own: once the server stops reading, the */
+	/* socket fills and send() blocks until the answers are read     */
+	thread sender( [&]{
+		for ( uint32_t i = 0; i < count; i++ ){
+			ofxSolarQuery q;
+			memset( &q, 0, sizeof(q) );
+			q.id = i;
+			q.events = OFXSOLAR_EVENT_ALL;
+			q.days = 366;
+			q.year = 2024;
+			q.month = 1;
+			q.day = 1;
+			q.lat = lat;
+			q.lon = lon;
+			q.tz = tz;
+			if ( !client.send( q ) )
+				break;
+		}
+	} );
+
+	/* Until the server holds the connection back */
+	for ( int k = 0; k < 200 && server.getStats().pauses == 0; k++ )
+		this_thread::sleep_for( chrono::milliseconds( 10 ) );
+	check.match( server.getStats().pauses > 0, sample( 0, 2024, 1, 1, lat, lon, tz, "paused" ) );
+
+	ofxSolarDay last = ofxSolar::dayEvents( 2024, 12, 31, lat, lon, tz );
+	for ( uint32_t i = 0; i < count; i++ ){
+		ofxSolarAnswer a;
+		vector<double> values;
+		bool received = client.receive( &a, values );
+		Sample s = sample( i, 2024, 1, 1, lat, lon, tz, "answer" );
+		check.match( received && a.id == i && a.status == OFXSOLAR_ANSWER_OK && a.days == 366
+			&& values.size() == 366 * 9 && fabs( secondsApart( values[365 * 9 + 1], last.set ) ) < 1.0, s );
+		if ( !received )
+			break;
+	}
+	sender.join();
+	check.add( server.getStats().maxBuffered / 1048576.0, sample( count, 2024, 1, 1, lat, lon, tz, "held" ) );
+	client.close();
+	server.stop();
+	return check;
+}
+#endif
+
+/* Built by the compiler. The poles divide by zero, which constant */
+/* evaluation rejects, their tables are built at runtime below       */
+static constexpr ofxSolarConstYear constBerlin = ofxSolarConst::year( 2026, 52.52, 13.40, 1.0 );
+static constexpr ofxSolarConstYear constLongyearbyen = ofxSolarConst::year( 2026, 78.22, 15.65, 1.0 );
+
+static Check constexprTables()
+	/**********************************************************************/
+	/* ofxSolarConstYear::maxError() of tables of a temperate and a polar */
+	/* site and of both poles, and the return codes of every day against  */
+	/* dayEvents()                                                        */
+	/**********************************************************************/
+{
+	Check check( "ofxSolarConst tables, maxError()", "s", 0.05 );
+	static const ofxSolarConstYear north = ofxSolarConst::year( 2026, 90.0, 0.0, 0.0 );
+	static const ofxSolarConstYear south = ofxSolarConst::year( 2026, -90.0, 0.0, 0.0 );
+	const ofxSolarConstYear *tables[4] = { &constBerlin, &constLongyearbyen, &north, &south };
+
+	for ( int k = 0; k < 4; k++ ){
+		const ofxSolarConstYear &table = *tables[k];
+		check.add( table.maxError() * 3600.0, sample( k, table.year, 1, 1, table.lat, table.lon, table.tz, "maxError" ) );
+		int year = table.year, month = 1, day = 1;
+		for ( int i = 0; i < table.days; i++, ofxSolar::nextDay( &year, &month, &day ) ){
+			ofxSolarDay exact = ofxSolar::dayEvents( year, month, day, table.lat, table.lon, table.tz );
+			const ofxSolarConstDay &t = table.get( month, day );
+			check.match( t.rs == exact.rs && t.civ == exact.civ && t.naut == exact.naut && t.astr == exact.astr,
+				sample( k, year, month, day, table.lat, table.lon, table.tz, "codes" ) );
+		}
+	}
+	return check;
+}
+
+/* The arithmetic of decimalday_to_timestamp() before formatTime(), */
+/* without the clock and strftime(). It printed the hour modulo 12   */
+static void legacyTimestamp( double hours, int *h, int *m, int *s ){
+	*h = (int)round( hours );
+	double minutes = ( hours - *h ) * 60;
+	*m = (int)round( minutes );
+	if ( *m < 0 ){
+		*h -= 1;
+		*m = 60 + *m;
+		minutes = 60 + minutes;
+	}
+	double seconds = ( minutes - *m ) * 60;
+	*s = (int)round( seconds );
+	if ( *s < 0 ){
+		*m -= 1;
+		if ( *m < 0 ){
+			*h -= 1;
+			*m = 60 + *m;
+		}
+		*s = 60 + *s;
+	}
+	if ( *m < 0 )
+		*h -= 1;
+	*h = *h % 12;
+}
+
+static string clockText( long seconds ){
+	char text[16];
+	snprintf( text, sizeof(text), "%02ld:%02ld:%02ld", seconds / 3600, seconds / 60 % 60, seconds % 60 );
+	return text;
+}
+
+static string formatted( double hours ){
+	char text[OFXSOLAR_TIME_LENGTH];
+	char *end = ofxSolar::formatTime( text, text + sizeof(text), hours );
+	return end ? string( text, end ) : string( "NULL" );
+}
+
+static Check formatting()
+	/**********************************************************************/
+	/* formatTime() of every second of the day, exact and 0.4 s either    */
+	/* side, against the text of the second and against the old           */
+	/* decimalday_to_timestamp(), which only differs by its hour modulo   */
+	/* 12. The wrap at 23:59:59.5, times before 0h and past 24h, NaN,     */
+	/* buffers too short, and formatTimes() of the whole day at once      */
+	/**********************************************************************/
+{
+	Check check( "formatTime() and formatTimes()", "", 0.0 );
+	vector<double> day( 86400 );
+	string expected;
+
+	for ( long k = 0; k < 86400; k++ ){
+		day[k] = k / 3600.0;
+		expected += clockText( k ) + '\n';
+		for ( int offset = -1; offset <= 1; offset++ ){
+			double hours = ( k + 0.4 * offset ) / 3600.0;
+			if ( hours < 0.0 )
+				continue;
+			Sample s = sample( k * 3 + offset + 1, 0, 0, 0, hours, 0.0, 0.0, "formatTime, lat = hours" );
+			string text = formatted( hours );
+			check.match( text == clockText( k ), s );
+			int h, m, sec;
+			legacyTimestamp( hours, &h, &m, &sec );
+			check.match( h == k / 3600 % 12 && m == k / 60 % 60 && sec == k % 60, s );
+		}
+	}
+
+	const struct{ double hours; const char *text; } cases[] = {
+		{ 23.0 + 59.0/60.0 + 59.5/3600.0,  "00:00:00" },
+		{ 23.0 + 59.0/60.0 + 59.49/3600.0, "23:59:59" },
+		{ 24.0,                            "00:00:00" },
+		{ 25.5,                            "01:30:00" },
+		{ 48.0 + 1.0/3600.0,               "00:00:01" },
+		{ -0.5,                            "23:30:00" },
+		{ -1.0/3600.0,                     "23:59:59" },
+		{ -0.4/3600.0,                     "00:00:00" },
+		{ -24.0 - 1.0/3600.0,              "23:59:59" },
+		{ 1.0E8,                           "16:00:00" },
+		{ -1.0E8,                          "08:00:00" },
+		{ 1.0E9,                           "--:--:--" },
+		{ NAN,                             "--:--:--" },
+		{ INFINITY,                        "--:--:--" },
+		{ -INFINITY,                       "--:--:--" },
+	};
+	const size_t count = sizeof(cases) / sizeof(cases[0]);
+	for ( size_t i = 0; i < count; i++ )
+		check.match( formatted( cases[i].hours ) == cases[i].text,
+			sample( 86400 * 3 + i, 0, 0, 0, cases[i].hours, 0.0, 0.0, "formatTime, lat = hours" ) );
+
+	/* Too short by one, and the whole day in one call */
+	char text[OFXSOLAR_TIME_LENGTH];
+	check.match( ofxSolar::formatTime( text, text + sizeof(text) - 1, 12.0 ) == NULL,
+		sample( 86400 * 4, 0, 0, 0, 12.0, 0.0, 0.0, "formatTime, short buffer" ) );
+	vector<char> all( expected.size() );
+	check.match( ofxSolar::formatTimes( all.data(), all.data() + all.size() - 1, day.data(), day.size(), '\n' ) == NULL,
+		sample( 86400 * 4 + 1, 0, 0, 0, 0.0, 0.0, 0.0, "formatTimes, short buffer" ) );
+	char *end = ofxSolar::formatTimes( all.data(), all.data() + all.size(), day.data(), day.size(), '\n' );
+	check.match( end == all.data() + all.size() && string( all.data(), all.size() ) == expected,
+		sample( 86400 * 4 + 2, 0, 0, 0, 0.0, 0.0, 0.0, "formatTimes, every second" ) );
+
+	double mixed[3] = { 23.0 + 59.0/60.0 + 59.5/3600.0, NAN, -0.5 };
+	char line[3 * ( OFXSOLAR_TIME_LENGTH + 1 )];
+	end = ofxSolar::formatTimes( line, line + sizeof(line), mixed, 3, ',' );
+	check.match( end == line + sizeof(line) && string( line, sizeof(line) ) == "00:00:00,--:--:--,23:30:00,",
+		sample( 86400 * 4 + 3, 0, 0, 0, 0.0, 0.0, 0.0, "formatTimes, wrap and NaN" ) );
+	return check;
+}
+
+static bool readFile( const string &path, vector<char> &bytes ){
+	FILE *f = fopen( ofToDataPath( path ).c_str(), "rb" );
+	if ( !f )
+		return false;
+	bytes.clear();
+	char buffer[65536];
+	for ( size_t n; ( n = fread( buffer, 1, sizeof(buffer), f ) ) > 0; )
+		bytes.insert( bytes.end(), buffer, buffer + n );
+	fclose( f );
+	return true;
+}
+
+static bool writeFile( const string &path, const char *data, size_t size ){
+	FILE *f = fopen( ofToDataPath( path ).c_str(), "wb" );
+	if ( !f )
+		return false;
+	bool ok = fwrite( data, 1, size, f ) == size;
+	return fclose( f ) == 0 && ok;
+}
+
+static vector<Check> tableFile()
+	/**********************************************************************/
+	/* A year of four sites written, mapped and read back against live    */
+	/* dayEvents(), then damaged copies: open() must refuse a bad magic,  */
+	/* byte order, version, header or size, verify() a changed record,    */
+	/* and the writer a table of no days                                  */
+	/**********************************************************************/
+{
+	vector<Check> checks;
+	checks.push_back( Check( "ofxSolarTableFile round trip", "s", 0.01 ) );
+	checks.push_back( Check( "ofxSolarTableFile damaged files refused", "", 0.0 ) );
+	Check &roundTrip = checks[0], &damaged = checks[1];
+
+	const string path = "ofxsolar-verify.table", copy = "ofxsolar-verify-damaged.table";
+	const double sites[4][3] = { { 52.52, 13.40, 1.0 }, { 78.22, 15.65, 1.0 },
+		{ -0.18, -78.47, -5.0 }, { -77.85, 166.67, 12.0 } };
+	ofxSolarTableWriter writer;
+	bool written = writer.open( path, 2024, 1, 1, 366 );
+	for ( int k = 0; k < 4; k++ )
+		written = written && writer.addSite( sites[k][0], sites[k][1], sites[k][2] );
+	written = writer.close() && written;
+
+	ofxSolarTableFile table;
+	bool opened = written && table.open( path );
+	roundTrip.match( opened && table.verify() && table.getNumSites() == 4 && table.getNumDays() == 366
+		&& !table.get( 0, 2023, 12, 31 ) && !table.get( 0, 2025, 1, 1 ) && !table.get( 4, 2024, 1, 1 ),
+		sample( 0, 2024, 1, 1, 0.0, 0.0, 0.0, "open" ) );
+	for ( size_t k = 0; opened && k < 4; k++ ){
+		const ofxSolarTableSite *site = table.getSite( k );
+		int year = 2024, month = 1, day = 1;
+		for ( int i = 0; i < 366; i++, ofxSolar::nextDay( &year, &month, &day ) ){
+			Sample s = sample( k * 366 + i, year, month, day, sites[k][0], sites[k][1], sites[k][2], "record" );
+			ofxSolarDay exact = ofxSolar::dayEvents( year, month, day, sites[k][0], sites[k][1], sites[k][2] );
+			const ofxSolarTableRecord *r = table.get( k, year, month, day );
+			if ( !r || !site ){
+				roundTrip.match( false, s );
+				continue;
+			}
+			roundTrip.match( site->lat == sites[k][0] && site->lon == sites[k][1] && site->tz == sites[k][2]
+				&& r->rs == exact.rs && r->civ == exact.civ && r->naut == exact.naut && r->astr == exact.astr, s );
+			const double diff[12] = { r->rise - exact.rise, r->set - exact.set,
+				r->civ_start - exact.civ_start, r->civ_end - exact.civ_end,
+				r->naut_start - exact.naut_start, r->naut_end - exact.naut_end,
+				r->astr_start - exact.astr_start, r->astr_end - exact.astr_end,
+				r->dayleng - exact.dayleng, r->civlen - exact.civlen,
+				r->nautlen - exact.nautlen, r->astrlen - exact.astrlen };
+			for ( int e = 0; e < 12; e++ )
+				roundTrip.add( diff[e] * 3600.0, s );
+		}
+	}
+	table.close();
+
+	/* Each copy is refused by open(), or by verify() for a changed record */
+	vector<char> bytes;
+	if ( !readFile( path, bytes ) || bytes.size() < sizeof(ofxSolarTableHeader) + 64 ){
+		damaged.match( false, sample( 0, 2024, 1, 1, 0.0, 0.0, 0.0, "read" ) );
+		return checks;
+	}
+	const char *names[9] = { "empty", "header cut", "last byte cut", "byte added", "magic",
+		"version", "header field", "record", "byte order" };
+	for ( int k = 0; k < 9; k++ ){
+		vector<char> d = bytes;
+		ofxSolarTableHeader header;
+		memcpy( &header, d.data(), sizeof(header) );
+		switch ( k ){
+		case 0: d.clear(); break;
+		case 1: d.resize( sizeof(header) / 2 ); break;
+		case 2: d.pop_back(); break;
+		case 3: d.push_back( 0 ); break;
+		case 4: header.magic[0] = 'O'; break;
+		case 5: header.version = OFXSOLAR_TABLE_VERSION - 1; break;
+		case 6: header.days--; break;
+		case 7: d[sizeof(header) + 3] ^= 1; break;
+		case 8: header.byteOrder = 0x04030201; break;
+		}
+		if ( k >= 4 && k != 7 )
+			memcpy( d.data(), &header, sizeof(header) );
+
+		ofxSolarTableFile file;
+		bool refused = !writeFile( copy, d.data(), d.size() ) ? false :
+			k == 7 ? file.open( copy ) && !file.verify() : !file.open( copy );
+		damaged.match( refused, sample( k, 2024, 1, 1, 0.0, 0.0, 0.0, names[k] ) );
+	}
+
+	/* Tables without days aren't started */
+	damaged.match( !writer.open( copy, 2024, 1, 1, 0 ) && !writer.open( copy, 2024, 1, 1, -1 ),
+		sample( 9, 2024, 1, 1, 0.0, 0.0, 0.0, "no days" ) );
+	remove( ofToDataPath( path ).c_str() );
+	remove( ofToDataPath( copy ).c_str() );
+	return checks;
+}
+
+#ifndef TARGET_WIN32
+/* Offset and daylight saving flag the C library gives for the zone in TZ */
+static int32_t libcOffset( int64_t utc, bool *dst ){
+	time_t t = (time_t)utc;
+	tm local;
+	localtime_r( &t, &local );
+	*dst = local.tm_isdst > 0;
+	return (int32_t)local.tm_gmtoff;
+}
+
+static Check timeZones()
+	/**********************************************************************/
+	/* getOffsetSeconds() and isDaylightSaving() against localtime_r() of */
+	/* the C library with TZ set to the same zone, from 1970 to 2105:     */
+	/* every 12 hours, and a second either side of every switch, found by */
+	/* bisection. Half and quarter hour zones, a half hour DST, Morocco's */
+	/* Ramadan switches and a POSIX rule, past the end of the TZif tables */
+	/* where the footer rule takes over                                   */
+	/**********************************************************************/
+{
+	Check check( "ofxSolarTimeZone vs localtime_r()", "s", 0.0 );
+	static const char * const zones[] = { "Europe/Berlin", "America/New_York", "Asia/Kolkata",
+		"Asia/Kathmandu", "Australia/Adelaide", "Australia/Lord_Howe", "Pacific/Chatham",
+		"America/St_Johns", "Africa/Casablanca", "America/Sao_Paulo", "CET-1CEST,M3.5.0,M10.5.0/3" };
+	const int64_t first = 0, last = ( ofxSolarTimeZone::daysFromCivil( 2105, 12, 31 ) ) * 86400, step = 12 * 3600;
+
+	const char *saved = getenv( "TZ" );
+	string savedTz = saved ? saved : "";
+	int checked = 0;
+	for ( size_t z = 0; z < sizeof(zones) / sizeof(zones[0]); z++ ){
+		shared_ptr<const ofxSolarTimeZone> zone = ofxSolarTimeZone::get( zones[z] );
+		if ( !zone )
+			continue;   /* Not in this system's tz database */
+		checked++;
+		setenv( "TZ", strchr( zones[z], ',' ) ? zones[z] : ( string( ":" ) + zones[z] ).c_str(), 1 );
+		tzset();
+
+		auto compare = [&]( int64_t utc ){
+			int year, month, day;
+			ofxSolarTimeZone::civilFromDays( ( utc >= 0 ? utc : utc - 86399 ) / 86400, &year, &month, &day );
+			bool dst;
+			int32_t expected = libcOffset( utc, &dst );
+			Sample s = sample( z, year, month, day, 0.0, 0.0, expected / 3600.0, zones[z] );
+			check.add( (double)( zone->getOffsetSeconds( utc ) - expected ), s );
+			check.match( zone->isDaylightSaving( utc ) == dst, s );
+		};
+
+		bool dst;
+		int32_t previous = libcOffset( first, &dst );
+		for ( int64_t t = first; t <= last; t += step ){
+			int32_t offset = libcOffset( t, &dst );
+			if ( offset != previous && t > first ){
+				/* The first second of the new offset */
+				int64_t lo = t - step, hi = t;
+				while ( hi - lo > 1 ){
+					int64_t mid = lo + ( hi - lo ) / 2;
+					( libcOffset( mid, &dst ) == previous ? lo : hi ) = mid;
+				}
+				compare( hi - 1 );
+				compare( hi );
+				compare( hi + 1 );
+			}
+			compare( t );
+			previous = offset;
+		}
+	}
+	if ( saved )
+		setenv( "TZ", savedTz.c_str(), 1 );
+	else
+		unsetenv( "TZ" );
+	tzset();
+
+	check.match( checked > 0, sample( 0, 0, 0, 0, 0.0, 0.0, 0.0, "no zoneinfo" ) );
+	return check;
+}
+#endif
+
+static Check scheduler()
+	/**********************************************************************/
+	/* Triggers due in the same process() that remove each other, and a   */
+	/* callback that clears the scheduler and adds a trigger into a freed  */
+	/* slot: only the first callback of the batch may run                  */
+	/**********************************************************************/
+{
+	Check check( "ofxSolarScheduler, triggers removed while dispatching", "", 0.0 );
+	const double lat = 52.52, lon = 13.40;
+	const double until = ofxSolarScheduler::now() + 1.0;
+
+	ofxSolarScheduler scheduler;
+	int fired = 0;
+	size_t a = 0, b = 0;
+	a = scheduler.add( lat, lon, OFXSOLAR_SUNRISE, [&]( const ofxSolarSchedulerEvent & ){ fired++; scheduler.remove( b ); } );
+	b = scheduler.add( lat, lon, OFXSOLAR_SUNRISE, [&]( const ofxSolarSchedulerEvent & ){ fired++; scheduler.remove( a ); } );
+	int calls = scheduler.process( until );
+	check.match( fired == 1 && calls == 1 && scheduler.size() == 1,
+		sample( 0, 0, 0, 0, lat, lon, 0.0, "remove" ) );
+
+	scheduler.clear();
+	fired = 0;
+	for ( int k = 0; k < 3; k++ )
+		scheduler.add( lat, lon, OFXSOLAR_SUNSET, [&]( const ofxSolarSchedulerEvent & ){
+			fired++;
+			scheduler.clear();
+			scheduler.add( lat, lon, OFXSOLAR_SUNSET, []( const ofxSolarSchedulerEvent & ){} );
+		} );
+	calls = scheduler.process( until );
+	check.match( fired == 1 && calls == 1 && scheduler.size() == 1,
+		sample( 1, 0, 0, 0, lat, lon, 0.0, "clear" ) );
+
+	/* A callback on the timer thread stopping it. The longitude where */
+	/* the Sun rises through the horizon a quarter second from now      */
+	double east = 0.0;
+	for ( int k = 0; k < 4; k++ ){
+		double now = ofxSolarScheduler::now();
+		east += ( ofxSolarScheduler::nextEvent( 0.0, east, 0.0, false, true, now ) - now - 0.25 / 86400.0 ) * 360.0;
+		east = ofxSolar::rev180( east );
+	}
+	scheduler.clear();
+	atomic<int> stops( 0 );
+	scheduler.add( 0.0, east, 0.0, false, true, [&]( const ofxSolarSchedulerEvent & ){
+		scheduler.stop();
+		stops++;
+	} );
+	scheduler.start();
+	for ( int k = 0; k < 300 && stops == 0; k++ )
+		this_thread::sleep_for( chrono::milliseconds( 10 ) );
+	check.match( stops == 1 && !scheduler.isRunning(), sample( 2, 0, 0, 0, 0.0, east, 0.0, "stop() in a callback" ) );
+	scheduler.start();
+	check.match( scheduler.isRunning(), sample( 3, 0, 0, 0, 0.0, east, 0.0, "start() after" ) );
+	scheduler.stop();
+	return check;
+}
+
+static Check arenaRequests()
+	/**********************************************************************/
+	/* The request of BM_request_arena, a month's calendar of 64 sites,   */
+	/* the events of one date and batch outputs, on one arena reset after */
+	/* each. Once the first request has grown it, the next ones must run  */
+	/* in the same blocks at the same addresses, allocating nothing       */
+	/**********************************************************************/
+{
+	Check check( "ofxSolarArena, no new blocks after the first request", "", 0.0 );
+	const int sites = 64;
+	vector<double> lat( sites ), lon( sites ), tz( sites );
+	for ( int i = 0; i < sites; i++ ){
+		lat[i] = -60.0 + 120.0 * i / sites;
+		lon[i] = -180.0 + 360.0 * ( ( i * 37 ) % sites ) / sites;
+		tz[i] = floor( lon[i] / 15.0 + 0.5 );
+	}
+
+	ofxSolarArena arena;
+	size_t blocks = 0, capacity = 0;
+	const void *first = NULL;
+	int year = 2026, month = 1, day = 1;
+	for ( int request = 0; request < 24; request++, ofxSolar::nextDay( &year, &month, &day ) ){
+		const void *start = NULL;
+		for ( int i = 0; i < sites; i++ ){
+			int ey = year, em = month, ed = day;
+			for ( int k = 1; k < 31; k++ )
+				ofxSolar::nextDay( &ey, &em, &ed );
+			ofxSolarSpan<ofxSolarDay> days = ofxSolar::calendar( arena, year, month, day, ey, em, ed, lat[i], lon[i], tz[i], 1 );
+			if ( i == 0 )
+				start = days.data();
+		}
+		ofxSolar::dayEvents( arena, year, month, day, lat.data(), lon.data(), tz.data(), sites );
+		ofxSolarBatchOutput out = ofxSolarBatch::allocate( arena, sites );
+		ofxSolarBatch::calculate( year, month, day, sites, lat.data(), lon.data(), tz.data(), out );
+
+		/* The same memory as the first request, before and after reset() */
+		size_t blocksUsed = arena.getBlockCount(), capacityUsed = arena.getCapacity();
+		arena.reset();
+		if ( request == 0 ){
+			blocks = blocksUsed;
+			capacity = capacityUsed;
+			first = start;
+			continue;
+		}
+		check.match( start == first && blocksUsed == blocks && capacityUsed == capacity
+			&& arena.getBlockCount() == blocks && arena.getCapacity() == capacity && arena.getUsed() == 0,
+			sample( request, year, month, day, 0.0, 0.0, 0.0, "request" ) );
+	}
+	return check;
+}
+
+static Check concurrentUpdate()
+	/**********************************************************************/
+	/* Fresh instances hammered by threads calling update() and the       */
+	/* accessors at once, so several compute the first day together.      */
+	/* Every value read must be today's. Built with -fsanitize=thread,    */
+	/* ThreadSanitizer reports the races too                              */
+	/**********************************************************************/
+{
+	const double lat = 52.52, lon = 13.40, tz = 1.0;
+	const int threads = 4, rounds = 50, calls = 200;
+
+	/* Run again if local midnight passes meanwhile */
+	for ( int attempt = 0; ; attempt++ ){
+		ofxSolar reference;
+		reference.init( lat, lon, tz );
+		const ofxSolarDay today = *reference.getSnapshot();
+
+		vector<Check> partial( threads, Check( "ofxSolar update() and accessors on 4 threads", "", 0.0 ) );
+		for ( int round = 0; round < rounds; round++ ){
+			ofxSolar solar;
+			solar.init( lat, lon, tz );
+			atomic<int> waiting( threads );
+			auto hammer = [&]( int worker ){
+				/* All threads start together */
+				waiting--;
+				while ( waiting > 0 )
+					this_thread::yield();
+				for ( int i = 0; i < calls; i++ ){
+					Sample s = sample( ( round * threads + worker ) * calls + i, 0, 0, 0, lat, lon, tz, "read" );
+					switch ( ( i + worker ) % 4 ){
+					case 0:
+						solar.update();
+						partial[worker].match( solar.sunrise() == today.rise, s );
+						break;
+					case 1:
+						partial[worker].match( solar.sunset() == today.set, s );
+						break;
+					case 2:
+						partial[worker].match( solar.getSnapshot()->civ_end == today.civ_end, s );
+						break;
+					case 3:
+						solar.update();
+						partial[worker].match( solar.dayLength() == today.dayleng, s );
+						break;
+					}
+				}
+			};
+			vector<thread> workers;
+			for ( int k = 0; k < threads; k++ )
+				workers.push_back( thread( hammer, k ) );
+			for ( int k = 0; k < threads; k++ )
+				workers[k].join();
+		}
+
+		for ( int k = 1; k < threads; k++ )
+			partial[0].merge( partial[k] );
+		ofxSolar later;
+		later.init( lat, lon, tz );
+		if ( later.sunrise() == today.rise || attempt > 0 )
+			return partial[0];
+	}
+}
+
+vector<ofxSolarVerifyResult> ofxSolarVerify::units(){
+	vector<ofxSolarVerifyResult> results;
+	results.push_back( constexprTables().result() );
+	results.push_back( formatting().result() );
+	results.push_back( concurrentUpdate().result() );
+	results.push_back( arenaRequests().result() );
+	results.push_back( scheduler().result() );
+#ifndef TARGET_WIN32
+	results.push_back( timeZones().result() );
+#endif
+	vector<Check> table = tableFile();
+	for ( size_t k = 0; k < table.size(); k++ )
+		results.push_back( table[k].result() );
+#ifdef TARGET_LINUX
+	results.push_back( server().result() );
+	results.push_back( serverBackpressure().result() );
+#endif
+	return results;
+}
+
+bool ofxSolarVerify::passed( const vector<ofxSolarVerifyResult> &results ){
+	for ( size_t i = 0; i < results.size(); i++ )
+		if ( results[i].failures > 0 )
+			return false;
+	return true;
+}
+
+string ofxSolarVerify::report( const vector<ofxSolarVerifyResult> &results ){
+	string text;
+	for ( size_t i = 0; i < results.size(); i++ ){
+		const ofxSolarVerifyResult &r = results[i];
+		char line[512];
+		if ( r.unit.empty() )
+			snprintf( line, sizeof(line), "%-4s %-48s %10llu samples %8llu differ",
+				r.failures ? "FAIL" : "ok", r.name.c_str(), (unsigned long long)r.samples,
+				(unsigned long long)r.failures );
+		else
+			snprintf( line, sizeof(line), "%-4s %-48s %10llu samples  max %10.3g %-4s budget %8.4g",
+				r.failures ? "FAIL" : "ok", r.name.c_str(), (unsigned long long)r.samples,
+				r.maxError, r.unit.c_str(), r.budget );
+		text += line;
+		if ( r.failures ){
+			snprintf( line, sizeof(line), "  %llu failed, worst at %s", (unsigned long long)r.failures, r.worst.c_str() );
+			text += line;
+		}
+		text += "\n";
+	}
+	return text;
+}
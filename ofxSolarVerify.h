@@ -0,0 +1,117 @@
+/*
+
+ofxSolarVerify - checks the computing paths of the addon against a
+reference and against each other, and the units that cache, store,
+format, schedule or serve their results
+
+reference() compares the rise/set and twilight times of the DEFAULT,
+FAST and ACCURATE tiers of ofxSolar::dayEvents() and of
+ofxSolarBatch::calculate() with ofxSolarReference.inl, times computed by
+ofxSolarReference.py from an ephemeris independent of the addon's
+(Meeus' low precision solar coordinates iterated to each event). Its
+sites are every LOCATION_* of ofxSolar.h and latitudes from pole to pole,
+its dates the solstices and equinoxes of years from 1801 to 2099, the
+range of days_since_2000_Jan_0(). Every path has an error budget for
+|lat| <= 60 and one for all latitudes; the polar day and night codes
+must match.
+
+differential() draws random sites and dates in 1801-2099 and compares
+the fast paths to the scalar code they replace:
+
+	FAST tier               dayEvents() DEFAULT
+	ofxSolarBatch           dayEvents(), crossings(), sunpos(), sun_RA_dec()
+	crossings()             diurnalArc(), the same bits
+	elevation()             the altitudes of crossings() back
+	ofxSolarGrid            dayEvents(), year 2026, |lat| <= 65
+	ofxSolarCache           diurnalArc() at the centers of the cells and
+	                        the altitudes rounded as keyed
+	ofxSolarTracker         sunPosition() after advance()
+	ofxSolarRaster          sunPosition()
+	calendar()              dayEvents() day by day, nextDay()
+	days_since_2000_Jan_0   ofxSolarTimeZone::daysFromCivil(), every date
+
+Near the poles, and where the Sun only just reaches an altitude, event
+times move by seconds for the last bits of the arithmetic. The timed
+paths therefore have a tight budget for the conditioned events, |lat| <=
+66 and |cos H0| <= 0.97, and a loose one for all of them; return codes
+are compared except where cos H0 is within 1e-5 of +-1. Times are
+compared modulo a day, for longitudes near 180 two paths can place the
+same event on either side of the branch of rev180().
+
+Samples are drawn in blocks, each from its own seed derived from the
+seed and the block number, and the blocks are spread over threads, so the
+results are the same for any number of threads. The budgets are a margin
+above the largest errors measured over a dozen seeds, so a result over
+budget means a change of behavior rather than bad luck.
+
+units() runs fixed cases of the parts that don't compute from a random
+site and date:
+
+	ofxSolarConst           maxError() and the codes of a temperate and a
+	                        polar site and of both poles
+	formatTime()            every second of the day against its text and
+	formatTimes()           the old decimalday_to_timestamp(), the wrap
+	                        at 23:59:59.5, negative, past 24 h and NaN
+	ofxSolar::update()      four threads calling update() and the
+	                        accessors of fresh instances at once
+	ofxSolarArena           the request of BM_request_arena from the
+	                        second on in the blocks of the first
+	ofxSolarScheduler       triggers due together that remove each other
+	                        or clear the scheduler from a callback, a
+	                        callback stopping the timer thread
+	ofxSolarTimeZone        offsets and DST flags against localtime_r()
+	                        every 12 hours and around every switch from
+	                        1970 to 2105, in 30- and 45-minute zones,
+	                        Lord Howe, Casablanca and a POSIX rule
+	ofxSolarTableFile       a year of four sites written, mapped and read
+	                        back against dayEvents(), and truncated,
+	                        padded, corrupted, other byte order and old
+	                        version files, a table of no days
+	ofxSolarServer          valid and invalid dates pipelined together,
+	                        and the memory held for a client that
+	                        doesn't read its answers, on Linux where
+	                        the server is built
+
+Not checked here: formatIso() and ofxSolarClimatology, ofxSolarExporter,
+ofxSolarLocations and ofxSolarMetrics, which only aggregate, write out
+or look up the results of the paths above.
+
+example-verify runs all three and exits with 1 if any result is over
+budget. One core of a virtualized x86-64 Xeon, GCC -O2: reference() 0.05
+s, differential() of a million samples 7-8 s, divided by the cores,
+units() 0.1 s.
+
+*/
+
+#pragma once
+
+#include "ofxSolar.h"
+
+struct ofxSolarVerifyResult{
+	string   name;
+	string   unit;          /* Of maxError and budget */
+	uint64_t samples;       /* Values compared */
+	uint64_t failures;      /* Over budget, or return codes that differ */
+	double   maxError;
+	double   budget;
+	string   worst;         /* The sample of maxError, or of the first failure */
+};
+
+class ofxSolarVerify{
+
+public:
+
+	static vector<ofxSolarVerifyResult> reference();
+
+	/* 0 threads = one per core */
+	static vector<ofxSolarVerifyResult> differential( uint64_t samples = 1000000, uint64_t seed = 1,
+		int threads = 0 );
+
+	static vector<ofxSolarVerifyResult> units();
+
+	static bool passed( const vector<ofxSolarVerifyResult> &results );
+
+	/* One line per result */
+	static string report( const vector<ofxSolarVerifyResult> &results );
+
+};